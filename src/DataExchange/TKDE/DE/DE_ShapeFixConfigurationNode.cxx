@@ -265,6 +265,8 @@ bool DE_ShapeFixConfigurationNode::Load(const Handle(DE_ConfigurationContext)& t
       "vertex.tolerance",
       (int)ShapeFixParameters.FixVertexToleranceMode,
       aScope);
+  ShapeFixParameters.RunParallel =
+    theResource->BooleanVal("parallel", ShapeFixParameters.RunParallel, aScope);
 
   return true;
 }
@@ -674,5 +676,12 @@ TCollection_AsciiString DE_ShapeFixConfigurationNode::Save() const
     aScope + "vertex.tolerance :\t " + (int)ShapeFixParameters.FixVertexToleranceMode + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Defines the mode for fixing sub-shapes of compound not sharing topology\n";
+  aResult += "!in parallel threads (faces of one solid or shell are fixed sequentially)\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "parallel :\t " + ShapeFixParameters.RunParallel + "\n";
+  aResult += "!\n";
+
   return aResult;
 }
@@ -82,6 +82,7 @@ struct DE_ShapeFixParameters
   FixMode          FixNonAdjacentIntersectingEdgesMode = FixMode::FixOrNot;
   FixMode          FixVertexPositionMode               = FixMode::NotFix;
   FixMode          FixVertexToleranceMode              = FixMode::FixOrNot;
+  bool             RunParallel                         = false;
 };
 
 #endif // _DE_ShapeFixParameters_HeaderFile
@@ -2,5 +2,6 @@
 set(OCCT_TKDEIGES_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDEIGES_GTests_FILES
+    IGESControl_Reader_Test.cxx
     IGESExportTest.cxx
 )
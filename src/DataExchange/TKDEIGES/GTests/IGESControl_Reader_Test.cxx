@@ -0,0 +1,71 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <IGESControl_Reader.hxx>
+#include <IGESControl_Writer.hxx>
+#include <TopExp_Explorer.hxx>
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+namespace
+{
+// Counts sub-shapes of the given type
+Standard_Integer countShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  Standard_Integer aNb = 0;
+  for (TopExp_Explorer anExp(theShape, theType); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+} // namespace
+
+// Parallel transfer of independent roots must produce the same shapes as sequential one
+TEST(IGESControl_ReaderTest, ParallelTransferMatchesSequential)
+{
+  const char*        aFileName = "IGESControl_Reader_ParallelTransfer.igs";
+  IGESControl_Writer aWriter("MM", 1);
+  aWriter.AddShape(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aWriter.AddShape(BRepPrimAPI_MakeSphere(5.0).Shape());
+  aWriter.AddShape(BRepPrimAPI_MakeCylinder(2.0, 8.0).Shape());
+  aWriter.ComputeModel();
+  ASSERT_TRUE(aWriter.Write(aFileName));
+
+  IGESControl_Reader aSeqReader;
+  ASSERT_EQ(IFSelect_RetDone, aSeqReader.ReadFile(aFileName));
+  EXPECT_FALSE(aSeqReader.IsParallelTransfer());
+
+  IGESControl_Reader aParReader;
+  ASSERT_EQ(IFSelect_RetDone, aParReader.ReadFile(aFileName));
+  aParReader.SetParallelTransfer(Standard_True);
+  EXPECT_TRUE(aParReader.IsParallelTransfer());
+  std::remove(aFileName);
+
+  ASSERT_EQ(3, aSeqReader.NbRootsForTransfer());
+  ASSERT_EQ(aSeqReader.NbRootsForTransfer(), aParReader.NbRootsForTransfer());
+  ASSERT_EQ(aSeqReader.TransferRoots(), aParReader.TransferRoots());
+  ASSERT_EQ(aSeqReader.NbShapes(), aParReader.NbShapes());
+  for (Standard_Integer anIter = 1; anIter <= aSeqReader.NbShapes(); ++anIter)
+  {
+    const TopoDS_Shape aSeqShape = aSeqReader.Shape(anIter);
+    const TopoDS_Shape aParShape = aParReader.Shape(anIter);
+    EXPECT_EQ(aSeqShape.ShapeType(), aParShape.ShapeType());
+    EXPECT_EQ(countShapes(aSeqShape, TopAbs_FACE), countShapes(aParShape, TopAbs_FACE));
+    EXPECT_EQ(countShapes(aSeqShape, TopAbs_EDGE), countShapes(aParShape, TopAbs_EDGE));
+  }
+}
@@ -61,6 +61,7 @@
 #include <TopoDS_Shape.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <XSAlgo.hxx>
+#include <XSAlgo_ShapeProcessor.hxx>
 #include <XSControl_SelectForTransfer.hxx>
 #include <XSControl_WorkSession.hxx>
 
@@ -332,6 +333,25 @@ Handle(Transfer_ActorOfTransientProcess) IGESControl_Controller::ActorRead(
   return myAdaptorRead;
 }
 
+//=================================================================================================
+
+Handle(Transfer_ActorOfTransientProcess) IGESControl_Controller::NewActorRead(
+  const Handle(Interface_InterfaceModel)& theModel) const
+{
+  Handle(IGESData_IGESModel) anIgesModel = Handle(IGESData_IGESModel)::DownCast(theModel);
+  if (anIgesModel.IsNull())
+    return Handle(Transfer_ActorOfTransientProcess)();
+
+  // the actors run concurrently and must not write the global length unit,
+  // so it is set here, before the transfer
+  XSAlgo_ShapeProcessor::PrepareForTransfer();
+  Handle(IGESToBRep_Actor) anActor = new IGESToBRep_Actor;
+  anActor->SetModel(anIgesModel);
+  anActor->SetUnitPrepared(Standard_True);
+  anActor->SetContinuity(Interface_Static::IVal("read.iges.bspline.continuity"));
+  return anActor;
+}
+
 //  ####    TRANSFER (SHAPE WRITING)    ####
 //  modetrans : 0  <5.1 (group of faces),  1 BREP-5.1
 
@@ -52,6 +52,12 @@ public:
   Standard_EXPORT Handle(Transfer_ActorOfTransientProcess) ActorRead(
     const Handle(Interface_InterfaceModel)& model) const Standard_OVERRIDE;
 
+  //! Creates a new Actor from IGESToBRep adapted from an IGESModel,
+  //! used by parallel transfer of roots. The length unit is set here
+  //! and is not changed by the Transfer() of the returned Actor.
+  Standard_EXPORT Handle(Transfer_ActorOfTransientProcess) NewActorRead(
+    const Handle(Interface_InterfaceModel)& theModel) const Standard_OVERRIDE;
+
   //! Takes one Shape and transfers it to the InterfaceModel
   //! (already created by NewModel for instance)
   //! <modetrans> is to be interpreted by each kind of XstepAdaptor
@@ -85,7 +85,8 @@ static void TrimTolerances(const TopoDS_Shape& theShape, const Standard_Real the
 
 IGESToBRep_Actor::IGESToBRep_Actor()
     : thecontinuity(0),
-      theeps(0.0001)
+      theeps(0.0001),
+      theunitprepared(Standard_False)
 {
 }
 
@@ -113,6 +114,13 @@ Standard_Integer IGESToBRep_Actor::GetContinuity() const
 
 //=======================================================================
 
+void IGESToBRep_Actor::SetUnitPrepared(const Standard_Boolean theIsPrepared)
+{
+  theunitprepared = theIsPrepared;
+}
+
+//=======================================================================
+
 Standard_Boolean IGESToBRep_Actor::Recognize(const Handle(Standard_Transient)& start)
 {
   DeclareAndCast(IGESData_IGESModel, mymodel, themodel);
@@ -160,7 +168,8 @@ Handle(Transfer_Binder) IGESToBRep_Actor::Transfer(const Handle(Standard_Transie
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressScope aPS(theProgress, "Transfer stage", 2);
 
-    XSAlgo_ShapeProcessor::PrepareForTransfer();
+    if (!theunitprepared)
+      XSAlgo_ShapeProcessor::PrepareForTransfer();
     IGESToBRep_CurveAndSurface CAS;
     CAS.SetModel(mymodel);
     CAS.SetContinuity(thecontinuity);
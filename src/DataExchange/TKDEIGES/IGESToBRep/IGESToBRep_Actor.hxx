@@ -53,6 +53,12 @@ public:
   //! Return "thecontinuity"
   Standard_EXPORT Standard_Integer GetContinuity() const;
 
+  //! Tells that the length unit is already set by the caller (see
+  //! XSAlgo_ShapeProcessor::PrepareForTransfer()), so that Transfer() does not set it again.
+  //! It is required when several actors transfer the roots of the same Model concurrently.
+  //! By default False: the unit is set by each Transfer().
+  Standard_EXPORT void SetUnitPrepared(const Standard_Boolean theIsPrepared);
+
   Standard_EXPORT virtual Standard_Boolean Recognize(const Handle(Standard_Transient)& start)
     Standard_OVERRIDE;
 
@@ -71,6 +77,7 @@ private:
   Handle(Interface_InterfaceModel) themodel;
   Standard_Integer                 thecontinuity;
   Standard_Real                    theeps;
+  Standard_Boolean                 theunitprepared;
 };
 
 #endif // _IGESToBRep_Actor_HeaderFile
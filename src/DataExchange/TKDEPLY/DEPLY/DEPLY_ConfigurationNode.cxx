@@ -63,6 +63,13 @@ bool DEPLY_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
                                                       aScope)
                               % 2);
 
+  InternalParameters.ReadSinglePrecision =
+    theResource->BooleanVal("read.single.precision",
+                            InternalParameters.ReadSinglePrecision,
+                            aScope);
+  InternalParameters.ReadRootPrefix =
+    theResource->StringVal("read.root.prefix", InternalParameters.ReadRootPrefix, aScope);
+
   InternalParameters.WriteNormals =
     theResource->BooleanVal("write.normals", InternalParameters.WriteNormals, aScope);
   InternalParameters.WriteColors =
@@ -114,6 +121,23 @@ TCollection_AsciiString DEPLY_ConfigurationNode::Save() const
   aResult += aScope + "file.cs :\t " + InternalParameters.FileCS + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Read parameters:\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag for reading vertex data with single or double floating point precision\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.single.precision :\t " + InternalParameters.ReadSinglePrecision + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Root folder for generating root labels names\n";
+  aResult += "!Default value: "
+             "(empty). Available values: <path>\n";
+  aResult += aScope + "read.root.prefix :\t " + InternalParameters.ReadRootPrefix + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -184,7 +208,7 @@ Handle(DE_Provider) DEPLY_ConfigurationNode::BuildProvider()
 
 bool DEPLY_ConfigurationNode::IsImportSupported() const
 {
-  return Standard_False;
+  return Standard_True;
 }
 
 //=================================================================================================
@@ -28,7 +28,7 @@ class DE_ConfigurationContext;
 //! The Vendor name is "OCC"
 //! The Format type is "PLY"
 //! The supported CAD extension is ".ply"
-//! The import process isn't supported.
+//! The import process is supported.
 //! The export process is supported.
 class DEPLY_ConfigurationNode : public DE_ConfigurationNode
 {
@@ -94,6 +94,9 @@ public:
     double FileLengthUnit = 1.; //!< File length units to convert from while reading the file, defined as scale factor for m (meters)
     RWMesh_CoordinateSystem SystemCS = RWMesh_CoordinateSystem_Zup; //!< System origin coordinate system to perform conversion into during read
     RWMesh_CoordinateSystem FileCS = RWMesh_CoordinateSystem_Yup; //!< File origin coordinate system to perform conversion during read
+    // Reading
+    bool ReadSinglePrecision = false; //!< Flag for reading vertex data with single or double floating point precision
+    TCollection_AsciiString ReadRootPrefix; //!< Root folder for generating root labels names
     // Writing
     bool WriteNormals = true; //!< Flag for write normals
     bool WriteColors = true; //!< Flag for write colors
@@ -19,8 +19,10 @@
 #include <DE_Wrapper.hxx>
 #include <Message.hxx>
 #include <RWMesh_FaceIterator.hxx>
+#include <RWPly_CafReader.hxx>
 #include <RWPly_CafWriter.hxx>
 #include <RWPly_PlyWriterContext.hxx>
+#include <RWPly_Reader.hxx>
 #include <TDocStd_Document.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -41,6 +43,54 @@ DEPLY_Provider::DEPLY_Provider(const Handle(DE_ConfigurationNode)& theNode)
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&  thePath,
+                          const Handle(TDocStd_Document)& theDocument,
+                          Handle(XSControl_WorkSession)&  theWS,
+                          const Message_ProgressRange&    theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theDocument, theProgress);
+}
+
+//=================================================================================================
+
+bool DEPLY_Provider::Read(const TCollection_AsciiString&  thePath,
+                          const Handle(TDocStd_Document)& theDocument,
+                          const Message_ProgressRange&    theProgress)
+{
+  TCollection_AsciiString aContext = TCollection_AsciiString("reading the file ") + thePath;
+  if (!DE_ValidationUtils::ValidateDocument(theDocument, aContext))
+  {
+    return false;
+  }
+  if (!DE_ValidationUtils::ValidateConfigurationNode(GetNode(),
+                                                     STANDARD_TYPE(DEPLY_ConfigurationNode),
+                                                     aContext))
+  {
+    return false;
+  }
+  Handle(DEPLY_ConfigurationNode) aNode = Handle(DEPLY_ConfigurationNode)::DownCast(GetNode());
+  RWPly_CafReader                 aReader;
+  aReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
+  aReader.SetSystemLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
+  aReader.SetSystemCoordinateSystem(aNode->InternalParameters.SystemCS);
+  aReader.SetFileLengthUnit(aNode->InternalParameters.FileLengthUnit);
+  aReader.SetFileCoordinateSystem(aNode->InternalParameters.FileCS);
+  aReader.SetDocument(theDocument);
+  aReader.SetRootPrefix(aNode->InternalParameters.ReadRootPrefix);
+  if (!aReader.Perform(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  XCAFDoc_DocumentTool::SetLengthUnit(theDocument,
+                                      aNode->GlobalParameters.LengthUnit,
+                                      UnitsMethods_LengthUnit_Millimeter);
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&  thePath,
                            const Handle(TDocStd_Document)& theDocument,
                            Handle(XSControl_WorkSession)&  theWS,
@@ -117,6 +167,57 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&  thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString& thePath,
+                          TopoDS_Shape&                  theShape,
+                          Handle(XSControl_WorkSession)& theWS,
+                          const Message_ProgressRange&   theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theShape, theProgress);
+}
+
+//=================================================================================================
+
+bool DEPLY_Provider::Read(const TCollection_AsciiString& thePath,
+                          TopoDS_Shape&                  theShape,
+                          const Message_ProgressRange&   theProgress)
+{
+  TCollection_AsciiString aContext = TCollection_AsciiString("reading the file ") + thePath;
+  if (!DE_ValidationUtils::ValidateConfigurationNode(GetNode(),
+                                                     STANDARD_TYPE(DEPLY_ConfigurationNode),
+                                                     aContext))
+  {
+    return false;
+  }
+  Handle(DEPLY_ConfigurationNode)  aNode = Handle(DEPLY_ConfigurationNode)::DownCast(GetNode());
+  RWMesh_CoordinateSystemConverter aConverter;
+  aConverter.SetOutputLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
+  aConverter.SetOutputCoordinateSystem(aNode->InternalParameters.SystemCS);
+  aConverter.SetInputLengthUnit(aNode->InternalParameters.FileLengthUnit);
+  aConverter.SetInputCoordinateSystem(aNode->InternalParameters.FileCS);
+
+  RWPly_Reader aReader;
+  aReader.SetTransformation(aConverter);
+  aReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
+  if (!aReader.Read(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  if (aReader.HasColors())
+  {
+    Message::SendWarning() << "Warning in the DEPLY_Provider: vertex colors of the file "
+                           << thePath << " are skipped, the shape has no color attributes";
+  }
+  TopoDS_Face  aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace(aFace, aReader.GetTriangulation());
+  theShape = aFace;
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString& thePath,
                            const TopoDS_Shape&            theShape,
                            Handle(XSControl_WorkSession)& theWS,
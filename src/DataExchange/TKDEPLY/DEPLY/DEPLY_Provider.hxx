@@ -17,14 +17,16 @@
 #include <DE_Provider.hxx>
 
 //! The class to transfer PLY files.
-//! Writes any PLY files from OCCT.
+//! Reads and writes any PLY files from/to OCCT.
 //! Each operation needs configuration node.
 //!
 //! Providers grouped by Vendor name and Format type.
 //! The Vendor name is "OCC"
 //! The Format type is "PLY"
-//! The import process isn't supported.
+//! The import process is supported.
 //! The export process is supported.
+//! Vertex colors are imported into the document only if all vertices have the same color,
+//! and are not imported into the shape.
 class DEPLY_Provider : public DE_Provider
 {
 public:
@@ -40,6 +42,18 @@ public:
   Standard_EXPORT DEPLY_Provider(const Handle(DE_ConfigurationNode)& theNode);
 
 public:
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theDocument document to save result
+  //! @param[in] theWS current work session
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT virtual bool Read(
+    const TCollection_AsciiString&  thePath,
+    const Handle(TDocStd_Document)& theDocument,
+    Handle(XSControl_WorkSession)&  theWS,
+    const Message_ProgressRange&    theProgress = Message_ProgressRange()) Standard_OVERRIDE;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theDocument document to export
@@ -52,6 +66,16 @@ public:
     Handle(XSControl_WorkSession)&  theWS,
     const Message_ProgressRange&    theProgress = Message_ProgressRange()) Standard_OVERRIDE;
 
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theDocument document to save result
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT virtual bool Read(
+    const TCollection_AsciiString&  thePath,
+    const Handle(TDocStd_Document)& theDocument,
+    const Message_ProgressRange&    theProgress = Message_ProgressRange()) Standard_OVERRIDE;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theDocument document to export
@@ -62,6 +86,18 @@ public:
     const Handle(TDocStd_Document)& theDocument,
     const Message_ProgressRange&    theProgress = Message_ProgressRange()) Standard_OVERRIDE;
 
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theShape shape to save result
+  //! @param[in] theWS current work session
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT virtual bool Read(
+    const TCollection_AsciiString& thePath,
+    TopoDS_Shape&                  theShape,
+    Handle(XSControl_WorkSession)& theWS,
+    const Message_ProgressRange&   theProgress = Message_ProgressRange()) Standard_OVERRIDE;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theShape shape to export
@@ -74,6 +110,16 @@ public:
     Handle(XSControl_WorkSession)& theWS,
     const Message_ProgressRange&   theProgress = Message_ProgressRange()) Standard_OVERRIDE;
 
+  //! Reads a CAD file, according internal configuration
+  //! @param[in] thePath path to the import CAD file
+  //! @param[out] theShape shape to save result
+  //! @param[in] theProgress progress indicator
+  //! @return true if Read operation has ended correctly
+  Standard_EXPORT virtual bool Read(
+    const TCollection_AsciiString& thePath,
+    TopoDS_Shape&                  theShape,
+    const Message_ProgressRange&   theProgress = Message_ProgressRange()) Standard_OVERRIDE;
+
   //! Writes a CAD file, according internal configuration
   //! @param[in] thePath path to the export CAD file
   //! @param[out] theShape shape to export
@@ -2,4 +2,5 @@
 set(OCCT_TKDEPLY_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDEPLY_GTests_FILES
+  RWPly_Reader_Test.cxx
 )
@@ -0,0 +1,245 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_Reader.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+//! Appends binary value to the stream with specified byte order.
+template <typename Type_t>
+void writeValue(std::ostream& theStream, const Type_t theValue, const bool theIsBigEndian)
+{
+  char aBytes[sizeof(Type_t)];
+  memcpy(aBytes, &theValue, sizeof(Type_t));
+  uint16_t aProbe = 1;
+  const bool isHostBig = *reinterpret_cast<const char*>(&aProbe) == 0;
+  if (isHostBig != theIsBigEndian)
+  {
+    for (size_t aByteIter = 0; aByteIter < sizeof(Type_t) / 2; ++aByteIter)
+    {
+      std::swap(aBytes[aByteIter], aBytes[sizeof(Type_t) - 1 - aByteIter]);
+    }
+  }
+  theStream.write(aBytes, sizeof(Type_t));
+}
+
+//! Writes binary PLY with the grid of theNbCells x theNbCells quads;
+//! vertices are defined by float coordinates, faces by uchar count and int indices.
+std::string writeBinaryGrid(const int theNbCells, const bool theIsBigEndian)
+{
+  const int          aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  std::ostringstream aStream;
+  aStream << "ply\n"
+          << "format " << (theIsBigEndian ? "binary_big_endian" : "binary_little_endian")
+          << " 1.0\n"
+          << "comment grid\n"
+          << "element vertex " << aNbNodes << "\n"
+          << "property float x\nproperty float y\nproperty float z\n"
+          << "element face " << theNbCells * theNbCells << "\n"
+          << "property list uchar int vertex_indices\n"
+          << "end_header\n";
+  for (int aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+  {
+    writeValue(aStream, float(aNodeIter % (theNbCells + 1)), theIsBigEndian);
+    writeValue(aStream, float(aNodeIter / (theNbCells + 1)), theIsBigEndian);
+    writeValue(aStream, 0.5f, theIsBigEndian);
+  }
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNode = aRow * (theNbCells + 1) + aCol;
+      writeValue(aStream, uint8_t(4), theIsBigEndian);
+      writeValue(aStream, int32_t(aNode), theIsBigEndian);
+      writeValue(aStream, int32_t(aNode + 1), theIsBigEndian);
+      writeValue(aStream, int32_t(aNode + theNbCells + 2), theIsBigEndian);
+      writeValue(aStream, int32_t(aNode + theNbCells + 1), theIsBigEndian);
+    }
+  }
+  return aStream.str();
+}
+
+//! Reads PLY data from the string.
+bool readPly(RWPly_Reader& theReader, const std::string& theData)
+{
+  std::istringstream aStream(theData);
+  return theReader.Read(aStream);
+}
+} // namespace
+
+TEST(RWPly_ReaderTest, AsciiWithAttributes)
+{
+  const std::string aData = "ply\n"
+                            "format ascii 1.0\n"
+                            "comment created by test\n"
+                            "element vertex 4\n"
+                            "property double x\n"
+                            "property double y\n"
+                            "property double z\n"
+                            "property float nx\n"
+                            "property float ny\n"
+                            "property float nz\n"
+                            "property float s\n"
+                            "property float t\n"
+                            "property uchar red\n"
+                            "property uchar green\n"
+                            "property uchar blue\n"
+                            "element face 2\n"
+                            "property list uchar uint vertex_indices\n"
+                            "property uint SurfaceID\n"
+                            "element edge 1\n"
+                            "property int vertex1\n"
+                            "property int vertex2\n"
+                            "end_header\n"
+                            "0 0 0 0 0 1 0 0 255 0 0\n"
+                            "1 0 0 0 0 1 1 0 0 255 0\n"
+                            "1 1 0 0 0 1 1 1 0 0 255\n"
+                            "0 1 0.25 0 0 1 0 1 10 20 30\n"
+                            "4 0 1 2 3 1\n"
+                            "3 0 2 7 1\n"
+                            "0 1\n";
+
+  RWPly_Reader aReader;
+  ASSERT_TRUE(readPly(aReader, aData));
+  EXPECT_EQ(RWPly_Reader::Format_Ascii, aReader.DataFormat());
+  EXPECT_TRUE(aReader.FileComments().IsEqual("created by test"));
+  ASSERT_EQ(3, aReader.Elements().Size());
+
+  const Handle(Poly_Triangulation)& aTris = aReader.GetTriangulation();
+  ASSERT_FALSE(aTris.IsNull());
+  EXPECT_TRUE(aTris->IsDoublePrecision());
+  ASSERT_EQ(4, aTris->NbNodes());
+  EXPECT_EQ(0.25, aTris->Node(4).Z());
+
+  // the quad is split into two triangles, the face with invalid index is skipped
+  ASSERT_EQ(2, aTris->NbTriangles());
+  Standard_Integer aNodes[3];
+  aTris->Triangle(2).Get(aNodes[0], aNodes[1], aNodes[2]);
+  EXPECT_EQ(1, aNodes[0]);
+  EXPECT_EQ(3, aNodes[1]);
+  EXPECT_EQ(4, aNodes[2]);
+
+  ASSERT_TRUE(aTris->HasNormals());
+  EXPECT_EQ(1.0f, aTris->Normal(2).Z());
+  ASSERT_TRUE(aTris->HasUVNodes());
+  EXPECT_EQ(1.0, aTris->UVNode(3).X());
+  EXPECT_EQ(1.0, aTris->UVNode(3).Y());
+
+  ASSERT_TRUE(aReader.HasColors());
+  EXPECT_EQ(10, aReader.Colors().Value(4).r());
+  EXPECT_EQ(20, aReader.Colors().Value(4).g());
+  EXPECT_EQ(30, aReader.Colors().Value(4).b());
+  EXPECT_EQ(255, aReader.Colors().Value(4).a());
+}
+
+TEST(RWPly_ReaderTest, BinaryByteOrders)
+{
+  const int aNbCells = 40;
+
+  // little endian data with standard layout is read directly into the node array
+  RWPly_Reader aReaderLE;
+  ASSERT_TRUE(readPly(aReaderLE, writeBinaryGrid(aNbCells, false)));
+  EXPECT_EQ(RWPly_Reader::Format_BinaryLittleEndian, aReaderLE.DataFormat());
+
+  RWPly_Reader aReaderBE;
+  ASSERT_TRUE(readPly(aReaderBE, writeBinaryGrid(aNbCells, true)));
+  EXPECT_EQ(RWPly_Reader::Format_BinaryBigEndian, aReaderBE.DataFormat());
+
+  const Handle(Poly_Triangulation)& aTrisLE = aReaderLE.GetTriangulation();
+  const Handle(Poly_Triangulation)& aTrisBE = aReaderBE.GetTriangulation();
+  ASSERT_EQ((aNbCells + 1) * (aNbCells + 1), aTrisLE->NbNodes());
+  ASSERT_EQ(2 * aNbCells * aNbCells, aTrisLE->NbTriangles());
+  ASSERT_EQ(aTrisLE->NbNodes(), aTrisBE->NbNodes());
+  ASSERT_EQ(aTrisLE->NbTriangles(), aTrisBE->NbTriangles());
+  EXPECT_FALSE(aTrisLE->IsDoublePrecision());
+  EXPECT_FALSE(aReaderLE.HasColors());
+  EXPECT_TRUE(aReaderLE.FileComments().IsEqual("grid"));
+
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aTrisLE->NbNodes(); ++aNodeIter)
+  {
+    const gp_Pnt aNodeLE = aTrisLE->Node(aNodeIter);
+    const gp_Pnt aNodeBE = aTrisBE->Node(aNodeIter);
+    EXPECT_EQ(double((aNodeIter - 1) % (aNbCells + 1)), aNodeLE.X());
+    EXPECT_EQ(double((aNodeIter - 1) / (aNbCells + 1)), aNodeLE.Y());
+    EXPECT_EQ(0.5, aNodeLE.Z());
+    EXPECT_EQ(aNodeLE.X(), aNodeBE.X());
+    EXPECT_EQ(aNodeLE.Y(), aNodeBE.Y());
+    EXPECT_EQ(aNodeLE.Z(), aNodeBE.Z());
+  }
+  for (Standard_Integer aTriIter = 1; aTriIter <= aTrisLE->NbTriangles(); ++aTriIter)
+  {
+    Standard_Integer aNodesLE[3], aNodesBE[3];
+    aTrisLE->Triangle(aTriIter).Get(aNodesLE[0], aNodesLE[1], aNodesLE[2]);
+    aTrisBE->Triangle(aTriIter).Get(aNodesBE[0], aNodesBE[1], aNodesBE[2]);
+    EXPECT_EQ(aNodesLE[0], aNodesBE[0]);
+    EXPECT_EQ(aNodesLE[1], aNodesBE[1]);
+    EXPECT_EQ(aNodesLE[2], aNodesBE[2]);
+  }
+}
+
+TEST(RWPly_ReaderTest, InvalidData)
+{
+  RWPly_Reader aReader;
+  EXPECT_FALSE(readPly(aReader, "solid\nendsolid\n"));
+  EXPECT_FALSE(readPly(aReader, "ply\nformat ascii 1.0\nelement vertex 1\nend_header\n0 0 0\n"));
+  EXPECT_FALSE(
+    readPly(aReader, "ply\nformat binary_little_endian 1.0\nelement vertex 2\nproperty float x\n"
+                     "property float y\nproperty float z\nend_header\n"));
+
+  // the truncated data is reported as an error
+  const std::string aData = writeBinaryGrid(10, true);
+  EXPECT_FALSE(readPly(aReader, aData.substr(0, aData.size() - 5)));
+  EXPECT_TRUE(aReader.GetTriangulation().IsNull());
+
+  // header without data is read in probe mode
+  std::istringstream aStream(aData);
+  ASSERT_TRUE(aReader.ReadHeader(aStream));
+  ASSERT_EQ(2, aReader.Elements().Size());
+  EXPECT_EQ(121, aReader.Elements().Value(0).Count);
+  EXPECT_TRUE(aReader.Elements().Value(1).Properties.Value(0).IsList());
+}
+
+TEST(RWPly_ReaderTest, FaceLargerThanBuffer)
+{
+  // polygon with the list of indices exceeding the read buffer of 4 MiB
+  const int          aNbNodes = 1200000;
+  std::ostringstream aStream;
+  aStream << "ply\nformat binary_little_endian 1.0\n"
+          << "element vertex " << aNbNodes << "\n"
+          << "property float x\nproperty float y\nproperty float z\n"
+          << "element face 1\n"
+          << "property list int int vertex_indices\n"
+          << "end_header\n";
+  for (int aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+  {
+    const double anAngle = 2.0 * M_PI * aNodeIter / aNbNodes;
+    writeValue(aStream, float(Cos(anAngle)), false);
+    writeValue(aStream, float(Sin(anAngle)), false);
+    writeValue(aStream, 0.0f, false);
+  }
+  writeValue(aStream, int32_t(aNbNodes), false);
+  for (int aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+  {
+    writeValue(aStream, int32_t(aNodeIter), false);
+  }
+
+  RWPly_Reader aReader;
+  ASSERT_TRUE(readPly(aReader, aStream.str()));
+  EXPECT_EQ(aNbNodes, aReader.GetTriangulation()->NbNodes());
+  EXPECT_EQ(aNbNodes - 2, aReader.GetTriangulation()->NbTriangles());
+}
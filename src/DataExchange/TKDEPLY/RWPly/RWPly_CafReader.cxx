@@ -0,0 +1,108 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_CafReader.hxx>
+
+#include <BRep_Builder.hxx>
+#include <Message.hxx>
+#include <OSD_Path.hxx>
+#include <TopoDS_Face.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+
+//=================================================================================================
+
+RWPly_CafReader::RWPly_CafReader()
+    : myIsSinglePrecision(Standard_False)
+{
+  // PLY format does not define coordinate system,
+  // use the same convention as RWPly_CafWriter
+  myCoordSysConverter.SetInputCoordinateSystem(RWMesh_CoordinateSystem_glTF);
+}
+
+//=================================================================================================
+
+Handle(RWPly_Reader) RWPly_CafReader::createReaderContext()
+{
+  Handle(RWPly_Reader) aReader = new RWPly_Reader();
+  return aReader;
+}
+
+//=================================================================================================
+
+Standard_Boolean RWPly_CafReader::performMesh(std::istream&                  theStream,
+                                              const TCollection_AsciiString& theFile,
+                                              const Message_ProgressRange&   theProgress,
+                                              const Standard_Boolean         theToProbe)
+{
+  Handle(RWPly_Reader) aCtx = createReaderContext();
+  aCtx->SetSinglePrecision(myIsSinglePrecision);
+  aCtx->SetTransformation(myCoordSysConverter);
+  Standard_Boolean isDone = Standard_False;
+  if (theToProbe)
+  {
+    isDone = aCtx->ReadHeader(theStream);
+  }
+  else
+  {
+    isDone = aCtx->Read(theStream, theProgress);
+  }
+  if (!aCtx->FileComments().IsEmpty())
+  {
+    myMetadata.Add("Comments", aCtx->FileComments());
+  }
+  if (!isDone || aCtx->GetTriangulation().IsNull())
+  {
+    return isDone;
+  }
+
+  TopoDS_Face  aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace(aFace, aCtx->GetTriangulation());
+
+  TCollection_AsciiString aFolder, aFileName, aName, anExt;
+  OSD_Path::FolderAndFileFromPath(theFile, aFolder, aFileName);
+  OSD_Path::FileNameAndExtension(aFileName, aName, anExt);
+
+  RWMesh_NodeAttributes aShapeAttribs;
+  aShapeAttribs.Name = aName;
+  if (aCtx->HasColors())
+  {
+    // XDE defines colors per shape, so only the color common to all vertices is kept
+    const NCollection_Array1<Graphic3d_Vec4ub>& aColors = aCtx->Colors();
+    const Graphic3d_Vec4ub&                     aColor  = aColors.First();
+    Standard_Boolean                            isSame  = Standard_True;
+    for (Standard_Integer aNodeIter = aColors.Lower() + 1; aNodeIter <= aColors.Upper() && isSame;
+         ++aNodeIter)
+    {
+      isSame = aColors.Value(aNodeIter) == aColor;
+    }
+    if (isSame)
+    {
+      aShapeAttribs.Style.SetColorSurf(
+        Quantity_ColorRGBA(Quantity_Color(aColor.r() / 255.0,
+                                          aColor.g() / 255.0,
+                                          aColor.b() / 255.0,
+                                          Quantity_TOC_sRGB),
+                           aColor.a() / 255.0f));
+    }
+    else
+    {
+      Message::SendWarning() << "Warning: PLY reader, per-vertex colors of '" << theFile
+                             << "' are not supported by the document and are skipped";
+    }
+  }
+  myAttribMap.Bind(aFace, aShapeAttribs);
+  myRootShapes.Append(aFace);
+  return Standard_True;
+}
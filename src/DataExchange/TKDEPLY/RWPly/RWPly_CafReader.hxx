@@ -0,0 +1,61 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_CafReader_HeaderFile
+#define _RWPly_CafReader_HeaderFile
+
+#include <RWMesh_CafReader.hxx>
+#include <RWPly_Reader.hxx>
+
+//! The PLY mesh reader into XDE document.
+//! The mesh is put into a single face named after the file.
+//! Vertex colors are kept only if all vertices have the same color, which is assigned
+//! to the face; otherwise, they are skipped with a warning, as the document defines
+//! colors per shape.
+class RWPly_CafReader : public RWMesh_CafReader
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+public:
+  //! Empty constructor.
+  Standard_EXPORT RWPly_CafReader();
+
+  //! Return single precision flag for reading vertex data (coordinates); FALSE by default.
+  Standard_Boolean IsSinglePrecision() const { return myIsSinglePrecision; }
+
+  //! Setup single/double precision flag for reading vertex data (coordinates).
+  void SetSinglePrecision(Standard_Boolean theIsSinglePrecision)
+  {
+    myIsSinglePrecision = theIsSinglePrecision;
+  }
+
+protected:
+  //! Read the mesh from specified file.
+  Standard_EXPORT virtual Standard_Boolean performMesh(std::istream&                  theStream,
+                                                       const TCollection_AsciiString& theFile,
+                                                       const Message_ProgressRange&   theProgress,
+                                                       const Standard_Boolean         theToProbe)
+    Standard_OVERRIDE;
+
+protected:
+  //! Create reader context.
+  //! Can be overridden by sub-class to read triangulation into application-specific data
+  //! structures.
+  Standard_EXPORT virtual Handle(RWPly_Reader) createReaderContext();
+
+protected:
+  // clang-format off
+  Standard_Boolean myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  // clang-format on
+};
+
+#endif // _RWPly_CafReader_HeaderFile
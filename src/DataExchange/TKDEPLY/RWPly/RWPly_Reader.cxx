@@ -0,0 +1,874 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_Reader.hxx>
+
+#include <FSD_BinaryFile.hxx>
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Standard_ReadLineBuffer.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_Reader, Standard_Transient)
+
+namespace
+{
+//! Size of the buffer for reading data.
+static const size_t THE_BUFFER_SIZE = 4 * 1024 * 1024;
+
+//! Number of element records read between progress indicator updates.
+static const Standard_Integer THE_PROGRESS_STEP = 1 << 16;
+
+//! Return property type from its name (including aliases), or undefined type.
+static RWPly_Reader::PropertyType propertyTypeFromString(const std::string& theName)
+{
+  if (theName == "char" || theName == "int8")
+  {
+    return RWPly_Reader::PropertyType_Int8;
+  }
+  else if (theName == "uchar" || theName == "uint8")
+  {
+    return RWPly_Reader::PropertyType_UInt8;
+  }
+  else if (theName == "short" || theName == "int16")
+  {
+    return RWPly_Reader::PropertyType_Int16;
+  }
+  else if (theName == "ushort" || theName == "uint16")
+  {
+    return RWPly_Reader::PropertyType_UInt16;
+  }
+  else if (theName == "int" || theName == "int32")
+  {
+    return RWPly_Reader::PropertyType_Int32;
+  }
+  else if (theName == "uint" || theName == "uint32")
+  {
+    return RWPly_Reader::PropertyType_UInt32;
+  }
+  else if (theName == "float" || theName == "float32")
+  {
+    return RWPly_Reader::PropertyType_Float32;
+  }
+  else if (theName == "double" || theName == "float64")
+  {
+    return RWPly_Reader::PropertyType_Float64;
+  }
+  return RWPly_Reader::PropertyType_Undefined;
+}
+
+//! Return size of the binary value of specified type.
+static size_t propertyTypeSize(const RWPly_Reader::PropertyType theType)
+{
+  switch (theType)
+  {
+    case RWPly_Reader::PropertyType_Int8:
+    case RWPly_Reader::PropertyType_UInt8:
+      return 1;
+    case RWPly_Reader::PropertyType_Int16:
+    case RWPly_Reader::PropertyType_UInt16:
+      return 2;
+    case RWPly_Reader::PropertyType_Int32:
+    case RWPly_Reader::PropertyType_UInt32:
+    case RWPly_Reader::PropertyType_Float32:
+      return 4;
+    case RWPly_Reader::PropertyType_Float64:
+      return 8;
+    case RWPly_Reader::PropertyType_Undefined:
+      break;
+  }
+  return 0;
+}
+
+//! Decode binary value of specified type.
+template <typename Type_t>
+static Type_t decodeRaw(const char* theData, const bool theToSwap)
+{
+  Type_t aValue;
+  if (theToSwap)
+  {
+    char* aBytes = reinterpret_cast<char*>(&aValue);
+    for (size_t aByteIter = 0; aByteIter < sizeof(Type_t); ++aByteIter)
+    {
+      aBytes[aByteIter] = theData[sizeof(Type_t) - 1 - aByteIter];
+    }
+  }
+  else
+  {
+    memcpy(&aValue, theData, sizeof(Type_t));
+  }
+  return aValue;
+}
+
+//! Decode binary value of specified type.
+static double decodeValue(const char*                      theData,
+                          const RWPly_Reader::PropertyType theType,
+                          const bool                       theToSwap)
+{
+  switch (theType)
+  {
+    case RWPly_Reader::PropertyType_Int8:
+      return double(decodeRaw<int8_t>(theData, false));
+    case RWPly_Reader::PropertyType_UInt8:
+      return double(decodeRaw<uint8_t>(theData, false));
+    case RWPly_Reader::PropertyType_Int16:
+      return double(decodeRaw<int16_t>(theData, theToSwap));
+    case RWPly_Reader::PropertyType_UInt16:
+      return double(decodeRaw<uint16_t>(theData, theToSwap));
+    case RWPly_Reader::PropertyType_Int32:
+      return double(decodeRaw<int32_t>(theData, theToSwap));
+    case RWPly_Reader::PropertyType_UInt32:
+      return double(decodeRaw<uint32_t>(theData, theToSwap));
+    case RWPly_Reader::PropertyType_Float32:
+      return double(decodeRaw<float>(theData, theToSwap));
+    case RWPly_Reader::PropertyType_Float64:
+      return decodeRaw<double>(theData, theToSwap);
+    case RWPly_Reader::PropertyType_Undefined:
+      break;
+  }
+  return 0.0;
+}
+
+//! Convert color component into 8-bit value; floating point components are defined in [0, 1].
+static Standard_Byte colorComponent(const double theValue, const RWPly_Reader::PropertyType theType)
+{
+  const bool isFloat =
+    theType == RWPly_Reader::PropertyType_Float32 || theType == RWPly_Reader::PropertyType_Float64;
+  const double aValue = isFloat ? theValue * 255.0 + 0.5 : theValue;
+  return Standard_Byte(Max(0.0, Min(aValue, 255.0)));
+}
+
+//! Return index of the first property of the element having one of the given names, or -1.
+static Standard_Integer findProperty(const RWPly_Reader::Element& theElement,
+                                     const char*                  theName1,
+                                     const char*                  theName2 = NULL,
+                                     const char*                  theName3 = NULL)
+{
+  for (Standard_Integer aPropIter = 0; aPropIter < theElement.Properties.Size(); ++aPropIter)
+  {
+    const RWPly_Reader::Property& aProp = theElement.Properties.Value(aPropIter);
+    if (!aProp.IsList()
+        && (aProp.Name.IsEqual(theName1) || (theName2 != NULL && aProp.Name.IsEqual(theName2))
+            || (theName3 != NULL && aProp.Name.IsEqual(theName3))))
+    {
+      return aPropIter;
+    }
+  }
+  return -1;
+}
+
+//! Mapping of the properties of vertex element onto vertex attributes.
+struct VertexLayout
+{
+  Standard_Integer Position[3]; //!< indices of x, y, z properties
+  Standard_Integer Normal[3];   //!< indices of nx, ny, nz properties
+  Standard_Integer UV[2];       //!< indices of texture coordinates properties
+  Standard_Integer Color[4];    //!< indices of red, green, blue, alpha properties
+
+  VertexLayout(const RWPly_Reader::Element& theElement)
+  {
+    Position[0] = findProperty(theElement, "x");
+    Position[1] = findProperty(theElement, "y");
+    Position[2] = findProperty(theElement, "z");
+    Normal[0]   = findProperty(theElement, "nx");
+    Normal[1]   = findProperty(theElement, "ny");
+    Normal[2]   = findProperty(theElement, "nz");
+    UV[0]       = findProperty(theElement, "s", "u", "texture_u");
+    UV[1]       = findProperty(theElement, "t", "v", "texture_v");
+    Color[0]    = findProperty(theElement, "red", "diffuse_red");
+    Color[1]    = findProperty(theElement, "green", "diffuse_green");
+    Color[2]    = findProperty(theElement, "blue", "diffuse_blue");
+    Color[3]    = findProperty(theElement, "alpha");
+  }
+
+  bool HasPosition() const { return Position[0] >= 0 && Position[1] >= 0 && Position[2] >= 0; }
+
+  bool HasNormals() const { return Normal[0] >= 0 && Normal[1] >= 0 && Normal[2] >= 0; }
+
+  bool HasUV() const { return UV[0] >= 0 && UV[1] >= 0; }
+
+  bool HasColors() const { return Color[0] >= 0 && Color[1] >= 0 && Color[2] >= 0; }
+
+  //! Return TRUE if element consists of three float coordinates x, y, z only,
+  //! so that it matches the memory layout of single precision nodes.
+  bool IsPackedPosition(const RWPly_Reader::Element& theElement) const
+  {
+    return theElement.Properties.Size() == 3 && Position[0] == 0 && Position[1] == 1
+           && Position[2] == 2
+           && theElement.Properties.Value(0).Type == RWPly_Reader::PropertyType_Float32
+           && theElement.Properties.Value(1).Type == RWPly_Reader::PropertyType_Float32
+           && theElement.Properties.Value(2).Type == RWPly_Reader::PropertyType_Float32;
+  }
+};
+
+//! Return index of the list property of face element defining vertex indices, or -1.
+static Standard_Integer findFaceIndices(const RWPly_Reader::Element& theElement)
+{
+  for (Standard_Integer aPropIter = 0; aPropIter < theElement.Properties.Size(); ++aPropIter)
+  {
+    const RWPly_Reader::Property& aProp = theElement.Properties.Value(aPropIter);
+    if (aProp.IsList()
+        && (aProp.Name.IsEqual("vertex_indices") || aProp.Name.IsEqual("vertex_index")))
+    {
+      return aPropIter;
+    }
+  }
+  return -1;
+}
+
+//! Fill in vertex attributes from the values of element properties.
+static void setVertex(Poly_Triangulation&                   theTriangulation,
+                      NCollection_Array1<Graphic3d_Vec4ub>& theColors,
+                      const RWPly_Reader::Element&          theElement,
+                      const VertexLayout&                   theLayout,
+                      const double*                         theValues,
+                      const Standard_Integer                theIndex)
+{
+  theTriangulation.SetNode(theIndex,
+                           gp_Pnt(theValues[theLayout.Position[0]],
+                                  theValues[theLayout.Position[1]],
+                                  theValues[theLayout.Position[2]]));
+  if (theTriangulation.HasNormals())
+  {
+    theTriangulation.SetNormal(theIndex,
+                               gp_Vec3f(float(theValues[theLayout.Normal[0]]),
+                                        float(theValues[theLayout.Normal[1]]),
+                                        float(theValues[theLayout.Normal[2]])));
+  }
+  if (theTriangulation.HasUVNodes())
+  {
+    theTriangulation.SetUVNode(theIndex,
+                               gp_Pnt2d(theValues[theLayout.UV[0]], theValues[theLayout.UV[1]]));
+  }
+  if (!theColors.IsEmpty())
+  {
+    Graphic3d_Vec4ub& aColor = theColors.ChangeValue(theIndex);
+    for (Standard_Integer aCompIter = 0; aCompIter < 4; ++aCompIter)
+    {
+      const Standard_Integer aProp = theLayout.Color[aCompIter];
+      aColor[aCompIter] =
+        aProp >= 0 ? colorComponent(theValues[aProp], theElement.Properties.Value(aProp).Type)
+                   : Standard_Byte(255);
+    }
+  }
+}
+
+//! Buffered reader of binary data.
+class BinaryBuffer
+{
+public:
+  BinaryBuffer(std::istream& theStream)
+      : myStream(theStream),
+        myBuffer(THE_BUFFER_SIZE),
+        myPos(0),
+        myEnd(0)
+  {
+  }
+
+  //! Return pointer to the next theNbBytes bytes, or NULL if the stream is too short.
+  //! The buffer is enlarged for the data not fitting into it (e.g. face with huge list).
+  //! The returned data remains valid until the next call.
+  const char* Next(const size_t theNbBytes)
+  {
+    if (myEnd - myPos < theNbBytes)
+    {
+      memmove(myBuffer.data(), myBuffer.data() + myPos, myEnd - myPos);
+      myEnd -= myPos;
+      myPos = 0;
+      if (theNbBytes > myBuffer.size())
+      {
+        myBuffer.resize(theNbBytes);
+      }
+      myStream.read(myBuffer.data() + myEnd, std::streamsize(myBuffer.size() - myEnd));
+      myEnd += size_t(myStream.gcount());
+      if (myEnd < theNbBytes)
+      {
+        return NULL;
+      }
+    }
+    const char* aData = myBuffer.data() + myPos;
+    myPos += theNbBytes;
+    return aData;
+  }
+
+  //! Read theNbBytes bytes into the destination memory without intermediate copying
+  //! of the data not buffered yet.
+  bool Read(char* theData, const size_t theNbBytes)
+  {
+    const size_t aNbBuffered = std::min(theNbBytes, myEnd - myPos);
+    memcpy(theData, myBuffer.data() + myPos, aNbBuffered);
+    myPos += aNbBuffered;
+    if (aNbBuffered == theNbBytes)
+    {
+      return true;
+    }
+    myStream.read(theData + aNbBuffered, std::streamsize(theNbBytes - aNbBuffered));
+    return size_t(myStream.gcount()) == theNbBytes - aNbBuffered;
+  }
+
+private:
+  std::istream&     myStream;
+  std::vector<char> myBuffer;
+  size_t            myPos;
+  size_t            myEnd;
+};
+
+//! Return number of progress indicator steps for the element.
+static Standard_Integer nbProgressSteps(const RWPly_Reader::Element& theElement)
+{
+  return Max(1, theElement.Count / THE_PROGRESS_STEP);
+}
+} // namespace
+
+//=================================================================================================
+
+RWPly_Reader::RWPly_Reader()
+    : myFormat(Format_Ascii),
+      myNbTriangles(0),
+      myNbInvalidFaces(0),
+      myIsSinglePrecision(Standard_False)
+{
+}
+
+//=================================================================================================
+
+Standard_Boolean RWPly_Reader::Read(const TCollection_AsciiString& theFile,
+                                    const Message_ProgressRange&   theProgress)
+{
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aStream =
+    aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
+  if (aStream.get() == NULL)
+  {
+    Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is not found");
+    return Standard_False;
+  }
+  return Read(*aStream, theProgress);
+}
+
+//=================================================================================================
+
+Standard_Boolean RWPly_Reader::ReadHeader(std::istream& theStream)
+{
+  myElements.Clear();
+  myFileComments.Clear();
+  myFormat = Format_Ascii;
+
+  std::string aLine;
+  if (!std::getline(theStream, aLine) || aLine.compare(0, 3, "ply") != 0)
+  {
+    Message::SendFail("Error: PLY reader, stream does not contain PLY data");
+    return Standard_False;
+  }
+
+  Standard_Boolean hasFormat = Standard_False;
+  for (;;)
+  {
+    if (!std::getline(theStream, aLine))
+    {
+      Message::SendFail("Error: PLY reader, unexpected end of header");
+      return Standard_False;
+    }
+    if (!aLine.empty() && aLine[aLine.size() - 1] == '\r')
+    {
+      aLine.resize(aLine.size() - 1);
+    }
+
+    std::istringstream aWords(aLine);
+    std::string        aKeyword;
+    aWords >> aKeyword;
+    if (aKeyword.empty())
+    {
+      continue;
+    }
+    else if (aKeyword == "end_header")
+    {
+      break;
+    }
+    else if (aKeyword == "comment" || aKeyword == "obj_info")
+    {
+      size_t aStart = aLine.find(aKeyword) + aKeyword.size();
+      aStart        = std::min(aLine.find_first_not_of(" \t", aStart), aLine.size());
+      if (!myFileComments.IsEmpty())
+      {
+        myFileComments += "\n";
+      }
+      myFileComments += aLine.c_str() + aStart;
+    }
+    else if (aKeyword == "format")
+    {
+      std::string aFormat;
+      aWords >> aFormat;
+      if (aFormat == "ascii")
+      {
+        myFormat = Format_Ascii;
+      }
+      else if (aFormat == "binary_little_endian")
+      {
+        myFormat = Format_BinaryLittleEndian;
+      }
+      else if (aFormat == "binary_big_endian")
+      {
+        myFormat = Format_BinaryBigEndian;
+      }
+      else
+      {
+        Message::SendFail(TCollection_AsciiString("Error: PLY reader, unsupported format '")
+                          + aFormat.c_str() + "'");
+        return Standard_False;
+      }
+      hasFormat = Standard_True;
+    }
+    else if (aKeyword == "element")
+    {
+      Element anElement;
+      long    aCount = -1;
+      std::string aName;
+      aWords >> aName >> aCount;
+      if (aName.empty() || aCount < 0 || aCount > IntegerLast())
+      {
+        Message::SendFail(
+          TCollection_AsciiString("Error: PLY reader, invalid element definition '")
+          + aLine.c_str() + "'");
+        return Standard_False;
+      }
+      anElement.Name  = aName.c_str();
+      anElement.Count = Standard_Integer(aCount);
+      myElements.Append(anElement);
+    }
+    else if (aKeyword == "property")
+    {
+      Property    aProp;
+      std::string aType, aName;
+      aWords >> aType;
+      if (aType == "list")
+      {
+        std::string aCountType;
+        aWords >> aCountType >> aType;
+        aProp.CountType = propertyTypeFromString(aCountType);
+        if (aProp.CountType == PropertyType_Undefined
+            || aProp.CountType == PropertyType_Float32
+            || aProp.CountType == PropertyType_Float64)
+        {
+          aProp.Type = PropertyType_Undefined;
+        }
+        else
+        {
+          aProp.Type = propertyTypeFromString(aType);
+        }
+      }
+      else
+      {
+        aProp.Type = propertyTypeFromString(aType);
+      }
+      aWords >> aName;
+      aProp.Name = aName.c_str();
+      if (myElements.IsEmpty() || aProp.Type == PropertyType_Undefined || aName.empty())
+      {
+        Message::SendFail(
+          TCollection_AsciiString("Error: PLY reader, invalid property definition '")
+          + aLine.c_str() + "'");
+        return Standard_False;
+      }
+      myElements.ChangeLast().Properties.Append(aProp);
+    }
+    else
+    {
+      Message::SendFail(TCollection_AsciiString("Error: PLY reader, unknown header keyword '")
+                        + aKeyword.c_str() + "'");
+      return Standard_False;
+    }
+  }
+
+  if (!hasFormat)
+  {
+    Message::SendFail("Error: PLY reader, format is not defined");
+    return Standard_False;
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean RWPly_Reader::Read(std::istream&                theStream,
+                                    const Message_ProgressRange& theProgress)
+{
+  myTriangulation.Nullify();
+  myColors = NCollection_Array1<Graphic3d_Vec4ub>();
+  myNbTriangles    = 0;
+  myNbInvalidFaces = 0;
+  if (!ReadHeader(theStream))
+  {
+    return Standard_False;
+  }
+
+  Standard_Boolean hasVertices = Standard_False;
+  myTriangulation              = new Poly_Triangulation();
+  for (NCollection_Vector<Element>::Iterator anElemIter(myElements); anElemIter.More();
+       anElemIter.Next())
+  {
+    const Element& anElement = anElemIter.Value();
+    if (anElement.Name.IsEqual("vertex") && !hasVertices)
+    {
+      if (!VertexLayout(anElement).HasPosition())
+      {
+        Message::SendFail("Error: PLY reader, vertex element does not define coordinates");
+        myTriangulation.Nullify();
+        return Standard_False;
+      }
+      allocateVertices(anElement);
+      hasVertices = Standard_True;
+    }
+    else if (anElement.Name.IsEqual("face") && findFaceIndices(anElement) >= 0)
+    {
+      allocateTriangles(myTriangulation->NbTriangles() + anElement.Count);
+    }
+  }
+  if (!hasVertices)
+  {
+    Message::SendFail("Error: PLY reader, vertex element is not defined");
+    myTriangulation.Nullify();
+    return Standard_False;
+  }
+
+  const Standard_Boolean isDone = myFormat == Format_Ascii ? readAscii(theStream, theProgress)
+                                                           : readBinary(theStream, theProgress);
+  if (!isDone)
+  {
+    myTriangulation.Nullify();
+    myColors = NCollection_Array1<Graphic3d_Vec4ub>();
+    return Standard_False;
+  }
+  finalize();
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void RWPly_Reader::allocateVertices(const Element& theElement)
+{
+  const VertexLayout aLayout(theElement);
+
+  // float coordinates are kept in single precision without loss of accuracy
+  const Standard_Boolean isDouble =
+    !myIsSinglePrecision
+    && (theElement.Properties.Value(aLayout.Position[0]).Type == PropertyType_Float64
+        || theElement.Properties.Value(aLayout.Position[1]).Type == PropertyType_Float64
+        || theElement.Properties.Value(aLayout.Position[2]).Type == PropertyType_Float64);
+  myTriangulation->SetDoublePrecision(isDouble);
+  myTriangulation->ResizeNodes(theElement.Count, Standard_False);
+  if (aLayout.HasNormals())
+  {
+    myTriangulation->AddNormals();
+  }
+  if (aLayout.HasUV())
+  {
+    myTriangulation->AddUVNodes();
+  }
+  if (aLayout.HasColors() && theElement.Count > 0)
+  {
+    myColors.Resize(1, theElement.Count, Standard_False);
+  }
+}
+
+//=================================================================================================
+
+void RWPly_Reader::allocateTriangles(const Standard_Integer theNbTriangles)
+{
+  myTriangulation->ResizeTriangles(theNbTriangles, Standard_True);
+}
+
+//=================================================================================================
+
+void RWPly_Reader::addPolygon(const Standard_Integer* theIndices,
+                              const Standard_Integer  theNbIndices)
+{
+  const Standard_Integer aNbNodes = myTriangulation->NbNodes();
+  for (Standard_Integer aNodeIter = 0; aNodeIter < theNbIndices; ++aNodeIter)
+  {
+    if (theIndices[aNodeIter] < 0 || theIndices[aNodeIter] >= aNbNodes)
+    {
+      ++myNbInvalidFaces;
+      return;
+    }
+  }
+  if (theNbIndices < 3)
+  {
+    ++myNbInvalidFaces;
+    return;
+  }
+
+  if (myNbTriangles + theNbIndices - 2 > myTriangulation->NbTriangles())
+  {
+    allocateTriangles(Max(2 * myTriangulation->NbTriangles(), myNbTriangles + theNbIndices - 2));
+  }
+
+  // split polygon into a fan of triangles, indices in PLY file start from 0
+  for (Standard_Integer aNodeIter = 2; aNodeIter < theNbIndices; ++aNodeIter)
+  {
+    myTriangulation->SetTriangle(++myNbTriangles,
+                                 Poly_Triangle(theIndices[0] + 1,
+                                               theIndices[aNodeIter - 1] + 1,
+                                               theIndices[aNodeIter] + 1));
+  }
+}
+
+//=================================================================================================
+
+void RWPly_Reader::finalize()
+{
+  if (myNbTriangles != myTriangulation->NbTriangles())
+  {
+    myTriangulation->ResizeTriangles(myNbTriangles, Standard_True);
+  }
+  if (myNbInvalidFaces > 0)
+  {
+    Message::SendWarning(TCollection_AsciiString("Warning: PLY reader, ") + myNbInvalidFaces
+                         + " invalid faces have been skipped");
+  }
+  if (myCSTrsf.IsEmpty())
+  {
+    return;
+  }
+
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= myTriangulation->NbNodes(); ++aNodeIter)
+  {
+    gp_XYZ aPnt = myTriangulation->Node(aNodeIter).XYZ();
+    myCSTrsf.TransformPosition(aPnt);
+    myTriangulation->SetNode(aNodeIter, aPnt);
+  }
+  if (myTriangulation->HasNormals())
+  {
+    NCollection_Array1<gp_Vec3f>& aNormals = myTriangulation->InternalNormals();
+    for (Standard_Integer aNodeIter = aNormals.Lower(); aNodeIter <= aNormals.Upper(); ++aNodeIter)
+    {
+      myCSTrsf.TransformNormal(aNormals.ChangeValue(aNodeIter));
+    }
+  }
+}
+
+//=================================================================================================
+
+Standard_Boolean RWPly_Reader::readAscii(std::istream&                theStream,
+                                         const Message_ProgressRange& theProgress)
+{
+  Standard_ReadLineBuffer aBuffer(THE_BUFFER_SIZE);
+  std::vector<double>     aValues;
+  std::vector<int>        anIndices;
+  Standard_Boolean        hasVertices = Standard_False;
+
+  Message_ProgressScope aPS(theProgress, "Reading PLY", myElements.Size());
+  for (NCollection_Vector<Element>::Iterator anElemIter(myElements); anElemIter.More();
+       anElemIter.Next())
+  {
+    const Element&         anElement = anElemIter.Value();
+    const Standard_Boolean isVertex  = anElement.Name.IsEqual("vertex") && !hasVertices;
+    const Standard_Integer aFaceProp =
+      anElement.Name.IsEqual("face") ? findFaceIndices(anElement) : -1;
+    const VertexLayout aLayout(anElement);
+    hasVertices = hasVertices || isVertex;
+    aValues.assign(anElement.Properties.Size(), 0.0);
+
+    Message_ProgressScope anElemPS(aPS.Next(), NULL, nbProgressSteps(anElement));
+    for (Standard_Integer aRecIter = 0; aRecIter < anElement.Count; ++aRecIter)
+    {
+      if ((aRecIter + 1) % THE_PROGRESS_STEP == 0)
+      {
+        anElemPS.Next();
+        if (!anElemPS.More())
+        {
+          return Standard_False;
+        }
+      }
+
+      // each record is stored on a separate line
+      size_t      aLineLen = 0;
+      const char* aLine    = NULL;
+      do
+      {
+        aLine = aBuffer.ReadLine(theStream, aLineLen);
+        if (aLine == NULL)
+        {
+          Message::SendFail("Error: PLY reader, unexpected end of file");
+          return Standard_False;
+        }
+        while (*aLine == ' ' || *aLine == '\t')
+        {
+          ++aLine;
+        }
+      } while (*aLine == '\0');
+      if (!isVertex && aFaceProp < 0)
+      {
+        continue;
+      }
+
+      const char* aPos = aLine;
+      for (Standard_Integer aPropIter = 0; aPropIter < anElement.Properties.Size(); ++aPropIter)
+      {
+        const Property& aProp = anElement.Properties.Value(aPropIter);
+        char*           aNext = NULL;
+        const double    aValue = Strtod(aPos, &aNext);
+        if (aNext == aPos)
+        {
+          Message::SendFail(TCollection_AsciiString("Error: PLY reader, invalid record '") + aLine
+                            + "'");
+          return Standard_False;
+        }
+        aPos = aNext;
+        if (!aProp.IsList())
+        {
+          aValues[aPropIter] = aValue;
+          continue;
+        }
+
+        const int aNbItems = int(aValue);
+        anIndices.resize(Max(aNbItems, 0));
+        for (int anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+        {
+          const double anItem = Strtod(aPos, &aNext);
+          if (aNext == aPos)
+          {
+            Message::SendFail(TCollection_AsciiString("Error: PLY reader, invalid record '") + aLine
+                              + "'");
+            return Standard_False;
+          }
+          aPos                   = aNext;
+          anIndices[anItemIter] = int(anItem);
+        }
+        if (aPropIter == aFaceProp)
+        {
+          addPolygon(anIndices.data(), aNbItems);
+        }
+      }
+      if (isVertex)
+      {
+        setVertex(*myTriangulation, myColors, anElement, aLayout, aValues.data(), aRecIter + 1);
+      }
+    }
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean RWPly_Reader::readBinary(std::istream&                theStream,
+                                          const Message_ProgressRange& theProgress)
+{
+#if OCCT_BINARY_FILE_DO_INVERSE
+  const bool toSwap = myFormat == Format_BinaryLittleEndian;
+#else
+  const bool toSwap = myFormat == Format_BinaryBigEndian;
+#endif
+
+  BinaryBuffer        aBuffer(theStream);
+  std::vector<double> aValues;
+  std::vector<int>    anIndices;
+  Standard_Boolean    hasVertices = Standard_False;
+
+  Message_ProgressScope aPS(theProgress, "Reading PLY", myElements.Size());
+  for (NCollection_Vector<Element>::Iterator anElemIter(myElements); anElemIter.More();
+       anElemIter.Next())
+  {
+    const Element&         anElement = anElemIter.Value();
+    const Standard_Boolean isVertex  = anElement.Name.IsEqual("vertex") && !hasVertices;
+    const Standard_Integer aFaceProp =
+      anElement.Name.IsEqual("face") ? findFaceIndices(anElement) : -1;
+    const VertexLayout aLayout(anElement);
+    hasVertices = hasVertices || isVertex;
+    aValues.assign(anElement.Properties.Size(), 0.0);
+
+    Message_ProgressScope anElemPS(aPS.Next(), NULL, nbProgressSteps(anElement));
+    if (isVertex && !toSwap && aLayout.IsPackedPosition(anElement) && anElement.Count > 0
+        && !myTriangulation->InternalNodes().IsDoublePrecision())
+    {
+      // the standard layout matches the memory of single precision nodes
+      Poly_ArrayOfNodes& aNodes = myTriangulation->InternalNodes();
+      if (!aBuffer.Read(reinterpret_cast<char*>(&aNodes.ChangeValue<gp_Vec3f>(0)),
+                        size_t(anElement.Count) * sizeof(gp_Vec3f)))
+      {
+        Message::SendFail("Error: PLY reader, unexpected end of file");
+        return Standard_False;
+      }
+      continue;
+    }
+
+    for (Standard_Integer aRecIter = 0; aRecIter < anElement.Count; ++aRecIter)
+    {
+      if ((aRecIter + 1) % THE_PROGRESS_STEP == 0)
+      {
+        anElemPS.Next();
+        if (!anElemPS.More())
+        {
+          return Standard_False;
+        }
+      }
+
+      for (Standard_Integer aPropIter = 0; aPropIter < anElement.Properties.Size(); ++aPropIter)
+      {
+        const Property& aProp     = anElement.Properties.Value(aPropIter);
+        const size_t    aTypeSize = propertyTypeSize(aProp.Type);
+        if (!aProp.IsList())
+        {
+          const char* aData = aBuffer.Next(aTypeSize);
+          if (aData == NULL)
+          {
+            Message::SendFail("Error: PLY reader, unexpected end of file");
+            return Standard_False;
+          }
+          aValues[aPropIter] = decodeValue(aData, aProp.Type, toSwap);
+          continue;
+        }
+
+        const char* aCountData = aBuffer.Next(propertyTypeSize(aProp.CountType));
+        const int   aNbItems =
+          aCountData != NULL ? Max(int(decodeValue(aCountData, aProp.CountType, toSwap)), 0) : -1;
+        const char* aData = aNbItems >= 0 ? aBuffer.Next(size_t(aNbItems) * aTypeSize) : NULL;
+        if (aData == NULL)
+        {
+          Message::SendFail("Error: PLY reader, unexpected end of file");
+          return Standard_False;
+        }
+        if (aPropIter != aFaceProp)
+        {
+          continue;
+        }
+
+        anIndices.resize(aNbItems);
+        if (!toSwap
+            && (aProp.Type == PropertyType_Int32 || aProp.Type == PropertyType_UInt32))
+        {
+          memcpy(anIndices.data(), aData, size_t(aNbItems) * sizeof(int));
+        }
+        else
+        {
+          for (int anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+          {
+            anIndices[anItemIter] =
+              int(decodeValue(aData + anItemIter * aTypeSize, aProp.Type, toSwap));
+          }
+        }
+        addPolygon(anIndices.data(), aNbItems);
+      }
+      if (isVertex)
+      {
+        setVertex(*myTriangulation, myColors, anElement, aLayout, aValues.data(), aRecIter + 1);
+      }
+    }
+  }
+  return Standard_True;
+}
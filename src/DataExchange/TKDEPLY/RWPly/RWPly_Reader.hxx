@@ -0,0 +1,193 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_Reader_HeaderFile
+#define _RWPly_Reader_HeaderFile
+
+#include <Graphic3d_Vec4.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWMesh_CoordinateSystemConverter.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! PLY format reader into Poly_Triangulation.
+//!
+//! Supports Ascii, binary little endian and binary big endian formats.
+//! Reads element "vertex" with mandatory properties x, y, z and optional normals (nx, ny, nz),
+//! texture coordinates (s, t or u, v) and colors (red, green, blue, alpha),
+//! and element "face" with list property vertex_indices (or vertex_index);
+//! polygons are split into triangles, other elements and properties are skipped.
+//! File without faces is read as a point cloud (triangulation without triangles).
+//!
+//! Nodes are stored with single precision unless the file defines coordinates in double
+//! precision and single precision is not requested by SetSinglePrecision().
+//! Binary vertices defined only by three floats x, y, z in native byte order are read directly
+//! into the single precision nodes of the triangulation. Binary face indices of 32-bit type
+//! in native byte order are copied without decoding, but each face is still validated and
+//! converted into triangles with 1-based indices one by one.
+class RWPly_Reader : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_Reader, Standard_Transient)
+public:
+  //! Format of PLY data.
+  enum Format
+  {
+    Format_Ascii,
+    Format_BinaryLittleEndian,
+    Format_BinaryBigEndian
+  };
+
+  //! Type of property value.
+  enum PropertyType
+  {
+    PropertyType_Undefined,
+    PropertyType_Int8,
+    PropertyType_UInt8,
+    PropertyType_Int16,
+    PropertyType_UInt16,
+    PropertyType_Int32,
+    PropertyType_UInt32,
+    PropertyType_Float32,
+    PropertyType_Float64
+  };
+
+  //! Property of element.
+  struct Property
+  {
+    TCollection_AsciiString Name;      //!< property name
+    PropertyType            Type;      //!< type of value or list item
+    PropertyType            CountType; //!< type of list size, undefined for scalar property
+
+    Property()
+        : Type(PropertyType_Undefined),
+          CountType(PropertyType_Undefined)
+    {
+    }
+
+    //! Return TRUE if property is a list.
+    bool IsList() const { return CountType != PropertyType_Undefined; }
+  };
+
+  //! Element definition.
+  struct Element
+  {
+    TCollection_AsciiString      Name;       //!< element name
+    Standard_Integer             Count;      //!< number of element records
+    NCollection_Vector<Property> Properties; //!< element properties
+
+    Element()
+        : Count(0)
+    {
+    }
+  };
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT RWPly_Reader();
+
+  //! Read PLY file.
+  //! @param[in] theFile  path to the file
+  //! @param[in] theProgress  progress indicator
+  //! @return TRUE if success, FALSE on error or user break
+  Standard_EXPORT Standard_Boolean Read(
+    const TCollection_AsciiString& theFile,
+    const Message_ProgressRange&   theProgress = Message_ProgressRange());
+
+  //! Read PLY data from the stream opened in binary mode.
+  //! @param[in] theStream  input stream
+  //! @param[in] theProgress  progress indicator
+  //! @return TRUE if success, FALSE on error or user break
+  Standard_EXPORT Standard_Boolean Read(
+    std::istream&                theStream,
+    const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Read only the header of PLY data (format, elements and comments).
+  //! The stream is left at the beginning of element data.
+  //! @return FALSE if the stream does not contain valid PLY header
+  Standard_EXPORT Standard_Boolean ReadHeader(std::istream& theStream);
+
+public: //! @name parameters
+  //! Return single precision flag for storing nodes; FALSE by default.
+  Standard_Boolean IsSinglePrecision() const { return myIsSinglePrecision; }
+
+  //! Set single precision flag for storing nodes.
+  void SetSinglePrecision(Standard_Boolean theIsSinglePrecision)
+  {
+    myIsSinglePrecision = theIsSinglePrecision;
+  }
+
+  //! Return transformation from the file coordinate system to the result one.
+  const RWMesh_CoordinateSystemConverter& Transformation() const { return myCSTrsf; }
+
+  //! Set transformation from the file coordinate system to the result one.
+  void SetTransformation(const RWMesh_CoordinateSystemConverter& theCSConverter)
+  {
+    myCSTrsf = theCSConverter;
+  }
+
+public: //! @name results
+  //! Return format of the data.
+  Format DataFormat() const { return myFormat; }
+
+  //! Return elements defined by the header.
+  const NCollection_Vector<Element>& Elements() const { return myElements; }
+
+  //! Return comments of the header.
+  const TCollection_AsciiString& FileComments() const { return myFileComments; }
+
+  //! Return read triangulation.
+  const Handle(Poly_Triangulation)& GetTriangulation() const { return myTriangulation; }
+
+  //! Return TRUE if vertices have colors.
+  Standard_Boolean HasColors() const { return !myColors.IsEmpty(); }
+
+  //! Return per-vertex colors; alpha is 255 if not defined by the file.
+  const NCollection_Array1<Graphic3d_Vec4ub>& Colors() const { return myColors; }
+
+protected:
+  //! Read element data in Ascii format.
+  Standard_EXPORT Standard_Boolean readAscii(std::istream&                theStream,
+                                             const Message_ProgressRange& theProgress);
+
+  //! Read element data in binary format.
+  Standard_EXPORT Standard_Boolean readBinary(std::istream&                theStream,
+                                              const Message_ProgressRange& theProgress);
+
+  //! Allocate arrays for vertex data.
+  Standard_EXPORT void allocateVertices(const Element& theElement);
+
+  //! Allocate triangles, keeping already read ones.
+  Standard_EXPORT void allocateTriangles(const Standard_Integer theNbTriangles);
+
+  //! Add polygon split into triangles; invalid polygons are skipped.
+  Standard_EXPORT void addPolygon(const Standard_Integer* theIndices,
+                                  const Standard_Integer  theNbIndices);
+
+  //! Release unused memory and apply transformation to the read data.
+  Standard_EXPORT void finalize();
+
+protected:
+  RWMesh_CoordinateSystemConverter     myCSTrsf;
+  NCollection_Vector<Element>          myElements;
+  TCollection_AsciiString              myFileComments;
+  Handle(Poly_Triangulation)           myTriangulation;
+  NCollection_Array1<Graphic3d_Vec4ub> myColors;
+  Format                               myFormat;
+  Standard_Integer                     myNbTriangles;
+  Standard_Integer                     myNbInvalidFaces;
+  Standard_Boolean                     myIsSinglePrecision;
+};
+
+#endif // _RWPly_Reader_HeaderFile
@@ -141,6 +141,10 @@ bool DESTEP_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRe
     theResource->BooleanVal("read.metadata", InternalParameters.ReadMetadata, aScope);
   InternalParameters.ReadProductMetadata =
     theResource->BooleanVal("read.productmetadata", InternalParameters.ReadProductMetadata, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
+  InternalParameters.ReadFastScanner =
+    theResource->BooleanVal("read.fast.scanner", InternalParameters.ReadFastScanner, aScope);
 
   InternalParameters.WritePrecisionMode =
     (DESTEP_Parameters::WriteMode_PrecisionMode)theResource->IntegerVal(
@@ -453,6 +457,20 @@ TCollection_AsciiString DESTEP_ConfigurationNode::Save() const
   aResult += aScope + "read.productmetadata :\t " + InternalParameters.ReadProductMetadata + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the read.parallel parameter which is used to indicate whether to "
+             "decode entities of the file in parallel or not\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Setting up the read.fast.scanner parameter which is used to indicate whether to "
+             "tokenize the file with the fast scanner before falling back to the generic parser\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.fast.scanner :\t " + InternalParameters.ReadFastScanner + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write Parameters:\n";
   aResult += "!\n";
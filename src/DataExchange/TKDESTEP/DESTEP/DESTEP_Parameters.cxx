@@ -55,6 +55,8 @@ void DESTEP_Parameters::InitFromStatic()
   ReadIdeas              = Interface_Static::IVal("read.step.ideas") == 1;
   ReadAllShapes          = Interface_Static::IVal("read.step.all.shapes") == 1;
   ReadRootTransformation = Interface_Static::IVal("read.step.root.transformation") == 1;
+  ReadParallel           = Interface_Static::IVal("read.step.parallel") == 1;
+  ReadFastScanner        = Interface_Static::IVal("read.step.fast.scanner") == 1;
 
   WritePrecisionMode =
     (DESTEP_Parameters::WriteMode_PrecisionMode)Interface_Static::IVal("write.precision.mode");
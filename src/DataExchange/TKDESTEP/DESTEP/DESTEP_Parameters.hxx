@@ -182,6 +182,8 @@ public:
   bool ReadProps = true; //<! PropsMode is used to indicate read Validation properties or not
   bool ReadMetadata = true; //! Parameter for metadata reading
   bool ReadProductMetadata = false; //! Parameter for product metadata reading
+  bool ReadParallel = false; //<! Defines whether STEP entities are decoded concurrently after parsing
+  bool ReadFastScanner = false; //<! Defines whether the file is tokenized by hand-written scanner instead of flex/bison
   
   // Write
   WriteMode_PrecisionMode WritePrecisionMode = WriteMode_PrecisionMode_Average; //<! Specifies the mode of writing the resolution value into the STEP file
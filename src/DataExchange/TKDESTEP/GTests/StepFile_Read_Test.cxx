@@ -0,0 +1,210 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <DESTEP_Parameters.hxx>
+#include <STEPControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepData_StepWriter.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Compound.hxx>
+#include <XSControl_WorkSession.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+// Writes a compound of a box and a sphere into STEP text
+std::string writeSampleStep()
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(5.0).Shape());
+
+  STEPControl_Writer aWriter;
+  aWriter.Transfer(aCompound, STEPControl_AsIs);
+  std::ostringstream aStream;
+  aWriter.WriteStream(aStream);
+  return aStream.str();
+}
+
+// Writes the entities of the loaded model back into STEP text, with all their parameters
+std::string writeLoadedModel(STEPControl_Reader& theReader)
+{
+  StepData_StepWriter aWriter(theReader.StepModel());
+  aWriter.SendModel(Handle(StepData_Protocol)::DownCast(theReader.WS()->Protocol()));
+  std::ostringstream aStream;
+  aWriter.Print(aStream);
+  return aStream.str();
+}
+
+// Stream buffer which cannot be positioned, like the one of a pipe
+class NonSeekableBuffer : public std::stringbuf
+{
+public:
+  NonSeekableBuffer(const std::string& theContent)
+      : std::stringbuf(theContent, std::ios::in)
+  {
+  }
+
+protected:
+  pos_type seekoff(off_type, std::ios::seekdir, std::ios::openmode) override
+  {
+    return pos_type(off_type(-1));
+  }
+
+  pos_type seekpos(pos_type, std::ios::openmode) override { return pos_type(off_type(-1)); }
+};
+
+// Counts sub-shapes of the given type
+Standard_Integer countShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  Standard_Integer aNb = 0;
+  for (TopExp_Explorer anExp(theShape, theType); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+} // namespace
+
+// Parallel decoding must produce the same model as sequential decoding
+TEST(StepFile_ReadTest, ParallelDecodingMatchesSequential)
+{
+  const std::string aContent = writeSampleStep();
+  ASSERT_FALSE(aContent.empty());
+
+  DESTEP_Parameters aParams;
+  aParams.ReadParallel = false;
+  STEPControl_Reader aSeqReader;
+  std::istringstream aSeqStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aSeqReader.ReadStream("seq.step", aParams, aSeqStream));
+
+  aParams.ReadParallel = true;
+  STEPControl_Reader aParReader;
+  std::istringstream aParStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aParReader.ReadStream("par.step", aParams, aParStream));
+
+  const Handle(StepData_StepModel) aSeqModel = aSeqReader.StepModel();
+  const Handle(StepData_StepModel) aParModel = aParReader.StepModel();
+  ASSERT_EQ(aSeqModel->NbEntities(), aParModel->NbEntities());
+  for (Standard_Integer anIter = 1; anIter <= aSeqModel->NbEntities(); ++anIter)
+  {
+    EXPECT_EQ(aSeqModel->Value(anIter)->DynamicType(), aParModel->Value(anIter)->DynamicType());
+    EXPECT_EQ(aSeqModel->IdentLabel(aSeqModel->Value(anIter)),
+              aParModel->IdentLabel(aParModel->Value(anIter)));
+  }
+
+  ASSERT_GT(aSeqReader.TransferRoots(), 0);
+  ASSERT_GT(aParReader.TransferRoots(), 0);
+  const TopoDS_Shape aSeqShape = aSeqReader.OneShape();
+  const TopoDS_Shape aParShape = aParReader.OneShape();
+  EXPECT_EQ(countShapes(aSeqShape, TopAbs_SOLID), countShapes(aParShape, TopAbs_SOLID));
+  EXPECT_EQ(countShapes(aSeqShape, TopAbs_FACE), countShapes(aParShape, TopAbs_FACE));
+  EXPECT_EQ(countShapes(aSeqShape, TopAbs_EDGE), countShapes(aParShape, TopAbs_EDGE));
+}
+
+// Fast scanner must produce the same model as flex/bison parser
+TEST(StepFile_ReadTest, FastScannerMatchesParser)
+{
+  const std::string aContent = writeSampleStep();
+  ASSERT_FALSE(aContent.empty());
+
+  DESTEP_Parameters aParams;
+  aParams.ReadFastScanner = false;
+  STEPControl_Reader aParsedReader;
+  std::istringstream aParsedStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aParsedReader.ReadStream("parsed.step", aParams, aParsedStream));
+
+  aParams.ReadFastScanner = true;
+  STEPControl_Reader aScannedReader;
+  std::istringstream aScannedStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aScannedReader.ReadStream("scanned.step", aParams, aScannedStream));
+
+  const Handle(StepData_StepModel) aParsedModel  = aParsedReader.StepModel();
+  const Handle(StepData_StepModel) aScannedModel = aScannedReader.StepModel();
+  ASSERT_EQ(aParsedModel->NbEntities(), aScannedModel->NbEntities());
+  for (Standard_Integer anIter = 1; anIter <= aParsedModel->NbEntities(); ++anIter)
+  {
+    EXPECT_EQ(aParsedModel->Value(anIter)->DynamicType(),
+              aScannedModel->Value(anIter)->DynamicType());
+    EXPECT_EQ(aParsedModel->IdentLabel(aParsedModel->Value(anIter)),
+              aScannedModel->IdentLabel(aScannedModel->Value(anIter)));
+  }
+  // decoded parameters of the entities must be the same as well
+  EXPECT_EQ(writeLoadedModel(aParsedReader), writeLoadedModel(aScannedReader));
+
+  ASSERT_GT(aParsedReader.TransferRoots(), 0);
+  ASSERT_GT(aScannedReader.TransferRoots(), 0);
+  const TopoDS_Shape aParsedShape  = aParsedReader.OneShape();
+  const TopoDS_Shape aScannedShape = aScannedReader.OneShape();
+  EXPECT_EQ(countShapes(aParsedShape, TopAbs_SOLID), countShapes(aScannedShape, TopAbs_SOLID));
+  EXPECT_EQ(countShapes(aParsedShape, TopAbs_FACE), countShapes(aScannedShape, TopAbs_FACE));
+  EXPECT_EQ(countShapes(aParsedShape, TopAbs_EDGE), countShapes(aScannedShape, TopAbs_EDGE));
+}
+
+// Content not supported by fast scanner must be read by flex/bison parser
+TEST(StepFile_ReadTest, FastScannerFallsBackOnScope)
+{
+  const std::string aContent = "ISO-10303-21;\n"
+                               "HEADER;\n"
+                               "FILE_DESCRIPTION((''),'2;1');\n"
+                               "FILE_NAME('','',(''),(''),'','','');\n"
+                               "FILE_SCHEMA(('AUTOMOTIVE_DESIGN'));\n"
+                               "ENDSEC;\n"
+                               "DATA;\n"
+                               "#1 = &SCOPE\n"
+                               "#2 = CARTESIAN_POINT('',(0.,0.,0.));\n"
+                               "ENDSCOPE CARTESIAN_POINT('',(1.,2.,3.));\n"
+                               "ENDSEC;\n"
+                               "END-ISO-10303-21;\n";
+
+  DESTEP_Parameters aParams;
+  aParams.ReadFastScanner = false;
+  STEPControl_Reader aParsedReader;
+  std::istringstream aParsedStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aParsedReader.ReadStream("parsed.step", aParams, aParsedStream));
+
+  aParams.ReadFastScanner = true;
+  STEPControl_Reader aScannedReader;
+  std::istringstream aScannedStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aScannedReader.ReadStream("scanned.step", aParams, aScannedStream));
+  EXPECT_EQ(aParsedReader.StepModel()->NbEntities(), aScannedReader.StepModel()->NbEntities());
+}
+
+// Stream which cannot be rewound must be read by flex/bison parser
+TEST(StepFile_ReadTest, FastScannerSkipsNonSeekableStream)
+{
+  const std::string aContent = writeSampleStep();
+  ASSERT_FALSE(aContent.empty());
+
+  DESTEP_Parameters aParams;
+  aParams.ReadFastScanner = false;
+  STEPControl_Reader aParsedReader;
+  std::istringstream aParsedStream(aContent);
+  ASSERT_EQ(IFSelect_RetDone, aParsedReader.ReadStream("parsed.step", aParams, aParsedStream));
+
+  aParams.ReadFastScanner = true;
+  STEPControl_Reader aScannedReader;
+  NonSeekableBuffer  aBuffer(aContent);
+  std::istream       aScannedStream(&aBuffer);
+  ASSERT_EQ(IFSelect_RetDone, aScannedReader.ReadStream("scanned.step", aParams, aScannedStream));
+  EXPECT_EQ(aParsedReader.StepModel()->NbEntities(), aScannedReader.StepModel()->NbEntities());
+}
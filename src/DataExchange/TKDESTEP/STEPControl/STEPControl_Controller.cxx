@@ -45,6 +45,7 @@
 #include <ShapeUpgrade_RemoveLocations.hxx>
 #include <TopoDS_Shape.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
+#include <UnitsMethods.hxx>
 #include <XSAlgo.hxx>
 #include <XSAlgo_ShapeProcessor.hxx>
 #include <XSControl_WorkSession.hxx>
@@ -181,6 +182,20 @@ STEPControl_Controller::STEPControl_Controller()
     Interface_Static::Init("step", "read.step.ideas", '&', "eval On");
     Interface_Static::SetIVal("read.step.ideas", 0);
 
+    // Parallel decoding of entities after the file has been parsed: OFF by default
+    Interface_Static::Init("step", "read.step.parallel", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel", '&', "eval Off");
+    Interface_Static::Init("step", "read.step.parallel", '&', "eval On");
+    Interface_Static::SetIVal("read.step.parallel", 0);
+
+    // Hand-written scanner of the file instead of generic flex/bison parser: OFF by default
+    Interface_Static::Init("step", "read.step.fast.scanner", 'e', "");
+    Interface_Static::Init("step", "read.step.fast.scanner", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.fast.scanner", '&', "eval Off");
+    Interface_Static::Init("step", "read.step.fast.scanner", '&', "eval On");
+    Interface_Static::SetIVal("read.step.fast.scanner", 0);
+
     // Parameter to write all free vertices in one SDR (name and style of vertex are lost) (default)
     // or each vertex in its own SDR (name and style of vertex are exported). (ika; 21.07.2014)
     Interface_Static::Init("step", "write.step.vertex.mode", 'e', "");
@@ -437,6 +452,25 @@ Handle(Transfer_ActorOfTransientProcess) STEPControl_Controller::ActorRead(
   return anAdap;
 }
 
+//=================================================================================================
+
+Handle(Transfer_ActorOfTransientProcess) STEPControl_Controller::NewActorRead(
+  const Handle(Interface_InterfaceModel)& theModel) const
+{
+  // the actors run concurrently and must only read the model,
+  // so the length unit is initialized here, before the transfer
+  Handle(StepData_StepModel) aStepModel = Handle(StepData_StepModel)::DownCast(theModel);
+  if (!aStepModel.IsNull() && !aStepModel->IsInitializedUnit())
+  {
+    XSAlgo_ShapeProcessor::PrepareForTransfer(); // update unit info
+    aStepModel->SetLocalLengthUnit(UnitsMethods::GetCasCadeLengthUnit());
+  }
+
+  Handle(STEPControl_ActorRead) anAdap = new STEPControl_ActorRead(theModel);
+  anAdap->SetModel(theModel);
+  return anAdap;
+}
+
 //  ####    PROVISOIRE ???   ####
 
 IFSelect_ReturnStatus STEPControl_Controller::TransferWriteShape(
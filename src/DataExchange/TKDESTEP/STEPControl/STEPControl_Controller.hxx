@@ -48,6 +48,12 @@ public:
   Standard_EXPORT Handle(Transfer_ActorOfTransientProcess) ActorRead(
     const Handle(Interface_InterfaceModel)& theModel) const Standard_OVERRIDE;
 
+  //! Creates a new Actor for Read, used by parallel transfer of roots.
+  //! Initializes the length unit of the Model if it is not done yet,
+  //! so that the concurrent transfers do not modify the Model.
+  Standard_EXPORT Handle(Transfer_ActorOfTransientProcess) NewActorRead(
+    const Handle(Interface_InterfaceModel)& theModel) const Standard_OVERRIDE;
+
   Standard_EXPORT virtual void Customise(Handle(XSControl_WorkSession)& WS) Standard_OVERRIDE;
 
   //! Takes one Shape and transfers it to the InterfaceModel
@@ -60,7 +60,8 @@ IMPLEMENT_STANDARD_RTTIEXT(StepData_StepReaderData, Interface_FileReaderData)
 //  #########################################################################
 //  ....   Creation and basic access to atomic file data    ....
 typedef TCollection_HAsciiString String;
-static char                      txtmes[200]; // more convenient than redeclaring everywhere
+// more convenient than redeclaring everywhere; per thread, as records may be read concurrently
+static Standard_THREADLOCAL char txtmes[200];
 
 static Standard_Boolean initstr = Standard_False;
 #define Maxlst 64
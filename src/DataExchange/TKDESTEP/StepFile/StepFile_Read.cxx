@@ -17,6 +17,7 @@
 #include <StepFile_Read.hxx>
 
 #include <StepFile_ReadData.hxx>
+#include <StepFile_Scanner.hxx>
 
 #include <Interface_Check.hxx>
 #include <Interface_InterfaceError.hxx>
@@ -91,26 +92,64 @@ static Standard_Integer StepFile_Read(const char*                            the
   Message_Messenger::StreamBuffer sout = Message::SendTrace();
   sout << "      ...    Step File Reading : '" << theName << "'";
 
-  StepFile_ReadData aFileDataModel;
-  try
+  // text values of the fast scanner refer to its buffer, so it is kept until the model is loaded
+  StepFile_ReadData  aScannedDataModel;
+  StepFile_ReadData  aParsedDataModel;
+  StepFile_ReadData* aFileDataModel = &aParsedDataModel;
+  StepFile_Scanner   aFastScanner(&aScannedDataModel);
+  if (theStepModel->InternalParameters.ReadFastScanner)
   {
-    OCC_CATCH_SIGNALS
-    int           aLetat = 0;
-    step::scanner aScanner(&aFileDataModel, aStreamPtr);
-    aScanner.yyrestart(aStreamPtr);
-    step::parser aParser(&aScanner);
-    aLetat = aParser.parse();
-    if (aLetat != 0)
+    // the stream is rewound when the fast scanner rejects the content,
+    // so a stream which cannot be positioned is left to the generic parser
+    const std::streampos aStart = aStreamPtr->tellg();
+    if (aStart < 0)
     {
-      StepFile_Interrupt(aFileDataModel.GetLastError(), Standard_True);
-      return 1;
+      aStreamPtr->clear();
+      sout << "      ...    Stream cannot be rewound, using generic parser ...\n";
+    }
+    else if (aFastScanner.Load(*aStreamPtr) && aFastScanner.Perform())
+    {
+      aFileDataModel = &aScannedDataModel;
+    }
+    else
+    {
+      aScannedDataModel.ClearRecorder(3);
+      aFastScanner.Clear();
+      aStreamPtr->clear();
+      aStreamPtr->seekg(aStart);
+      if (aStreamPtr->fail())
+      {
+        Message::SendFail() << " ...  Step File cannot be rewound after fast scanning : '"
+                            << theName << "'";
+        return 1;
+      }
+      sout << "      ...    Fast scanning rejected, using generic parser ...\n";
     }
   }
-  catch (Standard_Failure const& anException)
+
+  if (aFileDataModel == &aParsedDataModel)
   {
-    Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName << "':\n"
-                        << anException << "    ...";
-    return 1;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      int           aLetat = 0;
+      step::scanner aScanner(&aParsedDataModel, aStreamPtr);
+      aScanner.yyrestart(aStreamPtr);
+      step::parser aParser(&aScanner);
+      aLetat = aParser.parse();
+      if (aLetat != 0)
+      {
+        StepFile_Interrupt(aParsedDataModel.GetLastError(), Standard_True);
+        return 1;
+      }
+    }
+    catch (Standard_Failure const& anException)
+    {
+      Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName
+                          << "':\n"
+                          << anException << "    ...";
+      return 1;
+    }
   }
 
 #ifdef CHRONOMESURE
@@ -121,7 +160,7 @@ static Standard_Integer StepFile_Read(const char*                            the
 
   Standard_Mutex::Sentry aLocker(THE_GLOBAL_READ_MUTEX);
   Standard_Integer       nbhead, nbrec, nbpar;
-  aFileDataModel.GetFileNbR(&nbhead, &nbrec, &nbpar); // renvoi par lex/yacc
+  aFileDataModel->GetFileNbR(&nbhead, &nbrec, &nbpar); // renvoi par lex/yacc
   Handle(StepData_StepReaderData) undirec =
     // clang-format off
     new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
@@ -131,23 +170,23 @@ static Standard_Integer StepFile_Read(const char*                            the
     int   nbarg;
     char* ident;
     char* typrec = 0;
-    aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
+    aFileDataModel->GetRecordDescription(&ident, &typrec, &nbarg);
     undirec->SetRecord(nr, ident, typrec, nbarg);
 
     if (nbarg > 0)
     {
       Interface_ParamType typa;
       char*               val;
-      while (aFileDataModel.GetArgDescription(&typa, &val) == 1)
+      while (aFileDataModel->GetArgDescription(&typa, &val) == 1)
       {
         undirec->AddStepParam(nr, val, typa);
       }
     }
     undirec->InitParams(nr);
-    aFileDataModel.NextRecord();
+    aFileDataModel->NextRecord();
   }
 
-  aFileDataModel.ErrorHandle(undirec->GlobalCheck());
+  aFileDataModel->ErrorHandle(undirec->GlobalCheck());
   Standard_Integer anFailsCount = undirec->GlobalCheck()->NbFails();
   if (anFailsCount > 0)
   {
@@ -155,7 +194,7 @@ static Standard_Integer StepFile_Read(const char*                            the
                         << " ****";
   }
 
-  aFileDataModel.ClearRecorder(1);
+  aFileDataModel->ClearRecorder(1);
 
   sout << "      ... Step File loaded  ...\n";
   sout << "   " << undirec->NbRecords() << " records (entities,sub-lists,scopes), " << nbpar
@@ -169,6 +208,7 @@ static Standard_Integer StepFile_Read(const char*                            the
 
   StepData_StepReaderTool readtool(undirec, theProtocol);
   readtool.SetErrorHandle(Standard_True);
+  readtool.SetParallel(theStepModel->InternalParameters.ReadParallel);
 
   readtool.PrepareHeader(theRecogHeader); // Header. reco nul -> pour Protocol
   readtool.Prepare(theRecogData);         // Data.   reco nul -> pour Protocol
@@ -182,7 +222,7 @@ static Standard_Integer StepFile_Read(const char*                            the
   readtool.LoadModel(theStepModel);
   if (theStepModel->Protocol().IsNull())
     theStepModel->SetProtocol(theProtocol);
-  aFileDataModel.ClearRecorder(2);
+  aFileDataModel->ClearRecorder(2);
   anFailsCount = undirec->GlobalCheck()->NbFails() - anFailsCount;
   if (anFailsCount > 0)
   {
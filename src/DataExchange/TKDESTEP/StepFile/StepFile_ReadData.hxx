@@ -130,6 +130,10 @@ public:
   //! If characters page is full, allocates a new page.
   void CreateNewText(const char* theNewText, int theLenText);
 
+  //! Sets the text value for analysis without copying it.
+  //! Used by StepFile_Scanner, the text must be kept alive until records are read.
+  void SetNewText(char* theText) { myResText = theText; }
+
   //! Adds the current record to the list
   void RecordNewEntity();
 
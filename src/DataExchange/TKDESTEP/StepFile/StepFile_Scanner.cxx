@@ -0,0 +1,719 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepFile_Scanner.hxx>
+
+#include <StepFile_ReadData.hxx>
+
+#include <cstring>
+
+namespace
+{
+//! Returns TRUE for characters of type names (see rule [a-zA-Z0-9_]+ in step.lex)
+inline Standard_Boolean isTypeChar(const char theChar)
+{
+  return (theChar >= 'A' && theChar <= 'Z') || (theChar >= 'a' && theChar <= 'z')
+         || (theChar >= '0' && theChar <= '9') || theChar == '_';
+}
+
+//! Returns TRUE for digits
+inline Standard_Boolean isDigit(const char theChar)
+{
+  return theChar >= '0' && theChar <= '9';
+}
+
+//! Returns TRUE for characters allowed to follow an argument value
+inline Standard_Boolean isArgDelimiter(const char theChar)
+{
+  return theChar == ',' || theChar == ')' || theChar == ' ' || theChar == '\t' || theChar == '\n'
+         || theChar == '\r' || theChar == '/';
+}
+
+//! Compares the keyword with the given upper-case name, ignoring case
+Standard_Boolean isSameKeyword(const char*         theWord,
+                               const Standard_Size theLength,
+                               const char*         theName)
+{
+  const Standard_Size aNameLength = strlen(theName);
+  if (theLength < aNameLength)
+  {
+    return Standard_False;
+  }
+  for (Standard_Size aCharIter = 0; aCharIter < aNameLength; ++aCharIter)
+  {
+    const char aChar = theWord[aCharIter];
+    if ((aChar >= 'a' && aChar <= 'z' ? aChar - 'a' + 'A' : aChar) != theName[aCharIter])
+    {
+      return Standard_False;
+    }
+  }
+  // remaining characters are only allowed in numbered form of ISO keywords
+  for (Standard_Size aCharIter = aNameLength; aCharIter < theLength; ++aCharIter)
+  {
+    if (!isDigit(theWord[aCharIter]) && theWord[aCharIter] != '-')
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//! Section keywords recognized by the scanner
+enum StepFile_Keyword
+{
+  StepFile_Keyword_None,
+  StepFile_Keyword_Step,
+  StepFile_Keyword_Header,
+  StepFile_Keyword_EndSec,
+  StepFile_Keyword_Data,
+  StepFile_Keyword_EndStep
+};
+} // namespace
+
+//=================================================================================================
+
+StepFile_Scanner::StepFile_Scanner(StepFile_ReadData* theDataModel)
+    : myDataModel(theDataModel),
+      myBuffer(nullptr),
+      myPos(nullptr),
+      myEnd(nullptr),
+      myHeldPos(nullptr),
+      myHeldChar('\0')
+{
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::Load(std::istream& theStream)
+{
+  Clear();
+  const std::streampos aStart = theStream.tellg();
+  if (aStart < 0)
+  {
+    theStream.clear();
+    return Standard_False;
+  }
+  theStream.seekg(0, std::ios::end);
+  const std::streampos aFinish = theStream.tellg();
+  theStream.seekg(aStart);
+  if (theStream.fail() || aFinish < aStart)
+  {
+    theStream.clear();
+    theStream.seekg(aStart);
+    return Standard_False;
+  }
+
+  const Standard_Size aSize = static_cast<Standard_Size>(aFinish - aStart);
+  myBuffer                  = static_cast<char*>(Standard::Allocate(aSize + 1));
+  theStream.read(myBuffer, static_cast<std::streamsize>(aSize));
+  const Standard_Size aNbRead = static_cast<Standard_Size>(theStream.gcount());
+  myBuffer[aNbRead]           = '\0';
+  myPos                       = myBuffer;
+  myEnd                       = myBuffer + aNbRead;
+  return aNbRead == aSize;
+}
+
+//=================================================================================================
+
+void StepFile_Scanner::Clear()
+{
+  if (myBuffer != nullptr)
+  {
+    Standard::Free(myBuffer);
+  }
+  myBuffer  = nullptr;
+  myPos     = nullptr;
+  myEnd     = nullptr;
+  myHeldPos = nullptr;
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::Perform()
+{
+  if (myBuffer == nullptr)
+  {
+    return Standard_False;
+  }
+
+  //  stepf : STEP HEADER headl ENDSEC endhead model ENDSEC finstep
+  if (!skipBlanks() || readKeyword() != StepFile_Keyword_Step)
+  {
+    return Standard_False;
+  }
+  if (!skipBlanks() || readKeyword() != StepFile_Keyword_Header)
+  {
+    return Standard_False;
+  }
+  if (!readHeader())
+  {
+    return Standard_False;
+  }
+  if (!skipBlanks() || readKeyword() != StepFile_Keyword_Data)
+  {
+    return Standard_False;
+  }
+  myDataModel->FinalOfHead();
+  if (!readData())
+  {
+    return Standard_False;
+  }
+  // anything after the end of exchange structure is ignored, as by the lexer
+  return skipBlanks() && readKeyword() == StepFile_Keyword_EndStep;
+}
+
+//=================================================================================================
+
+char* StepFile_Scanner::terminate(char* theStart, char* theEnd)
+{
+  if (theEnd < myEnd)
+  {
+    myHeldPos  = theEnd;
+    myHeldChar = *theEnd;
+    *theEnd    = '\0';
+  }
+  myPos = theEnd;
+  return theStart;
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::skipBlanks()
+{
+  while (!isEnd())
+  {
+    switch (current())
+    {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+      case '\0':
+        ++myPos;
+        break;
+      case '/': {
+        if (myPos + 1 >= myEnd || myPos[1] != '*')
+        {
+          return Standard_True;
+        }
+        // comment: search for the closing "*/"
+        const char* aCommentEnd = myPos + 2;
+        for (;;)
+        {
+          aCommentEnd =
+            static_cast<const char*>(memchr(aCommentEnd, '*', size_t(myEnd - aCommentEnd)));
+          if (aCommentEnd == nullptr || aCommentEnd + 1 >= myEnd)
+          {
+            return Standard_False;
+          }
+          if (aCommentEnd[1] == '/')
+          {
+            break;
+          }
+          ++aCommentEnd;
+        }
+        myPos = const_cast<char*>(aCommentEnd) + 2;
+        break;
+      }
+      default:
+        return Standard_True;
+    }
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Integer StepFile_Scanner::readKeyword()
+{
+  const char* aWordEnd = myPos;
+  while (aWordEnd < myEnd && (isTypeChar(*aWordEnd) || *aWordEnd == '-'))
+  {
+    ++aWordEnd;
+  }
+  if (aWordEnd >= myEnd || *aWordEnd != ';' || aWordEnd == myPos)
+  {
+    return StepFile_Keyword_None;
+  }
+
+  const Standard_Size aLength  = static_cast<Standard_Size>(aWordEnd - myPos);
+  Standard_Integer    aKeyword = StepFile_Keyword_None;
+  if (isSameKeyword(myPos, aLength, "END-ISO"))
+  {
+    aKeyword = StepFile_Keyword_EndStep;
+  }
+  else if (isSameKeyword(myPos, aLength, "ISO"))
+  {
+    aKeyword = StepFile_Keyword_Step;
+  }
+  else if (aLength == 4 && isSameKeyword(myPos, aLength, "STEP"))
+  {
+    aKeyword = StepFile_Keyword_Step;
+  }
+  else if (aLength == 7 && isSameKeyword(myPos, aLength, "ENDSTEP"))
+  {
+    aKeyword = StepFile_Keyword_EndStep;
+  }
+  else if (aLength == 6 && isSameKeyword(myPos, aLength, "HEADER"))
+  {
+    aKeyword = StepFile_Keyword_Header;
+  }
+  else if (aLength == 6 && isSameKeyword(myPos, aLength, "ENDSEC"))
+  {
+    aKeyword = StepFile_Keyword_EndSec;
+  }
+  else if (aLength == 4 && isSameKeyword(myPos, aLength, "DATA"))
+  {
+    aKeyword = StepFile_Keyword_Data;
+  }
+  if (aKeyword != StepFile_Keyword_None)
+  {
+    myPos = const_cast<char*>(aWordEnd) + 1;
+  }
+  return aKeyword;
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::readHeader()
+{
+  //  headent : enttype listarg ';'
+  for (;;)
+  {
+    if (!skipBlanks() || isEnd())
+    {
+      return Standard_False;
+    }
+    const Standard_Integer aKeyword = readKeyword();
+    if (aKeyword == StepFile_Keyword_EndSec)
+    {
+      return Standard_True;
+    }
+    else if (aKeyword != StepFile_Keyword_None)
+    {
+      return Standard_False;
+    }
+
+    char* aType = readType();
+    if (aType == nullptr)
+    {
+      return Standard_False;
+    }
+    myDataModel->SetNewText(aType);
+    myDataModel->RecordType();
+    if (!readList() || !skipBlanks() || isEnd() || current() != ';')
+    {
+      return Standard_False;
+    }
+    ++myPos;
+  }
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::readData()
+{
+  for (;;)
+  {
+    if (!skipBlanks() || isEnd())
+    {
+      return Standard_False;
+    }
+    if (current() == '#')
+    {
+      if (!readEntity())
+      {
+        return Standard_False;
+      }
+      continue;
+    }
+    return readKeyword() == StepFile_Keyword_EndSec;
+  }
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::readEntity()
+{
+  //  bloc : entlab '=' unent ';'
+  //  entity label is directly followed by '=' (rule #[0-9]+/[ \t]*= in step.lex)
+  char* aLabelEnd = myPos + 1;
+  while (aLabelEnd < myEnd && isDigit(*aLabelEnd))
+  {
+    ++aLabelEnd;
+  }
+  char* anEqual = aLabelEnd;
+  while (anEqual < myEnd && (*anEqual == ' ' || *anEqual == '\t'))
+  {
+    ++anEqual;
+  }
+  if (aLabelEnd == myPos + 1 || anEqual >= myEnd || *anEqual != '=')
+  {
+    return Standard_False;
+  }
+  myDataModel->SetNewText(terminate(myPos, aLabelEnd));
+  myDataModel->RecordIdent();
+  myPos = anEqual + 1;
+
+  if (!skipBlanks() || isEnd())
+  {
+    return Standard_False;
+  }
+  if (current() == '(')
+  {
+    //  unent : '(' plex ')'  -- complex entity
+    ++myPos;
+    Standard_Integer aNbParts = 0;
+    for (;;)
+    {
+      if (!skipBlanks() || isEnd())
+      {
+        return Standard_False;
+      }
+      if (current() == ')')
+      {
+        ++myPos;
+        break;
+      }
+      char* aType = readType();
+      if (aType == nullptr)
+      {
+        return Standard_False;
+      }
+      myDataModel->SetNewText(aType);
+      myDataModel->RecordType();
+      if (!readList())
+      {
+        return Standard_False;
+      }
+      ++aNbParts;
+    }
+    if (aNbParts == 0)
+    {
+      return Standard_False;
+    }
+  }
+  else
+  {
+    //  unent : enttype listarg  -- simple entity; scopes are left to the generic parser
+    char* aType = readType();
+    if (aType == nullptr)
+    {
+      return Standard_False;
+    }
+    myDataModel->SetNewText(aType);
+    myDataModel->RecordType();
+    if (!readList())
+    {
+      return Standard_False;
+    }
+  }
+
+  if (!skipBlanks() || isEnd() || current() != ';')
+  {
+    return Standard_False;
+  }
+  ++myPos;
+  return Standard_True;
+}
+
+//=================================================================================================
+
+char* StepFile_Scanner::readType()
+{
+  char* aTypeEnd = myPos;
+  if (aTypeEnd < myEnd && *aTypeEnd == '!')
+  {
+    ++aTypeEnd;
+  }
+  const char* aNameStart = aTypeEnd;
+  while (aTypeEnd < myEnd && isTypeChar(*aTypeEnd))
+  {
+    ++aTypeEnd;
+  }
+  // type name starting with a digit would be scanned as a number by the lexer
+  if (aTypeEnd == aNameStart || isDigit(*aNameStart))
+  {
+    return nullptr;
+  }
+
+  // type is always followed by its list of arguments
+  const char* aNext = aTypeEnd;
+  while (aNext < myEnd && (*aNext == ' ' || *aNext == '\t' || *aNext == '\n' || *aNext == '\r'))
+  {
+    ++aNext;
+  }
+  if (aNext >= myEnd || *aNext != '(')
+  {
+    return nullptr;
+  }
+  return terminate(myPos, aTypeEnd);
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::readList()
+{
+  //  listarg : deblist finlist | deblist arglist finlist
+  if (!skipBlanks() || isEnd() || current() != '(')
+  {
+    return Standard_False;
+  }
+  ++myPos;
+  myDataModel->RecordListStart();
+
+  if (!skipBlanks() || isEnd())
+  {
+    return Standard_False;
+  }
+  if (current() != ')')
+  {
+    for (;;)
+    {
+      if (!readArgument() || !skipBlanks() || isEnd())
+      {
+        return Standard_False;
+      }
+      const char aChar = current();
+      if (aChar == ')')
+      {
+        break;
+      }
+      else if (aChar != ',')
+      {
+        return Standard_False;
+      }
+      ++myPos;
+      myDataModel->PrepareNewArg();
+      if (!skipBlanks() || isEnd())
+      {
+        return Standard_False;
+      }
+    }
+  }
+
+  //  finlist : ')'
+  ++myPos;
+  if (myDataModel->GetModePrint() > 0)
+  {
+    printf("Record no : %d -- ", myDataModel->GetNbRecord() + 1);
+    myDataModel->PrintCurrentRecord();
+  }
+  myDataModel->RecordNewEntity();
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean StepFile_Scanner::readArgument()
+{
+  const char aChar = current();
+  if (aChar == '(')
+  {
+    //  unarg : listarg
+    if (!readList())
+    {
+      return Standard_False;
+    }
+    myDataModel->CreateNewArg();
+    return Standard_True;
+  }
+  if (aChar == '!' || (isTypeChar(aChar) && !isDigit(aChar)))
+  {
+    //  unarg : listype listarg  -- typed parameter
+    char* aType = readType();
+    if (aType == nullptr)
+    {
+      return Standard_False;
+    }
+    myDataModel->SetNewText(aType);
+    myDataModel->RecordTypeText();
+    if (!readList())
+    {
+      return Standard_False;
+    }
+    myDataModel->CreateNewArg();
+    return Standard_True;
+  }
+
+  char*               aValue = nullptr;
+  Interface_ParamType aType  = Interface_ParamMisc;
+  switch (aChar)
+  {
+    case '#': {
+      char* anIdentEnd = myPos + 1;
+      while (anIdentEnd < myEnd && isDigit(*anIdentEnd))
+      {
+        ++anIdentEnd;
+      }
+      if (anIdentEnd == myPos + 1 || anIdentEnd >= myEnd || !isArgDelimiter(*anIdentEnd))
+      {
+        return Standard_False;
+      }
+      aValue = terminate(myPos, anIdentEnd);
+      aType  = Interface_ParamIdent;
+      break;
+    }
+    case '\'': {
+      aValue = readText();
+      aType  = Interface_ParamText;
+      break;
+    }
+    case '$':
+    case '*': {
+      if (myPos + 1 >= myEnd || !isArgDelimiter(myPos[1]))
+      {
+        return Standard_False;
+      }
+      aValue = terminate(myPos, myPos + 1);
+      aType  = aChar == '$' ? Interface_ParamVoid : Interface_ParamMisc;
+      break;
+    }
+    case '"': {
+      //  hexadecimal : ["][0-9A-F]+["]
+      char* aHexaEnd = myPos + 1;
+      while (aHexaEnd < myEnd && (isDigit(*aHexaEnd) || (*aHexaEnd >= 'A' && *aHexaEnd <= 'F')))
+      {
+        ++aHexaEnd;
+      }
+      if (aHexaEnd == myPos + 1 || aHexaEnd + 1 >= myEnd || *aHexaEnd != '"'
+          || !isArgDelimiter(aHexaEnd[1]))
+      {
+        return Standard_False;
+      }
+      aValue = terminate(myPos, aHexaEnd + 1);
+      aType  = Interface_ParamHexa;
+      break;
+    }
+    case '.': {
+      if (myPos + 1 < myEnd && (myPos[1] == '_' || (myPos[1] >= 'A' && myPos[1] <= 'Z')))
+      {
+        //  enumeration : [.][A-Z0-9_]+[.]
+        char* anEnumEnd = myPos + 1;
+        while (anEnumEnd < myEnd
+               && ((*anEnumEnd >= 'A' && *anEnumEnd <= 'Z') || isDigit(*anEnumEnd)
+                   || *anEnumEnd == '_'))
+        {
+          ++anEnumEnd;
+        }
+        if (anEnumEnd + 1 >= myEnd || *anEnumEnd != '.' || !isArgDelimiter(anEnumEnd[1]))
+        {
+          return Standard_False;
+        }
+        aValue = terminate(myPos, anEnumEnd + 1);
+        aType  = Interface_ParamEnum;
+        break;
+      }
+      Standard_Boolean isReal = Standard_False;
+      aValue                  = readNumber(isReal);
+      aType                   = isReal ? Interface_ParamReal : Interface_ParamInteger;
+      break;
+    }
+    default: {
+      if (aChar != '-' && aChar != '+' && !isDigit(aChar))
+      {
+        return Standard_False;
+      }
+      Standard_Boolean isReal = Standard_False;
+      aValue                  = readNumber(isReal);
+      aType                   = isReal ? Interface_ParamReal : Interface_ParamInteger;
+      break;
+    }
+  }
+  if (aValue == nullptr)
+  {
+    return Standard_False;
+  }
+
+  //  unarg : IDENT | QUID
+  myDataModel->SetNewText(aValue);
+  myDataModel->SetTypeArg(aType);
+  myDataModel->CreateNewArg();
+  return Standard_True;
+}
+
+//=================================================================================================
+
+char* StepFile_Scanner::readNumber(Standard_Boolean& theIsReal)
+{
+  // Classification follows the rules of step.lex:
+  //   [-+0-9][0-9]*                   integer
+  //   [-+\.0-9][\.0-9]+               real
+  //   [-+\.0-9][\.0-9]+E[-+0-9][0-9]* real
+  char*            aNumEnd = myPos + 1;
+  Standard_Boolean hasDot  = *myPos == '.';
+  while (aNumEnd < myEnd && (isDigit(*aNumEnd) || *aNumEnd == '.'))
+  {
+    hasDot = hasDot || *aNumEnd == '.';
+    ++aNumEnd;
+  }
+  const Standard_Size aMantissaLength = static_cast<Standard_Size>(aNumEnd - myPos);
+  theIsReal                           = hasDot;
+  if (aNumEnd < myEnd && *aNumEnd == 'E')
+  {
+    if (aMantissaLength < 2)
+    {
+      return nullptr;
+    }
+    ++aNumEnd;
+    if (aNumEnd >= myEnd || (*aNumEnd != '-' && *aNumEnd != '+' && !isDigit(*aNumEnd)))
+    {
+      return nullptr;
+    }
+    ++aNumEnd;
+    while (aNumEnd < myEnd && isDigit(*aNumEnd))
+    {
+      ++aNumEnd;
+    }
+    theIsReal = Standard_True;
+  }
+  else if (aMantissaLength == 1 && !isDigit(*myPos))
+  {
+    // single sign or dot is not a number for the lexer
+    return nullptr;
+  }
+  if (aNumEnd >= myEnd || !isArgDelimiter(*aNumEnd))
+  {
+    return nullptr;
+  }
+  return terminate(myPos, aNumEnd);
+}
+
+//=================================================================================================
+
+char* StepFile_Scanner::readText()
+{
+  // Text ends with an apostrophe followed (after blanks) by ',' or ')',
+  // see rule [']/[" "\n\r]*[\)\,] in step.lex; any other apostrophe,
+  // including doubled ones, is part of the text
+  const char* aQuote = myPos + 1;
+  for (;;)
+  {
+    aQuote = static_cast<const char*>(memchr(aQuote, '\'', size_t(myEnd - aQuote)));
+    if (aQuote == nullptr)
+    {
+      return nullptr;
+    }
+    const char* aNext = aQuote + 1;
+    while (aNext < myEnd && (*aNext == ' ' || *aNext == '"' || *aNext == '\n' || *aNext == '\r'))
+    {
+      ++aNext;
+    }
+    if (aNext < myEnd && (*aNext == ',' || *aNext == ')'))
+    {
+      break;
+    }
+    ++aQuote;
+  }
+  return terminate(myPos, const_cast<char*>(aQuote) + 1);
+}
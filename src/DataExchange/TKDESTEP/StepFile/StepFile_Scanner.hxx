@@ -0,0 +1,121 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepFile_Scanner_HeaderFile
+#define _StepFile_Scanner_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+#include <iostream>
+
+class StepFile_ReadData;
+
+//! Hand-written scanner of STEP Part 21 exchange structure,
+//! an alternative to the parser built with flex and bison.
+//!
+//! The whole file is loaded into a single memory buffer which is
+//! tokenized in place: each token is terminated by overwriting the
+//! delimiter following it, so the text values passed to StepFile_ReadData
+//! point directly into the buffer instead of being copied into its pages.
+//! The scanner calls the same StepFile_ReadData methods, in the same order,
+//! as the actions of the bison grammar (see step.yacc), so the resulting
+//! records are identical.
+//!
+//! Only well-formed files are handled. When the content contains scopes,
+//! syntax errors or any construction the generic parser would recover
+//! from, Perform() returns FALSE; the filled data model must then be
+//! discarded and the file parsed again by flex and bison.
+//!
+//! The buffer must be kept alive while the data model is in use.
+//! Peak memory of reading is therefore increased by the size of the file.
+//! The stream must support positioning (tellg() and seekg()) so that its size
+//! is known in advance and the generic parser may read it again after rejection;
+//! StepFile_Read() does not use the scanner for other streams.
+class StepFile_Scanner
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructs the scanner filling the given data model
+  StepFile_Scanner(StepFile_ReadData* theDataModel);
+
+  //! Destructor releases the buffer
+  ~StepFile_Scanner() { Clear(); }
+
+  //! Reads the remaining content of the stream into the buffer at once.
+  //! Returns FALSE if the stream cannot be positioned or read.
+  Standard_Boolean Load(std::istream& theStream);
+
+  //! Tokenizes the loaded buffer and fills the data model.
+  //! Returns FALSE if the content requires the generic parser.
+  Standard_Boolean Perform();
+
+  //! Releases the buffer
+  void Clear();
+
+private:
+  StepFile_Scanner(const StepFile_Scanner&)            = delete;
+  StepFile_Scanner& operator=(const StepFile_Scanner&) = delete;
+
+  //! Returns the character at the current position,
+  //! taking into account the delimiter overwritten by the last token
+  char current() const { return myPos == myHeldPos ? myHeldChar : *myPos; }
+
+  //! Returns TRUE if the end of buffer has been reached
+  Standard_Boolean isEnd() const { return myPos >= myEnd; }
+
+  //! Terminates the token ending before theEnd and moves after it
+  char* terminate(char* theStart, char* theEnd);
+
+  //! Skips blanks and comments; returns FALSE on unterminated comment
+  Standard_Boolean skipBlanks();
+
+  //! Reads a section keyword which must be directly followed by ';'
+  //! and returns its kind, or 0 (without moving) if there is no keyword at current position
+  Standard_Integer readKeyword();
+
+  //! Reads the header section
+  Standard_Boolean readHeader();
+
+  //! Reads the data section
+  Standard_Boolean readData();
+
+  //! Reads one data entity "#id = ... ;"
+  Standard_Boolean readEntity();
+
+  //! Reads an entity or sub-list type name
+  char* readType();
+
+  //! Reads a list of arguments in parentheses
+  Standard_Boolean readList();
+
+  //! Reads one argument of a list
+  Standard_Boolean readArgument();
+
+  //! Reads a numeric argument; sets theIsReal if it is a real value
+  char* readNumber(Standard_Boolean& theIsReal);
+
+  //! Reads a quoted text argument
+  char* readText();
+
+private:
+  StepFile_ReadData* myDataModel; //!< data model to fill
+  char*              myBuffer;    //!< content of the file, terminated by null character
+  char*              myPos;       //!< current position in the buffer
+  char*              myEnd;       //!< end of the content
+  char*              myHeldPos;   //!< position of the overwritten delimiter
+  char               myHeldChar;  //!< value of the overwritten delimiter
+};
+
+#endif // _StepFile_Scanner_HeaderFile
@@ -0,0 +1,270 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWStl_Reader.hxx>
+
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Vector.hxx>
+#include <Poly_Triangle.hxx>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+//! Reader collecting nodes and triangles.
+class CollectingReader : public RWStl_Reader
+{
+public:
+  virtual Standard_Integer AddNode(const gp_XYZ& thePnt) Standard_OVERRIDE
+  {
+    myNodes.Append(thePnt);
+    return myNodes.Size();
+  }
+
+  virtual void AddTriangle(Standard_Integer theN1,
+                           Standard_Integer theN2,
+                           Standard_Integer theN3) Standard_OVERRIDE
+  {
+    myTriangles.Append(Poly_Triangle(theN1, theN2, theN3));
+  }
+
+  const NCollection_Vector<gp_XYZ>&        Nodes() const { return myNodes; }
+  const NCollection_Vector<Poly_Triangle>& Triangles() const { return myTriangles; }
+
+private:
+  NCollection_Vector<gp_XYZ>        myNodes;
+  NCollection_Vector<Poly_Triangle> myTriangles;
+};
+
+//! Reader receiving triangles in streaming mode.
+class StreamingReader : public CollectingReader
+{
+public:
+  StreamingReader()
+      : myNbBatches(0),
+        myNbTriangles(0),
+        myMaxBatch(0),
+        myMaxNbBatches(-1)
+  {
+    SetStreaming(Standard_True);
+  }
+
+  virtual Standard_Boolean AddTriangles(const gp_Vec3f*        theNodes,
+                                        const Standard_Integer theNbTriangles) Standard_OVERRIDE
+  {
+    (void)theNodes;
+    ++myNbBatches;
+    myNbTriangles += theNbTriangles;
+    myMaxBatch = std::max(myMaxBatch, theNbTriangles);
+    return myMaxNbBatches < 0 || myNbBatches < myMaxNbBatches;
+  }
+
+  //! Set number of batches after which reading is stopped; -1 (never) by default.
+  void SetMaxNbBatches(int theNbBatches) { myMaxNbBatches = theNbBatches; }
+
+  int NbBatches() const { return myNbBatches; }
+
+  int NbTriangles() const { return myNbTriangles; }
+
+  int MaxBatch() const { return myMaxBatch; }
+
+private:
+  int myNbBatches;
+  int myNbTriangles;
+  int myMaxBatch;
+  int myMaxNbBatches;
+};
+
+//! Appends binary facet to the stream.
+void writeFacet(std::ostream& theStream, const float theNodes[9])
+{
+  char aFacet[50];
+  memset(aFacet, 0, sizeof(aFacet));
+  memcpy(aFacet + 12, theNodes, 9 * sizeof(float));
+  theStream.write(aFacet, sizeof(aFacet));
+}
+
+//! Writes binary STL with the planar grid of theNbCells x theNbCells cells with shuffled
+//! triangles (two per cell). Special cases are added if theToAddSpecial is set: nodes of every
+//! second cell get negative zero coordinate and the grid is followed by one degenerate triangle.
+std::string writeGrid(const int theNbCells, const bool theToAddSpecial = false)
+{
+  std::vector<std::vector<float>> aFacets;
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const float aX0 = float(aCol), aX1 = float(aCol + 1);
+      const float aY0 = float(aRow), aY1 = float(aRow + 1);
+      const float aZ  = theToAddSpecial && (aRow + aCol) % 2 == 0 ? -0.0f : 0.0f;
+      aFacets.push_back({aX0, aY0, aZ, aX1, aY0, aZ, aX0, aY1, aZ});
+      aFacets.push_back({aX1, aY0, aZ, aX1, aY1, aZ, aX0, aY1, aZ});
+    }
+  }
+  std::shuffle(aFacets.begin(), aFacets.end(), std::mt19937(1));
+  if (theToAddSpecial)
+  {
+    aFacets.push_back({0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+  }
+
+  std::ostringstream aStream;
+  char               aHeader[84];
+  memset(aHeader, 0, sizeof(aHeader));
+  const int32_t aNbFacets = (int32_t)aFacets.size();
+  memcpy(aHeader + 80, &aNbFacets, sizeof(aNbFacets));
+  aStream.write(aHeader, sizeof(aHeader));
+  for (const std::vector<float>& aFacet : aFacets)
+  {
+    writeFacet(aStream, aFacet.data());
+  }
+  return aStream.str();
+}
+
+//! Reads binary STL data by the reader.
+bool readBinary(RWStl_Reader& theReader, const std::string& theData)
+{
+  std::istringstream aStream(theData);
+  return theReader.ReadBinary(aStream, Message_ProgressRange());
+}
+
+//! Checks that readers produced the same mesh.
+void checkSameMesh(const CollectingReader& theReader1, const CollectingReader& theReader2)
+{
+  ASSERT_EQ(theReader1.Nodes().Size(), theReader2.Nodes().Size());
+  ASSERT_EQ(theReader1.Triangles().Size(), theReader2.Triangles().Size());
+  for (int aNodeIter = 0; aNodeIter < theReader1.Nodes().Size(); ++aNodeIter)
+  {
+    const gp_XYZ& aNode1 = theReader1.Nodes()(aNodeIter);
+    const gp_XYZ& aNode2 = theReader2.Nodes()(aNodeIter);
+    EXPECT_EQ(aNode1.X(), aNode2.X());
+    EXPECT_EQ(aNode1.Y(), aNode2.Y());
+    EXPECT_EQ(aNode1.Z(), aNode2.Z());
+  }
+  for (int aTriIter = 0; aTriIter < theReader1.Triangles().Size(); ++aTriIter)
+  {
+    int aNodes1[3], aNodes2[3];
+    theReader1.Triangles()(aTriIter).Get(aNodes1[0], aNodes1[1], aNodes1[2]);
+    theReader2.Triangles()(aTriIter).Get(aNodes2[0], aNodes2[1], aNodes2[2]);
+    EXPECT_EQ(aNodes1[0], aNodes2[0]);
+    EXPECT_EQ(aNodes1[1], aNodes2[1]);
+    EXPECT_EQ(aNodes1[2], aNodes2[2]);
+  }
+}
+} // namespace
+
+TEST(RWStl_ReaderTest, ExactMergeMatchesMergeTool)
+{
+  const int         aNbCells = 60;
+  const std::string aData    = writeGrid(aNbCells);
+
+  // default parameters merge nodes with exactly matching coordinates by chunks
+  CollectingReader aReader;
+  ASSERT_TRUE(readBinary(aReader, aData));
+  EXPECT_EQ((aNbCells + 1) * (aNbCells + 1), aReader.Nodes().Size());
+  EXPECT_EQ(2 * aNbCells * aNbCells, aReader.Triangles().Size());
+
+  // negative zero is merged with the positive one, degenerate triangle is skipped
+  CollectingReader aReaderZero;
+  ASSERT_TRUE(readBinary(aReaderZero, writeGrid(aNbCells, true)));
+  EXPECT_EQ((aNbCells + 1) * (aNbCells + 1), aReaderZero.Nodes().Size());
+  EXPECT_EQ(2 * aNbCells * aNbCells, aReaderZero.Triangles().Size());
+
+  // merge angle smaller than 90 degrees is handled by Poly_MergeNodesTool,
+  // which gives the same result for the planar mesh
+  CollectingReader aReaderRef;
+  aReaderRef.SetMergeAngle(89.0 * M_PI / 180.0);
+  ASSERT_TRUE(readBinary(aReaderRef, aData));
+  checkSameMesh(aReader, aReaderRef);
+}
+
+TEST(RWStl_ReaderTest, ParallelReadMatchesSequential)
+{
+  const std::string aData = writeGrid(100, true);
+
+  CollectingReader aReader;
+  ASSERT_TRUE(readBinary(aReader, aData));
+
+  // small chunks check merging of nodes between chunks
+  CollectingReader aReaderPar;
+  aReaderPar.SetParallel(Standard_True);
+  aReaderPar.SetChunkSize(1000);
+  ASSERT_TRUE(readBinary(aReaderPar, aData));
+  checkSameMesh(aReader, aReaderPar);
+}
+
+TEST(RWStl_ReaderTest, StreamingModeBoundsBatches)
+{
+  const int         aNbCells = 50;
+  const std::string aData    = writeGrid(aNbCells, true);
+  const int         aNbTris  = 2 * aNbCells * aNbCells + 1;
+
+  StreamingReader aReader;
+  aReader.SetChunkSize(1000);
+  ASSERT_TRUE(readBinary(aReader, aData));
+  EXPECT_EQ(aNbTris, aReader.NbTriangles());
+  EXPECT_EQ((aNbTris + 999) / 1000, aReader.NbBatches());
+  EXPECT_EQ(1000, aReader.MaxBatch());
+  EXPECT_EQ(0, aReader.Nodes().Size());
+
+  // default implementation of AddTriangles() passes triangles without merging nodes
+  CollectingReader aSoupReader;
+  aSoupReader.SetStreaming(Standard_True);
+  ASSERT_TRUE(readBinary(aSoupReader, aData));
+  EXPECT_EQ(3 * aNbTris, aSoupReader.Nodes().Size());
+  EXPECT_EQ(aNbTris, aSoupReader.Triangles().Size());
+
+  // Ascii data is streamed by the same batches
+  std::stringstream anAscii;
+  anAscii << "solid grid\n";
+  for (int aTriIter = 0; aTriIter < 2500; ++aTriIter)
+  {
+    anAscii << "facet normal 0 0 1\nouter loop\nvertex 0 0 0\nvertex 1 0 0\nvertex 0 1 "
+            << aTriIter << "\nendloop\nendfacet\n";
+  }
+  anAscii << "endsolid grid\n";
+
+  StreamingReader         anAsciiReader;
+  Standard_ReadLineBuffer aBuffer(1024);
+  anAsciiReader.SetChunkSize(1000);
+  ASSERT_TRUE(anAsciiReader.ReadAscii(anAscii, aBuffer, 0, Message_ProgressRange()));
+  EXPECT_EQ(2500, anAsciiReader.NbTriangles());
+  EXPECT_EQ(3, anAsciiReader.NbBatches());
+}
+
+TEST(RWStl_ReaderTest, StreamingStopIsNotFailure)
+{
+  const std::string aData = writeGrid(50);
+
+  StreamingReader aReader;
+  aReader.SetChunkSize(1000);
+  aReader.SetMaxNbBatches(2);
+  EXPECT_FALSE(readBinary(aReader, aData));
+  EXPECT_TRUE(aReader.IsStopped());
+  EXPECT_EQ(2, aReader.NbBatches());
+
+  // the flag is reset by the next reading
+  aReader.SetMaxNbBatches(-1);
+  EXPECT_TRUE(readBinary(aReader, aData));
+  EXPECT_FALSE(aReader.IsStopped());
+
+  // truncated data is a failure rather than a stop
+  StreamingReader aTruncReader;
+  EXPECT_FALSE(readBinary(aTruncReader, aData.substr(0, 40)));
+  EXPECT_FALSE(aTruncReader.IsStopped());
+}
@@ -18,16 +18,19 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
 
@@ -41,6 +44,12 @@ static const size_t THE_STL_MIN_FILE_SIZE = THE_STL_HEADER_SIZE + THE_STL_SIZEOF
 // The length of buffer to read (in bytes)
 static const size_t THE_BUFFER_SIZE = 1024;
 
+// The number of facets decoded by one parallel task
+static const Standard_Integer THE_DECODE_BLOCK_NBFACETS = 4096;
+
+// The maximum initial number of buckets of the maps of merged nodes
+static const Standard_Integer THE_MAX_INITIAL_NBBUCKETS = 1 << 24;
+
 //! Auxiliary tool for merging nodes during STL reading.
 class MergeNodeTool : public Poly_MergeNodesTool
 {
@@ -108,28 +117,363 @@ inline static float readStlFloat(const char* theData)
 }
 
 //! Read a Little Endian 32 bits float
-inline static gp_XYZ readStlFloatVec3(const char* theData)
+inline static gp_Vec3f readStlFloatVec3(const char* theData)
+{
+  return gp_Vec3f(readStlFloat(theData),
+                  readStlFloat(theData + sizeof(float)),
+                  readStlFloat(theData + sizeof(float) * 2));
+}
+
+//! Convert single precision point to gp_XYZ.
+inline static gp_XYZ toXYZ(const gp_Vec3f& theVec)
 {
-  return gp_XYZ(readStlFloat(theData),
-                readStlFloat(theData + sizeof(float)),
-                readStlFloat(theData + sizeof(float) * 2));
+  return gp_XYZ(theVec.x(), theVec.y(), theVec.z());
 }
 
+//! Auxiliary tool reading binary STL facets by chunks and decoding them into nodes of triangles.
+//! Big chunks are decoded in parallel, as facets are records of fixed size.
+class BinaryChunkReader
+{
+public:
+  //! Constructor
+  BinaryChunkReader(const Standard_Integer theNbFacets,
+                    const Standard_Integer theChunkSize,
+                    const Standard_Boolean theToParallel)
+      : myChunkSize(Max(Min(theChunkSize, theNbFacets), 1)),
+        myBuffer(0, myChunkSize * (Standard_Integer)THE_STL_SIZEOF_FACET - 1),
+        myNodes(0, myChunkSize * 3 - 1),
+        myNbFacetsLeft(theNbFacets),
+        myToParallel(theToParallel)
+  {
+  }
+
+  //! Return nodes of the last read chunk, three per triangle.
+  const gp_Vec3f* Nodes() const { return &myNodes.First(); }
+
+  //! Read and decode the next chunk.
+  //! Returns the number of read facets, 0 if all facets have been read, or -1 on read failure.
+  Standard_Integer Read(Standard_IStream& theStream)
+  {
+    const Standard_Integer aNbFacets = Min(myChunkSize, myNbFacetsLeft);
+    if (aNbFacets <= 0)
+    {
+      return 0;
+    }
+
+    const std::streamsize aDataToRead = std::streamsize(aNbFacets) * THE_STL_SIZEOF_FACET;
+    if (theStream.read(&myBuffer.ChangeFirst(), aDataToRead).gcount() != aDataToRead)
+    {
+      return -1;
+    }
+    myNbFacetsLeft -= aNbFacets;
+
+    const Standard_Integer aNbBlocks =
+      (aNbFacets + THE_DECODE_BLOCK_NBFACETS - 1) / THE_DECODE_BLOCK_NBFACETS;
+    OSD_Parallel::For(
+      0,
+      aNbBlocks,
+      [this, aNbFacets](const Standard_Integer theBlock) {
+        const Standard_Integer aLower = theBlock * THE_DECODE_BLOCK_NBFACETS;
+        const Standard_Integer anUpper = Min(aLower + THE_DECODE_BLOCK_NBFACETS, aNbFacets);
+        decode(aLower, anUpper);
+      },
+      !myToParallel || aNbBlocks < 2);
+    return aNbFacets;
+  }
+
+private:
+  //! Decode facets within [theLower, theUpper) range of the buffer.
+  void decode(const Standard_Integer theLower, const Standard_Integer theUpper)
+  {
+    // normal + 3 nodes + 2 extra bytes
+    const size_t aVec3Size = sizeof(float) * 3;
+    for (Standard_Integer aFacetIter = theLower; aFacetIter < theUpper; ++aFacetIter)
+    {
+      // skip normal
+      const char* aData = &myBuffer.First() + size_t(aFacetIter) * THE_STL_SIZEOF_FACET + aVec3Size;
+      myNodes.ChangeValue(aFacetIter * 3)     = readStlFloatVec3(aData);
+      myNodes.ChangeValue(aFacetIter * 3 + 1) = readStlFloatVec3(aData + aVec3Size);
+      myNodes.ChangeValue(aFacetIter * 3 + 2) = readStlFloatVec3(aData + aVec3Size * 2);
+    }
+  }
+
+private:
+  Standard_Integer             myChunkSize;
+  NCollection_Array1<char>     myBuffer;
+  NCollection_Array1<gp_Vec3f> myNodes;
+  Standard_Integer             myNbFacetsLeft;
+  Standard_Boolean             myToParallel;
+};
+
+//! Hasher of nodes with exactly matching coordinates.
+struct ExactNodeHasher
+{
+  size_t operator()(const gp_Vec3f& thePos) const
+  {
+    // adding positive zero maps negative zero to positive one, as they are equal
+    const gp_Vec3f aPos(thePos.x() + 0.0f, thePos.y() + 0.0f, thePos.z() + 0.0f);
+    return opencascade::hashBytes(aPos.GetData(), sizeof(gp_Vec3f));
+  }
+
+  bool operator()(const gp_Vec3f& thePos1, const gp_Vec3f& thePos2) const
+  {
+    return thePos1.IsEqual(thePos2);
+  }
+};
+
+//! Auxiliary tool merging nodes with exactly matching coordinates regardless of the angle
+//! between triangles, which is the default mode of RWStl_Reader.
+//! Merged nodes are distributed between several maps (partitions) by their hash codes, so that
+//! the nodes of a chunk of triangles are looked up in parallel. New nodes are then passed to
+//! RWStl_Reader::AddNode() sequentially in the order of their first occurrence, so that the
+//! result does not depend on the number of partitions.
+class ExactMergeNodeTool
+{
+  //! Merged node.
+  struct MergedNode
+  {
+    Standard_Integer Id;         //!< node index returned by RWStl_Reader::AddNode()
+    Standard_Integer Occurrence; //!< first occurrence within the current chunk, or -1
+  };
+
+  //! Map of merged nodes.
+  class MapOfMergedNodes : public NCollection_DataMap<gp_Vec3f, MergedNode, ExactNodeHasher>
+  {
+  public:
+    //! Empty constructor.
+    MapOfMergedNodes() {}
+
+    //! Constructor.
+    MapOfMergedNodes(const Standard_Integer theNbBuckets)
+        : NCollection_DataMap(theNbBuckets, new NCollection_IncAllocator(1024 * 1024))
+    {
+    }
+
+    //! Return the node bound to the key, or bind the new node to the key with single lookup.
+    MergedNode* FindOrBind(const gp_Vec3f& thePos, const MergedNode& theNode)
+    {
+      if (Resizable())
+      {
+        ReSize(Extent());
+      }
+      size_t       aHash = 0;
+      DataMapNode* aNode = NULL;
+      if (lookup(thePos, aNode, aHash))
+      {
+        return &aNode->ChangeValue();
+      }
+      DataMapNode** aData = (DataMapNode**)myData1;
+      aData[aHash]        = new (this->myAllocator) DataMapNode(thePos, theNode, aData[aHash]);
+      Increment();
+      return &aData[aHash]->ChangeValue();
+    }
+  };
+
+public:
+  //! Constructor
+  ExactMergeNodeTool(RWStl_Reader*          theReader,
+                     const Standard_Integer theNbFacets,
+                     const Standard_Integer theChunkSize,
+                     const Standard_Boolean theToParallel)
+      : myReader(theReader),
+        myMaps(0, theToParallel ? Max(OSD_Parallel::NbLogicalProcessors(), 1) - 1 : 0),
+        myPartitions(0, Max(Min(theChunkSize, theNbFacets), 1) * 3 - 1),
+        myPartitionNodes(0, myMaps.Size() > 1 ? myPartitions.Upper() : 0),
+        myPartitionOffsets(0, myMaps.Size()),
+        myOccurrences(0, myPartitions.Upper()),
+        myIds(0, myPartitions.Upper()),
+        myNewNodes(0, myPartitions.Upper())
+  {
+    // consider ratio 1:2 (NbTriangles:MergedNodes) as expected, like Poly_MergeNodesTool
+    const Standard_Integer aNbBuckets =
+      Min(Max(theNbFacets, 1), THE_MAX_INITIAL_NBBUCKETS / 2) * 2 / myMaps.Size() + 1;
+    for (Standard_Integer aMapIter = myMaps.Lower(); aMapIter <= myMaps.Upper(); ++aMapIter)
+    {
+      myMaps.ChangeValue(aMapIter) = MapOfMergedNodes(aNbBuckets);
+    }
+  }
+
+  //! Add triangles defined by theNbTriangles * 3 nodes.
+  void AddTriangles(const gp_Vec3f* theNodes, const Standard_Integer theNbTriangles)
+  {
+    const Standard_Integer aNbNodes      = theNbTriangles * 3;
+    const Standard_Integer aNbPartitions = myMaps.Size();
+    if (aNbPartitions > 1)
+    {
+      const Standard_Integer aNbBlocks =
+        (aNbNodes + THE_DECODE_BLOCK_NBFACETS - 1) / THE_DECODE_BLOCK_NBFACETS;
+      OSD_Parallel::For(0, aNbBlocks, [&](const Standard_Integer theBlock) {
+        const Standard_Integer aLower  = theBlock * THE_DECODE_BLOCK_NBFACETS;
+        const Standard_Integer anUpper = Min(aLower + THE_DECODE_BLOCK_NBFACETS, aNbNodes);
+        for (Standard_Integer aNodeIter = aLower; aNodeIter < anUpper; ++aNodeIter)
+        {
+          myPartitions.ChangeValue(aNodeIter) =
+            Standard_Integer(myHasher(theNodes[aNodeIter]) % aNbPartitions);
+        }
+      });
+
+      // bucket nodes by partitions (counting sort keeping the order of occurrence),
+      // so that each partition visits only its own nodes
+      myPartitionOffsets.Init(0);
+      for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+      {
+        ++myPartitionOffsets.ChangeValue(myPartitions.Value(aNodeIter) + 1);
+      }
+      for (Standard_Integer aPartIter = 1; aPartIter <= aNbPartitions; ++aPartIter)
+      {
+        myPartitionOffsets.ChangeValue(aPartIter) += myPartitionOffsets.Value(aPartIter - 1);
+      }
+      for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+      {
+        Standard_Integer& aPos = myPartitionOffsets.ChangeValue(myPartitions.Value(aNodeIter));
+        myPartitionNodes.ChangeValue(aPos++) = aNodeIter;
+      }
+      // filling has shifted each offset to the beginning of the next partition
+      for (Standard_Integer aPartIter = aNbPartitions; aPartIter > 0; --aPartIter)
+      {
+        myPartitionOffsets.ChangeValue(aPartIter) = myPartitionOffsets.Value(aPartIter - 1);
+      }
+      myPartitionOffsets.ChangeValue(0) = 0;
+    }
+
+    // look up nodes in partitions; within a partition nodes are processed in the order
+    // of occurrence, so that the duplicates within the chunk refer to the first occurrence
+    OSD_Parallel::For(
+      0,
+      aNbPartitions,
+      [&](const Standard_Integer thePartition) {
+        MapOfMergedNodes&      aMap    = myMaps.ChangeValue(thePartition);
+        const Standard_Integer aLower  = aNbPartitions > 1 ? myPartitionOffsets(thePartition) : 0;
+        const Standard_Integer anUpper =
+          aNbPartitions > 1 ? myPartitionOffsets(thePartition + 1) : aNbNodes;
+        for (Standard_Integer aBucketIter = aLower; aBucketIter < anUpper; ++aBucketIter)
+        {
+          const Standard_Integer aNodeIter =
+            aNbPartitions > 1 ? myPartitionNodes.Value(aBucketIter) : aBucketIter;
+          const MergedNode aNewNode = {0, aNodeIter};
+          MergedNode*      aNode    = aMap.FindOrBind(theNodes[aNodeIter], aNewNode);
+          myNewNodes.ChangeValue(aNodeIter)    = aNode;
+          myOccurrences.ChangeValue(aNodeIter) = aNode->Occurrence;
+          myIds.ChangeValue(aNodeIter)         = aNode->Id;
+        }
+      },
+      aNbPartitions == 1);
+
+    for (Standard_Integer aTriIter = 0; aTriIter < theNbTriangles; ++aTriIter)
+    {
+      Standard_Integer aNodesRes[3] = {-1, -1, -1};
+      for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+      {
+        const Standard_Integer aNodeIndex  = aTriIter * 3 + aNodeIter;
+        const Standard_Integer anOccurence = myOccurrences.Value(aNodeIndex);
+        if (anOccurence == aNodeIndex)
+        {
+          MergedNode* aNewNode          = myNewNodes.Value(aNodeIndex);
+          aNewNode->Id                  = myReader->AddNode(toXYZ(theNodes[aNodeIndex]));
+          aNewNode->Occurrence          = -1;
+          myIds.ChangeValue(aNodeIndex) = aNewNode->Id;
+        }
+        else if (anOccurence >= 0)
+        {
+          myIds.ChangeValue(aNodeIndex) = myIds.Value(anOccurence);
+        }
+        aNodesRes[aNodeIter] = myIds.Value(aNodeIndex);
+      }
+
+      if (aNodesRes[0] != aNodesRes[1] && aNodesRes[1] != aNodesRes[2]
+          && aNodesRes[2] != aNodesRes[0])
+      {
+        myReader->AddTriangle(aNodesRes[0], aNodesRes[1], aNodesRes[2]);
+      }
+    }
+  }
+
+private:
+  RWStl_Reader*                        myReader;
+  NCollection_Array1<MapOfMergedNodes> myMaps;
+  NCollection_Array1<Standard_Integer> myPartitions;
+  NCollection_Array1<Standard_Integer> myPartitionNodes;
+  NCollection_Array1<Standard_Integer> myPartitionOffsets;
+  NCollection_Array1<Standard_Integer> myOccurrences;
+  NCollection_Array1<Standard_Integer> myIds;
+  NCollection_Array1<MergedNode*>      myNewNodes;
+  ExactNodeHasher                      myHasher;
+};
+
+//! Auxiliary tool collecting triangles for RWStl_Reader::AddTriangles() in streaming mode.
+class TriangleBatch
+{
+public:
+  //! Constructor
+  TriangleBatch(RWStl_Reader* theReader, const Standard_Integer theBatchSize)
+      : myReader(theReader),
+        myNodes(0, theBatchSize * 3 - 1),
+        myNbTriangles(0)
+  {
+  }
+
+  //! Add triangle; returns FALSE if reading should be stopped.
+  Standard_Boolean AddTriangle(const gp_XYZ theElemNodes[3])
+  {
+    for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      myNodes.ChangeValue(myNbTriangles * 3 + aNodeIter) =
+        gp_Vec3f((float)theElemNodes[aNodeIter].X(),
+                 (float)theElemNodes[aNodeIter].Y(),
+                 (float)theElemNodes[aNodeIter].Z());
+    }
+    return ++myNbTriangles * 3 <= myNodes.Upper() || Flush();
+  }
+
+  //! Pass collected triangles to the reader; returns FALSE if reading should be stopped.
+  Standard_Boolean Flush()
+  {
+    const Standard_Integer aNbTriangles = myNbTriangles;
+    myNbTriangles                       = 0;
+    return aNbTriangles == 0 || myReader->AddTriangles(&myNodes.First(), aNbTriangles);
+  }
+
+private:
+  RWStl_Reader*                myReader;
+  NCollection_Array1<gp_Vec3f> myNodes;
+  Standard_Integer             myNbTriangles;
+};
+
 } // namespace
 
 //=================================================================================================
 
 RWStl_Reader::RWStl_Reader()
     : myMergeAngle(M_PI / 2.0),
-      myMergeTolearance(0.0)
+      myMergeTolearance(0.0),
+      myChunkSize(65536),
+      myIsStreaming(Standard_False),
+      myToParallel(Standard_False),
+      myIsStopped(Standard_False)
 {
   //
 }
 
 //=================================================================================================
 
+Standard_Boolean RWStl_Reader::AddTriangles(const gp_Vec3f*        theNodes,
+                                            const Standard_Integer theNbTriangles)
+{
+  for (Standard_Integer aTriIter = 0; aTriIter < theNbTriangles; ++aTriIter)
+  {
+    const Standard_Integer aNode1 = AddNode(toXYZ(theNodes[aTriIter * 3]));
+    const Standard_Integer aNode2 = AddNode(toXYZ(theNodes[aTriIter * 3 + 1]));
+    const Standard_Integer aNode3 = AddNode(toXYZ(theNodes[aTriIter * 3 + 2]));
+    AddTriangle(aNode1, aNode2, aNode3);
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
 Standard_Boolean RWStl_Reader::Read(const char* theFile, const Message_ProgressRange& theProgress)
 {
+  myIsStopped = Standard_False;
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::istream> aStream =
     aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
@@ -283,6 +627,8 @@ Standard_Boolean RWStl_Reader::ReadAscii(Standard_IStream&            theStream,
                                          const std::streampos         theUntilPos,
                                          const Message_ProgressRange& theProgress)
 {
+  myIsStopped = Standard_False;
+
   // use method seekpos() to get true 64-bit offset to enable
   // handling of large files (VS 2010 64-bit)
   const int64_t aStartPos = GETPOS(theStream.tellg());
@@ -305,6 +651,7 @@ Standard_Boolean RWStl_Reader::ReadAscii(Standard_IStream&            theStream,
   MergeNodeTool aMergeTool(this);
   aMergeTool.SetMergeAngle(myMergeAngle);
   aMergeTool.SetMergeTolerance(myMergeTolearance);
+  TriangleBatch aBatch(this, myIsStreaming ? myChunkSize : 1);
 
   Standard_CLocaleSentry::clocale_t aLocale = Standard_CLocaleSentry::GetCLocale();
   (void)aLocale; // to avoid warning on GCC where it is actually not used
@@ -385,7 +732,15 @@ Standard_Boolean RWStl_Reader::ReadAscii(Standard_IStream&            theStream,
     aNbLine += 5;
 
     // add triangle
-    aMergeTool.AddTriangle(aVertex);
+    if (!myIsStreaming)
+    {
+      aMergeTool.AddTriangle(aVertex);
+    }
+    else if (!aBatch.AddTriangle(aVertex))
+    {
+      myIsStopped = Standard_True;
+      return false;
+    }
 
     theBuffer.ReadLine(theStream, aLineLen); // skip "endloop"
     theBuffer.ReadLine(theStream, aLineLen); // skip "endfacet"
@@ -393,6 +748,11 @@ Standard_Boolean RWStl_Reader::ReadAscii(Standard_IStream&            theStream,
     aNbLine += 2;
   }
 
+  if (!aBatch.Flush())
+  {
+    myIsStopped = Standard_True;
+    return false;
+  }
   return aPS.More();
 }
 
@@ -414,6 +774,8 @@ Standard_Boolean RWStl_Reader::ReadBinary(Standard_IStream&            theStream
     THE_STL_SIZEOF_FACET);
   */
 
+  myIsStopped = Standard_False;
+
   // read file header at first
   char aHeader[THE_STL_HEADER_SIZE + 1];
   if (theStream.read(aHeader, THE_STL_HEADER_SIZE).gcount() != std::streamsize(THE_STL_HEADER_SIZE))
@@ -425,46 +787,66 @@ Standard_Boolean RWStl_Reader::ReadBinary(Standard_IStream&            theStream
   // number of facets is stored as 32-bit integer at position 80
   const Standard_Integer aNbFacets = *(int32_t*)(aHeader + 80);
 
-  MergeNodeTool aMergeTool(this, aNbFacets);
-  aMergeTool.SetMergeAngle(myMergeAngle);
-  aMergeTool.SetMergeTolerance(myMergeTolearance);
-
   // don't trust the number of triangles which is coded in the file
   // sometimes it is wrong, and with this technique we don't need to swap endians for integer
   Message_ProgressScope aPS(theProgress, "Reading binary STL file", aNbFacets);
-  Standard_Integer      aNbRead = 0;
-
-  // allocate buffer for 80 triangles
-  const int THE_CHUNK_NBFACETS = 80;
-  char      aBuffer[THE_STL_SIZEOF_FACET * THE_CHUNK_NBFACETS];
-
-  // normal + 3 nodes + 2 extra bytes
-  const size_t     aVec3Size        = sizeof(float) * 3;
-  const size_t     aFaceDataLen     = aVec3Size * 4 + 2;
-  const char*      aBufferPtr       = aBuffer;
-  Standard_Integer aNbFacesInBuffer = 0;
-  for (Standard_Integer aNbFacetRead = 0; aNbFacetRead < aNbFacets && aPS.More();
-       ++aNbFacetRead, ++aNbRead, --aNbFacesInBuffer, aBufferPtr += aFaceDataLen, aPS.Next())
+  BinaryChunkReader     aChunkReader(aNbFacets, myChunkSize, myToParallel);
+
+  // nodes with exactly matching coordinates (default mode) are merged by chunks,
+  // other modes are handled by Poly_MergeNodesTool triangle by triangle
+  const Standard_Boolean isExactMerge =
+    !myIsStreaming && myMergeTolearance <= 0.0 && myMergeAngle > 0.0 && Cos(myMergeAngle) <= 0.01;
+  std::unique_ptr<ExactMergeNodeTool> anExactMergeTool;
+  std::unique_ptr<MergeNodeTool>      aMergeTool;
+  if (isExactMerge)
+  {
+    anExactMergeTool.reset(new ExactMergeNodeTool(this, aNbFacets, myChunkSize, myToParallel));
+  }
+  else if (!myIsStreaming)
   {
-    // read more data
-    if (aNbFacesInBuffer <= 0)
+    aMergeTool.reset(new MergeNodeTool(this, aNbFacets));
+    aMergeTool->SetMergeAngle(myMergeAngle);
+    aMergeTool->SetMergeTolerance(myMergeTolearance);
+  }
+
+  for (Standard_Integer aNbRead = aChunkReader.Read(theStream); aNbRead != 0;
+       aNbRead                  = aChunkReader.Read(theStream))
+  {
+    if (aNbRead < 0)
     {
-      aNbFacesInBuffer                  = Min(THE_CHUNK_NBFACETS, aNbFacets - aNbFacetRead);
-      const std::streamsize aDataToRead = aNbFacesInBuffer * aFaceDataLen;
-      if (theStream.read(aBuffer, aDataToRead).gcount() != aDataToRead)
+      Message::SendFail("Error: binary STL read failed");
+      return false;
+    }
+
+    const gp_Vec3f* aNodes = aChunkReader.Nodes();
+    if (myIsStreaming)
+    {
+      if (!AddTriangles(aNodes, aNbRead))
       {
-        Message::SendFail("Error: binary STL read failed");
+        myIsStopped = Standard_True;
         return false;
       }
-      aBufferPtr = aBuffer;
+    }
+    else if (isExactMerge)
+    {
+      anExactMergeTool->AddTriangles(aNodes, aNbRead);
+    }
+    else
+    {
+      for (Standard_Integer aTriIter = 0; aTriIter < aNbRead; ++aTriIter)
+      {
+        const gp_XYZ aTriNodes[3] = {toXYZ(aNodes[aTriIter * 3]),
+                                     toXYZ(aNodes[aTriIter * 3 + 1]),
+                                     toXYZ(aNodes[aTriIter * 3 + 2])};
+        aMergeTool->AddTriangle(aTriNodes);
+      }
     }
 
-    // get points from buffer
-    //    readStlFloatVec3 (aBufferPtr); // skip normal
-    gp_XYZ aTriNodes[3] = {readStlFloatVec3(aBufferPtr + aVec3Size),
-                           readStlFloatVec3(aBufferPtr + aVec3Size * 2),
-                           readStlFloatVec3(aBufferPtr + aVec3Size * 3)};
-    aMergeTool.AddTriangle(aTriNodes);
+    aPS.Next(aNbRead);
+    if (!aPS.More())
+    {
+      return false;
+    }
   }
 
   return aPS.More();
@@ -16,6 +16,7 @@
 #ifndef _RWStl_Reader_HeaderFile
 #define _RWStl_Reader_HeaderFile
 
+#include <gp_Vec3f.hxx>
 #include <gp_XYZ.hxx>
 #include <Standard_ReadLineBuffer.hxx>
 #include <Standard_IStream.hxx>
@@ -32,6 +33,12 @@ class Message_ProgressRange;
 //! addNode() and addTriangle() to fill the mesh data structure.
 //!
 //! The nodes with equal coordinates are merged automatically  on the fly.
+//!
+//! Binary STL data is read and decoded by chunks of facets (see SetChunkSize()), optionally in
+//! parallel threads (see SetParallel()); nodes with exactly matching coordinates are merged in
+//! parallel as well. Alternatively, in streaming mode (see SetStreaming()) triangles are passed
+//! to method AddTriangles() by chunks without merging nodes, so that the memory used for reading
+//! is bounded by the chunk size regardless of the size of the file.
 class RWStl_Reader : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
@@ -92,6 +99,15 @@ public:
   //! Should create a new triangulation for a solid in multi-domain case.
   virtual void AddSolid() {}
 
+  //! Callback function receiving triangles in streaming mode, see SetStreaming().
+  //! The nodes of triangles are passed as array of theNbTriangles * 3 single precision points
+  //! (nodes are not merged), which is valid only within the call.
+  //! Default implementation passes the triangles to AddNode() and AddTriangle().
+  //! Should return FALSE to stop reading; in this case reading methods return false
+  //! and IsStopped() returns true, which distinguishes the stop from a reading failure.
+  Standard_EXPORT virtual Standard_Boolean AddTriangles(const gp_Vec3f*        theNodes,
+                                                        const Standard_Integer theNbTriangles);
+
 public:
   //! Return merge tolerance; M_PI/2 by default - all nodes are merged regardless angle between
   //! triangles.
@@ -109,9 +125,35 @@ public:
   //! Set linear merge tolerance.
   void SetMergeTolerance(double theTolerance) { myMergeTolearance = theTolerance; }
 
+  //! Return TRUE if triangles are passed to AddTriangles() by chunks without merging nodes;
+  //! FALSE by default.
+  Standard_Boolean IsStreaming() const { return myIsStreaming; }
+
+  //! Set streaming mode.
+  void SetStreaming(Standard_Boolean theIsStreaming) { myIsStreaming = theIsStreaming; }
+
+  //! Return number of facets read and decoded at once; 65536 by default.
+  Standard_Integer ChunkSize() const { return myChunkSize; }
+
+  //! Set number of facets read and decoded at once.
+  void SetChunkSize(Standard_Integer theNbFacets) { myChunkSize = Max(theNbFacets, 1); }
+
+  //! Return flag to decode binary STL and merge nodes in parallel threads; FALSE by default.
+  Standard_Boolean ToParallel() const { return myToParallel; }
+
+  //! Set flag to decode binary STL and merge nodes in parallel threads.
+  void SetParallel(Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
+  //! Return TRUE if the last reading has been stopped by AddTriangles() returning FALSE.
+  Standard_Boolean IsStopped() const { return myIsStopped; }
+
 protected:
-  Standard_Real myMergeAngle;
-  Standard_Real myMergeTolearance;
+  Standard_Real    myMergeAngle;
+  Standard_Real    myMergeTolearance;
+  Standard_Integer myChunkSize;
+  Standard_Boolean myIsStreaming;
+  Standard_Boolean myToParallel;
+  Standard_Boolean myIsStopped;
 };
 
 #endif
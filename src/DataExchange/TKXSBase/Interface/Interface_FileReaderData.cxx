@@ -32,12 +32,8 @@ IMPLEMENT_STANDARD_RTTIEXT(Interface_FileReaderData, Standard_Transient)
 //  Each standard can use it as a base (literal parameter lists,
 //  associated entities) and add its own data to it.
 //  Works under the control of FileReaderTool
-//  Optimization : Fields not possible, because Param is const. Too bad
-//  So, we assume that we read one file at a time (reasonable assumption)
-//  We note in field a file number, relative to which we optimize
-static Standard_Integer thefic = 0;
-static Standard_Integer thenm0 = -1;
-static Standard_Integer thenp0 = -1;
+//  Parameters are accessed without any shared cache, so that records
+//  can be read concurrently (see Interface_FileReaderTool::SetParallel)
 
 Interface_FileReaderData::Interface_FileReaderData(const Standard_Integer nbr,
                                                    const Standard_Integer npar)
@@ -47,8 +43,6 @@ Interface_FileReaderData::Interface_FileReaderData(const Standard_Integer nbr,
 {
   theparams = new Interface_ParamSet(npar);
   thenumpar.Init(0);
-  thenm0  = -1;
-  thenum0 = ++thefic;
 }
 
 Standard_Integer Interface_FileReaderData::NbRecords() const
@@ -124,27 +118,13 @@ Handle(Interface_ParamList) Interface_FileReaderData::Params(const Standard_Inte
 const Interface_FileParameter& Interface_FileReaderData::Param(const Standard_Integer num,
                                                                const Standard_Integer nump) const
 {
-  if (thefic != thenum0)
-    return theparams->Param(thenumpar(num - 1) + nump);
-  if (thenm0 != num)
-  {
-    thenp0 = thenumpar(num - 1);
-    thenm0 = num;
-  }
-  return theparams->Param(thenp0 + nump);
+  return theparams->Param(thenumpar(num - 1) + nump);
 }
 
 Interface_FileParameter& Interface_FileReaderData::ChangeParam(const Standard_Integer num,
                                                                const Standard_Integer nump)
 {
-  if (thefic != thenum0)
-    return theparams->ChangeParam(thenumpar(num - 1) + nump);
-  if (thenm0 != num)
-  {
-    thenp0 = thenumpar(num - 1);
-    thenm0 = num;
-  }
-  return theparams->ChangeParam(thenp0 + nump);
+  return theparams->ChangeParam(thenumpar(num - 1) + nump);
 }
 
 Interface_ParamType Interface_FileReaderData::ParamType(const Standard_Integer num,
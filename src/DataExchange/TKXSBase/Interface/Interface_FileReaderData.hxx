@@ -211,7 +211,6 @@ protected:
                                      Standard_Integer&      nump) const;
 
 private:
-  Standard_Integer           thenum0;
   Standard_Integer           therrload;
   Handle(Interface_ParamSet) theparams;
   TColStd_Array1OfInteger    thenumpar;
@@ -26,6 +26,8 @@
 #include <Interface_ReportEntity.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
@@ -55,6 +57,7 @@ Interface_FileReaderTool::Interface_FileReaderTool()
 {
   themessenger = Message::DefaultMessenger();
   theerrhand   = Standard_True;
+  theparallel  = Standard_False;
   thetrace     = 0;
   thenbrep0 = thenbreps = 0;
 }
@@ -141,6 +144,20 @@ Standard_Boolean Interface_FileReaderTool::ErrorHandle() const
   return theerrhand;
 }
 
+//=================================================================================================
+
+void Interface_FileReaderTool::SetParallel(const Standard_Boolean theIsParallel)
+{
+  theparallel = theIsParallel;
+}
+
+//=================================================================================================
+
+Standard_Boolean Interface_FileReaderTool::IsParallel() const
+{
+  return theparallel;
+}
+
 //  ....            Actions Related to MODEL LOADING            ....
 
 // SetEntities calls methods to be provided :
@@ -291,6 +308,10 @@ void Interface_FileReaderTool::LoadModel(const Handle(Interface_InterfaceModel)&
 
   amodel->Reservate(thereader->NbEntities());
 
+  //  Records are decoded concurrently, entities are then added in file order
+  if (theparallel)
+    AnalyseRecords();
+
   Standard_Integer num, num0 = thereader->FindNextRecord(0);
   num = num0;
 
@@ -478,6 +499,40 @@ void Interface_FileReaderTool::LoadModel(const Handle(Interface_InterfaceModel)&
   }
   else
     EndRead(amodel); // selon la norme
+
+  thedecoded.Nullify();
+}
+
+//=================================================================================================
+
+void Interface_FileReaderTool::AnalyseRecords()
+{
+  NCollection_Vector<Standard_Integer> aRecords;
+  for (Standard_Integer num = thereader->FindNextRecord(0); num > 0;
+       num                  = thereader->FindNextRecord(num))
+  {
+    aRecords.Append(num);
+  }
+  thedecoded = new TColStd_HArray1OfTransient(1, thereader->NbRecords());
+
+  // Each record fills only its own entity and check; references to other
+  // entities have been bound by SetEntities, so they are only read here
+  OSD_Parallel::For(0, aRecords.Length(), [&](const Standard_Integer theIndex) {
+    const Standard_Integer     aNum   = aRecords.Value(theIndex);
+    Handle(Standard_Transient) anEnt  = thereader->BoundEntity(aNum);
+    Handle(Interface_Check)    aCheck = new Interface_Check(anEnt);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      AnalyseRecord(aNum, anEnt, aCheck);
+    }
+    catch (Standard_Failure const&)
+    {
+      // record is left to sequential loading, which manages the recovery
+      return;
+    }
+    thedecoded->SetValue(aNum, aCheck);
+  });
 }
 
 //=================================================================================================
@@ -512,7 +567,14 @@ Handle(Standard_Transient) Interface_FileReaderTool::LoadedEntity(const Standard
     }
   }
   //  ..        Actual Loading : Standard Specific        ..
-  AnalyseRecord(num, anent, ach);
+  //  (already done if the record has been decoded by AnalyseRecords)
+  Handle(Interface_Check) aDecoded;
+  if (!thedecoded.IsNull())
+    aDecoded = Handle(Interface_Check)::DownCast(thedecoded->Value(num));
+  if (aDecoded.IsNull())
+    AnalyseRecord(num, anent, ach);
+  else
+    ach->GetMessages(aDecoded);
 
   //  ..        Adding to the model the entity as is        ..
   //            WARNING, ReportEntity processed in block after Load
@@ -573,4 +635,5 @@ void Interface_FileReaderTool::Clear()
   thereader.Nullify();
   themodel.Nullify();
   thereports.Nullify();
+  thedecoded.Nullify();
 }
@@ -95,6 +95,18 @@ public:
   //! Returns ErrorHandle flag
   Standard_EXPORT Standard_Boolean ErrorHandle() const;
 
+  //! Allows decoding records into their entities concurrently.
+  //! When set, LoadModel first runs AnalyseRecord for all data records
+  //! in parallel, then adds entities to the Model and builds reports
+  //! sequentially in record order, so the resulting Model is the same
+  //! as for sequential loading.
+  //! AnalyseRecord must be reentrant for distinct records to use this mode.
+  //! Default is False
+  Standard_EXPORT void SetParallel(const Standard_Boolean theIsParallel);
+
+  //! Returns Parallel flag
+  Standard_EXPORT Standard_Boolean IsParallel() const;
+
   //! Fills records with empty entities; once done, each entity can
   //! ask the FileReaderTool for any entity referenced through an
   //! identifier. Calls Recognize which is specific to each specific
@@ -188,6 +200,11 @@ public:
   Standard_EXPORT void Clear();
 
 protected:
+  //! Runs AnalyseRecord concurrently for all data records and stores
+  //! the resulting checks, to be consumed later by LoadedEntity.
+  //! Records which raised an exception are left to sequential loading.
+  Standard_EXPORT void AnalyseRecords();
+
   //! Constructor; sets default fields
   Standard_EXPORT Interface_FileReaderTool();
 
@@ -198,9 +215,11 @@ private:
   Handle(Message_Messenger)          themessenger;
   Standard_Integer                   thetrace;
   Standard_Boolean                   theerrhand;
+  Standard_Boolean                   theparallel;
   Standard_Integer                   thenbrep0;
   Standard_Integer                   thenbreps;
   Handle(TColStd_HArray1OfTransient) thereports;
+  Handle(TColStd_HArray1OfTransient) thedecoded;
 };
 
 #endif // _Interface_FileReaderTool_HeaderFile
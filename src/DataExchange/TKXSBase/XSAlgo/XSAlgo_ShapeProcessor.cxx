@@ -711,6 +711,10 @@ void XSAlgo_ShapeProcessor::FillParameterMap(const DE_ShapeFixParameters&
                theParameters.FixVertexToleranceMode,
                theIsReplace,
                theMap);
+  SetParameter("FixShape.RunParallel",
+               TCollection_AsciiString(static_cast<int>(theParameters.RunParallel)),
+               theIsReplace,
+               theMap);
 }
 
 //=============================================================================
@@ -138,6 +138,14 @@ Handle(Transfer_ActorOfTransientProcess) XSControl_Controller::ActorRead(
 
 //=================================================================================================
 
+Handle(Transfer_ActorOfTransientProcess) XSControl_Controller::NewActorRead(
+  const Handle(Interface_InterfaceModel)&) const
+{
+  return Handle(Transfer_ActorOfTransientProcess)();
+}
+
+//=================================================================================================
+
 Handle(Transfer_ActorOfFinderProcess) XSControl_Controller::ActorWrite() const
 {
   return myAdaptorWrite;
@@ -111,6 +111,15 @@ public:
   Standard_EXPORT virtual Handle(Transfer_ActorOfTransientProcess) ActorRead(
     const Handle(Interface_InterfaceModel)& model) const;
 
+  //! Creates a new Actor for Read, independent from the one returned by ActorRead(),
+  //! so that several transfers of the same Model can run concurrently.
+  //! It is called sequentially before the concurrent transfers, so it is the place
+  //! to prepare the data shared by them (e.g. units of the Model): the transfers
+  //! themselves should only read the Model.
+  //! Returns a Null Handle by default, which means that parallel transfer is not supported.
+  Standard_EXPORT virtual Handle(Transfer_ActorOfTransientProcess) NewActorRead(
+    const Handle(Interface_InterfaceModel)& theModel) const;
+
   //! Returns the Actor for Write attached to the pair (norm,appli)
   //! Read from field. Can be redefined
   Standard_EXPORT virtual Handle(Transfer_ActorOfFinderProcess) ActorWrite() const;
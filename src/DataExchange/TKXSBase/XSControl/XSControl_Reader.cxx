@@ -258,7 +258,22 @@ Standard_Integer XSControl_Reader::TransferRoots(const Message_ProgressRange& th
   TR->BeginTransfer();
   InitializeMissingParameters();
   ClearShapes();
-  ShapeExtend_Explorer  STU;
+  ShapeExtend_Explorer STU;
+  if (TR->IsParallel() && nb > 1)
+  {
+    Handle(TColStd_HSequenceOfTransient) aRoots = new TColStd_HSequenceOfTransient(theroots);
+    TR->TransferList(aRoots, Standard_True, theProgress);
+    for (i = 1; i <= nb; i++)
+    {
+      TopoDS_Shape sh = TR->ShapeResult(theroots.Value(i));
+      if (STU.ShapeType(sh, Standard_True) == TopAbs_SHAPE)
+        continue; // nulle-vide
+      theshapes.Append(sh);
+      nbt++;
+    }
+    return nbt;
+  }
+
   Message_ProgressScope PS(theProgress, "Root", nb);
   for (i = 1; i <= nb && PS.More(); i++)
   {
@@ -276,6 +291,20 @@ Standard_Integer XSControl_Reader::TransferRoots(const Message_ProgressRange& th
 
 //=================================================================================================
 
+void XSControl_Reader::SetParallelTransfer(const Standard_Boolean theIsParallel)
+{
+  thesession->TransferReader()->SetParallel(theIsParallel);
+}
+
+//=================================================================================================
+
+Standard_Boolean XSControl_Reader::IsParallelTransfer() const
+{
+  return thesession->TransferReader()->IsParallel();
+}
+
+//=================================================================================================
+
 void XSControl_Reader::ClearShapes()
 {
   theshapes.Clear();
@@ -196,6 +196,14 @@ public:
   Standard_EXPORT Standard_Integer
     TransferRoots(const Message_ProgressRange& theProgress = Message_ProgressRange());
 
+  //! Sets the parallel mode of TransferRoots() (OFF by default).
+  //! Roots which share no translated sub-entity are then translated concurrently,
+  //! see XSControl_TransferReader::SetParallel().
+  Standard_EXPORT void SetParallelTransfer(const Standard_Boolean theIsParallel);
+
+  //! Returns the parallel mode of TransferRoots()
+  Standard_EXPORT Standard_Boolean IsParallelTransfer() const;
+
   //! Clears the list of shapes that
   //! may have accumulated in calls to TransferOne or TransferRoot.C
   Standard_EXPORT void ClearShapes();
@@ -26,6 +26,9 @@
 #include <Interface_MSG.hxx>
 #include <Interface_Static.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeFix.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
@@ -51,6 +54,61 @@
 #include <stdio.h>
 IMPLEMENT_STANDARD_RTTIEXT(XSControl_TransferReader, Standard_Transient)
 
+namespace
+{
+//! Group of entities of the list transferred by its own Actor and TransientProcess
+struct XSControl_TransferJob
+{
+  NCollection_Vector<Standard_Integer> Items;    //!< indices of entities in the list
+  Handle(Transfer_TransientProcess)    Process;  //!< process receiving the binders of the group
+  Message_ProgressRange                Progress; //!< progress range of the group
+};
+
+//! Functor transferring the groups of entities concurrently
+class XSControl_TransferJobFunctor
+{
+public:
+  XSControl_TransferJobFunctor(NCollection_Vector<XSControl_TransferJob>&  theJobs,
+                               const Handle(TColStd_HSequenceOfTransient)& theList,
+                               const Handle(Interface_InterfaceModel)&     theModel)
+      : myJobs(theJobs),
+        myList(theList),
+        myModel(theModel)
+  {
+  }
+
+  void operator()(const Standard_Integer theIndex) const
+  {
+    XSControl_TransferJob&  aJob = myJobs.ChangeValue(theIndex);
+    Transfer_TransferOutput aTransfer(aJob.Process, myModel);
+    Message_ProgressScope   aPS(aJob.Progress, NULL, aJob.Items.Length());
+    for (NCollection_Vector<Standard_Integer>::Iterator anIter(aJob.Items);
+         anIter.More() && aPS.More();
+         anIter.Next())
+    {
+      aTransfer.Transfer(myList->Value(anIter.Value()), aPS.Next());
+    }
+  }
+
+private:
+  NCollection_Vector<XSControl_TransferJob>& myJobs;
+  Handle(TColStd_HSequenceOfTransient)       myList;
+  Handle(Interface_InterfaceModel)           myModel;
+};
+
+//! Returns the representative of the group in the union-find forest
+Standard_Integer findGroup(NCollection_Array1<Standard_Integer>& theParents,
+                           Standard_Integer                      theItem)
+{
+  while (theParents(theItem) != theItem)
+  {
+    theParents(theItem) = theParents(theParents(theItem));
+    theItem             = theParents(theItem);
+  }
+  return theItem;
+}
+} // namespace
+
 //=================================================================================================
 
 void XSControl_TransferReader::SetController(const Handle(XSControl_Controller)& control)
@@ -877,6 +935,13 @@ Standard_Integer XSControl_TransferReader::TransferList(
     sout << "\n*******************************************************************\n";
   }
 
+  if (myIsParallel && nb > 1)
+  {
+    const Standard_Integer aNbTransferred = transferParallel(list, rec, theProgress);
+    if (aNbTransferred >= 0)
+      return aNbTransferred;
+  }
+
   //  only difference between TransferRoots and TransferOne
   Standard_Integer res = 0;
   nb                   = list->Length();
@@ -902,6 +967,148 @@ Standard_Integer XSControl_TransferReader::TransferList(
   return res;
 }
 
+//=================================================================================================
+
+Standard_Integer XSControl_TransferReader::transferParallel(
+  const Handle(TColStd_HSequenceOfTransient)& theList,
+  const Standard_Boolean                      theRec,
+  const Message_ProgressRange&                theProgress)
+{
+  if (myController.IsNull())
+    return -1;
+
+  const Standard_Integer aNbItems = theList->Length();
+  for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+  {
+    // entities from another model are reported by the sequential transfer
+    if (myModel->Number(theList->Value(anItemIter)) == 0)
+      return -1;
+  }
+
+  Handle(Interface_HGraph) aHGraph = myGraph;
+  if (aHGraph.IsNull())
+    aHGraph = new Interface_HGraph(myModel);
+  const Interface_Graph& aGraph = aHGraph->Graph();
+
+  // Group the entities which share a sub-entity recognized by the Actor:
+  // the binder of such sub-entity must be the same for all of them
+  const Standard_Integer               aNbEntities = myModel->NbEntities();
+  NCollection_Array1<Standard_Integer> aParents(1, aNbItems);
+  NCollection_Array1<Standard_Integer> anOwners(1, aNbEntities);
+  NCollection_Array1<Standard_Integer> aVisited(1, aNbEntities);
+  anOwners.Init(0);
+  aVisited.Init(0);
+  NCollection_Vector<Standard_Integer> aStack;
+  for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+  {
+    aParents(anItemIter) = anItemIter;
+    const Standard_Integer aNumItem = myModel->Number(theList->Value(anItemIter));
+    aStack.Append(aNumItem);
+    while (!aStack.IsEmpty())
+    {
+      const Standard_Integer aNum = aStack.Last();
+      aStack.EraseLast();
+      if (aVisited(aNum) == anItemIter)
+        continue;
+      aVisited(aNum)                          = anItemIter;
+      const Handle(Standard_Transient)& anEnt = myModel->Value(aNum);
+      if (aNum == aNumItem || myActor->Recognize(anEnt))
+      {
+        if (anOwners(aNum) == 0)
+          anOwners(aNum) = anItemIter;
+        else
+          aParents(findGroup(aParents, anItemIter)) = findGroup(aParents, anOwners(aNum));
+      }
+      for (Interface_EntityIterator aShareds = aGraph.Shareds(anEnt); aShareds.More();
+           aShareds.Next())
+      {
+        aStack.Append(aGraph.EntityNumber(aShareds.Value()));
+      }
+    }
+  }
+
+  NCollection_Vector<XSControl_TransferJob> aJobs;
+  NCollection_Array1<Standard_Integer>      aJobIndices(1, aNbItems);
+  aJobIndices.Init(-1);
+  for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+  {
+    const Standard_Integer aGroup = findGroup(aParents, anItemIter);
+    if (aJobIndices(aGroup) < 0)
+    {
+      aJobIndices(aGroup) = aJobs.Length();
+      aJobs.Appended();
+    }
+    aJobs.ChangeValue(aJobIndices(aGroup)).Items.Append(anItemIter);
+  }
+  if (aJobs.Length() < 2)
+    return -1;
+
+  for (NCollection_Vector<XSControl_TransferJob>::Iterator aJobIter(aJobs); aJobIter.More();
+       aJobIter.Next())
+  {
+    XSControl_TransferJob&                   aJob    = aJobIter.ChangeValue();
+    Handle(Transfer_ActorOfTransientProcess) anActor = myController->NewActorRead(myModel);
+    if (anActor.IsNull())
+      return -1;
+    anActor->SetShapeFixParameters(myActor->GetShapeFixParameters());
+    if (myActor->GetProcessingFlags().second)
+      anActor->SetProcessingFlags(myActor->GetProcessingFlags().first);
+
+    aJob.Process = new Transfer_TransientProcess(aNbEntities);
+    aJob.Process->SetActor(anActor);
+    aJob.Process->SetErrorHandle(Standard_True);
+    aJob.Process->SetMessenger(myTP->Messenger());
+    aJob.Process->SetTraceLevel(myTP->TraceLevel());
+    aJob.Process->SetGraph(aHGraph);
+    aJob.Process->Context() = myTP->Context();
+  }
+
+  Message_ProgressScope aPS(theProgress, NULL, aNbItems);
+  for (NCollection_Vector<XSControl_TransferJob>::Iterator aJobIter(aJobs); aJobIter.More();
+       aJobIter.Next())
+  {
+    aJobIter.ChangeValue().Progress = aPS.Next(aJobIter.Value().Items.Length());
+  }
+
+  XSControl_TransferJobFunctor aFunctor(aJobs, theList, myModel);
+  OSD_Parallel::For(0, aJobs.Length(), aFunctor);
+  if (!aPS.More())
+    return 0;
+
+  // Merge binders, the first group binding an entity wins
+  for (NCollection_Vector<XSControl_TransferJob>::Iterator aJobIter(aJobs); aJobIter.More();
+       aJobIter.Next())
+  {
+    const Handle(Transfer_TransientProcess)& aJobTP = aJobIter.Value().Process;
+    for (Standard_Integer aMapIter = 1; aMapIter <= aJobTP->NbMapped(); ++aMapIter)
+    {
+      const Handle(Standard_Transient)& aStart  = aJobTP->Mapped(aMapIter);
+      Handle(Transfer_Binder)           aBinder = aJobTP->MapItem(aMapIter);
+      if (!aBinder.IsNull() && myTP->Find(aStart).IsNull())
+        myTP->Bind(aStart, aBinder);
+    }
+  }
+
+  Standard_Integer aNbResults = 0;
+  for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+  {
+    const Handle(Standard_Transient)& anEnt = theList->Value(anItemIter);
+    myTP->SetRoot(anEnt);
+
+    //  Result ...
+    Handle(Transfer_Binder) aBinder = myTP->Find(anEnt);
+    if (aBinder.IsNull())
+      continue;
+    if (theRec)
+      RecordResult(anEnt);
+
+    if (!aBinder->HasResult())
+      continue;
+    aNbResults++;
+  }
+  return aNbResults;
+}
+
 //  <<<< >>>>  Graph passing: judicious?
 
 //=================================================================================================
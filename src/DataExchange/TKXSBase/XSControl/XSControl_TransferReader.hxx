@@ -63,7 +63,10 @@ class XSControl_TransferReader : public Standard_Transient
 {
 public:
   //! Creates a TransferReader, empty
-  XSControl_TransferReader() {}
+  XSControl_TransferReader()
+      : myIsParallel(Standard_False)
+  {
+  }
 
   //! Sets a Controller. It is required to generate the Actor.
   //! Elsewhere, the Actor must be provided directly
@@ -113,6 +116,22 @@ public:
   //! Returns actual value of file name
   Standard_CString FileName() const { return myFileName.ToCString(); }
 
+  //! Sets the parallel mode of TransferList() (OFF by default).
+  //! In this mode the list is split into groups of entities which do not share
+  //! any sub-entity recognized by the Actor. Each group is transferred concurrently
+  //! by its own Actor (see XSControl_Controller::NewActorRead()) and TransientProcess,
+  //! then the binders are merged into the main TransientProcess.
+  //! The binders are not shared between the groups: sub-entities not recognized by the
+  //! Actor but used by roots of different groups (e.g. geometry or representation items)
+  //! are translated separately by each group, so the resulting shapes do not share
+  //! the corresponding sub-shapes (instancing between groups is lost).
+  //! Use the sequential mode when such sharing has to be kept.
+  //! The mode is ignored if the Controller cannot create independent Actors.
+  void SetParallel(const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the parallel mode of TransferList()
+  Standard_Boolean IsParallel() const { return myIsParallel; }
+
   //! Clears data, according mode :
   //! -1 all
   //! 0 nothing done
@@ -374,6 +393,13 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(XSControl_TransferReader, Standard_Transient)
 
+private:
+  //! Transfers the list in parallel, see SetParallel().
+  //! Returns -1 if the list cannot be transferred in parallel.
+  Standard_Integer transferParallel(const Handle(TColStd_HSequenceOfTransient)& theList,
+                                    const Standard_Boolean                      theRec,
+                                    const Message_ProgressRange&                theProgress);
+
 private:
   Handle(XSControl_Controller)                                             myController;
   TCollection_AsciiString                                                  myFileName;
@@ -384,6 +410,7 @@ private:
   Handle(Transfer_TransientProcess)                                        myTP;
   TColStd_DataMapOfIntegerTransient                                        myResults;
   Handle(TopTools_HSequenceOfShape)                                        myShapeResult;
+  Standard_Boolean                                                         myIsParallel;
 };
 
 #endif // _XSControl_TransferReader_HeaderFile
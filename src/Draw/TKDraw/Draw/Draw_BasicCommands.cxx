@@ -29,6 +29,8 @@
 #include <OSD_Parallel.hxx>
 #include <OSD_PerfMeter.hxx>
 #include <OSD_ThreadPool.hxx>
+#include <Standard.hxx>
+#include <Standard_MMgrStat.hxx>
 #include <Standard_Macro.hxx>
 #include <Standard_SStream.hxx>
 #include <Standard_Stream.hxx>
@@ -780,6 +782,48 @@ static int dmeminfo(Draw_Interpretor& theDI, Standard_Integer theArgNb, const ch
 
 //=================================================================================================
 
+static int dmemstat(Draw_Interpretor& theDI, Standard_Integer theArgNb, const char** theArgVec)
+{
+  Standard_MMgrStat* aStat = Standard::AllocatorStatistics();
+  if (aStat == NULL)
+  {
+    theDI << "Error: statistics of allocations is not collected (set MMGT_STAT=1)";
+    return 1;
+  }
+
+  Standard_Boolean toReset  = Standard_False;
+  Standard_Integer aNbSites = 10;
+  for (Standard_Integer anIter = 1; anIter < theArgNb; ++anIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anIter]);
+    anArg.LowerCase();
+    if (anArg == "-reset")
+    {
+      toReset = Standard_True;
+    }
+    else if (anIter + 1 < theArgNb && anArg == "-sites")
+    {
+      aNbSites = Draw::Atoi(theArgVec[++anIter]);
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anIter] << "'!\n";
+      return 1;
+    }
+  }
+
+  Standard_SStream aStream;
+  aStat->Dump(aStream, aNbSites);
+  theDI << aStream;
+  if (toReset)
+  {
+    aStat->Reset();
+  }
+  return 0;
+}
+
+//=================================================================================================
+
 static int dparallel(Draw_Interpretor& theDI, Standard_Integer theArgNb, const char** theArgVec)
 {
   const Handle(OSD_ThreadPool)& aDefPool = OSD_ThreadPool::DefaultPool();
@@ -788,7 +832,8 @@ static int dparallel(Draw_Interpretor& theDI, Standard_Integer theArgNb, const c
     theDI << "NbLogicalProcessors: " << OSD_Parallel::NbLogicalProcessors() << "\n"
           << "NbThreads:           " << aDefPool->NbThreads() << "\n"
           << "NbDefThreads:        " << aDefPool->NbDefaultThreadsToLaunch() << "\n"
-          << "UseOcct:             " << (OSD_Parallel::ToUseOcctThreads() ? 1 : 0);
+          << "UseOcct:             " << (OSD_Parallel::ToUseOcctThreads() ? 1 : 0) << "\n"
+          << "UseTaskGroup:        " << (OSD_Parallel::ToUseTaskGroup() ? 1 : 0);
     return 0;
   }
 
@@ -824,6 +869,10 @@ static int dparallel(Draw_Interpretor& theDI, Standard_Integer theArgNb, const c
         std::cout << "Warning: unable to switch threads library - no options available\n";
       }
     }
+    else if (anIter + 1 < theArgNb && (anArg == "-usetaskgroup" || anArg == "-taskgroup"))
+    {
+      OSD_Parallel::SetUseTaskGroup(Draw::Atoi(theArgVec[++anIter]) == 1);
+    }
     else if (anIter + 1 < theArgNb
              && (anArg == "-usetbb" || anArg == "-tousetbb" || anArg == "-tbb"))
     {
@@ -1204,6 +1253,15 @@ void Draw::BasicCommands(Draw_Interpretor& theCommands)
                   __FILE__,
                   dmeminfo,
                   g);
+  theCommands.Add("memstat",
+                  "memstat [-reset] [-sites N=10]"
+                  "\n\t\t: Prints statistics of allocations collected by memory manager"
+                  "\n\t\t: (requires environment variable MMGT_STAT=1)."
+                  "\n\t\t:   -reset  resets counters after printing"
+                  "\n\t\t:   -sites  maximum number of sampled call stacks to print",
+                  __FILE__,
+                  dmemstat,
+                  g);
   theCommands.Add("dperf",
                   "dperf [reset] -- show performance counters, reset if argument is provided",
                   __FILE__,
@@ -1221,9 +1279,10 @@ void Draw::BasicCommands(Draw_Interpretor& theCommands)
 
   theCommands.Add(
     "dparallel",
-    "dparallel [-occt {0|1}] [-nbThreads Count] [-nbDefThreads Count]"
+    "dparallel [-occt {0|1}] [-taskGroup {0|1}] [-nbThreads Count] [-nbDefThreads Count]"
     "\n\t\t: Manages global parallelization parameters:"
     "\n\t\t:   -occt         use OCCT implementation or external library (if available)"
+    "\n\t\t:   -taskGroup    use work-stealing task scheduler supporting nested loops"
     "\n\t\t:   -nbThreads    specify the number of threads in default thread pool"
     "\n\t\t:   -nbDefThreads specify the upper limit of threads to be used for default thread pool"
     "\n\t\t:                 within single parallelization call (should be <= of overall number of "
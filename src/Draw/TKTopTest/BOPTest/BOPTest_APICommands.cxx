@@ -155,6 +155,9 @@ Standard_Integer bapibop(Draw_Interpretor& di, Standard_Integer n, const char**
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetIntersectionCache(BOPTest_Objects::IntersectionCache());
+  pBuilder->SetToolsBatchSize(BOPTest_Objects::ToolsBatchSize());
+  pBuilder->SetToolsMemoryBudget(BOPTest_Objects::ToolsMemoryBudget());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -224,6 +227,7 @@ Standard_Integer bapibuild(Draw_Interpretor& di, Standard_Integer n, const char*
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -284,6 +288,7 @@ Standard_Integer bapisplit(Draw_Interpretor& di, Standard_Integer n, const char*
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
@@ -162,6 +162,7 @@ Standard_Integer bop(Draw_Interpretor& di, Standard_Integer n, const char** a)
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
@@ -431,6 +432,7 @@ Standard_Integer bsection(Draw_Interpretor& di, Standard_Integer n, const char**
   aSec.SetNonDestructive(bNonDestructive);
   aSec.SetGlue(aGlue);
   aSec.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSec.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   //
   aSec.Build(aProgress->Start());
   // Store the history of Section operation into the session
@@ -502,6 +504,7 @@ Standard_Integer bsmt(Draw_Interpretor&       di,
   aBOP.SetNonDestructive(BOPTest_Objects::NonDestructive());
   aBOP.SetRunParallel(BOPTest_Objects::RunParallel());
   aBOP.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBOP.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   aBOP.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBOP.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
@@ -851,6 +854,7 @@ Standard_Integer mkvolume(Draw_Interpretor& di, Standard_Integer n, const char**
   aMV.SetAvoidInternalShapes(bAvoidInternal);
   aMV.SetGlue(aGlue);
   aMV.SetUseOBB(BOPTest_Objects::UseOBB());
+  aMV.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   aMV.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
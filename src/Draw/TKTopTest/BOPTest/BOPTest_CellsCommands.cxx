@@ -132,6 +132,7 @@ Standard_Integer bcbuild(Draw_Interpretor& di, Standard_Integer n, const char**
   aCBuilder.SetGlue(aGlue);
   aCBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aCBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aCBuilder.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   aCBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
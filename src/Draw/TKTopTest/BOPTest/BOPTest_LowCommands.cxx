@@ -18,6 +18,8 @@
 #include <BRep_GCurve.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_BatchClassifier.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepClass_FaceClassifier.hxx>
 #include <DBRep.hxx>
@@ -26,8 +28,10 @@
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TopAbs_State.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 
 #include <stdio.h>
@@ -43,6 +47,7 @@ static Handle(Geom2d_Curve) CurveOnSurface(const TopoDS_Edge&          E,
                                            Standard_Real&              Last);
 
 static Standard_Integer bclassify(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bclassifypoints(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer b2dclassify(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer b2dclassifx(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bhaspc(Draw_Interpretor&, Standard_Integer, const char**);
@@ -62,6 +67,18 @@ void BOPTest::LowCommands(Draw_Interpretor& theCommands)
                   __FILE__,
                   bclassify,
                   g);
+  theCommands.Add(
+    "bclassifypoints",
+    "use bclassifypoints Solid NbPoints [-tol Tolerance=1.e-7] [-winding] [-serial] [-compare]\n"
+    "Classifies the regular grid of NbPoints^3 points in the bounding box of the solid\n"
+    "(or of the single solid of the compound)\n"
+    "by BRepClass3d_BatchClassifier using the triangulation of the solid.\n"
+    "-winding: use generalized winding number instead of ray casting.\n"
+    "-serial: classify the points in the current thread only.\n"
+    "-compare: compare the states with the ones given by BRepClass3d_SolidClassifier.",
+    __FILE__,
+    bclassifypoints,
+    g);
   theCommands.Add(
     "b2dclassify",
     "use b2dclassify Face Point2d [Tol] [UseBox] [GapCheckTol]\n"
@@ -191,6 +208,130 @@ Standard_Integer bclassify(Draw_Interpretor& theDI,
 
 //=================================================================================================
 
+Standard_Integer bclassifypoints(Draw_Interpretor& theDI,
+                                 Standard_Integer  theArgNb,
+                                 const char**      theArgVec)
+{
+  if (theArgNb < 3)
+  {
+    theDI.PrintHelp(theArgVec[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get(theArgVec[1]);
+  if (aS.IsNull())
+  {
+    theDI << " Null Shape is not allowed\n";
+    return 1;
+  }
+  if (aS.ShapeType() == TopAbs_COMPOUND && aS.NbChildren() == 1)
+  {
+    // take the solid out of the compound produced by Boolean operations
+    aS = TopoDS_Iterator(aS).Value();
+  }
+  if (aS.ShapeType() != TopAbs_SOLID)
+  {
+    theDI << " Shape type must be SOLID\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbPoints = Draw::Atoi(theArgVec[2]);
+  if (aNbPoints < 2)
+  {
+    theDI << " Number of points should be at least 2\n";
+    return 1;
+  }
+
+  Standard_Real    aTol        = 1.e-7;
+  Standard_Boolean isWinding   = Standard_False;
+  Standard_Boolean isParallel  = Standard_True;
+  Standard_Boolean isToCompare = Standard_False;
+  for (Standard_Integer anArgIter = 3; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-tol" && anArgIter + 1 < theArgNb)
+    {
+      aTol = Draw::Atof(theArgVec[++anArgIter]);
+    }
+    else if (anArg == "-winding")
+    {
+      isWinding = Standard_True;
+    }
+    else if (anArg == "-serial")
+    {
+      isParallel = Standard_False;
+    }
+    else if (anArg == "-compare")
+    {
+      isToCompare = Standard_True;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << anArg << "'\n";
+      return 1;
+    }
+  }
+
+  Bnd_Box aBox;
+  BRepBndLib::Add(aS, aBox);
+  aBox.Enlarge(aBox.IsVoid() ? 0.0 : 0.05 * Sqrt(aBox.SquareExtent()));
+  Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+  aBox.Get(aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+  const gp_XYZ aStep =
+    (gp_XYZ(aXMax, aYMax, aZMax) - gp_XYZ(aXMin, aYMin, aZMin)) / (aNbPoints - 1);
+
+  TColgp_Array1OfPnt aPoints(1, aNbPoints * aNbPoints * aNbPoints);
+  Standard_Integer   aPntIndex = 1;
+  for (Standard_Integer aX = 0; aX < aNbPoints; ++aX)
+  {
+    for (Standard_Integer aY = 0; aY < aNbPoints; ++aY)
+    {
+      for (Standard_Integer aZ = 0; aZ < aNbPoints; ++aZ)
+      {
+        aPoints.ChangeValue(aPntIndex++) = gp_Pnt(aXMin + aX * aStep.X(),
+                                                  aYMin + aY * aStep.Y(),
+                                                  aZMin + aZ * aStep.Z());
+      }
+    }
+  }
+
+  BRepClass3d_BatchClassifier aClassifier(aS, aTol);
+  aClassifier.SetMethod(isWinding ? BRepClass3d_BatchClassifier::Method_WindingNumber
+                                  : BRepClass3d_BatchClassifier::Method_RayCasting);
+  NCollection_Array1<TopAbs_State> aStates(aPoints.Lower(), aPoints.Upper());
+  aClassifier.Perform(aPoints, aStates, isParallel);
+
+  Standard_Integer aNbIn = 0, aNbOut = 0, aNbOn = 0, aNbDiff = 0;
+  BRepClass3d_SolidClassifier aSC;
+  if (isToCompare)
+  {
+    aSC.Load(aS);
+  }
+  for (Standard_Integer aPntIter = aPoints.Lower(); aPntIter <= aPoints.Upper(); ++aPntIter)
+  {
+    const TopAbs_State aState = aStates.Value(aPntIter);
+    aNbIn  += aState == TopAbs_IN ? 1 : 0;
+    aNbOut += aState == TopAbs_OUT ? 1 : 0;
+    aNbOn  += aState == TopAbs_ON ? 1 : 0;
+    if (isToCompare)
+    {
+      aSC.Perform(aPoints.Value(aPntIter), aTol);
+      aNbDiff += aSC.State() != aState ? 1 : 0;
+    }
+  }
+
+  theDI << "Mesh is used: " << (aClassifier.IsMeshUsed() ? "Yes" : "No") << "\n";
+  theDI << "IN: " << aNbIn << "\nOUT: " << aNbOut << "\nON: " << aNbOn << "\n";
+  if (isToCompare)
+  {
+    theDI << "Differences: " << aNbDiff << "\n";
+  }
+  return 0;
+}
+
+//=================================================================================================
+
 Standard_Integer bhaspc(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n < 3)
@@ -106,6 +106,9 @@ public:
     myUnifyEdges     = Standard_False;
     myUnifyFaces     = Standard_False;
     myAngTol         = Precision::Angular();
+    myIntersectionCache.Nullify();
+    myToolsBatchSize    = 0;
+    myToolsMemoryBudget = 0;
   }
 
   //
@@ -150,6 +153,27 @@ public:
   //
   Standard_Boolean UseOBB() const { return myUseOBB; };
 
+  //
+  void SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache)
+  {
+    myIntersectionCache = theCache;
+  }
+
+  //
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const { return myIntersectionCache; }
+
+  //
+  void SetToolsBatchSize(const Standard_Integer theSize) { myToolsBatchSize = theSize; }
+
+  //
+  Standard_Integer ToolsBatchSize() const { return myToolsBatchSize; }
+
+  //
+  void SetToolsMemoryBudget(const Standard_Size theBytes) { myToolsMemoryBudget = theBytes; }
+
+  //
+  Standard_Size ToolsMemoryBudget() const { return myToolsMemoryBudget; }
+
   // Controls the Unification of Edges after BOP
   void SetUnifyEdges(const Standard_Boolean bUE) { myUnifyEdges = bUE; }
 
@@ -191,6 +215,10 @@ protected:
   Standard_Boolean     myUnifyEdges;
   Standard_Boolean     myUnifyFaces;
   Standard_Real        myAngTol;
+
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache;
+  Standard_Integer                  myToolsBatchSize;
+  Standard_Size                     myToolsMemoryBudget;
 };
 
 //
@@ -415,6 +443,48 @@ Standard_Boolean BOPTest_Objects::UseOBB()
 
 //=================================================================================================
 
+void BOPTest_Objects::SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache)
+{
+  GetSession().SetIntersectionCache(theCache);
+}
+
+//=================================================================================================
+
+const Handle(BOPAlgo_IntersectionCache)& BOPTest_Objects::IntersectionCache()
+{
+  return GetSession().IntersectionCache();
+}
+
+//=================================================================================================
+
+void BOPTest_Objects::SetToolsBatchSize(const Standard_Integer theSize)
+{
+  GetSession().SetToolsBatchSize(theSize);
+}
+
+//=================================================================================================
+
+Standard_Integer BOPTest_Objects::ToolsBatchSize()
+{
+  return GetSession().ToolsBatchSize();
+}
+
+//=================================================================================================
+
+void BOPTest_Objects::SetToolsMemoryBudget(const Standard_Size theBytes)
+{
+  GetSession().SetToolsMemoryBudget(theBytes);
+}
+
+//=================================================================================================
+
+Standard_Size BOPTest_Objects::ToolsMemoryBudget()
+{
+  return GetSession().ToolsMemoryBudget();
+}
+
+//=================================================================================================
+
 void BOPTest_Objects::SetUnifyEdges(const Standard_Boolean bUE)
 {
   GetSession().SetUnifyEdges(bUE);
@@ -23,6 +23,7 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BOPAlgo_CellsBuilder.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 //
 class BOPAlgo_PaveFiller;
 class BOPAlgo_Builder;
@@ -91,6 +92,19 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  Standard_EXPORT static void SetIntersectionCache(
+    const Handle(BOPAlgo_IntersectionCache)& theCache);
+
+  Standard_EXPORT static const Handle(BOPAlgo_IntersectionCache)& IntersectionCache();
+
+  Standard_EXPORT static void SetToolsBatchSize(const Standard_Integer theSize);
+
+  Standard_EXPORT static Standard_Integer ToolsBatchSize();
+
+  Standard_EXPORT static void SetToolsMemoryBudget(const Standard_Size theBytes);
+
+  Standard_EXPORT static Standard_Size ToolsMemoryBudget();
+
   Standard_EXPORT static void             SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
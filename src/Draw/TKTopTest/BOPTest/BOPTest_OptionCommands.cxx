@@ -27,6 +27,8 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bintcache(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer btoolsbatch(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=================================================================================================
@@ -98,6 +100,26 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                   buseobb,
                   g);
 
+  theCommands.Add("bintcache",
+                  "Enables/Disables the cache of Face/Face intersections in BOP algorithms\n"
+                  "\t\tUsage: bintcache [0 (off) / 1 (on)] [-clear] [-invalidate shape]\n"
+                  "\t\tw/o arguments shows the number of stored and reused intersections\n"
+                  "\t\t-clear - removes all stored intersections\n"
+                  "\t\t-invalidate shape - removes the intersections of the faces of the shape",
+                  __FILE__,
+                  bintcache,
+                  g);
+
+  theCommands.Add("btoolsbatch",
+                  "Sets the maximal number of tools intersected at once in CUT and FUSE operations\n"
+                  "\t\tUsage: btoolsbatch size [memory]\n"
+                  "\t\tsize   - number of tools in a batch\n"
+                  "\t\tmemory - estimated memory of tools in a batch, in kilobytes\n"
+                  "\t\t0 (default) means no limit, by default all tools are intersected at once",
+                  __FILE__,
+                  btoolsbatch,
+                  g);
+
   theCommands.Add("bsimplify",
                   "Enables/Disables the result simplification after BOP\n"
                   "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
@@ -171,6 +193,21 @@ Standard_Integer boptions(Draw_Interpretor& di, Standard_Integer n, const char**
           BOPTest_Objects::UseOBB() ? "Yes" : "No",
           "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf,
+          " Intersection cache: %s \t(%s)\n",
+          BOPTest_Objects::IntersectionCache().IsNull() ? "No" : "Yes",
+          "use \"bintcache\" command to change");
+  di << buf;
+  Sprintf(buf,
+          " Tools batch size: %d \t\t(%s)\n",
+          BOPTest_Objects::ToolsBatchSize(),
+          "use \"btoolsbatch\" command to change");
+  di << buf;
+  Sprintf(buf,
+          " Tools memory budget: %d KB \t(%s)\n",
+          int(BOPTest_Objects::ToolsMemoryBudget() / 1024),
+          "use \"btoolsbatch\" command to change");
+  di << buf;
   Sprintf(buf,
           " Unify Edges: %s \t\t(%s)\n",
           BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
@@ -305,6 +342,95 @@ Standard_Integer buseobb(Draw_Interpretor& di, Standard_Integer n, const char**
 
 //=================================================================================================
 
+Standard_Integer bintcache(Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n == 1)
+  {
+    const Handle(BOPAlgo_IntersectionCache)& aCache = BOPTest_Objects::IntersectionCache();
+    if (aCache.IsNull())
+    {
+      di << "The intersection cache is disabled\n";
+      return 0;
+    }
+    di << "Stored intersections: " << aCache->Extent() << "\n";
+    di << "Reused intersections: " << aCache->NbHits() << "\n";
+    return 0;
+  }
+
+  for (Standard_Integer i = 1; i < n; ++i)
+  {
+    const Handle(BOPAlgo_IntersectionCache)& aCache = BOPTest_Objects::IntersectionCache();
+    if (!strcmp(a[i], "-clear"))
+    {
+      if (!aCache.IsNull())
+      {
+        aCache->Clear();
+      }
+    }
+    else if (!strcmp(a[i], "-invalidate") && i + 1 < n)
+    {
+      TopoDS_Shape aS = DBRep::Get(a[++i]);
+      if (aS.IsNull())
+      {
+        di << "Error: " << a[i] << " is a null shape\n";
+        return 1;
+      }
+      if (!aCache.IsNull())
+      {
+        aCache->Invalidate(aS);
+      }
+    }
+    else if (!strcmp(a[i], "0"))
+    {
+      BOPTest_Objects::SetIntersectionCache(Handle(BOPAlgo_IntersectionCache)());
+    }
+    else if (!strcmp(a[i], "1"))
+    {
+      if (aCache.IsNull())
+      {
+        BOPTest_Objects::SetIntersectionCache(new BOPAlgo_IntersectionCache());
+      }
+    }
+    else
+    {
+      di << "Wrong key option.\n";
+      di.PrintHelp(a[0]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+Standard_Integer btoolsbatch(Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n != 2 && n != 3)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  Standard_Integer aSize = Draw::Atoi(a[1]);
+  if (aSize < 0)
+  {
+    di << "Error: the batch size should not be negative\n";
+    return 1;
+  }
+
+  Standard_Integer aMemory = n == 3 ? Draw::Atoi(a[2]) : 0;
+  if (aMemory < 0)
+  {
+    di << "Error: the memory budget should not be negative\n";
+    return 1;
+  }
+  BOPTest_Objects::SetToolsBatchSize(aSize);
+  BOPTest_Objects::SetToolsMemoryBudget(Standard_Size(aMemory) * 1024);
+  return 0;
+}
+
+//=================================================================================================
+
 Standard_Integer bsimplify(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n == 1 || n % 2 == 0)
@@ -187,6 +187,7 @@ Standard_Integer bfillds(Draw_Interpretor& di, Standard_Integer n, const char**
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   //
   OSD_Timer aTimer;
   aTimer.Start();
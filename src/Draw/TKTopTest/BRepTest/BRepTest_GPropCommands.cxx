@@ -25,6 +25,7 @@
 
 #include <Draw_Axis3D.hxx>
 #include <Precision.hxx>
+#include <NCollection_Array1.hxx>
 
 #ifdef _WIN32
 Standard_IMPORT Draw_Viewer dout;
@@ -32,9 +33,28 @@ Standard_IMPORT Draw_Viewer dout;
 
 Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
+  // the -parallel key may be given at any position, other arguments are positional
+  Standard_Boolean                isParallel = Standard_False;
+  NCollection_Array1<const char*> anArgs(0, n - 1);
+  Standard_Integer                aNbArgs    = 0;
+  for (Standard_Integer anArgIter = 0; anArgIter < n; ++anArgIter)
+  {
+    if (anArgIter > 0 && strcmp(a[anArgIter], "-parallel") == 0)
+    {
+      isParallel = Standard_True;
+    }
+    else
+    {
+      anArgs.ChangeValue(aNbArgs++) = a[anArgIter];
+    }
+  }
+  n = aNbArgs;
+  a = &anArgs.ChangeFirst();
+
   if (n < 2)
   {
-    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]\n";
+    di << "Use: " << a[0]
+       << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel]\n";
     di << "Compute properties of the shape, exact geometry (curves, surfaces) or\n";
     di << "some discrete data (polygons, triangulations) can be used for calculations\n";
     di << "The epsilon, if given, defines relative precision of computation\n";
@@ -45,7 +65,9 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     di << "Preferable source of geometry data are triangulations in case if it exists, if the -tri "
           "key is used.\n";
     di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations "
-          "independently of using key -tri\n\n";
+          "independently of using key -tri\n";
+    di << "Faces are integrated in parallel threads if the -parallel key is used at any position "
+          "(surface and volume properties only)\n\n";
     return 1;
   }
 
@@ -92,18 +114,18 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S, G, SkipShared);
     else if (*a[0] == 's')
-      eps = BRepGProp::SurfaceProperties(S, G, eps, SkipShared);
+      eps = BRepGProp::SurfaceProperties(S, G, eps, SkipShared, isParallel);
     else
-      eps = BRepGProp::VolumeProperties(S, G, eps, onlyClosed, SkipShared);
+      eps = BRepGProp::VolumeProperties(S, G, eps, onlyClosed, SkipShared, isParallel);
   }
   else
   {
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S, G, SkipShared, UseTriangulation);
     else if (*a[0] == 's')
-      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation);
+      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation, isParallel);
     else
-      BRepGProp::VolumeProperties(S, G, onlyClosed, SkipShared, UseTriangulation);
+      BRepGProp::VolumeProperties(S, G, onlyClosed, SkipShared, UseTriangulation, isParallel);
   }
 
   gp_Pnt P = G.CentreOfMass();
@@ -357,13 +379,13 @@ void BRepTest::GPropCommands(Draw_Interpretor& theCommands)
                   props,
                   g);
   theCommands.Add("sprops",
-                  "sprops name [epsilon] [x y z] [-skip] [-full] [-tri]:\n"
+                  "sprops name [epsilon] [x y z] [-skip] [-full] [-tri] [-parallel]:\n"
                   "  compute surfacic properties",
                   __FILE__,
                   props,
                   g);
   theCommands.Add("vprops",
-                  "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]:\n"
+                  "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel]:\n"
                   "  compute volumic properties",
                   __FILE__,
                   props,
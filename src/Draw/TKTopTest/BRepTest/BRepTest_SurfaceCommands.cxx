@@ -373,6 +373,7 @@ static Standard_Integer sewing(Draw_Interpretor& theDi,
   Standard_Boolean aSameParameterMode = Standard_True;
   Standard_Boolean aFloatingEdgesMode = Standard_False;
   Standard_Boolean aFaceMode          = Standard_True;
+  Standard_Boolean aRunParallel       = Standard_False;
   Standard_Boolean aSetMinTol         = Standard_False;
   Standard_Real    aMinTol            = 0.;
   Standard_Real    aMaxTol            = Precision::Infinite();
@@ -431,6 +432,9 @@ static Standard_Integer sewing(Draw_Interpretor& theDi,
         case 'f':
           aFaceMode = aVal;
           break;
+        case 't':
+          aRunParallel = aVal;
+          break;
       }
     }
     else
@@ -469,6 +473,7 @@ static Standard_Integer sewing(Draw_Interpretor& theDi,
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "  t - mode for running in parallel threads\n";
     return (1);
   }
 
@@ -493,6 +498,7 @@ static Standard_Integer sewing(Draw_Interpretor& theDi,
   aSewing.SetSameParameterMode(aSameParameterMode);
   aSewing.SetFloatingEdgesMode(aFloatingEdgesMode);
   aSewing.SetFaceMode(aFaceMode);
+  aSewing.SetRunParallel(aRunParallel);
   aSewing.SetMinTolerance(aMinTol);
   aSewing.SetMaxTolerance(aMaxTol);
 
@@ -24,6 +24,7 @@
 #include <HLRTest_OutLiner.hxx>
 #include <HLRTest_Projector.hxx>
 #include <HLRTopoBRep_OutLiner.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TopoDS_Shape.hxx>
 #include <BRep_Builder.hxx>
 
@@ -284,8 +285,26 @@ static Standard_Integer upda(Draw_Interpretor&, Standard_Integer, const char**)
 
 //=================================================================================================
 
-static Standard_Integer hide(Draw_Interpretor&, Standard_Integer, const char**)
+static Standard_Integer hide(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
+  for (Standard_Integer anArgIter = 1; anArgIter < n; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(a[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-parallel")
+    {
+      hider->SetRunParallel(Standard_True);
+    }
+    else if (anArg == "-serial")
+    {
+      hider->SetRunParallel(Standard_False);
+    }
+    else
+    {
+      di << "Syntax error at '" << a[anArgIter] << "'\n";
+      return 1;
+    }
+  }
   hider->Hide();
   return 0;
 }
@@ -552,7 +571,13 @@ void HLRTest::Commands(Draw_Interpretor& theCommands)
   theCommands.Add("hremove", "hremove [name]", __FILE__, hrem, g);
   theCommands.Add("hsetprj", "hsetprj [name]", __FILE__, sprj, g);
   theCommands.Add("hupdate", "hupdate", __FILE__, upda, g);
-  theCommands.Add("hhide", "hhide", __FILE__, hide, g);
+  theCommands.Add("hhide",
+                  "hhide [-parallel|-serial]"
+                  "\n\t\t: Hides the loaded shapes;"
+                  "\n\t\t: -parallel hides the edges by the faces in parallel threads.",
+                  __FILE__,
+                  hide,
+                  g);
   theCommands.Add("hshowall", "hshowall", __FILE__, show, g);
   theCommands.Add("hdebug", "hdebug", __FILE__, hdbg, g);
   theCommands.Add("hnullify", "hnullify", __FILE__, hnul, g);
@@ -26,7 +26,9 @@
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepLib.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_MeshPyramid.hxx>
 #include <BRepTest.hxx>
+#include <BRepTest_DrawableHistory.hxx>
 #include <BRepTools.hxx>
 #include <CSLib.hxx>
 #include <DBRep.hxx>
@@ -87,9 +89,14 @@ static Standard_Integer incrementalmesh(Draw_Interpretor& theDI,
     return 1;
   }
 
-  TopoDS_ListOfShape    aListOfShapes;
-  IMeshTools_Parameters aMeshParams;
-  bool                  hasDefl = false, hasAngDefl = false, isPrsDefl = false;
+  TopoDS_ListOfShape         aListOfShapes;
+  IMeshTools_Parameters      aMeshParams;
+  bool                       hasDefl = false, hasAngDefl = false, isPrsDefl = false;
+  TopTools_IndexedMapOfShape aModifiedShapes;
+  TopoDS_Shape               anInitialShape;
+  Handle(BRepTools_History)  aHistory;
+  Standard_Integer           aNbLevels   = 1;
+  Standard_Real              aLevelRatio = 4.0;
 
   Handle(IMeshTools_Context) aContext = new BRepMesh_Context();
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
@@ -131,6 +138,48 @@ static Standard_Integer incrementalmesh(Draw_Interpretor& theDI,
       aMeshParams.AllowQualityDecrease =
         Draw::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-modified" && anArgIter + 1 < theNbArgs)
+    {
+      TopoDS_Shape aModified = DBRep::Get(theArgVec[++anArgIter]);
+      if (aModified.IsNull())
+      {
+        theDI << "Syntax error: null shapes are not allowed here '" << theArgVec[anArgIter]
+              << "'\n";
+        return 1;
+      }
+      aModifiedShapes.Add(aModified);
+    }
+    else if (aNameCase == "-history" && anArgIter + 2 < theNbArgs)
+    {
+      anInitialShape = DBRep::Get(theArgVec[++anArgIter]);
+      Handle(BRepTest_DrawableHistory) aDrawHist =
+        Handle(BRepTest_DrawableHistory)::DownCast(Draw::Get(theArgVec[++anArgIter]));
+      if (anInitialShape.IsNull() || aDrawHist.IsNull() || aDrawHist->History().IsNull())
+      {
+        theDI << "Syntax error: wrong initial shape or history at '" << theArgVec[anArgIter]
+              << "'\n";
+        return 1;
+      }
+      aHistory = aDrawHist->History();
+    }
+    else if (aNameCase == "-levels" && anArgIter + 1 < theNbArgs)
+    {
+      aNbLevels = Draw::Atoi(theArgVec[++anArgIter]);
+      if (aNbLevels < 1)
+      {
+        theDI << "Syntax error: invalid input parameter '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (aNameCase == "-levelratio" && anArgIter + 1 < theNbArgs)
+    {
+      aLevelRatio = Draw::Atof(theArgVec[++anArgIter]);
+      if (aLevelRatio <= 1.0)
+      {
+        theDI << "Syntax error: invalid input parameter '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
     else if (aNameCase == "-algo" && anArgIter + 1 < theNbArgs)
     {
       TCollection_AsciiString anAlgoStr(theArgVec[++anArgIter]);
@@ -267,9 +316,40 @@ static Standard_Integer incrementalmesh(Draw_Interpretor& theDI,
   }
 
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
-  BRepMesh_IncrementalMesh       aMesher;
+  if (aNbLevels > 1)
+  {
+    BRepMesh_MeshPyramid aPyramid(aShape, aMeshParams, aNbLevels, aLevelRatio, aProgress->Start());
+    if (!aPyramid.IsDone())
+    {
+      theDI << "Error: mesh pyramid is not built";
+      return 1;
+    }
+    theDI << "Mesh pyramid of " << aNbLevels << " levels is built";
+    return 0;
+  }
+
+  BRepMesh_IncrementalMesh aMesher;
   aMesher.SetShape(aShape);
   aMesher.ChangeParameters() = aMeshParams;
+  if (!aHistory.IsNull())
+  {
+    aMesher.SetHistory(anInitialShape, aHistory);
+    if (aMesher.ModifiedShapes().IsEmpty())
+    {
+      theDI << "Warning: the shape is not modified, nothing to mesh\n";
+      return 0;
+    }
+  }
+  if (!aModifiedShapes.IsEmpty())
+  {
+    TopTools_IndexedMapOfShape aModified = aMesher.ModifiedShapes();
+    for (TopTools_IndexedMapOfShape::Iterator aModIt(aModifiedShapes); aModIt.More();
+         aModIt.Next())
+    {
+      aModified.Add(aModIt.Value());
+    }
+    aMesher.SetModifiedShapes(aModified);
+  }
   aMesher.Perform(aContext, aProgress->Start());
 
   theDI << "Meshing statuses: ";
@@ -1689,6 +1769,8 @@ void MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
     "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-modified Shape [-modified Shape ...]] [-history InitialShape History]"
+    "\n\t\t:   [-levels NbLevels=1 [-levelratio Ratio=4]]"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by "
@@ -1718,7 +1800,15 @@ void MeshTest::Commands(Draw_Interpretor& theCommands)
     "(FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the "
     "new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -modified       sub-shape modified since the last meshing of the shape; only the"
+    "\n\t\t:                  faces containing modified sub-shapes are meshed and stitched with"
+    "\n\t\t:                  the existing mesh of their neighbours;"
+    "\n\t\t:  -history        defines the modified sub-shapes as the images of the sub-shapes of"
+    "\n\t\t:                  the initial (already meshed) shape in the history of the operation;"
+    "\n\t\t:  -levels         builds the pyramid of meshes (levels of detail) stored in faces from"
+    "\n\t\t:                  the coarsest to the finest one, defined by the given deflections;"
+    "\n\t\t:  -levelratio     ratio of the deflections of the neighbor levels.",
     __FILE__,
     incrementalmesh,
     g);
@@ -609,6 +609,10 @@ static Standard_Integer fixshape(Draw_Interpretor& di, Standard_Integer argc, co
       sfs->FixWireTool()->SetMaxTailWidth(Draw::Atof(argv[i]));
       sfs->FixWireTool()->FixTailMode() = 1;
     }
+    else if (!strcmp(argv[i], "-parallel"))
+    {
+      sfs->SetRunParallel(Standard_True);
+    }
     else
     {
       switch (par)
@@ -1039,7 +1043,8 @@ void SWDRAW_ShapeFix::InitCommands(Draw_Interpretor& theCommands)
   theCommands.Add("reface", "shape result : controle sens wire", __FILE__, reface, g);
   theCommands.Add("fixshape",
                   "res shape [preci [maxpreci]] [{switches}]\n"
-                  "  [-maxtaila <degrees>] [-maxtailw <width>]",
+                  "  [-maxtaila <degrees>] [-maxtailw <width>] [-parallel]\n"
+                  "  -parallel fix sub-shapes of compound not sharing topology in parallel",
                   __FILE__,
                   fixshape,
                   g);
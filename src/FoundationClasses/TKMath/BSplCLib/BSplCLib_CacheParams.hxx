@@ -15,6 +15,7 @@
 #define _BSplCLib_CacheParams_Headerfile
 
 #include <BSplCLib.hxx>
+#include <ElCLib.hxx>
 
 //! Simple structure containing parameters describing parameterization
 //! of a B-spline curve or a surface in one direction (U or V),
@@ -29,6 +30,9 @@ struct BSplCLib_CacheParams
   const Standard_Integer SpanIndexMin; ///< minimal index of span
   const Standard_Integer SpanIndexMax; ///< maximal index of span
 
+  const Standard_Real InvUniformSpan; ///< inverted length of uniform spans, 0 for other knots
+                                      ///< or if the knots are not checked
+
   Standard_Real    SpanStart;  ///< parameter for the frst point of the span
   Standard_Real    SpanLength; ///< length of the span
   Standard_Integer SpanIndex;  ///< index of the span
@@ -37,15 +41,22 @@ struct BSplCLib_CacheParams
   //! \param theDegree     degree of the B-spline (or Bezier)
   //! \param thePeriodic   identify whether the B-spline is periodic
   //! \param theFlatKnots  knots of Bezier / B-spline parameterization
+  //! \param theToDetectUniform  check if the knots are uniform to locate spans directly;
+  //!                            the check scans all knots, so it is worth only for the
+  //!                            parameters locating spans many times (multi-span caches)
   BSplCLib_CacheParams(Standard_Integer            theDegree,
                        Standard_Boolean            thePeriodic,
-                       const TColStd_Array1OfReal& theFlatKnots)
+                       const TColStd_Array1OfReal& theFlatKnots,
+                       Standard_Boolean            theToDetectUniform = Standard_False)
       : Degree(theDegree),
         IsPeriodic(thePeriodic),
         FirstParameter(theFlatKnots.Value(theFlatKnots.Lower() + theDegree)),
         LastParameter(theFlatKnots.Value(theFlatKnots.Upper() - theDegree)),
         SpanIndexMin(theFlatKnots.Lower() + theDegree),
         SpanIndexMax(theFlatKnots.Upper() - theDegree - 1),
+        InvUniformSpan(theToDetectUniform
+                         ? invUniformSpan(SpanIndexMin, SpanIndexMax, theFlatKnots)
+                         : 0.0),
         SpanStart(0.),
         SpanLength(0.),
         SpanIndex(0)
@@ -84,24 +95,96 @@ struct BSplCLib_CacheParams
             && (aDelta < SpanLength || SpanIndex == SpanIndexMax));
   }
 
-  //! Computes span for the specified parameter
+  //! Computes span for the specified parameter.
+  //! The span is computed directly for uniform knots and by dichotomy otherwise.
   //! \param theParameter parameter of the point placed in the span
   //! \param theFlatKnots  knots of Bezier / B-spline parameterization
   void LocateParameter(Standard_Real& theParameter, const TColStd_Array1OfReal& theFlatKnots)
   {
-    SpanIndex = 0;
-    BSplCLib::LocateParameter(Degree,
-                              theFlatKnots,
-                              BSplCLib::NoMults(),
-                              theParameter,
-                              IsPeriodic,
-                              SpanIndex,
-                              theParameter);
+    if (InvUniformSpan > 0.0)
+    {
+      locateUniform(theParameter, theFlatKnots);
+    }
+    else
+    {
+      SpanIndex = 0;
+      BSplCLib::LocateParameter(Degree,
+                                theFlatKnots,
+                                BSplCLib::NoMults(),
+                                theParameter,
+                                IsPeriodic,
+                                SpanIndex,
+                                theParameter);
+    }
     SpanStart  = theFlatKnots.Value(SpanIndex);
     SpanLength = theFlatKnots.Value(SpanIndex + 1) - SpanStart;
   }
 
 private:
+  //! Computes span for the parameter in case of uniform knots;
+  //! the result is the same as of BSplCLib::LocateParameter().
+  void locateUniform(Standard_Real& theParameter, const TColStd_Array1OfReal& theFlatKnots)
+  {
+    const Standard_Real anEps = Epsilon(Min(Abs(theFlatKnots.Last()), Abs(theParameter)));
+    if (IsPeriodic && (theParameter < FirstParameter || theParameter > LastParameter))
+    {
+      theParameter = ElCLib::InPeriod(theParameter, FirstParameter, LastParameter);
+    }
+
+    const Standard_Real aSpan = (theParameter - FirstParameter) * InvUniformSpan;
+    if (!(aSpan > 0.0))
+    {
+      SpanIndex = SpanIndexMin;
+    }
+    else if (aSpan >= Standard_Real(SpanIndexMax - SpanIndexMin))
+    {
+      SpanIndex = SpanIndexMax;
+    }
+    else
+    {
+      SpanIndex = SpanIndexMin + Standard_Integer(aSpan);
+    }
+
+    // correct rounding errors, the parameter coinciding with the knot within precision
+    // belongs to the span starting at this knot
+    if (SpanIndex > SpanIndexMin && theFlatKnots.Value(SpanIndex) - theParameter > anEps)
+    {
+      --SpanIndex;
+    }
+    else if (SpanIndex < SpanIndexMax && theFlatKnots.Value(SpanIndex + 1) - theParameter <= anEps)
+    {
+      ++SpanIndex;
+    }
+  }
+
+  //! Returns inverted length of spans if the knots in the valid range are distributed uniformly,
+  //! and 0 otherwise
+  static Standard_Real invUniformSpan(const Standard_Integer      theSpanIndexMin,
+                                      const Standard_Integer      theSpanIndexMax,
+                                      const TColStd_Array1OfReal& theFlatKnots)
+  {
+    const Standard_Real aFirst  = theFlatKnots.Value(theSpanIndexMin);
+    const Standard_Real aLength = (theFlatKnots.Value(theSpanIndexMax + 1) - aFirst)
+                                  / Standard_Real(theSpanIndexMax - theSpanIndexMin + 1);
+    if (aLength <= 0.0)
+    {
+      return 0.0;
+    }
+
+    // deviation of the knots should be small enough to find the span
+    // by one correction of the computed index
+    const Standard_Real aTol = 1.e-3 * aLength;
+    for (Standard_Integer anIndex = theSpanIndexMin + 1; anIndex <= theSpanIndexMax; ++anIndex)
+    {
+      const Standard_Real aKnot = aFirst + (anIndex - theSpanIndexMin) * aLength;
+      if (Abs(theFlatKnots.Value(anIndex) - aKnot) > aTol)
+      {
+        return 0.0;
+      }
+    }
+    return 1.0 / aLength;
+  }
+
   // copying is prohibited
   BSplCLib_CacheParams(const BSplCLib_CacheParams&);
   void operator=(const BSplCLib_CacheParams&);
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BSplCLib_CacheSlots_Headerfile
+#define _BSplCLib_CacheSlots_Headerfile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+
+//! Assigns spans of Bezier/B-spline to a limited number of slots storing their caches.
+//!
+//! If the number of spans does not exceed the number of slots, each span has its own slot
+//! (index of the slot is the index of the span). Otherwise the slots are reused in the order
+//! of the least recent use, the spans stored in the slots are found by the map.
+//! Spans are identified by zero-based indices.
+class BSplCLib_CacheSlots
+{
+public:
+  //! Empty constructor.
+  BSplCLib_CacheSlots()
+      : myNbUsed(0),
+        myHead(-1),
+        myTail(-1),
+        myIsDirect(Standard_True)
+  {
+  }
+
+  //! Initializes the slots.
+  //! \param theNbSpans     total number of spans
+  //! \param theMaxNbSlots  maximal number of slots, at least one slot is allocated
+  void Init(const Standard_Size theNbSpans, const Standard_Integer theMaxNbSlots)
+  {
+    const Standard_Integer aMaxNbSlots = Max(theMaxNbSlots, 1);
+    myIsDirect                         = theNbSpans <= Standard_Size(aMaxNbSlots);
+
+    const Standard_Integer aNbSlots = myIsDirect ? Standard_Integer(theNbSpans) : aMaxNbSlots;
+    mySpans.Resize(0, aNbSlots - 1, Standard_False);
+    mySpans.Init(-1);
+    if (!myIsDirect)
+    {
+      myPrev.Resize(0, aNbSlots - 1, Standard_False);
+      myNext.Resize(0, aNbSlots - 1, Standard_False);
+    }
+    mySlotMap.Clear();
+    myNbUsed = 0;
+    myHead   = -1;
+    myTail   = -1;
+  }
+
+  //! Returns the number of slots.
+  Standard_Integer NbSlots() const { return mySpans.Length(); }
+
+  //! Returns the number of slots assigned to spans.
+  Standard_Integer NbUsedSlots() const { return myNbUsed; }
+
+  //! Returns the slot for the span and marks it as the most recently used.
+  //! \param[in]  theSpan   zero-based index of the span
+  //! \param[out] theIsNew  set to TRUE if the slot has been just assigned to the span,
+  //!                       thus its content should be recomputed
+  Standard_Integer Slot(const Standard_Integer theSpan, Standard_Boolean& theIsNew)
+  {
+    if (myIsDirect)
+    {
+      theIsNew = mySpans.Value(theSpan) != theSpan;
+      if (theIsNew)
+      {
+        mySpans.ChangeValue(theSpan) = theSpan;
+        ++myNbUsed;
+      }
+      return theSpan;
+    }
+
+    Standard_Integer aSlot = -1;
+    theIsNew               = !mySlotMap.Find(theSpan, aSlot);
+    if (!theIsNew)
+    {
+      moveToHead(aSlot);
+      return aSlot;
+    }
+
+    if (myNbUsed < mySpans.Length())
+    {
+      // take free slot
+      aSlot                     = myNbUsed++;
+      myPrev.ChangeValue(aSlot) = -1;
+      myNext.ChangeValue(aSlot) = myHead;
+      if (myHead >= 0)
+      {
+        myPrev.ChangeValue(myHead) = aSlot;
+      }
+      else
+      {
+        myTail = aSlot;
+      }
+      myHead = aSlot;
+    }
+    else
+    {
+      // reuse the least recently used slot
+      aSlot = myTail;
+      mySlotMap.UnBind(mySpans.Value(aSlot));
+      moveToHead(aSlot);
+    }
+    mySpans.ChangeValue(aSlot) = theSpan;
+    mySlotMap.Bind(theSpan, aSlot);
+    return aSlot;
+  }
+
+private:
+  //! Moves the slot to the head of the list of used slots.
+  void moveToHead(const Standard_Integer theSlot)
+  {
+    if (theSlot == myHead)
+    {
+      return;
+    }
+
+    // unlink the slot; it is not the head, thus it has previous one
+    const Standard_Integer aPrev = myPrev.Value(theSlot);
+    const Standard_Integer aNext = myNext.Value(theSlot);
+    myNext.ChangeValue(aPrev)    = aNext;
+    if (aNext >= 0)
+    {
+      myPrev.ChangeValue(aNext) = aPrev;
+    }
+    else
+    {
+      myTail = aPrev;
+    }
+
+    myPrev.ChangeValue(theSlot) = -1;
+    myNext.ChangeValue(theSlot) = myHead;
+    myPrev.ChangeValue(myHead)  = theSlot;
+    myHead                      = theSlot;
+  }
+
+private:
+  NCollection_Array1<Standard_Integer>                    mySpans;   //!< spans stored in slots
+  NCollection_Array1<Standard_Integer>                    myPrev;    //!< previous slot in use order
+  NCollection_Array1<Standard_Integer>                    myNext;    //!< next slot in use order
+  NCollection_DataMap<Standard_Integer, Standard_Integer> mySlotMap; //!< slots of stored spans
+
+  Standard_Integer myNbUsed;   //!< number of used slots
+  Standard_Integer myHead;     //!< the most recently used slot
+  Standard_Integer myTail;     //!< the least recently used slot
+  Standard_Boolean myIsDirect; //!< each span has its own slot
+};
+
+#endif
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplCLib_MultiSpanCache.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplCLib_MultiSpanCache, Standard_Transient)
+
+namespace
+{
+//! Returns the cache of the slot, computing it for the span of the parameter if necessary.
+template <class TheArrayOfPoles>
+const Handle(BSplCLib_Cache)& fillCache(Handle(BSplCLib_Cache)&     theCache,
+                                        const Standard_Boolean      theIsNew,
+                                        const BSplCLib_CacheParams& theParams,
+                                        const Standard_Real         theParameter,
+                                        const TColStd_Array1OfReal& theFlatKnots,
+                                        const TheArrayOfPoles&      thePoles,
+                                        const TColStd_Array1OfReal* theWeights)
+{
+  if (theIsNew)
+  {
+    if (theCache.IsNull())
+    {
+      theCache = new BSplCLib_Cache(theParams.Degree,
+                                    theParams.IsPeriodic,
+                                    theFlatKnots,
+                                    thePoles,
+                                    theWeights);
+    }
+    theCache->BuildCache(theParameter, theFlatKnots, thePoles, theWeights);
+  }
+  return theCache;
+}
+} // namespace
+
+//=================================================================================================
+
+BSplCLib_MultiSpanCache::BSplCLib_MultiSpanCache(const Standard_Integer      theDegree,
+                                                 const Standard_Boolean      thePeriodic,
+                                                 const TColStd_Array1OfReal& theFlatKnots,
+                                                 const Standard_Integer      theDimension,
+                                                 const Standard_Boolean      theIsRational,
+                                                 const Standard_Size         theMaxMemory)
+    : myParams(theDegree, thePeriodic, theFlatKnots, Standard_True)
+{
+  const Standard_Size aNbSpans = Standard_Size(myParams.SpanIndexMax - myParams.SpanIndexMin + 1);
+  const Standard_Size aMaxNbSlots =
+    theMaxMemory / SpanMemory(theDegree, theDimension, theIsRational);
+  mySlots.Init(aNbSpans, Standard_Integer(std::min(aMaxNbSlots, aNbSpans)));
+  myCaches.Resize(0, mySlots.NbSlots() - 1, Standard_False);
+}
+
+//=================================================================================================
+
+Standard_Size BSplCLib_MultiSpanCache::SpanMemory(const Standard_Integer theDegree,
+                                                  const Standard_Integer theDimension,
+                                                  const Standard_Boolean theIsRational)
+{
+  const Standard_Size aNbValues =
+    Standard_Size(theDegree + 1) * (theDimension + (theIsRational ? 1 : 0));
+  return aNbValues * sizeof(Standard_Real) + sizeof(BSplCLib_Cache) + sizeof(TColStd_HArray2OfReal);
+}
+
+//=================================================================================================
+
+Standard_Integer BSplCLib_MultiSpanCache::locateSlot(const Standard_Real         theParameter,
+                                                     const TColStd_Array1OfReal& theFlatKnots,
+                                                     Standard_Boolean&           theIsNew)
+{
+  // the span is located in the same way as by BSplCLib_Cache::BuildCache()
+  Standard_Real aParam = myParams.PeriodicNormalization(theParameter);
+  myParams.LocateParameter(aParam, theFlatKnots);
+  return mySlots.Slot(myParams.SpanIndex - myParams.SpanIndexMin, theIsNew);
+}
+
+//=================================================================================================
+
+const Handle(BSplCLib_Cache)& BSplCLib_MultiSpanCache::Cache(
+  const Standard_Real         theParameter,
+  const TColStd_Array1OfReal& theFlatKnots,
+  const TColgp_Array1OfPnt2d& thePoles2d,
+  const TColStd_Array1OfReal* theWeights)
+{
+  Standard_Boolean       isNew = Standard_False;
+  const Standard_Integer aSlot = locateSlot(theParameter, theFlatKnots, isNew);
+  return fillCache(myCaches.ChangeValue(aSlot),
+                   isNew,
+                   myParams,
+                   theParameter,
+                   theFlatKnots,
+                   thePoles2d,
+                   theWeights);
+}
+
+//=================================================================================================
+
+const Handle(BSplCLib_Cache)& BSplCLib_MultiSpanCache::Cache(
+  const Standard_Real         theParameter,
+  const TColStd_Array1OfReal& theFlatKnots,
+  const TColgp_Array1OfPnt&   thePoles,
+  const TColStd_Array1OfReal* theWeights)
+{
+  Standard_Boolean       isNew = Standard_False;
+  const Standard_Integer aSlot = locateSlot(theParameter, theFlatKnots, isNew);
+  return fillCache(myCaches.ChangeValue(aSlot),
+                   isNew,
+                   myParams,
+                   theParameter,
+                   theFlatKnots,
+                   thePoles,
+                   theWeights);
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BSplCLib_MultiSpanCache_Headerfile
+#define _BSplCLib_MultiSpanCache_Headerfile
+
+#include <BSplCLib_Cache.hxx>
+#include <BSplCLib_CacheSlots.hxx>
+
+//! \brief A cache of several spans of Bezier and B-spline curves.
+//!
+//! BSplCLib_Cache keeps the data of a single span and has to be recomputed each time
+//! the evaluated parameter leaves it. This class keeps caches of the spans already visited
+//! within the memory limit, so that evaluations jumping between spans reuse them.
+//! If the caches of all spans fit into the limit, each span gets its own cache;
+//! otherwise the cache of the least recently used span is recomputed for the new one.
+//! The spans of uniform knots are located directly, without dichotomy.
+class BSplCLib_MultiSpanCache : public Standard_Transient
+{
+public:
+  //! Constructor, prepares data structures for caching.
+  //! \param theDegree     degree of the curve
+  //! \param thePeriodic   identify whether the curve is periodic
+  //! \param theFlatKnots  knots of Bezier/B-spline curve (with repetitions)
+  //! \param theDimension  dimension of the curve (2 or 3)
+  //! \param theIsRational identify whether the curve is rational
+  //! \param theMaxMemory  memory limit for the caches in bytes,
+  //!                      the cache of one span is kept in any case
+  Standard_EXPORT BSplCLib_MultiSpanCache(const Standard_Integer      theDegree,
+                                          const Standard_Boolean      thePeriodic,
+                                          const TColStd_Array1OfReal& theFlatKnots,
+                                          const Standard_Integer      theDimension,
+                                          const Standard_Boolean      theIsRational,
+                                          const Standard_Size         theMaxMemory);
+
+  //! Returns the cache of the span containing the parameter of 2D curve,
+  //! the cache is computed if the span has not been stored yet.
+  //! \param theParameter  parameter of the point placed in the span
+  //! \param theFlatKnots  knots of Bezier/B-spline curve (with repetitions)
+  //! \param thePoles2d    array of poles of 2D curve
+  //! \param theWeights    array of weights of corresponding poles
+  Standard_EXPORT const Handle(BSplCLib_Cache)& Cache(const Standard_Real         theParameter,
+                                                      const TColStd_Array1OfReal& theFlatKnots,
+                                                      const TColgp_Array1OfPnt2d& thePoles2d,
+                                                      const TColStd_Array1OfReal* theWeights);
+
+  //! Returns the cache of the span containing the parameter of 3D curve,
+  //! the cache is computed if the span has not been stored yet.
+  //! \param theParameter  parameter of the point placed in the span
+  //! \param theFlatKnots  knots of Bezier/B-spline curve (with repetitions)
+  //! \param thePoles      array of poles of 3D curve
+  //! \param theWeights    array of weights of corresponding poles
+  Standard_EXPORT const Handle(BSplCLib_Cache)& Cache(const Standard_Real         theParameter,
+                                                      const TColStd_Array1OfReal& theFlatKnots,
+                                                      const TColgp_Array1OfPnt&   thePoles,
+                                                      const TColStd_Array1OfReal* theWeights);
+
+  //! Returns the maximal number of stored spans.
+  Standard_Integer MaxNbSpans() const { return mySlots.NbSlots(); }
+
+  //! Returns the number of stored spans.
+  Standard_Integer NbSpans() const { return mySlots.NbUsedSlots(); }
+
+  //! Returns the approximate memory occupied by the cache of one span in bytes.
+  Standard_EXPORT static Standard_Size SpanMemory(const Standard_Integer theDegree,
+                                                  const Standard_Integer theDimension,
+                                                  const Standard_Boolean theIsRational);
+
+  DEFINE_STANDARD_RTTIEXT(BSplCLib_MultiSpanCache, Standard_Transient)
+
+private:
+  //! Returns the slot of the span containing the parameter.
+  Standard_Integer locateSlot(const Standard_Real         theParameter,
+                              const TColStd_Array1OfReal& theFlatKnots,
+                              Standard_Boolean&           theIsNew);
+
+  // copying is prohibited
+  BSplCLib_MultiSpanCache(const BSplCLib_MultiSpanCache&);
+  void operator=(const BSplCLib_MultiSpanCache&);
+
+private:
+  BSplCLib_CacheParams                       myParams; //!< parameters used to locate spans
+  BSplCLib_CacheSlots                        mySlots;  //!< assignment of spans to caches
+  NCollection_Array1<Handle(BSplCLib_Cache)> myCaches; //!< caches of stored spans
+};
+
+DEFINE_STANDARD_HANDLE(BSplCLib_MultiSpanCache, Standard_Transient)
+
+#endif
@@ -12,8 +12,11 @@ set(OCCT_BSplCLib_FILES
   BSplCLib_Cache.cxx
   BSplCLib_Cache.hxx
   BSplCLib_CacheParams.hxx
+  BSplCLib_CacheSlots.hxx
   BSplCLib_CurveComputation.gxx
   BSplCLib_EvaluatorFunction.hxx
   BSplCLib_KnotDistribution.hxx
   BSplCLib_MultDistribution.hxx
+  BSplCLib_MultiSpanCache.cxx
+  BSplCLib_MultiSpanCache.hxx
 )
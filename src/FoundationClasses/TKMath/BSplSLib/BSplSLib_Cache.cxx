@@ -385,3 +385,204 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
   theCurvatureV.Multiply(anInvV * anInvV);
   theCurvatureUV.Multiply(anInvU * anInvV);
 }
+
+void BSplSLib_Cache::D0Grid(const TColStd_Array1OfReal& theUParams,
+                            const Standard_Integer      theUFrom,
+                            const Standard_Integer      theUTo,
+                            const TColStd_Array1OfReal& theVParams,
+                            const Standard_Integer      theVFrom,
+                            const Standard_Integer      theVTo,
+                            TColgp_Array2OfPnt&         thePoints) const
+{
+  if (theUFrom > theUTo || theVFrom > theVTo)
+    return;
+
+  // The grid is evaluated by lines along the variable with maximal degree (outer loop),
+  // the variable with minimal degree runs along the line (inner loop)
+  const Standard_Boolean      isMaxU       = myParamsU.Degree > myParamsV.Degree;
+  const BSplCLib_CacheParams& anOuter      = isMaxU ? myParamsU : myParamsV;
+  const BSplCLib_CacheParams& anInner      = isMaxU ? myParamsV : myParamsU;
+  const TColStd_Array1OfReal& anOuterArray = isMaxU ? theUParams : theVParams;
+  const TColStd_Array1OfReal& anInnerArray = isMaxU ? theVParams : theUParams;
+  const Standard_Integer      anOuterFrom  = isMaxU ? theUFrom : theVFrom;
+  const Standard_Integer      anOuterTo    = isMaxU ? theUTo : theVTo;
+  const Standard_Integer      anInnerFrom  = isMaxU ? theVFrom : theUFrom;
+  const Standard_Integer      anInnerTo    = isMaxU ? theVTo : theUTo;
+  const Standard_Integer      aRowShift    = thePoints.LowerRow() - theUParams.Lower();
+  const Standard_Integer      aColShift    = thePoints.LowerCol() - theVParams.Lower();
+
+  // BSplSLib uses different convention for span parameters than BSplCLib
+  // (Start is in the middle of the span and length is half-span),
+  // thus we need to amend them here
+  const Standard_Real anOuterLength = 0.5 * anOuter.SpanLength;
+  const Standard_Real anOuterStart  = anOuter.SpanStart + anOuterLength;
+  const Standard_Real anInnerLength = 0.5 * anInner.SpanLength;
+  const Standard_Real anInnerStart  = anInner.SpanStart + anInnerLength;
+
+  Standard_Real*         aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Integer aDimension  = myIsRational ? 4 : 3;
+  const Standard_Integer aCacheCols  = myPolesWeights->RowLength();
+  const Standard_Integer aMinDegree  = anInner.Degree;
+  const Standard_Integer aMaxDegree  = anOuter.Degree;
+
+  // normalized parameters along the line are computed once for all lines
+  NCollection_LocalArray<Standard_Real> anInnerParams(anInnerTo - anInnerFrom + 1);
+  for (Standard_Integer anIndex = anInnerFrom; anIndex <= anInnerTo; ++anIndex)
+  {
+    anInnerParams[anIndex - anInnerFrom] =
+      (anInner.PeriodicNormalization(anInnerArray(anIndex)) - anInnerStart) / anInnerLength;
+  }
+
+  // clang-format off
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols); // array for intermediate results
+  // clang-format on
+  Standard_Real aPoint[4];
+  for (Standard_Integer anOuterIndex = anOuterFrom; anOuterIndex <= anOuterTo; ++anOuterIndex)
+  {
+    const Standard_Real anOuterParam =
+      (anOuter.PeriodicNormalization(anOuterArray(anOuterIndex)) - anOuterStart) / anOuterLength;
+
+    // Calculate intermediate value of cached polynomial along columns once per line
+    PLib::NoDerivativeEvalPolynomial(anOuterParam,
+                                     aMaxDegree,
+                                     aCacheCols,
+                                     aMaxDegree * aCacheCols,
+                                     aPolesArray[0],
+                                     aTransientCoeffs[0]);
+
+    for (Standard_Integer anInnerIndex = anInnerFrom; anInnerIndex <= anInnerTo; ++anInnerIndex)
+    {
+      PLib::NoDerivativeEvalPolynomial(anInnerParams[anInnerIndex - anInnerFrom],
+                                       aMinDegree,
+                                       aDimension,
+                                       aDimension * aMinDegree,
+                                       aTransientCoeffs[0],
+                                       aPoint[0]);
+
+      gp_Pnt& aResult = isMaxU ? thePoints(anOuterIndex + aRowShift, anInnerIndex + aColShift)
+                               : thePoints(anInnerIndex + aRowShift, anOuterIndex + aColShift);
+      aResult.SetCoord(aPoint[0], aPoint[1], aPoint[2]);
+      if (myIsRational)
+        aResult.ChangeCoord().Divide(aPoint[3]);
+    }
+  }
+}
+
+void BSplSLib_Cache::D1Grid(const TColStd_Array1OfReal& theUParams,
+                            const Standard_Integer      theUFrom,
+                            const Standard_Integer      theUTo,
+                            const TColStd_Array1OfReal& theVParams,
+                            const Standard_Integer      theVFrom,
+                            const Standard_Integer      theVTo,
+                            TColgp_Array2OfPnt&         thePoints,
+                            TColgp_Array2OfVec&         theTangentsU,
+                            TColgp_Array2OfVec&         theTangentsV) const
+{
+  if (theUFrom > theUTo || theVFrom > theVTo)
+    return;
+
+  // The grid is evaluated by lines along the variable with maximal degree (outer loop),
+  // the variable with minimal degree runs along the line (inner loop)
+  const Standard_Boolean      isMaxU       = myParamsU.Degree > myParamsV.Degree;
+  const BSplCLib_CacheParams& anOuter      = isMaxU ? myParamsU : myParamsV;
+  const BSplCLib_CacheParams& anInner      = isMaxU ? myParamsV : myParamsU;
+  const TColStd_Array1OfReal& anOuterArray = isMaxU ? theUParams : theVParams;
+  const TColStd_Array1OfReal& anInnerArray = isMaxU ? theVParams : theUParams;
+  const Standard_Integer      anOuterFrom  = isMaxU ? theUFrom : theVFrom;
+  const Standard_Integer      anOuterTo    = isMaxU ? theUTo : theVTo;
+  const Standard_Integer      anInnerFrom  = isMaxU ? theVFrom : theUFrom;
+  const Standard_Integer      anInnerTo    = isMaxU ? theVTo : theUTo;
+
+  // BSplSLib uses different convention for span parameters than BSplCLib
+  // (Start is in the middle of the span and length is half-span),
+  // thus we need to amend them here
+  const Standard_Real anOuterLength = 0.5 * anOuter.SpanLength;
+  const Standard_Real anOuterStart  = anOuter.SpanStart + anOuterLength;
+  const Standard_Real anInnerLength = 0.5 * anInner.SpanLength;
+  const Standard_Real anInnerStart  = anInner.SpanStart + anInnerLength;
+  const Standard_Real anInvOuter    = 1.0 / anOuterLength;
+  const Standard_Real anInvInner    = 1.0 / anInnerLength;
+
+  Standard_Real*         aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Integer aCacheCols  = myPolesWeights->RowLength();
+  const Standard_Integer aMinDegree  = anInner.Degree;
+  const Standard_Integer aMaxDegree  = anOuter.Degree;
+
+  // normalized parameters along the line are computed once for all lines
+  NCollection_LocalArray<Standard_Real> anInnerParams(anInnerTo - anInnerFrom + 1);
+  for (Standard_Integer anIndex = anInnerFrom; anIndex <= anInnerTo; ++anIndex)
+  {
+    anInnerParams[anIndex - anInnerFrom] =
+      (anInner.PeriodicNormalization(anInnerArray(anIndex)) - anInnerStart) * anInvInner;
+  }
+
+  // clang-format off
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols<<1); // array for intermediate results
+  // clang-format on
+  Standard_Real aPntDeriv[12]; // result storage (point and derivative coordinates)
+  Standard_Real aTempStorage[12];
+  for (Standard_Integer anOuterIndex = anOuterFrom; anOuterIndex <= anOuterTo; ++anOuterIndex)
+  {
+    const Standard_Real anOuterParam =
+      (anOuter.PeriodicNormalization(anOuterArray(anOuterIndex)) - anOuterStart) * anInvOuter;
+
+    // Calculate intermediate values and derivatives of bivariate polynomial along variable with
+    // maximal degree once per line
+    PLib::EvalPolynomial(anOuterParam,
+                         1,
+                         aMaxDegree,
+                         aCacheCols,
+                         aPolesArray[0],
+                         aTransientCoeffs[0]);
+
+    for (Standard_Integer anInnerIndex = anInnerFrom; anInnerIndex <= anInnerTo; ++anInnerIndex)
+    {
+      const Standard_Real anInnerParam = anInnerParams[anInnerIndex - anInnerFrom];
+      Standard_Integer    aDimension   = myIsRational ? 4 : 3;
+
+      // Calculate a point on surface and a derivative along variable with minimal degree
+      PLib::EvalPolynomial(anInnerParam,
+                           1,
+                           aMinDegree,
+                           aDimension,
+                           aTransientCoeffs[0],
+                           aPntDeriv[0]);
+
+      // Calculate derivative along variable with maximal degree
+      PLib::NoDerivativeEvalPolynomial(anInnerParam,
+                                       aMinDegree,
+                                       aDimension,
+                                       aMinDegree * aDimension,
+                                       aTransientCoeffs[aCacheCols],
+                                       aPntDeriv[aDimension << 1]);
+
+      Standard_Real* aResult = aPntDeriv;
+      if (myIsRational) // calculate derivatives divided by weight's derivatives
+      {
+        BSplSLib::RationalDerivative(1, 1, 1, 1, aPntDeriv[0], aTempStorage[0]);
+        aResult = aTempStorage;
+        aDimension--;
+      }
+
+      // offsets of the point in the output arrays
+      const Standard_Integer aRow   = (isMaxU ? anOuterIndex : anInnerIndex) - theUParams.Lower();
+      const Standard_Integer aCol   = (isMaxU ? anInnerIndex : anOuterIndex) - theVParams.Lower();
+      const Standard_Integer aShift = aDimension << 1;
+
+      gp_Vec& aTangentU =
+        theTangentsU(theTangentsU.LowerRow() + aRow, theTangentsU.LowerCol() + aCol);
+      gp_Vec& aTangentV =
+        theTangentsV(theTangentsV.LowerRow() + aRow, theTangentsV.LowerCol() + aCol);
+      gp_Vec& anInnerTangent = isMaxU ? aTangentV : aTangentU;
+      gp_Vec& anOuterTangent = isMaxU ? aTangentU : aTangentV;
+      thePoints(thePoints.LowerRow() + aRow, thePoints.LowerCol() + aCol)
+        .SetCoord(aResult[0], aResult[1], aResult[2]);
+      anInnerTangent.SetCoord(aResult[aDimension] * anInvInner,
+                              aResult[aDimension + 1] * anInvInner,
+                              aResult[aDimension + 2] * anInvInner);
+      anOuterTangent.SetCoord(aResult[aShift] * anInvOuter,
+                              aResult[aShift + 1] * anInvOuter,
+                              aResult[aShift + 2] * anInvOuter);
+    }
+  }
+}
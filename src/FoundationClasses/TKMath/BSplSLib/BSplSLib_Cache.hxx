@@ -16,6 +16,8 @@
 
 #include <TColStd_HArray2OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
 
@@ -104,6 +106,42 @@ public:
                           gp_Vec&              theCurvatureV,
                           gp_Vec&              theCurvatureUV) const;
 
+  //! Calculates the points of the grid of parameters lying in the current span.
+  //! The cached polynomial is evaluated along the parameter of the maximal degree once per
+  //! line of the grid and the intermediate coefficients are shared by all points of the line,
+  //! which makes evaluation of the grid cheaper than evaluation of its points one by one.
+  //! Validity of the cache for the parameters is not verified.
+  //! \param[in]  theUParams  U parameters of the grid
+  //! \param[in]  theUFrom    index of the first U parameter to be evaluated
+  //! \param[in]  theUTo      index of the last U parameter to be evaluated
+  //! \param[in]  theVParams  V parameters of the grid
+  //! \param[in]  theVFrom    index of the first V parameter to be evaluated
+  //! \param[in]  theVTo      index of the last V parameter to be evaluated
+  //! \param[out] thePoints   points of the grid, the point of theUParams(i) and theVParams(j)
+  //!                         is stored into the i-th row and j-th column counted from the lower
+  //!                         bounds of the arrays
+  Standard_EXPORT void D0Grid(const TColStd_Array1OfReal& theUParams,
+                              const Standard_Integer      theUFrom,
+                              const Standard_Integer      theUTo,
+                              const TColStd_Array1OfReal& theVParams,
+                              const Standard_Integer      theVFrom,
+                              const Standard_Integer      theVTo,
+                              TColgp_Array2OfPnt&         thePoints) const;
+
+  //! Calculates the points and the first derivatives of the grid of parameters lying in the
+  //! current span, see D0Grid() for the description of parameters.
+  //! \param[out] theTangentsU  tangent vectors along U axis in the calculated points
+  //! \param[out] theTangentsV  tangent vectors along V axis in the calculated points
+  Standard_EXPORT void D1Grid(const TColStd_Array1OfReal& theUParams,
+                              const Standard_Integer      theUFrom,
+                              const Standard_Integer      theUTo,
+                              const TColStd_Array1OfReal& theVParams,
+                              const Standard_Integer      theVFrom,
+                              const Standard_Integer      theVTo,
+                              TColgp_Array2OfPnt&         thePoints,
+                              TColgp_Array2OfVec&         theTangentsU,
+                              TColgp_Array2OfVec&         theTangentsV) const;
+
   DEFINE_STANDARD_RTTIEXT(BSplSLib_Cache, Standard_Transient)
 
 private:
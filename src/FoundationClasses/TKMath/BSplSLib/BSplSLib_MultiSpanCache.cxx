@@ -0,0 +1,98 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplSLib_MultiSpanCache.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_MultiSpanCache, Standard_Transient)
+
+//=================================================================================================
+
+BSplSLib_MultiSpanCache::BSplSLib_MultiSpanCache(const Standard_Integer      theDegreeU,
+                                                 const Standard_Boolean      thePeriodicU,
+                                                 const TColStd_Array1OfReal& theFlatKnotsU,
+                                                 const Standard_Integer      theDegreeV,
+                                                 const Standard_Boolean      thePeriodicV,
+                                                 const TColStd_Array1OfReal& theFlatKnotsV,
+                                                 const Standard_Boolean      theIsRational,
+                                                 const Standard_Size         theMaxMemory)
+    : myParamsU(theDegreeU, thePeriodicU, theFlatKnotsU, Standard_True),
+      myParamsV(theDegreeV, thePeriodicV, theFlatKnotsV, Standard_True)
+{
+  const Standard_Size aNbSpans =
+    Standard_Size(myParamsU.SpanIndexMax - myParamsU.SpanIndexMin + 1)
+    * Standard_Size(myParamsV.SpanIndexMax - myParamsV.SpanIndexMin + 1);
+  const Standard_Size aMaxNbSlots =
+    theMaxMemory / SpanMemory(theDegreeU, theDegreeV, theIsRational);
+  mySlots.Init(aNbSpans, Standard_Integer(std::min(aMaxNbSlots, aNbSpans)));
+  myCaches.Resize(0, mySlots.NbSlots() - 1, Standard_False);
+}
+
+//=================================================================================================
+
+Standard_Size BSplSLib_MultiSpanCache::SpanMemory(const Standard_Integer theDegreeU,
+                                                  const Standard_Integer theDegreeV,
+                                                  const Standard_Boolean theIsRational)
+{
+  const Standard_Size aNbValues =
+    Standard_Size(theDegreeU + 1) * (theDegreeV + 1) * (theIsRational ? 4 : 3);
+  return aNbValues * sizeof(Standard_Real) + sizeof(BSplSLib_Cache) + sizeof(TColStd_HArray2OfReal);
+}
+
+//=================================================================================================
+
+const Handle(BSplSLib_Cache)& BSplSLib_MultiSpanCache::Cache(
+  const Standard_Real         theParameterU,
+  const Standard_Real         theParameterV,
+  const TColStd_Array1OfReal& theFlatKnotsU,
+  const TColStd_Array1OfReal& theFlatKnotsV,
+  const TColgp_Array2OfPnt&   thePoles,
+  const TColStd_Array2OfReal* theWeights)
+{
+  // the span is located in the same way as by BSplSLib_Cache::BuildCache()
+  Standard_Real aParamU = myParamsU.PeriodicNormalization(theParameterU);
+  Standard_Real aParamV = myParamsV.PeriodicNormalization(theParameterV);
+  myParamsU.LocateParameter(aParamU, theFlatKnotsU);
+  myParamsV.LocateParameter(aParamV, theFlatKnotsV);
+
+  // spans are numbered row by row
+  const Standard_Integer aNbSpansV = myParamsV.SpanIndexMax - myParamsV.SpanIndexMin + 1;
+  const Standard_Integer aSpanU    = myParamsU.SpanIndex - myParamsU.SpanIndexMin;
+  const Standard_Integer aSpanV    = myParamsV.SpanIndex - myParamsV.SpanIndexMin;
+
+  Standard_Boolean        isNew  = Standard_False;
+  const Standard_Integer  aSlot  = mySlots.Slot(aSpanU * aNbSpansV + aSpanV, isNew);
+  Handle(BSplSLib_Cache)& aCache = myCaches.ChangeValue(aSlot);
+  if (isNew)
+  {
+    if (aCache.IsNull())
+    {
+      aCache = new BSplSLib_Cache(myParamsU.Degree,
+                                  myParamsU.IsPeriodic,
+                                  theFlatKnotsU,
+                                  myParamsV.Degree,
+                                  myParamsV.IsPeriodic,
+                                  theFlatKnotsV,
+                                  theWeights);
+    }
+    aCache->BuildCache(theParameterU,
+                       theParameterV,
+                       theFlatKnotsU,
+                       theFlatKnotsV,
+                       thePoles,
+                       theWeights);
+  }
+  return aCache;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BSplSLib_MultiSpanCache_Headerfile
+#define _BSplSLib_MultiSpanCache_Headerfile
+
+#include <BSplCLib_CacheSlots.hxx>
+#include <BSplSLib_Cache.hxx>
+
+//! \brief A cache of several spans of Bezier and B-spline surfaces.
+//!
+//! BSplSLib_Cache keeps the data of a single span and has to be recomputed each time
+//! the evaluated point leaves it. This class keeps caches of the spans already visited
+//! within the memory limit, so that evaluations jumping between spans (projection, sampling,
+//! marching across the seam) reuse them.
+//! If the caches of all spans fit into the limit, each span gets its own cache;
+//! otherwise the cache of the least recently used span is recomputed for the new one.
+//! The spans of uniform knots are located directly, without dichotomy.
+class BSplSLib_MultiSpanCache : public Standard_Transient
+{
+public:
+  //! Constructor, prepares data structures for caching.
+  //! \param theDegreeU    degree along the first parameter (U) of the surface
+  //! \param thePeriodicU  identify the surface is periodical along U axis
+  //! \param theFlatKnotsU knots of the surface (with repetition) along U axis
+  //! \param theDegreeV    degree along the second parameter (V) of the surface
+  //! \param thePeriodicV  identify the surface is periodical along V axis
+  //! \param theFlatKnotsV knots of the surface (with repetition) along V axis
+  //! \param theIsRational identify whether the surface is rational
+  //! \param theMaxMemory  memory limit for the caches in bytes,
+  //!                      the cache of one span is kept in any case
+  Standard_EXPORT BSplSLib_MultiSpanCache(const Standard_Integer      theDegreeU,
+                                          const Standard_Boolean      thePeriodicU,
+                                          const TColStd_Array1OfReal& theFlatKnotsU,
+                                          const Standard_Integer      theDegreeV,
+                                          const Standard_Boolean      thePeriodicV,
+                                          const TColStd_Array1OfReal& theFlatKnotsV,
+                                          const Standard_Boolean      theIsRational,
+                                          const Standard_Size         theMaxMemory);
+
+  //! Returns the cache of the span containing the point,
+  //! the cache is computed if the span has not been stored yet.
+  //! \param theParameterU  first parameter of the point placed in the span
+  //! \param theParameterV  second parameter of the point placed in the span
+  //! \param theFlatKnotsU  flat knots of the surface along U axis
+  //! \param theFlatKnotsV  flat knots of the surface along V axis
+  //! \param thePoles       array of poles of the surface
+  //! \param theWeights     array of weights of corresponding poles
+  Standard_EXPORT const Handle(BSplSLib_Cache)& Cache(const Standard_Real         theParameterU,
+                                                      const Standard_Real         theParameterV,
+                                                      const TColStd_Array1OfReal& theFlatKnotsU,
+                                                      const TColStd_Array1OfReal& theFlatKnotsV,
+                                                      const TColgp_Array2OfPnt&   thePoles,
+                                                      const TColStd_Array2OfReal* theWeights);
+
+  //! Returns the maximal number of stored spans.
+  Standard_Integer MaxNbSpans() const { return mySlots.NbSlots(); }
+
+  //! Returns the number of stored spans.
+  Standard_Integer NbSpans() const { return mySlots.NbUsedSlots(); }
+
+  //! Returns the approximate memory occupied by the cache of one span in bytes.
+  Standard_EXPORT static Standard_Size SpanMemory(const Standard_Integer theDegreeU,
+                                                  const Standard_Integer theDegreeV,
+                                                  const Standard_Boolean theIsRational);
+
+  DEFINE_STANDARD_RTTIEXT(BSplSLib_MultiSpanCache, Standard_Transient)
+
+private:
+  // copying is prohibited
+  BSplSLib_MultiSpanCache(const BSplSLib_MultiSpanCache&);
+  void operator=(const BSplSLib_MultiSpanCache&);
+
+private:
+  BSplCLib_CacheParams                       myParamsU; //!< parameters used to locate U spans
+  BSplCLib_CacheParams                       myParamsV; //!< parameters used to locate V spans
+  BSplCLib_CacheSlots                        mySlots;   //!< assignment of spans to caches
+  NCollection_Array1<Handle(BSplSLib_Cache)> myCaches;  //!< caches of stored spans
+};
+
+DEFINE_STANDARD_HANDLE(BSplSLib_MultiSpanCache, Standard_Transient)
+
+#endif
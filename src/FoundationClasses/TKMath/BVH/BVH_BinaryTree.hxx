@@ -17,9 +17,11 @@
 #define _BVH_BinaryTree_Header
 
 #include <BVH_QuadTree.hxx>
+#include <BVH_Set.hxx>
 
 #include <deque>
 #include <tuple>
+#include <vector>
 
 //! Specialization of binary BVH tree.
 template <class T, int N>
@@ -146,6 +148,14 @@ public: //! @name methods specific to binary BVH
   //! the same sets of geometric objects with different methods.
   T EstimateSAH() const;
 
+  //! Updates the boxes of the nodes bottom-up from the boxes of the primitives of the given set,
+  //! keeping the topology of the tree. The set should contain the same primitives in the same
+  //! order as the one used for building the tree. This is much cheaper than rebuilding when the
+  //! primitives are moved, but the quality of the tree degrades with the distance of movement,
+  //! so the returned value of SAH (the same as the one of EstimateSAH()) of the refitted tree
+  //! should be compared with the one of the built tree to decide when to rebuild it.
+  T Refit(const BVH_Set<T, N>& theSet);
+
   //! Collapses the tree into QBVH an returns it. As a result, each
   //! 2-nd level of current tree is kept and the rest are discarded.
   BVH_Tree<T, N, BVH_QuadTree>* CollapseToQuadTree() const;
@@ -208,6 +218,61 @@ T BVH_Tree<T, N, BVH_BinaryTree>::EstimateSAH() const
 
 //=================================================================================================
 
+template <class T, int N>
+T BVH_Tree<T, N, BVH_BinaryTree>::Refit(const BVH_Set<T, N>& theSet)
+{
+  if (this->Length() == 0)
+  {
+    return static_cast<T>(0.0);
+  }
+
+  // Order the nodes by levels, so that the children follow their parents
+  std::vector<int> aNodes;
+  aNodes.reserve(this->Length());
+  aNodes.push_back(0);
+  for (size_t anIdx = 0; anIdx < aNodes.size(); ++anIdx)
+  {
+    if (!this->IsOuter(aNodes[anIdx]))
+    {
+      aNodes.push_back(Child<0>(aNodes[anIdx]));
+      aNodes.push_back(Child<1>(aNodes[anIdx]));
+    }
+  }
+
+  // Update the nodes in reversed order, accumulating the areas
+  // of the nodes weighted by their costs to compute SAH
+  T aSAH = static_cast<T>(0.0);
+  for (size_t anIdx = aNodes.size(); anIdx > 0; --anIdx)
+  {
+    const int     aNode = aNodes[anIdx - 1];
+    BVH_Box<T, N> aBox;
+    T             aCost;
+    if (this->IsOuter(aNode))
+    {
+      for (int anElem = this->BegPrimitive(aNode); anElem <= this->EndPrimitive(aNode); ++anElem)
+      {
+        aBox.Combine(theSet.Box(anElem));
+      }
+      aCost = static_cast<T>(this->NbPrimitives(aNode));
+    }
+    else
+    {
+      aBox = BVH_Box<T, N>(this->MinPoint(Child<0>(aNode)), this->MaxPoint(Child<0>(aNode)));
+      aBox.Combine(BVH_Box<T, N>(this->MinPoint(Child<1>(aNode)), this->MaxPoint(Child<1>(aNode))));
+      aCost = static_cast<T>(2.0);
+    }
+
+    this->MinPoint(aNode) = aBox.CornerMin();
+    this->MaxPoint(aNode) = aBox.CornerMax();
+    aSAH += aBox.Area() * aCost;
+  }
+
+  const T aRootArea = BVH_Box<T, N>(this->MinPoint(0), this->MaxPoint(0)).Area();
+  return aRootArea > static_cast<T>(0.0) ? aSAH / aRootArea : static_cast<T>(0.0);
+}
+
+//=================================================================================================
+
 template <class T, int N>
 BVH_Tree<T, N, BVH_QuadTree>* BVH_Tree<T, N, BVH_BinaryTree>::CollapseToQuadTree() const
 {
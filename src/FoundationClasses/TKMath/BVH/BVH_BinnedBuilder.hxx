@@ -17,8 +17,10 @@
 #define BVH_BinnedBuilder_HeaderFile
 
 #include <BVH_QueueBuilder.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <algorithm>
+#include <vector>
 
 #if defined(_WIN32) && defined(max)
   #undef max
@@ -45,7 +47,8 @@ struct BVH_Bin
 //! better). For optimal results, use 32 - 48 bins. However, reasonable
 //! performance is provided even for 4 - 8 bins (it is only 10-20% lower
 //! in comparison with optimal settings). Note that multiple threads can
-//! be used only with thread safe BVH primitive sets.
+//! be used only with thread safe BVH primitive sets. In parallel mode,
+//! the primitives of large nodes are also arranged into bins in parallel.
 template <class T, int N, int Bins = BVH_Constants_NbBinsOptimal>
 class BVH_BinnedBuilder : public BVH_QueueBuilder<T, N>
 {
@@ -92,6 +95,19 @@ protected:
                              BVH_BinVector&         theBins,
                              const Standard_Integer theAxis) const;
 
+  //! Arranges primitives of the given range into bins.
+  void fillBins(BVH_Set<T, N>*         theSet,
+                const Standard_Integer theBegPrimitive,
+                const Standard_Integer theEndPrimitive,
+                const T                theMin,
+                const T                theInverseStep,
+                BVH_Bin<T, N>*         theBins,
+                const Standard_Integer theAxis) const;
+
+protected:
+  //! Minimal number of primitives of the node to arrange them into bins in parallel.
+  static const Standard_Integer THE_PARALLEL_BINNING_MIN_SIZE = 65536;
+
 private:
   // clang-format off
   Standard_Boolean myUseMainAxis; //!< Defines whether to search for the best split or use the widest axis
@@ -110,13 +126,61 @@ void BVH_BinnedBuilder<T, N, Bins>::getSubVolumes(BVH_Set<T, N>*         theSet,
   const T aMin          = BVH::VecComp<T, N>::Get(theBVH->MinPoint(theNode), theAxis);
   const T aMax          = BVH::VecComp<T, N>::Get(theBVH->MaxPoint(theNode), theAxis);
   const T anInverseStep = static_cast<T>(Bins) / (aMax - aMin);
-  for (Standard_Integer anIdx = theBVH->BegPrimitive(theNode);
-       anIdx <= theBVH->EndPrimitive(theNode);
-       ++anIdx)
+
+  const Standard_Integer aBegPrimitive = theBVH->BegPrimitive(theNode);
+  const Standard_Integer aEndPrimitive = theBVH->EndPrimitive(theNode);
+  const Standard_Integer aNbPrimitives = aEndPrimitive - aBegPrimitive + 1;
+  const Standard_Integer aNbChunks =
+    std::min(this->myNumOfThreads, aNbPrimitives / (THE_PARALLEL_BINNING_MIN_SIZE / 4));
+  if (aNbPrimitives < THE_PARALLEL_BINNING_MIN_SIZE || aNbChunks < 2)
+  {
+    fillBins(theSet, aBegPrimitive, aEndPrimitive, aMin, anInverseStep, theBins, theAxis);
+    return;
+  }
+
+  // Arrange the chunks of primitives into the local bins, then merge them
+  std::vector<BVH_Bin<T, N>> aChunkBins(aNbChunks * Bins);
+  OSD_Parallel::For(0, aNbChunks, [&](const Standard_Integer theChunk) {
+    const Standard_Integer aChunkBeg = aBegPrimitive + aNbPrimitives / aNbChunks * theChunk;
+    const Standard_Integer aChunkEnd = theChunk == aNbChunks - 1
+                                         ? aEndPrimitive
+                                         : aChunkBeg + aNbPrimitives / aNbChunks - 1;
+    fillBins(theSet,
+             aChunkBeg,
+             aChunkEnd,
+             aMin,
+             anInverseStep,
+             &aChunkBins[theChunk * Bins],
+             theAxis);
+  });
+
+  for (Standard_Integer aChunk = 0; aChunk < aNbChunks; ++aChunk)
+  {
+    for (Standard_Integer aBinIndex = 0; aBinIndex < Bins; ++aBinIndex)
+    {
+      const BVH_Bin<T, N>& aBin = aChunkBins[aChunk * Bins + aBinIndex];
+      theBins[aBinIndex].Count += aBin.Count;
+      theBins[aBinIndex].Box.Combine(aBin.Box);
+    }
+  }
+}
+
+//=================================================================================================
+
+template <class T, int N, int Bins>
+void BVH_BinnedBuilder<T, N, Bins>::fillBins(BVH_Set<T, N>*         theSet,
+                                             const Standard_Integer theBegPrimitive,
+                                             const Standard_Integer theEndPrimitive,
+                                             const T                theMin,
+                                             const T                theInverseStep,
+                                             BVH_Bin<T, N>*         theBins,
+                                             const Standard_Integer theAxis) const
+{
+  for (Standard_Integer anIdx = theBegPrimitive; anIdx <= theEndPrimitive; ++anIdx)
   {
     typename BVH_Set<T, N>::BVH_BoxNt aBox = theSet->Box(anIdx);
     Standard_Integer                  aBinIndex =
-      BVH::IntFloor<T>((theSet->Center(anIdx, theAxis) - aMin) * anInverseStep);
+      BVH::IntFloor<T>((theSet->Center(anIdx, theAxis) - theMin) * theInverseStep);
     if (aBinIndex < 0)
     {
       aBinIndex = 0;
@@ -0,0 +1,413 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BVH_BoxKernels_Header
+#define _BVH_BoxKernels_Header
+
+#include <BVH_Types.hxx>
+
+#include <limits>
+
+#if defined(__AVX__)
+  #include <immintrin.h>
+  #define BVH_BOX_KERNELS_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define BVH_BOX_KERNELS_SSE2
+#endif
+
+namespace BVH
+{
+//! Scalar implementation of the kernels testing several boxes at once.
+template <class T, int N>
+struct BoxKernelsScalar
+{
+  typedef typename BVH::VectorType<T, N>::Type BVH_VecNt;
+
+  //! Returns the bitmask of the boxes (up to 4) lying out of the query box.
+  //! The optional inside mask marks the boxes fully contained in the query box.
+  static int OutMask(const BVH_VecNt& theQueryMin,
+                     const BVH_VecNt& theQueryMax,
+                     const BVH_VecNt* theBoxesMin,
+                     const BVH_VecNt* theBoxesMax,
+                     const int        theNbBoxes,
+                     int*             theInsideMask = NULL)
+  {
+    const int aDim     = N < 3 ? N : 3;
+    int       anOut    = 0;
+    int       anInside = 0;
+    for (int aBoxIter = 0; aBoxIter < theNbBoxes; ++aBoxIter)
+    {
+      const BVH_VecNt& aMin     = theBoxesMin[aBoxIter];
+      const BVH_VecNt& aMax     = theBoxesMax[aBoxIter];
+      bool             isOut    = false;
+      bool             isInside = true;
+      for (int i = 0; i < aDim && !isOut; ++i)
+      {
+        isOut    = theQueryMin[i] > aMax[i] || theQueryMax[i] < aMin[i];
+        isInside = isInside && theQueryMin[i] <= aMin[i] && theQueryMax[i] >= aMax[i];
+      }
+      if (isOut)
+      {
+        anOut |= 1 << aBoxIter;
+      }
+      else if (isInside)
+      {
+        anInside |= 1 << aBoxIter;
+      }
+    }
+    if (theInsideMask != NULL)
+    {
+      *theInsideMask = anInside;
+    }
+    return anOut;
+  }
+
+  //! Returns the bitmask of the pairs of boxes (up to 4) which do not overlap
+  //! (bit i is set if the i-th box of the first array is out of the i-th box of the second one).
+  static int PairOutMask(const BVH_VecNt* theBoxesMin1,
+                         const BVH_VecNt* theBoxesMax1,
+                         const BVH_VecNt* theBoxesMin2,
+                         const BVH_VecNt* theBoxesMax2,
+                         const int        theNbPairs,
+                         const T          theTolerance)
+  {
+    const int aDim  = N < 3 ? N : 3;
+    int       anOut = 0;
+    for (int aPairIter = 0; aPairIter < theNbPairs; ++aPairIter)
+    {
+      for (int i = 0; i < aDim; ++i)
+      {
+        if (theBoxesMin1[aPairIter][i] > theBoxesMax2[aPairIter][i] + theTolerance
+            || theBoxesMax1[aPairIter][i] < theBoxesMin2[aPairIter][i] - theTolerance)
+        {
+          anOut |= 1 << aPairIter;
+          break;
+        }
+      }
+    }
+    return anOut;
+  }
+
+  //! Returns the bitmask of the boxes (up to 4) missed by the ray.
+  //! The optional array receives the ray parameters of entering into the boxes.
+  static int RayOutMask(const BVH_VecNt& theOrigin,
+                        const BVH_VecNt& theDirection,
+                        const BVH_VecNt* theBoxesMin,
+                        const BVH_VecNt* theBoxesMax,
+                        const int        theNbBoxes,
+                        T*               theTimeEnter = NULL)
+  {
+    const int aDim  = N < 3 ? N : 3;
+    int       anOut = 0;
+    for (int aBoxIter = 0; aBoxIter < theNbBoxes; ++aBoxIter)
+    {
+      T    anEnter = -(std::numeric_limits<T>::max)();
+      T    aLeave  = (std::numeric_limits<T>::max)();
+      bool isOut   = false;
+      for (int i = 0; i < aDim && !isOut; ++i)
+      {
+        const T aMin = theBoxesMin[aBoxIter][i] - theOrigin[i];
+        const T aMax = theBoxesMax[aBoxIter][i] - theOrigin[i];
+        if (theDirection[i] == 0)
+        {
+          // the ray is parallel to the slab
+          isOut = aMin > 0 || aMax < 0;
+          continue;
+        }
+
+        const T anInv = static_cast<T>(1) / theDirection[i];
+        const T aT0   = aMin * anInv;
+        const T aT1   = aMax * anInv;
+        anEnter       = Max(anEnter, Min(aT0, aT1));
+        aLeave        = Min(aLeave, Max(aT0, aT1));
+      }
+      if (isOut || anEnter > aLeave || aLeave < 0)
+      {
+        anOut |= 1 << aBoxIter;
+      }
+      if (theTimeEnter != NULL)
+      {
+        theTimeEnter[aBoxIter] = anEnter;
+      }
+    }
+    return anOut;
+  }
+};
+} // namespace BVH
+
+//! Kernels testing up to four boxes at once: the children of the node of BVH_QuadTree
+//! or the pairs of the children of two nodes of the binary trees.
+//! The kernels return the bitmask of rejected boxes (bit i corresponds to the i-th box).
+//!
+//! The kernels for 3D boxes of double precision are vectorized: four boxes per register
+//! with AVX, or two boxes per register with SSE2. The instruction set is chosen at compile time
+//! by the compiler options, otherwise (e.g. on other architectures) the scalar version is used.
+template <class T, int N>
+class BVH_BoxKernels : public BVH::BoxKernelsScalar<T, N>
+{
+public:
+  //! Returns true if the kernels are vectorized.
+  static Standard_Boolean IsVectorized() { return Standard_False; }
+};
+
+#if defined(BVH_BOX_KERNELS_AVX) || defined(BVH_BOX_KERNELS_SSE2)
+
+namespace BVH
+{
+  #if defined(BVH_BOX_KERNELS_AVX)
+//! Four double values in one AVX register.
+struct Packet4d
+{
+  __m256d V;
+
+  static Packet4d Load(const double* theValues) { return Packet4d{_mm256_loadu_pd(theValues)}; }
+
+  static Packet4d Set(const double theValue) { return Packet4d{_mm256_set1_pd(theValue)}; }
+
+  void Store(double* theValues) const { _mm256_storeu_pd(theValues, V); }
+
+  int Mask() const { return _mm256_movemask_pd(V); }
+
+  friend Packet4d operator+(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_add_pd(theA.V, theB.V)};
+  }
+
+  friend Packet4d operator-(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_sub_pd(theA.V, theB.V)};
+  }
+
+  friend Packet4d operator*(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_mul_pd(theA.V, theB.V)};
+  }
+
+  friend Packet4d operator|(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_or_pd(theA.V, theB.V)};
+  }
+
+  friend Packet4d operator&(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_and_pd(theA.V, theB.V)};
+  }
+
+  friend Packet4d operator>(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_cmp_pd(theA.V, theB.V, _CMP_GT_OQ)};
+  }
+
+  friend Packet4d operator<(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_cmp_pd(theA.V, theB.V, _CMP_LT_OQ)};
+  }
+
+  friend Packet4d operator<=(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_cmp_pd(theA.V, theB.V, _CMP_LE_OQ)};
+  }
+
+  friend Packet4d operator>=(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_cmp_pd(theA.V, theB.V, _CMP_GE_OQ)};
+  }
+
+  friend Packet4d Min(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_min_pd(theA.V, theB.V)};
+  }
+
+  friend Packet4d Max(const Packet4d& theA, const Packet4d& theB)
+  {
+    return Packet4d{_mm256_max_pd(theA.V, theB.V)};
+  }
+};
+  #else
+//! Four double values in two SSE2 registers.
+struct Packet4d
+{
+  __m128d Lo;
+  __m128d Hi;
+
+  static Packet4d Load(const double* theValues)
+  {
+    return Packet4d{_mm_loadu_pd(theValues), _mm_loadu_pd(theValues + 2)};
+  }
+
+  static Packet4d Set(const double theValue)
+  {
+    return Packet4d{_mm_set1_pd(theValue), _mm_set1_pd(theValue)};
+  }
+
+  void Store(double* theValues) const
+  {
+    _mm_storeu_pd(theValues, Lo);
+    _mm_storeu_pd(theValues + 2, Hi);
+  }
+
+  int Mask() const { return _mm_movemask_pd(Lo) | (_mm_movemask_pd(Hi) << 2); }
+
+    #define BVH_PACKET4D_BINARY_OPERATOR(theOperator, theIntrinsic)                                \
+      friend Packet4d theOperator(const Packet4d& theA, const Packet4d& theB)                      \
+      {                                                                                            \
+        return Packet4d{theIntrinsic(theA.Lo, theB.Lo), theIntrinsic(theA.Hi, theB.Hi)};           \
+      }
+
+  BVH_PACKET4D_BINARY_OPERATOR(operator+, _mm_add_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator-, _mm_sub_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator*, _mm_mul_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator|, _mm_or_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator&, _mm_and_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator>, _mm_cmpgt_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator<, _mm_cmplt_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator<=, _mm_cmple_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(operator>=, _mm_cmpge_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(Min, _mm_min_pd)
+  BVH_PACKET4D_BINARY_OPERATOR(Max, _mm_max_pd)
+
+    #undef BVH_PACKET4D_BINARY_OPERATOR
+};
+  #endif
+
+//! Loads the coordinate of up to four vectors into the packet.
+//! The unused lanes are filled by the first vector.
+//! The lanes are assembled in registers: storing the values into a temporary array
+//! and loading them by one wide load stalls on store forwarding.
+inline Packet4d GatherPacket4d(const BVH_Vec3d* theVecs, const int theNb, const int theAxis)
+{
+  const double aV0 = theVecs[0][theAxis];
+  const double aV1 = theVecs[theNb > 1 ? 1 : 0][theAxis];
+  const double aV2 = theVecs[theNb > 2 ? 2 : 0][theAxis];
+  const double aV3 = theVecs[theNb > 3 ? 3 : 0][theAxis];
+  #if defined(BVH_BOX_KERNELS_AVX)
+  return Packet4d{_mm256_set_pd(aV3, aV2, aV1, aV0)};
+  #else
+  return Packet4d{_mm_set_pd(aV1, aV0), _mm_set_pd(aV3, aV2)};
+  #endif
+}
+} // namespace BVH
+
+//! Vectorized kernels for 3D boxes of double precision.
+template <>
+class BVH_BoxKernels<Standard_Real, 3>
+{
+public:
+  //! Returns true if the kernels are vectorized.
+  static Standard_Boolean IsVectorized() { return Standard_True; }
+
+  //! Returns the bitmask of the boxes (up to 4) lying out of the query box.
+  //! The optional inside mask marks the boxes fully contained in the query box.
+  static int OutMask(const BVH_Vec3d& theQueryMin,
+                     const BVH_Vec3d& theQueryMax,
+                     const BVH_Vec3d* theBoxesMin,
+                     const BVH_Vec3d* theBoxesMax,
+                     const int        theNbBoxes,
+                     int*             theInsideMask = NULL)
+  {
+    const BVH::Packet4d aZero    = BVH::Packet4d::Set(0.0);
+    BVH::Packet4d       anOut    = aZero;
+    BVH::Packet4d       anInside = aZero >= aZero; // all bits are set
+    for (int i = 0; i < 3; ++i)
+    {
+      const BVH::Packet4d aQueryMin = BVH::Packet4d::Set(theQueryMin[i]);
+      const BVH::Packet4d aQueryMax = BVH::Packet4d::Set(theQueryMax[i]);
+      const BVH::Packet4d aMin      = BVH::GatherPacket4d(theBoxesMin, theNbBoxes, i);
+      const BVH::Packet4d aMax      = BVH::GatherPacket4d(theBoxesMax, theNbBoxes, i);
+
+      anOut    = anOut | (aQueryMin > aMax) | (aQueryMax < aMin);
+      anInside = anInside & (aQueryMin <= aMin) & (aQueryMax >= aMax);
+    }
+
+    const int aValid    = (1 << theNbBoxes) - 1;
+    const int anOutMask = anOut.Mask() & aValid;
+    if (theInsideMask != NULL)
+    {
+      *theInsideMask = anInside.Mask() & ~anOutMask & aValid;
+    }
+    return anOutMask;
+  }
+
+  //! Returns the bitmask of the pairs of boxes (up to 4) which do not overlap
+  //! (bit i is set if the i-th box of the first array is out of the i-th box of the second one).
+  static int PairOutMask(const BVH_Vec3d*    theBoxesMin1,
+                         const BVH_Vec3d*    theBoxesMax1,
+                         const BVH_Vec3d*    theBoxesMin2,
+                         const BVH_Vec3d*    theBoxesMax2,
+                         const int           theNbPairs,
+                         const Standard_Real theTolerance)
+  {
+    const BVH::Packet4d aTolerance = BVH::Packet4d::Set(theTolerance);
+    BVH::Packet4d       anOut      = BVH::Packet4d::Set(0.0);
+    for (int i = 0; i < 3; ++i)
+    {
+      const BVH::Packet4d aMin1 = BVH::GatherPacket4d(theBoxesMin1, theNbPairs, i);
+      const BVH::Packet4d aMax1 = BVH::GatherPacket4d(theBoxesMax1, theNbPairs, i);
+      const BVH::Packet4d aMin2 = BVH::GatherPacket4d(theBoxesMin2, theNbPairs, i);
+      const BVH::Packet4d aMax2 = BVH::GatherPacket4d(theBoxesMax2, theNbPairs, i);
+
+      anOut = anOut | (aMin1 > aMax2 + aTolerance) | (aMax1 < aMin2 - aTolerance);
+    }
+    return anOut.Mask() & ((1 << theNbPairs) - 1);
+  }
+
+  //! Returns the bitmask of the boxes (up to 4) missed by the ray.
+  //! The optional array receives the ray parameters of entering into the boxes.
+  static int RayOutMask(const BVH_Vec3d& theOrigin,
+                        const BVH_Vec3d& theDirection,
+                        const BVH_Vec3d* theBoxesMin,
+                        const BVH_Vec3d* theBoxesMax,
+                        const int        theNbBoxes,
+                        Standard_Real*   theTimeEnter = NULL)
+  {
+    const BVH::Packet4d aZero  = BVH::Packet4d::Set(0.0);
+    BVH::Packet4d       anOut  = aZero;
+    BVH::Packet4d       aEnter = BVH::Packet4d::Set(-(std::numeric_limits<Standard_Real>::max)());
+    BVH::Packet4d       aLeave = BVH::Packet4d::Set((std::numeric_limits<Standard_Real>::max)());
+    for (int i = 0; i < 3; ++i)
+    {
+      const BVH::Packet4d anOrigin = BVH::Packet4d::Set(theOrigin[i]);
+      const BVH::Packet4d aMin     = BVH::GatherPacket4d(theBoxesMin, theNbBoxes, i) - anOrigin;
+      const BVH::Packet4d aMax     = BVH::GatherPacket4d(theBoxesMax, theNbBoxes, i) - anOrigin;
+      if (theDirection[i] == 0.0)
+      {
+        // the ray is parallel to the slab
+        anOut = anOut | (aMin > aZero) | (aMax < aZero);
+        continue;
+      }
+
+      const BVH::Packet4d anInv = BVH::Packet4d::Set(1.0 / theDirection[i]);
+      const BVH::Packet4d aT0   = aMin * anInv;
+      const BVH::Packet4d aT1   = aMax * anInv;
+      aEnter                    = Max(aEnter, Min(aT0, aT1));
+      aLeave                    = Min(aLeave, Max(aT0, aT1));
+    }
+    anOut = anOut | (aEnter > aLeave) | (aLeave < aZero);
+
+    if (theTimeEnter != NULL)
+    {
+      Standard_Real aValues[4];
+      aEnter.Store(aValues);
+      for (int aBoxIter = 0; aBoxIter < theNbBoxes; ++aBoxIter)
+      {
+        theTimeEnter[aBoxIter] = aValues[aBoxIter];
+      }
+    }
+    return anOut.Mask() & ((1 << theNbBoxes) - 1);
+  }
+};
+
+#endif
+
+#endif // _BVH_BoxKernels_Header
@@ -22,6 +22,9 @@
 
 //! BVH geometry as a set of abstract geometric objects
 //! organized with bounding volume hierarchy (BVH).
+//! When only the objects are moved (see MarkMoved()), the BVH is refitted
+//! instead of rebuilding, until its SAH exceeds the one of the last built
+//! BVH by the given ratio (see SetRefitSAHRatio()).
 //! \tparam T Numeric data type
 //! \tparam N Vector dimension
 template <class T, int N>
@@ -31,6 +34,9 @@ public:
   //! Creates uninitialized BVH geometry.
   BVH_Geometry()
       : myIsDirty(Standard_False),
+        myIsMoved(Standard_False),
+        myBuiltSAH(static_cast<T>(0.0)),
+        myRefitSAHRatio(static_cast<T>(2.0)),
         myBVH(new BVH_Tree<T, N>()),
         // set default builder - binned SAH split
         myBuilder(new BVH_BinnedBuilder<T, N, BVH_Constants_NbBinsOptimal>(
@@ -42,6 +48,9 @@ public:
   //! Creates uninitialized BVH geometry.
   BVH_Geometry(const opencascade::handle<BVH_Builder<T, N>>& theBuilder)
       : myIsDirty(Standard_False),
+        myIsMoved(Standard_False),
+        myBuiltSAH(static_cast<T>(0.0)),
+        myRefitSAHRatio(static_cast<T>(2.0)),
         myBVH(new BVH_Tree<T, N>()),
         myBuilder(theBuilder)
   {
@@ -62,13 +71,27 @@ public:
   //! Marks geometry as outdated.
   virtual void MarkDirty() { myIsDirty = Standard_True; }
 
+  //! Returns TRUE if the objects have been moved since the last update of BVH.
+  Standard_Boolean IsMoved() const { return myIsMoved; }
+
+  //! Marks geometry as outdated due to the movement of the objects only
+  //! (the objects themselves remain the same), so that BVH can be refitted.
+  virtual void MarkMoved() { myIsMoved = Standard_True; }
+
+  //! Returns the maximum ratio of SAH of the refitted BVH to the one of the built BVH.
+  T RefitSAHRatio() const { return myRefitSAHRatio; }
+
+  //! Sets the maximum ratio of SAH of the refitted BVH to the one of the built BVH,
+  //! beyond which the BVH is rebuilt. Zero value disables refitting.
+  void SetRefitSAHRatio(const T theRatio) { myRefitSAHRatio = theRatio; }
+
   //! Returns AABB of the given object.
   using BVH_ObjectSet<T, N>::Box;
 
   //! Returns AABB of the whole geometry.
   virtual BVH_Box<T, N> Box() const Standard_OVERRIDE
   {
-    if (myIsDirty)
+    if (myIsDirty || myIsMoved)
     {
       myBox = BVH_Set<T, N>::Box();
     }
@@ -78,7 +101,7 @@ public:
   //! Returns BVH tree (and builds it if necessary).
   virtual const opencascade::handle<BVH_Tree<T, N>>& BVH()
   {
-    if (myIsDirty)
+    if (myIsDirty || myIsMoved)
     {
       Update();
     }
@@ -98,17 +121,36 @@ protected:
   //! Updates internal geometry state.
   virtual void Update()
   {
-    if (myIsDirty)
+    if (!myIsDirty && myIsMoved && myBVH->Length() != 0
+        && myRefitSAHRatio > static_cast<T>(0.0))
+    {
+      // Keep the topology of BVH until its quality degrades too much
+      const T aSAH = myBVH->Refit(*this);
+      myBox        = BVH_Box<T, N>(myBVH->MinPoint(0), myBVH->MaxPoint(0));
+      myIsMoved    = Standard_False;
+      if (aSAH <= myBuiltSAH * myRefitSAHRatio)
+      {
+        return;
+      }
+      myIsDirty = Standard_True;
+    }
+
+    if (myIsDirty || myIsMoved)
     {
       myBuilder->Build(this, myBVH.operator->(), Box());
-      myIsDirty = Standard_False;
+      myBuiltSAH = myBVH->Length() != 0 ? myBVH->EstimateSAH() : static_cast<T>(0.0);
+      myIsDirty  = Standard_False;
+      myIsMoved  = Standard_False;
     }
   }
 
 protected:
-  Standard_Boolean                       myIsDirty; //!< Is geometry state outdated?
-  opencascade::handle<BVH_Tree<T, N>>    myBVH;     //!< Constructed hight-level BVH
-  opencascade::handle<BVH_Builder<T, N>> myBuilder; //!< Builder for hight-level BVH
+  Standard_Boolean                       myIsDirty;       //!< Is geometry state outdated?
+  Standard_Boolean                       myIsMoved;       //!< Are the objects moved?
+  T                                      myBuiltSAH;      //!< SAH of the last built BVH
+  T                                      myRefitSAHRatio; //!< Maximum SAH ratio for refitting
+  opencascade::handle<BVH_Tree<T, N>>    myBVH;           //!< Constructed hight-level BVH
+  opencascade::handle<BVH_Builder<T, N>> myBuilder;       //!< Builder for hight-level BVH
 
   mutable BVH_Box<T, N> myBox; //!< Cached bounding box of geometric objects
 };
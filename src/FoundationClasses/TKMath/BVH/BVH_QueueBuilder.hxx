@@ -19,12 +19,20 @@
 #include <BVH_Builder.hxx>
 #include <BVH_BuildThread.hxx>
 #include <NCollection_Vector.hxx>
+#include <OSD_TaskGroup.hxx>
+
+#include <atomic>
+#include <vector>
 
 //! Abstract BVH builder based on the concept of work queue.
-//! Queue based BVH builders support parallelization with a
-//! fixed number of threads (maximum efficiency is achieved
-//! by setting the number of threads equal to the number of
-//! CPU cores plus one). Note that to support parallel mode,
+//! Queue based BVH builders support parallelization: when the number
+//! of threads is greater than one, the subtrees of large nodes are built
+//! by the tasks of OSD_TaskGroup (executed by the worker threads of its
+//! process-wide scheduler), while the subtrees of small nodes are built
+//! sequentially within the task of their ancestor. At most the given number
+//! of subtrees are built simultaneously, including the one built by the
+//! calling thread; the scheduler may provide less threads, but never more.
+//! Note that to support parallel mode,
 //! a corresponding BVH primitive set should provide thread
 //! safe implementations of interface functions (e.g., Swap,
 //! Box, Center). Otherwise, the results will be undefined.
@@ -156,6 +164,21 @@ protected:
                            const Standard_Integer theNode,
                            const BVH_ChildNodes&  theSubNodes) const;
 
+  //! Builds the subtree of the given node within the task of parallel build.
+  //! The child nodes containing at least THE_TASK_MIN_SIZE primitives are built
+  //! by separate tasks of the group while theNbFreeThreads is positive;
+  //! each task takes one of these threads and returns it on completion.
+  void buildSubtree(BVH_TypedBuildTool&    theBuildTool,
+                    BVH_Tree<T, N>*        theBVH,
+                    BVH_BuildQueue&        theBuildQueue,
+                    OSD_TaskGroup&         theTaskGroup,
+                    std::atomic<int>&      theNbFreeThreads,
+                    const Standard_Integer theNode) const;
+
+protected:
+  //! Minimal number of primitives of the node to build its subtree by a separate task.
+  static const Standard_Integer THE_TASK_MIN_SIZE = 4096;
+
 protected:
   Standard_Integer myNumOfThreads; //!< Number of threads used to build BVH
 };
@@ -211,6 +234,57 @@ void BVH_QueueBuilder<T, N>::addChildren(
   }
 }
 
+//=================================================================================================
+
+template <class T, int N>
+void BVH_QueueBuilder<T, N>::buildSubtree(BVH_TypedBuildTool&    theBuildTool,
+                                          BVH_Tree<T, N>*        theBVH,
+                                          BVH_BuildQueue&        theBuildQueue,
+                                          OSD_TaskGroup&         theTaskGroup,
+                                          std::atomic<int>&      theNbFreeThreads,
+                                          const Standard_Integer theNode) const
+{
+  std::vector<Standard_Integer> aStack(1, theNode);
+  while (!aStack.empty())
+  {
+    const Standard_Integer aNode = aStack.back();
+    aStack.pop_back();
+    theBuildTool.Perform(aNode);
+
+    // Take the nodes to split from the queue (these are the children of the
+    // processed node, or of the nodes processed concurrently by other tasks)
+    Standard_Boolean wasBusy = Standard_False;
+    for (Standard_Integer aChild = theBuildQueue.Fetch(wasBusy); aChild != -1;
+         aChild                  = theBuildQueue.Fetch(wasBusy))
+    {
+      // Take one of the free threads for the task building the subtree of large node
+      int aNbFree = 0;
+      if (theBVH->EndPrimitive(aChild) - theBVH->BegPrimitive(aChild) + 1 >= THE_TASK_MIN_SIZE)
+      {
+        aNbFree = theNbFreeThreads.load();
+        while (aNbFree > 0 && !theNbFreeThreads.compare_exchange_weak(aNbFree, aNbFree - 1))
+        {
+          //
+        }
+      }
+      if (aNbFree <= 0)
+      {
+        aStack.push_back(aChild);
+        continue;
+      }
+
+      BVH_TypedBuildTool* aBuildTool  = &theBuildTool;
+      BVH_BuildQueue*     aBuildQueue = &theBuildQueue;
+      OSD_TaskGroup*      aTaskGroup  = &theTaskGroup;
+      std::atomic<int>*   aNbThreads  = &theNbFreeThreads;
+      theTaskGroup.Run([this, aBuildTool, theBVH, aBuildQueue, aTaskGroup, aNbThreads, aChild]() {
+        buildSubtree(*aBuildTool, theBVH, *aBuildQueue, *aTaskGroup, *aNbThreads, aChild);
+        ++(*aNbThreads);
+      });
+    }
+  }
+}
+
 // =======================================================================
 // function : Build
 // purpose  : Builds BVH using specific algorithm
@@ -235,35 +309,25 @@ void BVH_QueueBuilder<T, N>::Build(BVH_Set<T, N>*       theSet,
     return;
   }
 
-  BVH_BuildQueue aBuildQueue;
-  aBuildQueue.Enqueue(aRoot);
-
+  BVH_BuildQueue     aBuildQueue;
   BVH_TypedBuildTool aBuildTool(theSet, theBVH, aBuildQueue, this);
   if (myNumOfThreads > 1)
   {
     // Reserve the maximum possible number of nodes in the BVH
     theBVH->Reserve(2 * aSetSize - 1);
 
-    NCollection_Vector<Handle(BVH_BuildThread)> aThreads;
-
-    // Run BVH build threads
-    for (Standard_Integer aThreadIndex = 0; aThreadIndex < myNumOfThreads; ++aThreadIndex)
-    {
-      aThreads.Append(new BVH_BuildThread(aBuildTool, aBuildQueue));
-      aThreads.Last()->Run();
-    }
-
-    // Wait until all threads finish their work
-    for (Standard_Integer aThreadIndex = 0; aThreadIndex < myNumOfThreads; ++aThreadIndex)
-    {
-      aThreads.ChangeValue(aThreadIndex)->Wait();
-    }
+    // Build the tree by the tasks, starting from the root within the calling thread
+    OSD_TaskGroup    aTaskGroup;
+    std::atomic<int> aNbFreeThreads(myNumOfThreads - 1);
+    buildSubtree(aBuildTool, theBVH, aBuildQueue, aTaskGroup, aNbFreeThreads, aRoot);
+    aTaskGroup.Wait();
 
     // Free unused memory
     theBVH->Reserve(theBVH->Length());
   }
   else
   {
+    aBuildQueue.Enqueue(aRoot);
     BVH_BuildThread aThread(aBuildTool, aBuildQueue);
 
     // Execute thread function inside current thread
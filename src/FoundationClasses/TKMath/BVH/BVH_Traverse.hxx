@@ -17,7 +17,7 @@
 #define _BVH_Traverse_Header
 
 #include <BVH_Box.hxx>
-#include <BVH_Tree.hxx>
+#include <BVH_QuadTree.hxx>
 
 //! The classes implement the traverse of the BVH tree.
 //!
@@ -53,6 +53,14 @@
 //! - *AcceptMetric* - basing on the metric of the node decides if the
 //!   node may be accepted without any further checks.
 //!
+//! The children of the node of the quad tree (see BVH_Tree::CollapseToQuadTree())
+//! and the pairs of the children of two nodes of the binary trees are tested
+//! by the *RejectNodes* method, which calls *RejectNode* for each node by default.
+//! The selectors testing the nodes by a box may override it using the vectorized
+//! kernels of BVH_BoxKernels, which test up to four boxes at once. The children
+//! of the node of the binary tree are tested one by one, so that the selection
+//! may be stopped after testing the first child.
+//!
 //! Two ways of selection are possible:
 //! 1. Set the BVH set containing the tree and use the method Select()
 //!    which allows using common interface for setting the BVH Set for accessing
@@ -212,6 +220,27 @@ public: //! @name Rules for Accept/Reject
                                       const BVH_VecNt& theCornerMax,
                                       MetricType&      theMetric) const = 0;
 
+  //! Rejection of several sibling nodes (up to 4) by their bounding boxes.
+  //! Metrics are computed for all nodes to choose the best branch.
+  //! Returns the bitmask of the nodes which should be rejected
+  //! (bit i corresponds to the i-th node).
+  //! By default, calls RejectNode() for each node.
+  virtual Standard_Integer RejectNodes(const BVH_VecNt*       theCornersMin,
+                                       const BVH_VecNt*       theCornersMax,
+                                       const Standard_Integer theNbNodes,
+                                       MetricType*            theMetrics) const
+  {
+    Standard_Integer aRejected = 0;
+    for (Standard_Integer aNodeIter = 0; aNodeIter < theNbNodes; ++aNodeIter)
+    {
+      if (RejectNode(theCornersMin[aNodeIter], theCornersMax[aNodeIter], theMetrics[aNodeIter]))
+      {
+        aRejected |= 1 << aNodeIter;
+      }
+    }
+    return aRejected;
+  }
+
   //! Leaf element acceptance.
   //! Metric of the parent leaf-node is passed to avoid the check on the
   //! element and accept it unconditionally.
@@ -238,6 +267,14 @@ public: //! @name Selection
   //! Returns the number of accepted elements.
   Standard_Integer Select(const opencascade::handle<BVH_Tree<NumType, Dimension>>& theBVH);
 
+  //! Performs selection of the elements from the quad BVH tree by the
+  //! rules defined in Accept/Reject methods.
+  //! All children of the node are tested at once by RejectNodes() method,
+  //! the Stop() condition is checked after testing all of them.
+  //! Returns the number of accepted elements.
+  Standard_Integer Select(
+    const opencascade::handle<BVH_Tree<NumType, Dimension, BVH_QuadTree>>& theBVH);
+
 protected: //! @name Fields
   BVHSetType* myBVHSet;
 };
@@ -284,6 +321,33 @@ public: //! @name Rules for Accept/Reject
                                       const BVH_VecNt& theCornerMax2,
                                       MetricType&      theMetric) const = 0;
 
+  //! Rejection of several pairs of nodes (up to 4) by their bounding boxes.
+  //! Metrics are computed for all pairs to choose the best branch.
+  //! Returns the bitmask of the pairs which should be rejected
+  //! (bit i corresponds to the i-th pair).
+  //! By default, calls RejectNode() for each pair.
+  virtual Standard_Integer RejectNodes(const BVH_VecNt*       theCornersMin1,
+                                       const BVH_VecNt*       theCornersMax1,
+                                       const BVH_VecNt*       theCornersMin2,
+                                       const BVH_VecNt*       theCornersMax2,
+                                       const Standard_Integer theNbPairs,
+                                       MetricType*            theMetrics) const
+  {
+    Standard_Integer aRejected = 0;
+    for (Standard_Integer aPairIter = 0; aPairIter < theNbPairs; ++aPairIter)
+    {
+      if (RejectNode(theCornersMin1[aPairIter],
+                     theCornersMax1[aPairIter],
+                     theCornersMin2[aPairIter],
+                     theCornersMax2[aPairIter],
+                     theMetrics[aPairIter]))
+      {
+        aRejected |= 1 << aPairIter;
+      }
+    }
+    return aRejected;
+  }
+
   //! Leaf element acceptance.
   //! Returns true if the pair of elements is accepted, false otherwise.
   virtual Standard_Boolean Accept(const Standard_Integer theIndex1,
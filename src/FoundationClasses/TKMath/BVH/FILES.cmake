@@ -5,6 +5,7 @@ set(OCCT_BVH_FILES
   BVH.cxx
   BVH_BinnedBuilder.hxx
   BVH_Box.hxx
+  BVH_BoxKernels.hxx
   BVH_BoxSet.hxx
   BVH_Builder.hxx
   BVH_Builder3d.hxx
@@ -0,0 +1,139 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplCLib_CacheParams.hxx>
+#include <BSplCLib_CacheSlots.hxx>
+
+#include <TColStd_Array1OfInteger.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns flat knots of B-spline of degree 3 with the given knots.
+TColStd_Array1OfReal flatKnots(const TColStd_Array1OfReal& theKnots,
+                               const Standard_Boolean      theIsPeriodic)
+{
+  const Standard_Integer  aDegree = 3;
+  TColStd_Array1OfInteger aMults(theKnots.Lower(), theKnots.Upper());
+  aMults.Init(1);
+  if (!theIsPeriodic)
+  {
+    aMults.ChangeFirst() = aMults.ChangeLast() = aDegree + 1;
+  }
+
+  TColStd_Array1OfReal aFlatKnots(1, BSplCLib::KnotSequenceLength(aMults, aDegree, theIsPeriodic));
+  BSplCLib::KnotSequence(theKnots, aMults, aDegree, theIsPeriodic, aFlatKnots);
+  return aFlatKnots;
+}
+
+//! Checks that the span located by cache parameters is the same as located by BSplCLib.
+void checkLocation(const TColStd_Array1OfReal& theFlatKnots,
+                   const Standard_Boolean      theIsPeriodic,
+                   const Standard_Boolean      theIsUniform)
+{
+  BSplCLib_CacheParams aParams(3, theIsPeriodic, theFlatKnots, Standard_True);
+  EXPECT_EQ(theIsUniform, aParams.InvUniformSpan > 0.0);
+
+  // the knots are not checked by default
+  BSplCLib_CacheParams aDefaultParams(3, theIsPeriodic, theFlatKnots);
+  EXPECT_EQ(0.0, aDefaultParams.InvUniformSpan);
+
+  const Standard_Real aFirst = aParams.FirstParameter;
+  const Standard_Real aLast  = aParams.LastParameter;
+  const Standard_Real aTiny  = Epsilon(1.0);
+  for (Standard_Integer i = -40; i <= 140; ++i)
+  {
+    const Standard_Real aBase = aFirst + (aLast - aFirst) * i / 100.0;
+    for (const Standard_Real aParam : {aBase, aBase - aTiny, aBase + aTiny, aBase - 1.0e-9})
+    {
+      Standard_Integer anIndex   = 0;
+      Standard_Real    aNewParam = aParam;
+      BSplCLib::LocateParameter(3,
+                                theFlatKnots,
+                                BSplCLib::NoMults(),
+                                aParam,
+                                theIsPeriodic,
+                                anIndex,
+                                aNewParam);
+
+      Standard_Real aCacheParam = aParam;
+      aParams.LocateParameter(aCacheParam, theFlatKnots);
+      EXPECT_EQ(anIndex, aParams.SpanIndex) << "parameter " << aParam;
+      EXPECT_EQ(aNewParam, aCacheParam) << "parameter " << aParam;
+      EXPECT_EQ(theFlatKnots(anIndex), aParams.SpanStart);
+    }
+  }
+}
+} // namespace
+
+TEST(BSplCLib_CacheParamsTest, LocateParameter)
+{
+  TColStd_Array1OfReal aUniform(1, 11), aNonUniform(1, 11);
+  for (Standard_Integer i = 1; i <= 11; ++i)
+  {
+    aUniform(i)    = -1.0 + 0.1 * (i - 1);
+    aNonUniform(i) = 0.01 * (i - 1) * (i - 1);
+  }
+
+  checkLocation(flatKnots(aUniform, Standard_False), Standard_False, Standard_True);
+  checkLocation(flatKnots(aUniform, Standard_True), Standard_True, Standard_True);
+  checkLocation(flatKnots(aNonUniform, Standard_False), Standard_False, Standard_False);
+  checkLocation(flatKnots(aNonUniform, Standard_True), Standard_True, Standard_False);
+}
+
+TEST(BSplCLib_CacheSlotsTest, LeastRecentlyUsed)
+{
+  Standard_Boolean    isNew = Standard_False;
+  BSplCLib_CacheSlots aSlots;
+  aSlots.Init(10, 3);
+  EXPECT_EQ(3, aSlots.NbSlots());
+
+  const Standard_Integer aSlot0 = aSlots.Slot(0, isNew);
+  EXPECT_TRUE(isNew);
+  const Standard_Integer aSlot1 = aSlots.Slot(1, isNew);
+  EXPECT_TRUE(isNew);
+  const Standard_Integer aSlot2 = aSlots.Slot(2, isNew);
+  EXPECT_TRUE(isNew);
+  EXPECT_EQ(aSlot0, aSlots.Slot(0, isNew));
+  EXPECT_FALSE(isNew);
+  EXPECT_EQ(3, aSlots.NbUsedSlots());
+
+  // span 1 is the least recently used one
+  EXPECT_EQ(aSlot1, aSlots.Slot(3, isNew));
+  EXPECT_TRUE(isNew);
+  EXPECT_EQ(aSlot2, aSlots.Slot(1, isNew));
+  EXPECT_TRUE(isNew);
+  EXPECT_EQ(aSlot0, aSlots.Slot(0, isNew));
+  EXPECT_FALSE(isNew);
+  EXPECT_EQ(aSlot1, aSlots.Slot(4, isNew));
+  EXPECT_TRUE(isNew);
+  EXPECT_EQ(3, aSlots.NbUsedSlots());
+}
+
+TEST(BSplCLib_CacheSlotsTest, SlotPerSpan)
+{
+  Standard_Boolean    isNew = Standard_False;
+  BSplCLib_CacheSlots aSlots;
+  aSlots.Init(4, 10);
+  EXPECT_EQ(4, aSlots.NbSlots());
+  for (Standard_Integer aSpan = 3; aSpan >= 0; --aSpan)
+  {
+    EXPECT_EQ(aSpan, aSlots.Slot(aSpan, isNew));
+    EXPECT_TRUE(isNew);
+  }
+  EXPECT_EQ(2, aSlots.Slot(2, isNew));
+  EXPECT_FALSE(isNew);
+  EXPECT_EQ(4, aSlots.NbUsedSlots());
+}
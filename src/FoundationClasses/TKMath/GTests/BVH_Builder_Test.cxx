@@ -0,0 +1,194 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BVH_BinnedBuilder.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_SweepPlaneBuilder.hxx>
+#include <BVH_Triangulation.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace
+{
+typedef BVH_Triangulation<Standard_Real, 3> Triangulation;
+typedef BVH_Tree<Standard_Real, 3>          Tree;
+
+//! Number of cells of the grid of the benchmark (two triangles per cell)
+const int THE_NB_CELLS = 708;
+
+//! Fills the triangulation by the grid of the wavy surface with shuffled triangles
+void fillTriangulation(Triangulation& theTriangulation, const int theNbCells)
+{
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      const double aX = aCol * 0.1;
+      const double aY = aRow * 0.1;
+      theTriangulation.Vertices.push_back(BVH_Vec3d(aX, aY, std::sin(aX) * std::cos(aY)));
+    }
+  }
+
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNode = aRow * (theNbCells + 1) + aCol;
+      theTriangulation.Elements.push_back(BVH_Vec4i(aNode, aNode + 1, aNode + theNbCells + 1, 0));
+      theTriangulation.Elements.push_back(
+        BVH_Vec4i(aNode + 1, aNode + theNbCells + 2, aNode + theNbCells + 1, 0));
+    }
+  }
+
+  std::shuffle(theTriangulation.Elements.begin(),
+               theTriangulation.Elements.end(),
+               std::mt19937(1234));
+}
+
+//! Checks that the boxes of the tree nodes enclose the boxes of their primitives
+//! and that the leaves cover all primitives exactly once.
+void checkTree(const Tree& theTree, const Triangulation& theTriangulation)
+{
+  ASSERT_GT(theTree.Length(), 0);
+
+  std::vector<int> aCoverage(theTriangulation.Size(), 0);
+  for (int aNode = 0; aNode < theTree.Length(); ++aNode)
+  {
+    const BVH_Box<Standard_Real, 3> aNodeBox(theTree.MinPoint(aNode), theTree.MaxPoint(aNode));
+    if (!theTree.IsOuter(aNode))
+    {
+      const int aChildren[2] = {theTree.Child<0>(aNode), theTree.Child<1>(aNode)};
+      for (int aChildIdx = 0; aChildIdx < 2; ++aChildIdx)
+      {
+        ASSERT_FALSE(aNodeBox.IsOut(theTree.MinPoint(aChildren[aChildIdx])));
+        ASSERT_FALSE(aNodeBox.IsOut(theTree.MaxPoint(aChildren[aChildIdx])));
+      }
+      continue;
+    }
+
+    for (int anElem = theTree.BegPrimitive(aNode); anElem <= theTree.EndPrimitive(aNode); ++anElem)
+    {
+      const BVH_Box<Standard_Real, 3> anElemBox = theTriangulation.Box(anElem);
+      ASSERT_FALSE(aNodeBox.IsOut(anElemBox.CornerMin()));
+      ASSERT_FALSE(aNodeBox.IsOut(anElemBox.CornerMax()));
+      ++aCoverage[anElem];
+    }
+  }
+
+  EXPECT_EQ(std::count(aCoverage.begin(), aCoverage.end(), 1), theTriangulation.Size());
+}
+
+//! Builds the tree for the copy of the triangulation, checks it and returns its SAH cost.
+//! The building time is reported only when the name of the builder is given (by the benchmark).
+double buildTree(const Triangulation&                                      theTriangulation,
+                 const opencascade::handle<BVH_Builder<Standard_Real, 3>>& theBuilder,
+                 const char*                                               theName = NULL)
+{
+  Triangulation aTriangulation;
+  aTriangulation.Vertices = theTriangulation.Vertices;
+  aTriangulation.Elements = theTriangulation.Elements;
+
+  Tree                                        aTree;
+  const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+  theBuilder->Build(&aTriangulation, &aTree, aTriangulation.BVH_Set<Standard_Real, 3>::Box());
+  const std::chrono::duration<double> aTime = std::chrono::steady_clock::now() - aStart;
+
+  const double aSAH = aTree.EstimateSAH();
+  if (theName != NULL)
+  {
+    std::cout << theName << ": " << aTriangulation.Size() << " triangles, " << aTime.count()
+              << " s, " << aTree.Length() << " nodes, depth " << aTree.Depth() << ", SAH " << aSAH
+              << std::endl;
+  }
+
+  checkTree(aTree, aTriangulation);
+  return aSAH;
+}
+} // namespace
+
+TEST(BVH_BuilderTest, ParallelBinnedBuilderMatchesSequential)
+{
+  Triangulation aTriangulation;
+  fillTriangulation(aTriangulation, 300);
+
+  const double aSAH1 =
+    buildTree(aTriangulation,
+              new BVH_BinnedBuilder<Standard_Real, 3>(BVH_Constants_LeafNodeSizeDefault,
+                                                      BVH_Constants_MaxTreeDepth,
+                                                      Standard_False,
+                                                      1));
+  const double aSAH2 =
+    buildTree(aTriangulation,
+              new BVH_BinnedBuilder<Standard_Real, 3>(BVH_Constants_LeafNodeSizeDefault,
+                                                      BVH_Constants_MaxTreeDepth,
+                                                      Standard_False,
+                                                      4));
+
+  // the splits do not depend on the order of building of the nodes
+  EXPECT_NEAR(aSAH1, aSAH2, 1.0e-9 * aSAH1);
+}
+
+TEST(BVH_BuilderTest, ParallelSweepPlaneBuilderMatchesSequential)
+{
+  Triangulation aTriangulation;
+  fillTriangulation(aTriangulation, 100);
+
+  const double aSAH1 = buildTree(aTriangulation, new BVH_SweepPlaneBuilder<Standard_Real, 3>());
+  const double aSAH2 =
+    buildTree(aTriangulation,
+              new BVH_SweepPlaneBuilder<Standard_Real, 3>(BVH_Constants_LeafNodeSizeDefault,
+                                                          BVH_Constants_MaxTreeDepth,
+                                                          4));
+  EXPECT_NEAR(aSAH1, aSAH2, 1.0e-9 * aSAH1);
+}
+
+// The benchmark takes several seconds, run it with --gtest_also_run_disabled_tests
+TEST(BVH_BuilderTest, DISABLED_BenchmarkOnMillionTriangles)
+{
+  Triangulation aTriangulation;
+  fillTriangulation(aTriangulation, THE_NB_CELLS);
+  ASSERT_GE(aTriangulation.Size(), 1000000);
+
+  const int aNbThreads = std::max(OSD_Parallel::NbLogicalProcessors(), 2);
+
+  const double aSAHBinned =
+    buildTree(aTriangulation, new BVH_BinnedBuilder<Standard_Real, 3>(), "Binned, 1 thread");
+  const double aSAHBinnedPar =
+    buildTree(aTriangulation,
+              new BVH_BinnedBuilder<Standard_Real, 3>(BVH_Constants_LeafNodeSizeDefault,
+                                                      BVH_Constants_MaxTreeDepth,
+                                                      Standard_False,
+                                                      aNbThreads),
+              "Binned, N threads");
+  const double aSAHLinear =
+    buildTree(aTriangulation, new BVH_LinearBuilder<Standard_Real, 3>(), "Linear");
+  const double aSAHSweepPar =
+    buildTree(aTriangulation,
+              new BVH_SweepPlaneBuilder<Standard_Real, 3>(BVH_Constants_LeafNodeSizeDefault,
+                                                          BVH_Constants_MaxTreeDepth,
+                                                          aNbThreads),
+              "SweepPlane, N threads");
+
+  EXPECT_NEAR(aSAHBinned, aSAHBinnedPar, 1.0e-9 * aSAHBinned);
+
+  // SAH based builders give trees not worse than the linear one
+  EXPECT_LE(aSAHBinned, aSAHLinear);
+  EXPECT_LE(aSAHSweepPar, aSAHLinear);
+}
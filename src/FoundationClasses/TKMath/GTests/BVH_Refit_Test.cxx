@@ -0,0 +1,175 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BVH_BinnedBuilder.hxx>
+#include <BVH_Geometry.hxx>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace
+{
+//! Object bounded by the box which can be moved
+class MovableObject : public BVH_Object<Standard_Real, 3>
+{
+public:
+  MovableObject(const BVH_Box<Standard_Real, 3>& theBox)
+      : myBox(theBox)
+  {
+  }
+
+  virtual BVH_Box<Standard_Real, 3> Box() const Standard_OVERRIDE { return myBox; }
+
+  void Move(const BVH_Vec3d& theShift)
+  {
+    myBox = BVH_Box<Standard_Real, 3>(myBox.CornerMin() + theShift, myBox.CornerMax() + theShift);
+  }
+
+private:
+  BVH_Box<Standard_Real, 3> myBox;
+};
+
+//! Binned builder counting the builds
+class CountingBuilder : public BVH_BinnedBuilder<Standard_Real, 3>
+{
+public:
+  CountingBuilder()
+      : BVH_BinnedBuilder<Standard_Real, 3>(BVH_Constants_LeafNodeSizeSingle),
+        myNbBuilds(0)
+  {
+  }
+
+  virtual void Build(BVH_Set<Standard_Real, 3>*       theSet,
+                     BVH_Tree<Standard_Real, 3>*      theBVH,
+                     const BVH_Box<Standard_Real, 3>& theBox) const Standard_OVERRIDE
+  {
+    ++myNbBuilds;
+    BVH_BinnedBuilder<Standard_Real, 3>::Build(theSet, theBVH, theBox);
+  }
+
+  int NbBuilds() const { return myNbBuilds; }
+
+private:
+  mutable int myNbBuilds;
+};
+
+//! Fills the geometry by the grid of unit boxes
+void fillGeometry(BVH_Geometry<Standard_Real, 3>& theGeometry, const int theNbBoxes)
+{
+  for (int anIter = 0; anIter < theNbBoxes; ++anIter)
+  {
+    const BVH_Vec3d aMin((anIter % 32) * 2.0, (anIter / 32) * 2.0, 0.0);
+    theGeometry.Objects().Append(
+      new MovableObject(BVH_Box<Standard_Real, 3>(aMin, aMin + BVH_Vec3d(1.0, 1.0, 1.0))));
+  }
+  theGeometry.MarkDirty();
+}
+
+//! Moves the objects of the geometry by random shifts of the given magnitude
+void moveObjects(BVH_Geometry<Standard_Real, 3>& theGeometry,
+                 const double                    theMagnitude,
+                 const unsigned                  theSeed)
+{
+  std::mt19937                           aGen(theSeed);
+  std::uniform_real_distribution<double> aShift(-theMagnitude, theMagnitude);
+  for (int anIter = 0; anIter < theGeometry.Size(); ++anIter)
+  {
+    MovableObject* anObject =
+      static_cast<MovableObject*>(theGeometry.Objects().ChangeValue(anIter).get());
+    anObject->Move(BVH_Vec3d(aShift(aGen), aShift(aGen), aShift(aGen)));
+  }
+  theGeometry.MarkMoved();
+}
+
+//! Checks that the boxes of the nodes enclose the boxes of their primitives
+void checkBoxes(const BVH_Tree<Standard_Real, 3>& theTree, const BVH_Set<Standard_Real, 3>& theSet)
+{
+  for (int aNode = 0; aNode < theTree.Length(); ++aNode)
+  {
+    if (!theTree.IsOuter(aNode))
+    {
+      continue;
+    }
+
+    const BVH_Box<Standard_Real, 3> aNodeBox(theTree.MinPoint(aNode), theTree.MaxPoint(aNode));
+    for (int anElem = theTree.BegPrimitive(aNode); anElem <= theTree.EndPrimitive(aNode); ++anElem)
+    {
+      EXPECT_FALSE(aNodeBox.IsOut(theSet.Box(anElem).CornerMin()));
+      EXPECT_FALSE(aNodeBox.IsOut(theSet.Box(anElem).CornerMax()));
+    }
+  }
+}
+} // namespace
+
+TEST(BVH_RefitTest, RefitKeepsTopology)
+{
+  BVH_Geometry<Standard_Real, 3> aGeometry;
+  fillGeometry(aGeometry, 1024);
+  const opencascade::handle<BVH_Tree<Standard_Real, 3>> aTree    = aGeometry.BVH();
+  const int                                             aNbNodes = aTree->Length();
+  const int                                             aDepth   = aTree->Depth();
+
+  // translation of all objects keeps SAH
+  const double aSAH = aTree->EstimateSAH();
+  for (int anIter = 0; anIter < aGeometry.Size(); ++anIter)
+  {
+    static_cast<MovableObject*>(aGeometry.Objects().ChangeValue(anIter).get())
+      ->Move(BVH_Vec3d(10.0, -5.0, 3.0));
+  }
+  const double aRefitSAH = aTree->Refit(aGeometry);
+  EXPECT_NEAR(aSAH, aRefitSAH, 1.0e-9 * aSAH);
+  EXPECT_NEAR(aRefitSAH, aTree->EstimateSAH(), 1.0e-9 * aSAH);
+  EXPECT_EQ(aNbNodes, aTree->Length());
+  EXPECT_EQ(aDepth, aTree->Depth());
+  EXPECT_NEAR(aTree->MinPoint(0).x(), 10.0, 1.0e-12);
+  EXPECT_NEAR(aTree->MinPoint(0).y(), -5.0, 1.0e-12);
+  checkBoxes(*aTree, aGeometry);
+}
+
+TEST(BVH_RefitTest, GeometryRefitsMovedObjects)
+{
+  opencascade::handle<CountingBuilder> aBuilder = new CountingBuilder();
+  BVH_Geometry<Standard_Real, 3>       aGeometry(aBuilder);
+  fillGeometry(aGeometry, 1024);
+  aGeometry.BVH();
+  EXPECT_EQ(1, aBuilder->NbBuilds());
+
+  // small movements are handled by refit
+  for (unsigned aStep = 0; aStep < 10; ++aStep)
+  {
+    moveObjects(aGeometry, 0.1, aStep);
+    EXPECT_TRUE(aGeometry.IsMoved());
+    checkBoxes(*aGeometry.BVH(), aGeometry);
+    EXPECT_FALSE(aGeometry.IsMoved());
+  }
+  EXPECT_EQ(1, aBuilder->NbBuilds());
+
+  // the box of the whole geometry follows the objects
+  typedef BVH_Set<Standard_Real, 3> Set;
+  const BVH_Box<Standard_Real, 3>   aBox    = aGeometry.Box();
+  const BVH_Box<Standard_Real, 3>   aSetBox = aGeometry.Set::Box();
+  EXPECT_NEAR(aBox.CornerMin().x(), aSetBox.CornerMin().x(), 1.0e-12);
+  EXPECT_NEAR(aBox.CornerMax().z(), aSetBox.CornerMax().z(), 1.0e-12);
+
+  // scattering of objects degrades the refitted tree, so that it is rebuilt
+  moveObjects(aGeometry, 100.0, 100);
+  checkBoxes(*aGeometry.BVH(), aGeometry);
+  EXPECT_EQ(2, aBuilder->NbBuilds());
+
+  // refitting can be disabled
+  aGeometry.SetRefitSAHRatio(0.0);
+  moveObjects(aGeometry, 0.1, 200);
+  aGeometry.BVH();
+  EXPECT_EQ(3, aBuilder->NbBuilds());
+}
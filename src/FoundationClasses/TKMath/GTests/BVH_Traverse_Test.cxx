@@ -0,0 +1,312 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BVH_BoxKernels.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace
+{
+typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BoxSet;
+typedef BVH_BoxKernels<Standard_Real, 3>               BoxKernels;
+typedef BVH_Tools<Standard_Real, 3>                    Tools;
+
+//! Fills the set by random boxes
+void fillBoxSet(BoxSet& theSet, const int theNbBoxes, const unsigned theSeed)
+{
+  std::mt19937                           aGen(theSeed);
+  std::uniform_real_distribution<double> aCoord(0.0, 100.0);
+  std::uniform_real_distribution<double> aSize(0.1, 3.0);
+  theSet.SetSize(theNbBoxes);
+  for (int anIter = 0; anIter < theNbBoxes; ++anIter)
+  {
+    const BVH_Vec3d aMin(aCoord(aGen), aCoord(aGen), aCoord(aGen));
+    const BVH_Vec3d aMax = aMin + BVH_Vec3d(aSize(aGen), aSize(aGen), aSize(aGen));
+    theSet.Add(anIter, BVH_Box<Standard_Real, 3>(aMin, aMax));
+  }
+  theSet.Build();
+}
+
+//! Selector of the boxes overlapping the given box
+class BoxSelector : public BVH_Traverse<Standard_Real, 3, BoxSet, Standard_Boolean>
+{
+public:
+  BoxSelector(const BVH_Box<Standard_Real, 3>& theBox, const bool theToUseKernels)
+      : myBox(theBox),
+        myToUseKernels(theToUseKernels),
+        myNbRejectCalls(0)
+  {
+  }
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d&  theCMin,
+                                      const BVH_Vec3d&  theCMax,
+                                      Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    ++myNbRejectCalls;
+    Standard_Boolean hasOverlap;
+    theIsInside = myBox.Contains(theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  virtual Standard_Integer RejectNodes(const BVH_Vec3d*       theCornersMin,
+                                       const BVH_Vec3d*       theCornersMax,
+                                       const Standard_Integer theNbNodes,
+                                       Standard_Boolean*      theIsInside) const Standard_OVERRIDE
+  {
+    if (!myToUseKernels)
+    {
+      return BVH_Traverse::RejectNodes(theCornersMin, theCornersMax, theNbNodes, theIsInside);
+    }
+
+    ++myNbRejectCalls;
+    int       anInside  = 0;
+    const int aRejected = BoxKernels::OutMask(myBox.CornerMin(),
+                                              myBox.CornerMax(),
+                                              theCornersMin,
+                                              theCornersMax,
+                                              theNbNodes,
+                                              &anInside);
+    for (int aNodeIter = 0; aNodeIter < theNbNodes; ++aNodeIter)
+    {
+      theIsInside[aNodeIter] = (anInside & (1 << aNodeIter)) != 0;
+    }
+    return aRejected;
+  }
+
+  virtual Standard_Boolean AcceptMetric(const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    return theIsInside;
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer  theIndex,
+                                  const Standard_Boolean& theIsInside) Standard_OVERRIDE
+  {
+    return theIsInside || !myBox.IsOut(myBVHSet->Box(theIndex));
+  }
+
+  int NbRejectCalls() const { return myNbRejectCalls; }
+
+private:
+  BVH_Box<Standard_Real, 3> myBox;
+  bool                      myToUseKernels;
+  mutable int               myNbRejectCalls;
+};
+
+//! Selector of the pairs of overlapping boxes
+class PairSelector : public BVH_PairTraverse<Standard_Real, 3, BoxSet>
+{
+public:
+  PairSelector(const bool theToUseKernels)
+      : myToUseKernels(theToUseKernels)
+  {
+  }
+
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& theCMin1,
+                                      const BVH_Vec3d& theCMax1,
+                                      const BVH_Vec3d& theCMin2,
+                                      const BVH_Vec3d& theCMax2,
+                                      Standard_Real&) const Standard_OVERRIDE
+  {
+    return BVH_Box<Standard_Real, 3>(theCMin1, theCMax1).IsOut(theCMin2, theCMax2);
+  }
+
+  virtual Standard_Integer RejectNodes(const BVH_Vec3d*       theCornersMin1,
+                                       const BVH_Vec3d*       theCornersMax1,
+                                       const BVH_Vec3d*       theCornersMin2,
+                                       const BVH_Vec3d*       theCornersMax2,
+                                       const Standard_Integer theNbPairs,
+                                       Standard_Real*         theMetrics) const Standard_OVERRIDE
+  {
+    if (!myToUseKernels)
+    {
+      return BVH_PairTraverse::RejectNodes(theCornersMin1,
+                                           theCornersMax1,
+                                           theCornersMin2,
+                                           theCornersMax2,
+                                           theNbPairs,
+                                           theMetrics);
+    }
+    return BoxKernels::PairOutMask(theCornersMin1,
+                                   theCornersMax1,
+                                   theCornersMin2,
+                                   theCornersMax2,
+                                   theNbPairs,
+                                   0.0);
+  }
+
+  virtual Standard_Boolean Accept(const Standard_Integer theIndex1,
+                                  const Standard_Integer theIndex2) Standard_OVERRIDE
+  {
+    return !myBVHSet1->Box(theIndex1).IsOut(myBVHSet2->Box(theIndex2));
+  }
+
+private:
+  bool myToUseKernels;
+};
+
+//! Selector stopping the selection on the first tested node
+class StoppingSelector : public BoxSelector
+{
+public:
+  StoppingSelector(const BVH_Box<Standard_Real, 3>& theBox)
+      : BoxSelector(theBox, false)
+  {
+  }
+
+  virtual Standard_Boolean Stop() const Standard_OVERRIDE { return NbRejectCalls() > 0; }
+};
+} // namespace
+
+TEST(BVH_BoxKernelsTest, OutMask)
+{
+  const BVH_Vec3d aMin[4] = {BVH_Vec3d(0, 0, 0),
+                             BVH_Vec3d(5, 5, 5),
+                             BVH_Vec3d(2, 2, 2),
+                             BVH_Vec3d(-5, 0, 0)};
+  const BVH_Vec3d aMax[4] = {BVH_Vec3d(1, 1, 1),
+                             BVH_Vec3d(6, 6, 6),
+                             BVH_Vec3d(3, 3, 3),
+                             BVH_Vec3d(-4, 1, 1)};
+
+  int       anInside = 0;
+  const int anOut    = BoxKernels::OutMask(BVH_Vec3d(0.5, 0.5, 0.5),
+                                           BVH_Vec3d(4, 4, 4),
+                                           aMin,
+                                           aMax,
+                                           4,
+                                           &anInside);
+  EXPECT_EQ(2 | 8, anOut);
+  EXPECT_EQ(4, anInside);
+
+  // the boxes out of the range are ignored
+  EXPECT_EQ(2, BoxKernels::OutMask(BVH_Vec3d(0.5, 0.5, 0.5), BVH_Vec3d(4, 4, 4), aMin, aMax, 3));
+}
+
+TEST(BVH_BoxKernelsTest, PairOutMaskWithTolerance)
+{
+  const BVH_Vec3d aMin1[2] = {BVH_Vec3d(0, 0, 0), BVH_Vec3d(0, 0, 0)};
+  const BVH_Vec3d aMax1[2] = {BVH_Vec3d(1, 1, 1), BVH_Vec3d(1, 1, 1)};
+  const BVH_Vec3d aMin2[2] = {BVH_Vec3d(1.5, 0, 0), BVH_Vec3d(0, 0, 3)};
+  const BVH_Vec3d aMax2[2] = {BVH_Vec3d(2, 1, 1), BVH_Vec3d(1, 1, 4)};
+
+  EXPECT_EQ(3, BoxKernels::PairOutMask(aMin1, aMax1, aMin2, aMax2, 2, 0.0));
+  EXPECT_EQ(2, BoxKernels::PairOutMask(aMin1, aMax1, aMin2, aMax2, 2, 1.0));
+}
+
+TEST(BVH_BoxKernelsTest, RayOutMaskMatchesTools)
+{
+  std::mt19937                           aGen(7);
+  std::uniform_real_distribution<double> aCoord(-10.0, 10.0);
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    BVH_Vec3d aMin[4], aMax[4];
+    for (int aBoxIter = 0; aBoxIter < 4; ++aBoxIter)
+    {
+      aMin[aBoxIter] = BVH_Vec3d(aCoord(aGen), aCoord(aGen), aCoord(aGen));
+      aMax[aBoxIter] = aMin[aBoxIter] + BVH_Vec3d(2.0, 3.0, 4.0);
+    }
+    const BVH_Vec3d anOrigin(aCoord(aGen), aCoord(aGen), aCoord(aGen));
+    const BVH_Vec3d aDir(aCoord(aGen), aCoord(aGen), aCoord(aGen));
+
+    Standard_Real aTimes[4];
+    const int     anOut = BoxKernels::RayOutMask(anOrigin, aDir, aMin, aMax, 4, aTimes);
+    for (int aBoxIter = 0; aBoxIter < 4; ++aBoxIter)
+    {
+      Standard_Real          anEnter = 0.0, aLeave = 0.0;
+      const Standard_Boolean isHit =
+        Tools::RayBoxIntersection(anOrigin, aDir, aMin[aBoxIter], aMax[aBoxIter], anEnter, aLeave);
+      EXPECT_EQ(isHit, (anOut & (1 << aBoxIter)) == 0);
+      if (isHit)
+      {
+        EXPECT_NEAR(anEnter, aTimes[aBoxIter], 1.0e-9);
+      }
+    }
+  }
+}
+
+TEST(BVH_TraverseTest, SelectByQuadTree)
+{
+  BoxSet aSet(new BVH_LinearBuilder<Standard_Real, 3>());
+  fillBoxSet(aSet, 5000, 1);
+
+  opencascade::handle<BVH_Tree<Standard_Real, 3, BVH_QuadTree>> aQuadTree =
+    aSet.BVH()->CollapseToQuadTree();
+
+  const BVH_Box<Standard_Real, 3> aQuery(BVH_Vec3d(20, 20, 20), BVH_Vec3d(60, 45, 70));
+  int                             aNbExpected = 0;
+  for (int anIter = 0; anIter < aSet.Size(); ++anIter)
+  {
+    aNbExpected += aQuery.IsOut(aSet.Box(anIter)) ? 0 : 1;
+  }
+  ASSERT_GT(aNbExpected, 0);
+
+  for (int aMode = 0; aMode < 2; ++aMode)
+  {
+    BoxSelector aBinarySelector(aQuery, aMode == 1);
+    aBinarySelector.SetBVHSet(&aSet);
+    EXPECT_EQ(aNbExpected, aBinarySelector.Select());
+
+    BoxSelector aQuadSelector(aQuery, aMode == 1);
+    aQuadSelector.SetBVHSet(&aSet);
+    EXPECT_EQ(aNbExpected, aQuadSelector.Select(aQuadTree));
+
+    if (aMode == 1)
+    {
+      // all children of the quad node are tested by one call of the kernel
+      EXPECT_LT(aQuadSelector.NbRejectCalls(), aBinarySelector.NbRejectCalls());
+    }
+  }
+}
+
+TEST(BVH_TraverseTest, SelectStopsBeforeSecondChild)
+{
+  BoxSet aSet(new BVH_LinearBuilder<Standard_Real, 3>());
+  fillBoxSet(aSet, 100, 1);
+
+  StoppingSelector aSelector(aSet.Box());
+  aSelector.SetBVHSet(&aSet);
+  EXPECT_EQ(0, aSelector.Select());
+  EXPECT_EQ(1, aSelector.NbRejectCalls());
+}
+
+TEST(BVH_TraverseTest, PairSelect)
+{
+  BoxSet aSet1(new BVH_LinearBuilder<Standard_Real, 3>());
+  BoxSet aSet2(new BVH_LinearBuilder<Standard_Real, 3>());
+  fillBoxSet(aSet1, 2000, 2);
+  fillBoxSet(aSet2, 2000, 3);
+
+  int aNbExpected = 0;
+  for (int anIter1 = 0; anIter1 < aSet1.Size(); ++anIter1)
+  {
+    for (int anIter2 = 0; anIter2 < aSet2.Size(); ++anIter2)
+    {
+      aNbExpected += aSet1.Box(anIter1).IsOut(aSet2.Box(anIter2)) ? 0 : 1;
+    }
+  }
+  ASSERT_GT(aNbExpected, 0);
+
+  PairSelector aScalarSelector(false);
+  aScalarSelector.SetBVHSets(&aSet1, &aSet2);
+  EXPECT_EQ(aNbExpected, aScalarSelector.Select());
+
+  PairSelector aVectorSelector(true);
+  aVectorSelector.SetBVHSets(&aSet1, &aSet2);
+  EXPECT_EQ(aNbExpected, aVectorSelector.Select());
+}
@@ -4,6 +4,10 @@ set(OCCT_TKMath_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_TKMath_GTests_FILES
   Bnd_BoundSortBox_Test.cxx
   Bnd_Box_Test.cxx
+  BSplCLib_CacheParams_Test.cxx
+  BVH_Builder_Test.cxx
+  BVH_Refit_Test.cxx
+  BVH_Traverse_Test.cxx
   ElCLib_Test.cxx
   math_BFGS_Test.cxx
   math_BissecNewton_Test.cxx
@@ -21,7 +21,10 @@ set(OCCT_TKernel_GTests_FILES
   NCollection_Vector_Test.cxx
   OSD_Path_Test.cxx
   OSD_PerfMeter_Test.cxx
+  OSD_TaskGroup_Test.cxx
   Standard_ArrayStreamBuffer_Test.cxx
+  Standard_MMgrOpt_Test.cxx
+  Standard_MMgrStat_Test.cxx
   TCollection_AsciiString_Test.cxx
   TCollection_ExtendedString_Test.cxx
 )
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_Parallel.hxx>
+#include <OSD_TaskGroup.hxx>
+#include <Standard_ProgramError.hxx>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+// Functor summing indices by nested parallel loop
+struct NestedSum
+{
+  std::atomic<int>* mySum;
+
+  void operator()(int theOuter) const
+  {
+    OSD_Parallel::For(0, 100, [this, theOuter](int theInner) {
+      *mySum += theOuter * 100 + theInner;
+    });
+  }
+};
+} // namespace
+
+TEST(OSD_TaskGroupTest, RunAndWait)
+{
+  std::vector<int> aValues(1000, 0);
+  OSD_TaskGroup    aGroup;
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    aGroup.Run([&aValues, anIter]() { aValues[anIter] = anIter * 2; });
+  }
+  aGroup.Wait();
+  EXPECT_FALSE(aGroup.IsRunning());
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    EXPECT_EQ(anIter * 2, aValues[anIter]);
+  }
+}
+
+TEST(OSD_TaskGroupTest, NestedGroups)
+{
+  std::atomic<int> aSum(0);
+  OSD_TaskGroup    anOuter;
+  for (int anOuterIter = 0; anOuterIter < 16; ++anOuterIter)
+  {
+    anOuter.Run([&aSum]() {
+      OSD_TaskGroup anInner;
+      for (int anInnerIter = 1; anInnerIter <= 100; ++anInnerIter)
+      {
+        anInner.Run([&aSum, anInnerIter]() { aSum += anInnerIter; });
+      }
+      anInner.Wait();
+    });
+  }
+  anOuter.Wait();
+  EXPECT_EQ(16 * 5050, aSum.load());
+}
+
+TEST(OSD_TaskGroupTest, Exception)
+{
+  std::atomic<int> aNbDone(0);
+  OSD_TaskGroup    aGroup;
+  for (int anIter = 0; anIter < 10; ++anIter)
+  {
+    aGroup.Run([&aNbDone, anIter]() {
+      if (anIter == 5)
+      {
+        throw Standard_ProgramError("task failure");
+      }
+      ++aNbDone;
+    });
+  }
+  EXPECT_THROW(aGroup.Wait(), Standard_ProgramError);
+  EXPECT_EQ(9, aNbDone.load());
+
+  // the group can be reused after failure
+  aGroup.Run([&aNbDone]() { ++aNbDone; });
+  EXPECT_NO_THROW(aGroup.Wait());
+  EXPECT_EQ(10, aNbDone.load());
+}
+
+TEST(OSD_TaskGroupTest, NestedParallelFor)
+{
+  const Standard_Boolean toUseTaskGroup = OSD_Parallel::ToUseTaskGroup();
+  OSD_Parallel::SetUseTaskGroup(Standard_True);
+
+  std::atomic<int> aSum(0);
+  NestedSum        aFunctor;
+  aFunctor.mySum = &aSum;
+  OSD_Parallel::For(0, 50, aFunctor);
+  EXPECT_EQ(5000 * 4999 / 2, aSum.load());
+
+  OSD_Parallel::SetUseTaskGroup(toUseTaskGroup);
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrOpt.hxx>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Allocates and frees blocks of various sizes, checking that they are cleared and not shared
+void allocateBlocks(Standard_MMgrOpt* theMgr,
+                    const int         theThreadIndex,
+                    std::atomic<int>* theNbErrors)
+{
+  std::vector<unsigned char*> aBlocks;
+  for (int aRound = 0; aRound < 50; ++aRound)
+  {
+    for (int aBlockIter = 0; aBlockIter < 500; ++aBlockIter)
+    {
+      const size_t   aSize  = 8 + (aBlockIter * 7 + theThreadIndex) % 300;
+      unsigned char* aBlock = static_cast<unsigned char*>(theMgr->Allocate(aSize));
+      for (size_t aByteIter = 0; aByteIter < aSize; ++aByteIter)
+      {
+        if (aBlock[aByteIter] != 0)
+        {
+          ++(*theNbErrors);
+          break;
+        }
+      }
+      memset(aBlock, theThreadIndex + 1, aSize);
+      aBlocks.push_back(aBlock);
+    }
+    for (size_t aBlockIter = 0; aBlockIter < aBlocks.size(); ++aBlockIter)
+    {
+      const size_t aSize = 8 + (aBlockIter * 7 + theThreadIndex) % 300;
+      for (size_t aByteIter = 0; aByteIter < aSize; ++aByteIter)
+      {
+        if (aBlocks[aBlockIter][aByteIter] != theThreadIndex + 1)
+        {
+          ++(*theNbErrors);
+          break;
+        }
+      }
+      theMgr->Free(aBlocks[aBlockIter]);
+    }
+    aBlocks.clear();
+  }
+}
+} // namespace
+
+TEST(Standard_MMgrOptTest, ThreadCacheMultiThreaded)
+{
+  Standard_MMgrOpt aMgr(Standard_True, Standard_False, 200, 1000, 40000, Standard_True);
+  EXPECT_TRUE(aMgr.IsThreadCache());
+
+  std::atomic<int>         aNbErrors(0);
+  std::vector<std::thread> aThreads;
+  for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+  {
+    aThreads.emplace_back(allocateBlocks, &aMgr, aThreadIter, &aNbErrors);
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+  EXPECT_EQ(0, aNbErrors.load());
+
+  // statistics of finished threads are kept by the manager
+  Standard_Size aNbHits = 0, aNbMisses = 0;
+  aMgr.ThreadCacheStatistics(aNbHits, aNbMisses);
+  EXPECT_GT(aNbHits, aNbMisses);
+  EXPECT_GT(aNbMisses, Standard_Size(0));
+}
+
+TEST(Standard_MMgrOptTest, WithoutThreadCache)
+{
+  Standard_MMgrOpt aMgr(Standard_True, Standard_False, 200, 1000, 40000);
+  EXPECT_FALSE(aMgr.IsThreadCache());
+
+  std::atomic<int> aNbErrors(0);
+  std::thread      aThread(allocateBlocks, &aMgr, 0, &aNbErrors);
+  aThread.join();
+  EXPECT_EQ(0, aNbErrors.load());
+
+  Standard_Size aNbHits = 0, aNbMisses = 0;
+  aMgr.ThreadCacheStatistics(aNbHits, aNbMisses);
+  EXPECT_EQ(Standard_Size(0), aNbHits);
+  EXPECT_EQ(Standard_Size(0), aNbMisses);
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrOpt.hxx>
+#include <Standard_MMgrStat.hxx>
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST(Standard_MMgrStatTest, SizeClasses)
+{
+  EXPECT_EQ(0, Standard_MMgrStat::SizeClass(1));
+  EXPECT_EQ(0, Standard_MMgrStat::SizeClass(8));
+  EXPECT_EQ(1, Standard_MMgrStat::SizeClass(9));
+  EXPECT_EQ(7, Standard_MMgrStat::SizeClass(1024));
+  EXPECT_EQ(Standard_MMgrStat::THE_NB_SIZE_CLASSES - 1,
+            Standard_MMgrStat::SizeClass(Standard_Size(-1)));
+  EXPECT_EQ(Standard_Size(1024), Standard_MMgrStat::SizeClassUpperBound(7));
+}
+
+TEST(Standard_MMgrStatTest, Counters)
+{
+  Standard_MMgrStat aMgr(new Standard_MMgrOpt(Standard_True, Standard_False), 0);
+
+  void* aSmall = aMgr.Allocate(16);
+  void* aLarge = aMgr.Allocate(1000);
+  EXPECT_EQ(Standard_Size(1016), aMgr.LiveBytes());
+  aMgr.Free(aSmall);
+  aLarge = aMgr.Reallocate(aLarge, 2000);
+  EXPECT_EQ(Standard_Size(2000), aMgr.LiveBytes());
+  EXPECT_EQ(Standard_Size(2000), aMgr.PeakBytes());
+
+  Standard_Size aNbAllocs = 0, aNbFrees = 0;
+  aMgr.Counters(Standard_MMgrStat::SizeClass(16), aNbAllocs, aNbFrees);
+  EXPECT_EQ(Standard_Size(1), aNbAllocs);
+  EXPECT_EQ(Standard_Size(1), aNbFrees);
+  aMgr.Counters(-1, aNbAllocs, aNbFrees);
+  EXPECT_EQ(Standard_Size(3), aNbAllocs);
+  EXPECT_EQ(Standard_Size(2), aNbFrees);
+
+  aMgr.Free(aLarge);
+  EXPECT_EQ(Standard_Size(0), aMgr.LiveBytes());
+
+  aMgr.Reset();
+  aMgr.Counters(-1, aNbAllocs, aNbFrees);
+  EXPECT_EQ(Standard_Size(0), aNbAllocs);
+  EXPECT_EQ(Standard_Size(0), aNbFrees);
+  EXPECT_EQ(Standard_Size(0), aMgr.PeakBytes());
+}
+
+TEST(Standard_MMgrStatTest, MultiThreaded)
+{
+  Standard_MMgrStat aMgr(new Standard_MMgrOpt(Standard_True, Standard_False), 16);
+
+  std::vector<std::thread> aThreads;
+  for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+  {
+    aThreads.emplace_back([&aMgr]() {
+      std::vector<void*> aBlocks;
+      for (int aBlockIter = 0; aBlockIter < 1000; ++aBlockIter)
+      {
+        aBlocks.push_back(aMgr.Allocate(8 + aBlockIter % 100));
+      }
+      for (void* aBlock : aBlocks)
+      {
+        aMgr.Free(aBlock);
+      }
+    });
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+
+  // counters of finished threads are kept by the manager
+  Standard_Size aNbAllocs = 0, aNbFrees = 0;
+  aMgr.Counters(-1, aNbAllocs, aNbFrees);
+  EXPECT_EQ(Standard_Size(4000), aNbAllocs);
+  EXPECT_EQ(Standard_Size(4000), aNbFrees);
+  EXPECT_EQ(Standard_Size(0), aMgr.LiveBytes());
+  EXPECT_GT(aMgr.PeakBytes(), Standard_Size(0));
+
+  std::ostringstream aStream;
+  aMgr.Dump(aStream);
+  EXPECT_FALSE(aStream.str().empty());
+}
@@ -85,6 +85,8 @@ set(OCCT_OSD_FILES
   OSD_SingleProtection.hxx
   OSD_StreamBuffer.hxx
   OSD_SysType.hxx
+  OSD_TaskGroup.cxx
+  OSD_TaskGroup.hxx
   OSD_Thread.cxx
   OSD_Thread.hxx
   OSD_ThreadPool.cxx
@@ -173,12 +173,8 @@ static uint32_t readCpuMask(const char* thePath)
 }
 #endif
 
-static Standard_Boolean OSD_Parallel_ToUseOcctThreads =
-#ifdef HAVE_TBB
-  Standard_False;
-#else
-  Standard_True;
-#endif
+static Standard_Boolean OSD_Parallel_ToUseOcctThreads = Standard_False;
+static Standard_Boolean OSD_Parallel_ToUseTaskGroup   = Standard_False;
 } // namespace
 
 //=================================================================================================
@@ -199,6 +195,20 @@ void OSD_Parallel::SetUseOcctThreads(Standard_Boolean theToUseOcct)
 #endif
 }
 
+//=================================================================================================
+
+Standard_Boolean OSD_Parallel::ToUseTaskGroup()
+{
+  return OSD_Parallel_ToUseTaskGroup;
+}
+
+//=================================================================================================
+
+void OSD_Parallel::SetUseTaskGroup(Standard_Boolean theToUseTaskGroup)
+{
+  OSD_Parallel_ToUseTaskGroup = theToUseTaskGroup;
+}
+
 //=======================================================================
 // function : NbLogicalProcessors
 // purpose  : Returns number of logical processors.
@@ -52,8 +52,10 @@
 //! (ForEach).
 //!
 //! Implementation uses TBB if OCCT is built with support of TBB; otherwise it
-//! uses ad-hoc parallelization tool. In general, if TBB is available, it is
-//! more efficient to use it directly instead of using OSD_Parallel.
+//! uses OSD_ThreadPool. Work-stealing scheduler OSD_TaskGroup, which supports
+//! nested parallel loops, can be selected instead (see SetUseTaskGroup()).
+//! In general, if TBB is available, it is more efficient to use it directly
+//! instead of using OSD_Parallel.
 
 class OSD_Parallel
 {
@@ -287,6 +289,12 @@ private:
                                               const FunctorInterface& theFunctor,
                                               Standard_Integer        theNbItems);
 
+  //! Same as forEachOcct() but implemented using work-stealing scheduler OSD_TaskGroup.
+  Standard_EXPORT static void forEachTaskGroup(UniversalIterator&      theBegin,
+                                               UniversalIterator&      theEnd,
+                                               const FunctorInterface& theFunctor,
+                                               Standard_Integer        theNbItems);
+
 public: //! @name public methods
   //! Returns TRUE if OCCT threads should be used instead of auxiliary threads library;
   //! default value is FALSE if alternative library has been enabled while OCCT building and TRUE
@@ -297,6 +305,18 @@ public: //! @name public methods
   //! Has no effect if OCCT has been built with no auxiliary threads library.
   Standard_EXPORT static void SetUseOcctThreads(Standard_Boolean theToUseOcct);
 
+  //! Returns TRUE if the loops are executed by work-stealing scheduler OSD_TaskGroup
+  //! instead of OSD_ThreadPool or auxiliary threads library; FALSE by default.
+  //! The scheduler supports nested loops: the thread waiting for the loop executes
+  //! pending tasks instead of being blocked. Note that the tasks of other loops can
+  //! thus be interleaved on the same thread, so that the data bound to the thread
+  //! (e.g. by OSD_Thread::Current()) can be accessed by several tasks at once.
+  Standard_EXPORT static Standard_Boolean ToUseTaskGroup();
+
+  //! Sets if the loops should be executed by work-stealing scheduler OSD_TaskGroup.
+  //! Has priority over SetUseOcctThreads().
+  Standard_EXPORT static void SetUseTaskGroup(Standard_Boolean theToUseTaskGroup);
+
   //! Returns number of logical processors.
   Standard_EXPORT static Standard_Integer NbLogicalProcessors();
 
@@ -329,7 +349,11 @@ public: //! @name public methods
       UniversalIterator aBegin(new IteratorWrapper<InputIterator>(theBegin));
       UniversalIterator aEnd(new IteratorWrapper<InputIterator>(theEnd));
       FunctorWrapperIter<InputIterator, Functor> aFunctor(theFunctor);
-      if (ToUseOcctThreads())
+      if (ToUseTaskGroup())
+      {
+        forEachTaskGroup(aBegin, aEnd, aFunctor, theNbItems);
+      }
+      else if (ToUseOcctThreads())
       {
         forEachOcct(aBegin, aEnd, aFunctor, theNbItems);
       }
@@ -363,6 +387,13 @@ public: //! @name public methods
       for (Standard_Integer it(theBegin); it != theEnd; ++it)
         theFunctor(it);
     }
+    else if (ToUseTaskGroup())
+    {
+      UniversalIterator          aBegin(new IteratorWrapper<Standard_Integer>(theBegin));
+      UniversalIterator          aEnd(new IteratorWrapper<Standard_Integer>(theEnd));
+      FunctorWrapperInt<Functor> aFunctor(theFunctor);
+      forEachTaskGroup(aBegin, aEnd, aFunctor, aRange);
+    }
     else if (ToUseOcctThreads())
     {
       const Handle(OSD_ThreadPool)&        aThreadPool = OSD_ThreadPool::DefaultPool();
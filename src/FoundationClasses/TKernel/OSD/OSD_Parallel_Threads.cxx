@@ -16,6 +16,7 @@
 
 #include <OSD_Parallel.hxx>
 
+#include <OSD_TaskGroup.hxx>
 #include <OSD_ThreadPool.hxx>
 
 #include <NCollection_Array1.hxx>
@@ -109,6 +110,32 @@ public:
     const Range&            myRange;     //!< Link on processed data block
   };
 
+  //! Functor processing elements of the range within OSD_TaskGroup.
+  class RangeFunctor
+  {
+  public:
+    //! Constructor.
+    RangeFunctor(const OSD_Parallel::FunctorInterface& thePerformer, const Range& theRange)
+        : myPerformer(&thePerformer),
+          myRange(&theRange)
+    {
+    }
+
+    //! Processes elements until the range is exhausted.
+    void operator()() const
+    {
+      for (OSD_Parallel::UniversalIterator anIter = myRange->It(); anIter != myRange->End();
+           anIter                                 = myRange->It())
+      {
+        (*myPerformer)(*anIter);
+      }
+    }
+
+  private:
+    const FunctorInterface* myPerformer; //!< Pointer to functor
+    const Range*            myRange;     //!< Pointer to processed data block
+  };
+
   //! Launcher specialization.
   class UniversalLauncher : public Launcher
   {
@@ -146,6 +173,29 @@ void OSD_Parallel::forEachOcct(UniversalIterator&      theBegin,
   aLauncher.Perform(theBegin, theEnd, theFunctor);
 }
 
+//=================================================================================================
+
+void OSD_Parallel::forEachTaskGroup(UniversalIterator&      theBegin,
+                                    UniversalIterator&      theEnd,
+                                    const FunctorInterface& theFunctor,
+                                    Standard_Integer        theNbItems)
+{
+  // elements are distributed dynamically, so that spawned tasks which have not been
+  // picked up by busy threads (e.g. within nested loops) find the range exhausted
+  const Standard_Integer aNbTasks = theNbItems != -1
+                                      ? Min(theNbItems, OSD_TaskGroup::NbThreads())
+                                      : OSD_TaskGroup::NbThreads();
+  OSD_Parallel_Threads::Range        aData(theBegin, theEnd);
+  OSD_Parallel_Threads::RangeFunctor aFunctor(theFunctor, aData);
+  OSD_TaskGroup                      aGroup;
+  for (Standard_Integer aTaskIter = 1; aTaskIter < aNbTasks; ++aTaskIter)
+  {
+    aGroup.Run(aFunctor);
+  }
+  aFunctor();
+  aGroup.Wait();
+}
+
 // Version of parallel executor used when TBB is not available
 #ifndef HAVE_TBB
 //=================================================================================================
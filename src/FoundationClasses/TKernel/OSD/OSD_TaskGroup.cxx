@@ -0,0 +1,458 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_TaskGroup.hxx>
+
+#include <OSD.hxx>
+#include <OSD_Thread.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_ProgramError.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace
+{
+//! Index of the worker thread within the scheduler, -1 for other threads.
+static Standard_THREADLOCAL int THE_WORKER_INDEX = -1;
+
+//! Floating point signals mode currently set for the worker thread.
+static Standard_THREADLOCAL bool THE_WORKER_TO_CATCH_FPE = false;
+} // namespace
+
+//! Work-stealing scheduler executing tasks of all groups.
+class OSD_TaskGroup::Scheduler
+{
+public:
+  //! Returns the scheduler, starting worker threads on first call.
+  static Scheduler& Instance()
+  {
+    static Scheduler THE_SCHEDULER(OSD_ThreadPool::DefaultPool()->NbThreads() - 1);
+    return THE_SCHEDULER;
+  }
+
+public:
+  //! Constructor starting worker threads.
+  Scheduler(const int theNbWorkers);
+
+  //! Destructor stopping worker threads.
+  ~Scheduler();
+
+  //! Returns the number of worker threads.
+  int NbWorkers() const { return myNbWorkers; }
+
+  //! Puts the task into the deque of calling worker thread, or into the shared queue.
+  void Push(Task* theTask);
+
+  //! Takes a task for execution within the calling thread, or returns NULL if there are no tasks.
+  Task* Pop();
+
+  //! Blocks the calling thread until the counter of pending tasks of the group becomes zero,
+  //! or until some task is queued.
+  void WaitFor(const std::atomic<int>& theNbPending);
+
+  //! Wakes up the threads waiting for the group, which tasks have been completed.
+  void NotifyCompleted();
+
+private:
+  //! Deque of tasks.
+  struct Queue
+  {
+    Standard_Mutex    Mutex;
+    std::deque<Task*> Tasks;
+    std::atomic<int>  NbTasks;
+
+    Queue()
+        : NbTasks(0)
+    {
+    }
+  };
+
+  //! Worker thread.
+  struct Worker
+  {
+    OSD_Thread Thread;
+    Scheduler* Owner;
+    int        Index;
+
+    Worker()
+        : Owner(NULL),
+          Index(-1)
+    {
+    }
+  };
+
+  //! Takes a task from the back (owner) or from the front (thief) of the queue.
+  Task* popFrom(const int theQueue, const bool theFromBack);
+
+  //! Main loop of the worker thread.
+  void performWorker(const int theWorker);
+
+  //! Thread function.
+  static Standard_Address runWorker(Standard_Address theWorker);
+
+private:
+  Scheduler(const Scheduler&);
+  Scheduler& operator=(const Scheduler&);
+
+private:
+  Queue*                  myQueues;     //!< deques of workers followed by the shared queue
+  Worker*                 myWorkers;    //!< worker threads
+  int                     myNbWorkers;  //!< number of worker threads
+  std::atomic<int>        myNbQueued;   //!< overall number of queued tasks
+  std::atomic<int>        myNbSleeping; //!< number of sleeping workers and waiting threads
+  std::atomic<bool>       myToStop;     //!< flag to stop worker threads
+  std::mutex              mySleepMutex; //!< mutex for sleeping threads
+  std::condition_variable myWakeUp;     //!< condition to wake up sleeping threads
+};
+
+//=================================================================================================
+
+OSD_TaskGroup::Scheduler::Scheduler(const int theNbWorkers)
+    : myQueues(NULL),
+      myWorkers(NULL),
+      myNbWorkers(Max(theNbWorkers, 0)),
+      myNbQueued(0),
+      myNbSleeping(0),
+      myToStop(false)
+{
+  myQueues = new Queue[myNbWorkers + 1];
+  if (myNbWorkers == 0)
+  {
+    return;
+  }
+
+  myWorkers = new Worker[myNbWorkers];
+  for (int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter)
+  {
+    Worker& aWorker = myWorkers[aWorkerIter];
+    aWorker.Owner   = this;
+    aWorker.Index   = aWorkerIter;
+    aWorker.Thread.SetFunction(&OSD_TaskGroup::Scheduler::runWorker);
+    aWorker.Thread.Run(&aWorker);
+  }
+}
+
+//=================================================================================================
+
+OSD_TaskGroup::Scheduler::~Scheduler()
+{
+  {
+    std::lock_guard<std::mutex> aLock(mySleepMutex);
+    myToStop = true;
+  }
+  myWakeUp.notify_all();
+  for (int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter)
+  {
+    myWorkers[aWorkerIter].Thread.Wait();
+  }
+  delete[] myWorkers;
+  delete[] myQueues;
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::Scheduler::Push(Task* theTask)
+{
+  const int aQueueIndex = THE_WORKER_INDEX >= 0 ? THE_WORKER_INDEX : myNbWorkers;
+  Queue&    aQueue      = myQueues[aQueueIndex];
+  ++myNbQueued;
+  {
+    Standard_Mutex::Sentry aSentry(aQueue.Mutex);
+    aQueue.Tasks.push_back(theTask);
+    ++aQueue.NbTasks;
+  }
+
+  // the sleeping counter is incremented by worker before checking the number of queued tasks,
+  // so that either the worker finds the task, or it is found sleeping here
+  if (myNbSleeping.load() != 0)
+  {
+    {
+      std::lock_guard<std::mutex> aLock(mySleepMutex);
+    }
+    myWakeUp.notify_one();
+  }
+}
+
+//=================================================================================================
+
+OSD_TaskGroup::Task* OSD_TaskGroup::Scheduler::popFrom(const int theQueue, const bool theFromBack)
+{
+  Queue& aQueue = myQueues[theQueue];
+  if (aQueue.NbTasks.load() == 0)
+  {
+    return NULL;
+  }
+
+  Task* aTask = NULL;
+  {
+    Standard_Mutex::Sentry aSentry(aQueue.Mutex);
+    if (aQueue.Tasks.empty())
+    {
+      return NULL;
+    }
+    if (theFromBack)
+    {
+      aTask = aQueue.Tasks.back();
+      aQueue.Tasks.pop_back();
+    }
+    else
+    {
+      aTask = aQueue.Tasks.front();
+      aQueue.Tasks.pop_front();
+    }
+    --aQueue.NbTasks;
+  }
+  --myNbQueued;
+  return aTask;
+}
+
+//=================================================================================================
+
+OSD_TaskGroup::Task* OSD_TaskGroup::Scheduler::Pop()
+{
+  if (myNbQueued.load() == 0)
+  {
+    return NULL;
+  }
+
+  // own deque first (most recently spawned task), then the shared queue
+  const int aWorker = THE_WORKER_INDEX;
+  if (aWorker >= 0)
+  {
+    if (Task* aTask = popFrom(aWorker, true))
+    {
+      return aTask;
+    }
+  }
+  if (Task* aTask = popFrom(myNbWorkers, false))
+  {
+    return aTask;
+  }
+
+  // steal the oldest task from other workers
+  for (int aVictimIter = 1; aVictimIter <= myNbWorkers; ++aVictimIter)
+  {
+    const int aVictim = (Max(aWorker, 0) + aVictimIter) % myNbWorkers;
+    if (aVictim == aWorker)
+    {
+      continue;
+    }
+    if (Task* aTask = popFrom(aVictim, false))
+    {
+      return aTask;
+    }
+  }
+  return NULL;
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::Scheduler::WaitFor(const std::atomic<int>& theNbPending)
+{
+  std::unique_lock<std::mutex> aLock(mySleepMutex);
+  ++myNbSleeping;
+  while (theNbPending.load() != 0 && myNbQueued.load() == 0)
+  {
+    myWakeUp.wait(aLock);
+  }
+  --myNbSleeping;
+
+  // the thread might have been woken up instead of a worker for the queued task,
+  // which it is not going to take as its group has been completed
+  if (theNbPending.load() == 0 && myNbQueued.load() != 0)
+  {
+    myWakeUp.notify_one();
+  }
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::Scheduler::NotifyCompleted()
+{
+  // the counter of pending tasks is decremented before checking the number of sleeping threads,
+  // so that either the waiting thread finds the group completed, or it is found sleeping here
+  if (myNbSleeping.load() != 0)
+  {
+    {
+      std::lock_guard<std::mutex> aLock(mySleepMutex);
+    }
+    myWakeUp.notify_all();
+  }
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::Scheduler::performWorker(const int theWorker)
+{
+  THE_WORKER_INDEX        = theWorker;
+  THE_WORKER_TO_CATCH_FPE = false;
+  OSD::SetThreadLocalSignal(OSD::SignalMode(), false);
+  for (;;)
+  {
+    if (Task* aTask = Pop())
+    {
+      OSD_TaskGroup::execute(aTask);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> aLock(mySleepMutex);
+    ++myNbSleeping;
+    while (myNbQueued.load() == 0 && !myToStop)
+    {
+      myWakeUp.wait(aLock);
+    }
+    --myNbSleeping;
+    if (myToStop)
+    {
+      return;
+    }
+  }
+}
+
+//=================================================================================================
+
+Standard_Address OSD_TaskGroup::Scheduler::runWorker(Standard_Address theWorker)
+{
+  Worker* aWorker = static_cast<Worker*>(theWorker);
+  aWorker->Owner->performWorker(aWorker->Index);
+  return NULL;
+}
+
+//=================================================================================================
+
+int OSD_TaskGroup::NbThreads()
+{
+  return Scheduler::Instance().NbWorkers() + 1;
+}
+
+//=================================================================================================
+
+bool OSD_TaskGroup::IsWorkerThread()
+{
+  return THE_WORKER_INDEX >= 0;
+}
+
+//=================================================================================================
+
+OSD_TaskGroup::OSD_TaskGroup()
+    : myNbPending(0)
+{
+}
+
+//=================================================================================================
+
+OSD_TaskGroup::~OSD_TaskGroup()
+{
+  try
+  {
+    Wait();
+  }
+  catch (Standard_Failure const&)
+  {
+    //
+  }
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::Spawn(Task* theTask)
+{
+  theTask->myGroup      = this;
+  theTask->myToCatchFpe = OSD::ToCatchFloatingSignals();
+  ++myNbPending;
+  Scheduler::Instance().Push(theTask);
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::Wait()
+{
+  Scheduler& aScheduler = Scheduler::Instance();
+  while (myNbPending.load() != 0)
+  {
+    if (Task* aTask = aScheduler.Pop())
+    {
+      execute(aTask);
+    }
+    else
+    {
+      // remaining tasks are being executed by other threads
+      aScheduler.WaitFor(myNbPending);
+    }
+  }
+
+  Handle(Standard_Failure) aFailure;
+  {
+    Standard_Mutex::Sentry aSentry(myMutex);
+    aFailure = myFailure;
+    myFailure.Nullify();
+  }
+  if (!aFailure.IsNull())
+  {
+    aFailure->Reraise();
+  }
+}
+
+//=================================================================================================
+
+void OSD_TaskGroup::execute(Task* theTask)
+{
+  OSD_TaskGroup* aGroup = theTask->myGroup;
+  if (THE_WORKER_INDEX >= 0 && THE_WORKER_TO_CATCH_FPE != theTask->myToCatchFpe)
+  {
+    THE_WORKER_TO_CATCH_FPE = theTask->myToCatchFpe;
+    OSD::SetThreadLocalSignal(OSD::SignalMode(), THE_WORKER_TO_CATCH_FPE);
+  }
+
+  Handle(Standard_Failure) aFailure;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    theTask->Perform();
+  }
+  catch (Standard_Failure const& anException)
+  {
+    TCollection_AsciiString aMsg = TCollection_AsciiString(anException.DynamicType()->Name()) + ": "
+                                   + anException.GetMessageString();
+    aFailure = new Standard_ProgramError(aMsg.ToCString(), anException.GetStackString());
+  }
+  catch (std::exception& anStdException)
+  {
+    TCollection_AsciiString aMsg =
+      TCollection_AsciiString(typeid(anStdException).name()) + ": " + anStdException.what();
+    aFailure = new Standard_ProgramError(aMsg.ToCString(), NULL);
+  }
+  catch (...)
+  {
+    aFailure = new Standard_ProgramError("Error: Unknown exception", NULL);
+  }
+  delete theTask;
+
+  if (!aFailure.IsNull())
+  {
+    Standard_Mutex::Sentry aSentry(aGroup->myMutex);
+    if (aGroup->myFailure.IsNull())
+    {
+      aGroup->myFailure = aFailure;
+    }
+  }
+  // the group may be destroyed right after the counter reaches zero
+  if (--aGroup->myNbPending == 0)
+  {
+    Scheduler::Instance().NotifyCompleted();
+  }
+}
@@ -0,0 +1,144 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _OSD_TaskGroup_HeaderFile
+#define _OSD_TaskGroup_HeaderFile
+
+#include <Standard_Failure.hxx>
+#include <Standard_Mutex.hxx>
+
+#include <atomic>
+
+//! Group of tasks executed by the work-stealing scheduler shared within the process.
+//!
+//! The scheduler keeps a set of worker threads (one less than the number of threads
+//! in OSD_ThreadPool::DefaultPool() at the moment of first usage),
+//! each with its own deque of tasks:
+//! - a task spawned by a worker thread is put into the deque of this worker,
+//!   tasks spawned by other threads are put into the shared queue;
+//! - a worker executes tasks from its own deque in LIFO order,
+//!   and steals tasks from other deques in FIFO order when its own deque is empty;
+//! - a thread waiting for a group executes pending tasks, and sleeps only when
+//!   there are no queued tasks while the tasks of its group are executed by other threads.
+//!
+//! Thus, groups can be nested (a task may create and wait for another group)
+//! without locking threads as OSD_ThreadPool::Launcher does,
+//! and idle threads pick up the work left by busy ones.
+//! OSD_Parallel executes its loops by this scheduler when OSD_Parallel::SetUseTaskGroup() is set.
+//!
+//! @code
+//!   OSD_TaskGroup aGroup;
+//!   for (int anIter = 0; anIter < theNbItems; ++anIter)
+//!   {
+//!     aGroup.Run([&theItems, anIter]() { theItems[anIter].Perform(); });
+//!   }
+//!   aGroup.Wait();
+//! @endcode
+//!
+//! Exceptions thrown by tasks are caught, and the first one is rethrown by Wait()
+//! as Standard_ProgramError.
+class OSD_TaskGroup
+{
+public:
+  //! Interface of the task.
+  class Task
+  {
+    friend class OSD_TaskGroup;
+
+  public:
+    //! Empty constructor.
+    Task()
+        : myGroup(NULL),
+          myToCatchFpe(false)
+    {
+    }
+
+    //! Destructor.
+    virtual ~Task() {}
+
+    //! Performs the task.
+    virtual void Perform() = 0;
+
+  private:
+    OSD_TaskGroup* myGroup;      //!< group of the task
+    bool           myToCatchFpe; //!< floating point signals mode of the spawning thread
+  };
+
+public:
+  //! Returns the number of threads executing tasks, including the waiting thread; >= 1.
+  Standard_EXPORT static int NbThreads();
+
+  //! Returns TRUE if the calling thread is a worker thread of the scheduler.
+  Standard_EXPORT static bool IsWorkerThread();
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT OSD_TaskGroup();
+
+  //! Destructor waits for completion of the tasks; exceptions are not propagated.
+  Standard_EXPORT ~OSD_TaskGroup();
+
+  //! Adds the functor to the group; it is copied and executed by one of the threads.
+  //! @param theFunctor functor providing an interface "void operator()() const"
+  template <typename Functor>
+  void Run(const Functor& theFunctor)
+  {
+    Spawn(new FunctorTask<Functor>(theFunctor));
+  }
+
+  //! Adds the task to the group; the task is deleted after execution.
+  Standard_EXPORT void Spawn(Task* theTask);
+
+  //! Waits for completion of all tasks of the group,
+  //! executing pending tasks (of this or other groups) within the calling thread;
+  //! the thread is blocked when there are no tasks to execute.
+  //! Throws Standard_ProgramError if some task has failed.
+  Standard_EXPORT void Wait();
+
+  //! Returns TRUE if the group has unfinished tasks.
+  bool IsRunning() const { return myNbPending.load() != 0; }
+
+private:
+  //! Wrapper of the functor.
+  template <typename Functor>
+  class FunctorTask : public Task
+  {
+  public:
+    FunctorTask(const Functor& theFunctor)
+        : myFunctor(theFunctor)
+    {
+    }
+
+    virtual void Perform() Standard_OVERRIDE { myFunctor(); }
+
+  private:
+    Functor myFunctor;
+  };
+
+  //! Scheduler of tasks.
+  class Scheduler;
+
+  //! Performs the task, catches exceptions and deletes the task.
+  static void execute(Task* theTask);
+
+private:
+  OSD_TaskGroup(const OSD_TaskGroup& theCopy);
+  OSD_TaskGroup& operator=(const OSD_TaskGroup& theCopy);
+
+private:
+  std::atomic<int>         myNbPending; //!< number of unfinished tasks
+  Handle(Standard_Failure) myFailure;   //!< first exception thrown by tasks
+  Standard_Mutex           myMutex;     //!< mutex protecting the exception
+};
+
+#endif // _OSD_TaskGroup_HeaderFile
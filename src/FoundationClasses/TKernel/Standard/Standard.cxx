@@ -75,6 +75,7 @@ static Standard::AllocatorType& allocatorTypeInstance()
 // - OCCT_MMGT_OPT_JEMALLOC, using external jecalloc, jefree
 #ifdef OCCT_MMGT_OPT_FLEXIBLE
   #include <Standard_MMgrOpt.hxx>
+  #include <Standard_MMgrStat.hxx>
   #include <Standard_Assert.hxx>
 
   // There is no support for environment variables in UWP
@@ -282,15 +283,18 @@ Standard_MMgrFactory::Standard_MMgrFactory()
   {
     case 1: // OCCT optimized memory allocator
     {
-      aVar                        = getenv("MMGT_MMAP");
-      Standard_Boolean bMMap      = (aVar ? (atoi(aVar) != 0) : Standard_True);
-      aVar                        = getenv("MMGT_CELLSIZE");
-      Standard_Integer aCellSize  = (aVar ? atoi(aVar) : 200);
-      aVar                        = getenv("MMGT_NBPAGES");
-      Standard_Integer aNbPages   = (aVar ? atoi(aVar) : 1000);
-      aVar                        = getenv("MMGT_THRESHOLD");
-      Standard_Integer aThreshold = (aVar ? atoi(aVar) : 40000);
-      myFMMgr = new Standard_MMgrOpt(toClear, bMMap, aCellSize, aNbPages, aThreshold);
+      aVar                          = getenv("MMGT_MMAP");
+      Standard_Boolean bMMap        = (aVar ? (atoi(aVar) != 0) : Standard_True);
+      aVar                          = getenv("MMGT_CELLSIZE");
+      Standard_Integer aCellSize    = (aVar ? atoi(aVar) : 200);
+      aVar                          = getenv("MMGT_NBPAGES");
+      Standard_Integer aNbPages     = (aVar ? atoi(aVar) : 1000);
+      aVar                          = getenv("MMGT_THRESHOLD");
+      Standard_Integer aThreshold   = (aVar ? atoi(aVar) : 40000);
+      aVar                          = getenv("MMGT_THREADCACHE");
+      Standard_Boolean bThreadCache = (aVar ? (atoi(aVar) != 0) : Standard_False);
+      myFMMgr =
+        new Standard_MMgrOpt(toClear, bMMap, aCellSize, aNbPages, aThreshold, bThreadCache);
       break;
     }
     case 2: // TBB memory allocator
@@ -300,6 +304,15 @@ Standard_MMgrFactory::Standard_MMgrFactory()
     default: // system default memory allocator
       myFMMgr = new Standard_MMgrRaw(toClear);
   }
+
+  // collect statistics of allocations, if requested
+  aVar = getenv("MMGT_STAT");
+  if (aVar != NULL && atoi(aVar) != 0)
+  {
+    aVar                       = getenv("MMGT_STAT_SAMPLING");
+    Standard_Integer aSampling = (aVar ? atoi(aVar) : 0);
+    myFMMgr                    = new Standard_MMgrStat(myFMMgr, aSampling);
+  }
   allocatorTypeInstance() = static_cast<Standard::AllocatorType>(anAllocId);
 }
 
@@ -369,6 +382,17 @@ Standard::AllocatorType Standard::GetAllocatorType()
 
 //=================================================================================================
 
+Standard_MMgrStat* Standard::AllocatorStatistics()
+{
+#ifdef OCCT_MMGT_OPT_FLEXIBLE
+  return dynamic_cast<Standard_MMgrStat*>(Standard_MMgrFactory::GetMMgr());
+#else
+  return NULL;
+#endif
+}
+
+//=================================================================================================
+
 Standard_Address Standard::Allocate(const Standard_Size theSize)
 {
 #ifdef OCCT_MMGT_OPT_FLEXIBLE
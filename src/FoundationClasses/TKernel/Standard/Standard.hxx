@@ -20,6 +20,8 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Integer.hxx>
 
+class Standard_MMgrStat;
+
 //! The package Standard provides global memory allocator and other basic
 //! services used by other OCCT components.
 
@@ -40,6 +42,12 @@ public:
   //! Returns default allocator type
   Standard_EXPORT static AllocatorType GetAllocatorType();
 
+  //! Returns the memory manager collecting statistics of allocations,
+  //! or NULL if statistics is not collected.
+  //! Statistics is collected when environment variable MMGT_STAT is set to 1;
+  //! MMGT_STAT_SAMPLING defines the rate of recording call stacks (see Standard_MMgrStat).
+  Standard_EXPORT static Standard_MMgrStat* AllocatorStatistics();
+
   //! Allocates memory blocks
   //! theSize - bytes to  allocate
   Standard_EXPORT static Standard_Address Allocate(const Standard_Size theSize);
@@ -21,6 +21,7 @@
 #include <Standard_OutOfMemory.hxx>
 #include <Standard_Assert.hxx>
 
+#include <atomic>
 #include <stdio.h>
 #include <errno.h>
 
@@ -136,13 +137,66 @@ extern "C" int getpagesize();
 #define GET_USER(block) (((Standard_Size*)(block)) + BLOCK_SHIFT)
 #define GET_BLOCK(storage) (((Standard_Size*)(storage)) - BLOCK_SHIFT)
 
+// Maximal number of free blocks of one size kept in the cache of a thread;
+// when exceeded, the older half of them is returned to the shared free list
+#define THREAD_CACHE_MAX 64
+
+// Number of free blocks taken at once from the shared free list to refill the cache
+#define THREAD_CACHE_BATCH 16
+
+//======================================================================
+// Thread caches
+//======================================================================
+
+// Free small blocks kept by one thread.
+// The free lists and counters are modified only by the owning thread;
+// the counters are atomic only to be read by ThreadCacheStatistics().
+struct Standard_MMgrOpt::ThreadCache
+{
+  Standard_MMgrOpt*          Owner;      //!< memory manager the cache is bound to
+  ThreadCache*               Next;       //!< next cache registered in the same manager
+  Standard_Size**            FreeList;   //!< free blocks lists, one per size index
+  Standard_Size*             NbBlocks;   //!< numbers of blocks in free lists
+  std::atomic<Standard_Size> NbHits;     //!< allocations served by the cache
+  std::atomic<Standard_Size> NbMisses;   //!< allocations accessing the shared free lists
+  Standard_Boolean           IsReleased; //!< flag indicating that the thread is exiting
+
+  ThreadCache()
+      : Owner(NULL),
+        Next(NULL),
+        FreeList(NULL),
+        NbBlocks(NULL),
+        NbHits(0),
+        NbMisses(0),
+        IsReleased(Standard_False)
+  {
+  }
+
+  // Returns the blocks to the manager when the thread exits
+  ~ThreadCache()
+  {
+    if (Owner != NULL)
+    {
+      Owner->releaseThreadCache(*this);
+    }
+    IsReleased = Standard_True;
+  }
+
+  // Increments the counter; cheaper than atomic increment as there is a single writer
+  static void Increment(std::atomic<Standard_Size>& theCounter)
+  {
+    theCounter.store(theCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+};
+
 //=================================================================================================
 
 Standard_MMgrOpt::Standard_MMgrOpt(const Standard_Boolean aClear,
                                    const Standard_Boolean aMMap,
                                    const Standard_Size    aCellSize,
                                    const Standard_Integer aNbPages,
-                                   const Standard_Size    aThreshold)
+                                   const Standard_Size    aThreshold,
+                                   const Standard_Boolean aThreadCache)
 {
   // check basic assumption
   Standard_STATIC_ASSERT(sizeof(Standard_Size) == sizeof(Standard_Address));
@@ -155,12 +209,18 @@ Standard_MMgrOpt::Standard_MMgrOpt(const Standard_Boolean aClear,
   myNextAddr    = NULL;
   myEndBlock    = NULL;
 
+  // clear thread caches data
+  myThreadCaches     = NULL;
+  myNbReleasedHits   = 0;
+  myNbReleasedMisses = 0;
+
   // initialize parameters
-  myClear     = aClear;
-  myMMap      = (Standard_Integer)aMMap;
-  myCellSize  = aCellSize;
-  myNbPages   = aNbPages;
-  myThreshold = aThreshold;
+  myClear       = aClear;
+  myMMap        = (Standard_Integer)aMMap;
+  myCellSize    = aCellSize;
+  myNbPages     = aNbPages;
+  myThreshold   = aThreshold;
+  myThreadCache = aThreadCache;
 
   // initialize
   Initialize();
@@ -170,6 +230,22 @@ Standard_MMgrOpt::Standard_MMgrOpt(const Standard_Boolean aClear,
 
 Standard_MMgrOpt::~Standard_MMgrOpt()
 {
+  // detach caches of running threads; their blocks belong to the pools released below
+  {
+    Standard_Mutex::Sentry aSentry(myMutex);
+    while (myThreadCaches != NULL)
+    {
+      ThreadCache* aCache = myThreadCaches;
+      myThreadCaches      = aCache->Next;
+      free(aCache->FreeList);
+      free(aCache->NbBlocks);
+      aCache->FreeList = NULL;
+      aCache->NbBlocks = NULL;
+      aCache->Next     = NULL;
+      aCache->Owner    = NULL;
+    }
+  }
+
   Purge(Standard_True);
   free(myFreeList);
 
@@ -300,6 +376,22 @@ Standard_Address Standard_MMgrOpt::Allocate(const Standard_Size aSize)
   volatile Standard_Size RoundSize = ROUNDUP_CELL(aSize);
   const Standard_Size    Index     = INDEX_CELL(RoundSize);
 
+  // small blocks are taken without locking from the cache of the calling thread, if enabled
+  if (myThreadCache && RoundSize <= myCellSize)
+  {
+    Standard_Size* aBlock = allocateCached(Index);
+    if (aBlock)
+    {
+      aBlock[0] = RoundSize;
+      aStorage  = GET_USER(aBlock);
+      if (myClear)
+        memset(aStorage, 0, RoundSize);
+
+      callBack(Standard_True, aStorage, RoundSize, aSize);
+      return aStorage;
+    }
+  }
+
   // blocks of small and medium size are recyclable
   if (Index <= myFreeListMax)
   {
@@ -455,6 +547,11 @@ void Standard_MMgrOpt::Free(Standard_Address theStorage)
 
   // check whether blocks with that size are recyclable
   const Standard_Size Index = INDEX_CELL(RoundSize);
+
+  // small blocks are put without locking into the cache of the calling thread, if enabled
+  if (myThreadCache && RoundSize <= myCellSize && freeCached(aBlock, Index))
+    return;
+
   if (Index <= myFreeListMax)
   {
     // Lock access to critical data (myFreeList and other) by mutex
@@ -477,6 +574,168 @@ void Standard_MMgrOpt::Free(Standard_Address theStorage)
     FreeMemory(aBlock, RoundSize);
 }
 
+//=================================================================================================
+
+Standard_MMgrOpt::ThreadCache* Standard_MMgrOpt::threadCache()
+{
+  static thread_local ThreadCache aCache;
+  if (aCache.Owner == this)
+    return &aCache;
+
+  // the cache is bound to the first manager used by the thread,
+  // and cannot be used any more when the thread is exiting
+  if (aCache.Owner != NULL || aCache.IsReleased)
+    return NULL;
+
+  const Standard_Size aNbCells = INDEX_CELL(myCellSize) + 1;
+  aCache.FreeList              = (Standard_Size**)calloc(aNbCells, sizeof(Standard_Size*));
+  aCache.NbBlocks              = (Standard_Size*)calloc(aNbCells, sizeof(Standard_Size));
+  if (!aCache.FreeList || !aCache.NbBlocks)
+  {
+    free(aCache.FreeList);
+    free(aCache.NbBlocks);
+    aCache.FreeList = NULL;
+    aCache.NbBlocks = NULL;
+    return NULL;
+  }
+
+  Standard_Mutex::Sentry aSentry(myMutex);
+  aCache.Owner   = this;
+  aCache.Next    = myThreadCaches;
+  myThreadCaches = &aCache;
+  return &aCache;
+}
+
+//=================================================================================================
+
+Standard_Size* Standard_MMgrOpt::allocateCached(const Standard_Size theIndex)
+{
+  ThreadCache* aCache = threadCache();
+  if (!aCache)
+    return NULL;
+
+  Standard_Size* aBlock = aCache->FreeList[theIndex];
+  if (aBlock)
+  {
+    ThreadCache::Increment(aCache->NbHits);
+  }
+  else
+  {
+    ThreadCache::Increment(aCache->NbMisses);
+
+    // take a batch of blocks from the shared free list
+    myMutex.Lock();
+    aBlock                  = myFreeList[theIndex];
+    Standard_Size* aLast    = NULL;
+    Standard_Size  aNbTaken = 0;
+    for (Standard_Size* aFree = aBlock; aFree && aNbTaken < THREAD_CACHE_BATCH; ++aNbTaken)
+    {
+      aLast = aFree;
+      aFree = *(Standard_Size**)aFree;
+    }
+    if (aLast)
+    {
+      myFreeList[theIndex]    = *(Standard_Size**)aLast;
+      *(Standard_Size**)aLast = NULL;
+    }
+    myMutex.Unlock();
+
+    // the block will be allocated from the pool
+    if (!aBlock)
+      return NULL;
+    aCache->NbBlocks[theIndex] = aNbTaken;
+  }
+
+  aCache->FreeList[theIndex] = *(Standard_Size**)aBlock;
+  --aCache->NbBlocks[theIndex];
+  return aBlock;
+}
+
+//=================================================================================================
+
+Standard_Boolean Standard_MMgrOpt::freeCached(Standard_Size* theBlock, const Standard_Size theIndex)
+{
+  ThreadCache* aCache = threadCache();
+  if (!aCache)
+    return Standard_False;
+
+  *(Standard_Size**)theBlock = aCache->FreeList[theIndex];
+  aCache->FreeList[theIndex] = theBlock;
+  if (++aCache->NbBlocks[theIndex] <= THREAD_CACHE_MAX)
+    return Standard_True;
+
+  // keep the recently freed half of blocks and return the others to the shared free list
+  Standard_Size* aLast = theBlock;
+  for (Standard_Size aBlockIter = 1; aBlockIter < THREAD_CACHE_MAX / 2; ++aBlockIter)
+    aLast = *(Standard_Size**)aLast;
+  Standard_Size* aFirst   = *(Standard_Size**)aLast;
+  *(Standard_Size**)aLast = NULL;
+  Standard_Size* aTail    = aFirst;
+  while (*(Standard_Size**)aTail)
+    aTail = *(Standard_Size**)aTail;
+  aCache->NbBlocks[theIndex] = THREAD_CACHE_MAX / 2;
+
+  myMutex.Lock();
+  *(Standard_Size**)aTail = myFreeList[theIndex];
+  myFreeList[theIndex]    = aFirst;
+  myMutex.Unlock();
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void Standard_MMgrOpt::releaseThreadCache(ThreadCache& theCache)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+
+  // return all blocks to the shared free lists
+  const Standard_Size nCells = INDEX_CELL(myCellSize);
+  for (Standard_Size i = 0; i <= nCells; i++)
+  {
+    Standard_Size* aFirst = theCache.FreeList[i];
+    if (!aFirst)
+      continue;
+    Standard_Size* aTail = aFirst;
+    while (*(Standard_Size**)aTail)
+      aTail = *(Standard_Size**)aTail;
+    *(Standard_Size**)aTail = myFreeList[i];
+    myFreeList[i]           = aFirst;
+  }
+
+  // keep statistics and unregister the cache
+  myNbReleasedHits += theCache.NbHits.load(std::memory_order_relaxed);
+  myNbReleasedMisses += theCache.NbMisses.load(std::memory_order_relaxed);
+  for (ThreadCache** aCacheIter = &myThreadCaches; *aCacheIter; aCacheIter = &(*aCacheIter)->Next)
+  {
+    if (*aCacheIter == &theCache)
+    {
+      *aCacheIter = theCache.Next;
+      break;
+    }
+  }
+
+  free(theCache.FreeList);
+  free(theCache.NbBlocks);
+  theCache.FreeList = NULL;
+  theCache.NbBlocks = NULL;
+  theCache.Next     = NULL;
+  theCache.Owner    = NULL;
+}
+
+//=================================================================================================
+
+void Standard_MMgrOpt::ThreadCacheStatistics(Standard_Size& theNbHits, Standard_Size& theNbMisses)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  theNbHits   = myNbReleasedHits;
+  theNbMisses = myNbReleasedMisses;
+  for (ThreadCache* aCache = myThreadCaches; aCache; aCache = aCache->Next)
+  {
+    theNbHits += aCache->NbHits.load(std::memory_order_relaxed);
+    theNbMisses += aCache->NbMisses.load(std::memory_order_relaxed);
+  }
+}
+
 //=======================================================================
 // function : Purge
 // purpose  : Frees all free lists except small blocks (less than CellSize)
@@ -51,6 +51,14 @@
  * Note that destructor of that class frees all free lists and memory pools
  * allocated for small blocks.
  *
+ * - If option aThreadCache is True, free small blocks are additionally
+ *   kept in caches local to each thread. Allocation and deallocation of
+ *   small blocks is then done within the cache of the calling thread
+ *   without locking; the shared free lists are accessed (under mutex) only
+ *   to take a batch of blocks when the cache is empty, or to return a batch
+ *   when the cache grows too big. The remaining blocks are returned to the
+ *   shared free lists when the thread exits.
+ *
  * Note that size of memory blocks allocated by this memory manager is always
  * rounded up to 16 bytes. In addition, 8 bytes are added at the beginning
  * of the memory block to hold auxiliary information (size of the block when
@@ -65,11 +73,12 @@ public:
   //! Constructor. If aClear is True, the allocated emmory will be
   //! nullified. For description of other parameters, see description
   //! of the class above.
-  Standard_EXPORT Standard_MMgrOpt(const Standard_Boolean aClear     = Standard_True,
-                                   const Standard_Boolean aMMap      = Standard_True,
-                                   const Standard_Size    aCellSize  = 200,
-                                   const Standard_Integer aNbPages   = 10000,
-                                   const Standard_Size    aThreshold = 40000);
+  Standard_EXPORT Standard_MMgrOpt(const Standard_Boolean aClear       = Standard_True,
+                                   const Standard_Boolean aMMap        = Standard_True,
+                                   const Standard_Size    aCellSize    = 200,
+                                   const Standard_Integer aNbPages     = 10000,
+                                   const Standard_Size    aThreshold   = 40000,
+                                   const Standard_Boolean aThreadCache = Standard_False);
 
   //! Frees all free lists and pools allocated for small blocks
   Standard_EXPORT virtual ~Standard_MMgrOpt();
@@ -108,6 +117,32 @@ public:
   //! Allocate and Free methods.
   Standard_EXPORT static void SetCallBackFunction(TPCallBackFunc pFunc);
 
+  //! Returns True if free small blocks are cached per thread.
+  Standard_Boolean IsThreadCache() const { return myThreadCache; }
+
+  //! Returns statistics of thread caches: number of small blocks allocated
+  //! from the cache of the calling thread without locking (theNbHits),
+  //! and number of allocations which had to access the shared free lists (theNbMisses).
+  Standard_EXPORT void ThreadCacheStatistics(Standard_Size& theNbHits, Standard_Size& theNbMisses);
+
+protected:
+  //! Cache of free small blocks of one thread
+  struct ThreadCache;
+
+  //! Returns the cache of the calling thread bound to this manager, or NULL
+  ThreadCache* threadCache();
+
+  //! Takes the block of the given size index from the cache of the calling thread,
+  //! refilling it from the shared free list if empty; returns NULL if no free block is available
+  Standard_Size* allocateCached(const Standard_Size theIndex);
+
+  //! Puts the block into the cache of the calling thread;
+  //! returns False if the cache cannot be used
+  Standard_Boolean freeCached(Standard_Size* theBlock, const Standard_Size theIndex);
+
+  //! Returns blocks of the cache to the shared free lists and unregisters it
+  void releaseThreadCache(ThreadCache& theCache);
+
 protected:
   //! Internal - initialization of buffers
   Standard_EXPORT void Initialize();
@@ -143,6 +178,11 @@ protected:
 
   Standard_Mutex myMutex;      //!< Mutex to protect free lists data
   Standard_Mutex myMutexPools; //!< Mutex to protect small block pools data
+
+  Standard_Boolean myThreadCache;      //!< option to cache free small blocks per thread
+  ThreadCache*     myThreadCaches;     //!< list of registered thread caches
+  Standard_Size    myNbReleasedHits;   //!< cache hits of the threads already finished
+  Standard_Size    myNbReleasedMisses; //!< cache misses of the threads already finished
 };
 
 #endif
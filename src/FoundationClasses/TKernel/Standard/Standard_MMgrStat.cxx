@@ -0,0 +1,457 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrStat.hxx>
+
+#include <Standard.hxx>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+//! Size of the header keeping the size of block;
+//! 16 bytes are used to keep alignment of the user area.
+static const Standard_Size THE_HEADER_SIZE = 16;
+
+//! Maximum number of frames of the recorded call stack
+static const int THE_NB_FRAMES = 10;
+
+//! Flag indicating that the calling thread is recording call stack;
+//! used to ignore allocations made by the system while collecting it
+static thread_local bool THE_IS_RECORDING = false;
+
+//! Removes the leading and trailing lines added by Standard::StackTrace()
+static void trimStackTrace(std::string& theStack)
+{
+  static const char THE_HEAD[] = "\n==Backtrace==";
+  static const char THE_TAIL[] = "\n=============";
+  if (theStack.compare(0, sizeof(THE_HEAD) - 1, THE_HEAD) == 0)
+  {
+    theStack.erase(0, sizeof(THE_HEAD) - 1);
+  }
+  if (theStack.size() >= sizeof(THE_TAIL) - 1
+      && theStack.compare(theStack.size() - sizeof(THE_TAIL) + 1, sizeof(THE_TAIL) - 1, THE_TAIL)
+           == 0)
+  {
+    theStack.erase(theStack.size() - sizeof(THE_TAIL) + 1);
+  }
+}
+} // namespace
+
+//! Counters of one thread.
+//! Allocations of the threads which cannot be registered (e.g. exiting)
+//! are recorded in the shared counters of finished threads.
+struct Standard_MMgrStat::ThreadData
+{
+  Standard_MMgrStat*         Owner;                         //!< manager the counters are bound to
+  ThreadData*                Next;                          //!< next registered thread
+  std::thread::id            Id;                            //!< thread identifier
+  std::atomic<Standard_Size> NbAllocs[THE_NB_SIZE_CLASSES]; //!< allocated blocks per size class
+  std::atomic<Standard_Size> NbFrees[THE_NB_SIZE_CLASSES];  //!< freed blocks per size class
+  std::atomic<Standard_Size> AllocBytes;                    //!< number of allocated bytes
+  std::atomic<Standard_Size> FreeBytes;                     //!< number of freed bytes
+  Standard_Integer           NbToSample;                    //!< allocations left till next sample
+  Standard_Boolean           IsReleased;                    //!< flag indicating exited thread
+
+  ThreadData()
+      : Owner(NULL),
+        Next(NULL),
+        AllocBytes(0),
+        FreeBytes(0),
+        NbToSample(0),
+        IsReleased(Standard_False)
+  {
+    for (Standard_Integer aClass = 0; aClass < THE_NB_SIZE_CLASSES; ++aClass)
+    {
+      NbAllocs[aClass] = 0;
+      NbFrees[aClass]  = 0;
+    }
+  }
+
+  //! Passes the counters to the manager when the thread exits
+  ~ThreadData()
+  {
+    if (Owner != NULL)
+    {
+      Owner->releaseThreadData(*this);
+    }
+    IsReleased = Standard_True;
+  }
+
+  //! Resets counters
+  void Reset()
+  {
+    for (Standard_Integer aClass = 0; aClass < THE_NB_SIZE_CLASSES; ++aClass)
+    {
+      NbAllocs[aClass].store(0, std::memory_order_relaxed);
+      NbFrees[aClass].store(0, std::memory_order_relaxed);
+    }
+    AllocBytes.store(0, std::memory_order_relaxed);
+    FreeBytes.store(0, std::memory_order_relaxed);
+  }
+
+  //! Adds counters of another thread
+  void Add(const ThreadData& theOther)
+  {
+    for (Standard_Integer aClass = 0; aClass < THE_NB_SIZE_CLASSES; ++aClass)
+    {
+      NbAllocs[aClass].fetch_add(theOther.NbAllocs[aClass].load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+      NbFrees[aClass].fetch_add(theOther.NbFrees[aClass].load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+    }
+    AllocBytes.fetch_add(theOther.AllocBytes.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+    FreeBytes.fetch_add(theOther.FreeBytes.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+  }
+
+  //! Returns total numbers of allocated and freed blocks
+  void Totals(Standard_Size& theNbAllocs, Standard_Size& theNbFrees) const
+  {
+    theNbAllocs = 0;
+    theNbFrees  = 0;
+    for (Standard_Integer aClass = 0; aClass < THE_NB_SIZE_CLASSES; ++aClass)
+    {
+      theNbAllocs += NbAllocs[aClass].load(std::memory_order_relaxed);
+      theNbFrees += NbFrees[aClass].load(std::memory_order_relaxed);
+    }
+  }
+};
+
+//! Call stacks of sampled allocations
+struct Standard_MMgrStat::SiteMap
+{
+  //! Number of samples and their size
+  struct Site
+  {
+    Standard_Size NbSamples;
+    Standard_Size NbBytes;
+
+    Site()
+        : NbSamples(0),
+          NbBytes(0)
+    {
+    }
+  };
+
+  std::map<std::string, Site> Sites;
+};
+
+//=================================================================================================
+
+Standard_MMgrStat::Standard_MMgrStat(Standard_MMgrRoot* theMMgr, const Standard_Integer theSampling)
+    : myMMgr(theMMgr),
+      mySampling(theSampling > 0 ? theSampling : 0),
+      myLiveBytes(0),
+      myPeakBytes(0),
+      myThreads(NULL),
+      myFinished(new ThreadData()),
+      mySites(new SiteMap())
+{
+}
+
+//=================================================================================================
+
+Standard_MMgrStat::~Standard_MMgrStat()
+{
+  {
+    // detach counters of running threads
+    Standard_Mutex::Sentry aSentry(myMutex);
+    while (myThreads != NULL)
+    {
+      ThreadData* aData = myThreads;
+      myThreads         = aData->Next;
+      aData->Next       = NULL;
+      aData->Owner      = NULL;
+    }
+  }
+  delete mySites;
+  delete myFinished;
+  delete myMMgr;
+}
+
+//=================================================================================================
+
+Standard_Address Standard_MMgrStat::Allocate(const Standard_Size theSize)
+{
+  Standard_Size* aBlock = (Standard_Size*)myMMgr->Allocate(theSize + THE_HEADER_SIZE);
+  aBlock[0]             = theSize;
+  recordAlloc(threadData(), theSize);
+  return (char*)aBlock + THE_HEADER_SIZE;
+}
+
+//=================================================================================================
+
+Standard_Address Standard_MMgrStat::Reallocate(Standard_Address thePtr, const Standard_Size theSize)
+{
+  if (thePtr == NULL)
+  {
+    return Allocate(theSize);
+  }
+
+  Standard_Size*      aBlock    = (Standard_Size*)((char*)thePtr - THE_HEADER_SIZE);
+  const Standard_Size anOldSize = aBlock[0];
+
+  aBlock    = (Standard_Size*)myMMgr->Reallocate(aBlock, theSize + THE_HEADER_SIZE);
+  aBlock[0] = theSize;
+
+  ThreadData& aData = threadData();
+  recordFree(aData, anOldSize);
+  recordAlloc(aData, theSize);
+  return (char*)aBlock + THE_HEADER_SIZE;
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::Free(Standard_Address thePtr)
+{
+  if (thePtr == NULL)
+  {
+    return;
+  }
+
+  Standard_Size* aBlock = (Standard_Size*)((char*)thePtr - THE_HEADER_SIZE);
+  recordFree(threadData(), aBlock[0]);
+  myMMgr->Free(aBlock);
+}
+
+//=================================================================================================
+
+Standard_Integer Standard_MMgrStat::Purge(Standard_Boolean isDestroyed)
+{
+  return myMMgr->Purge(isDestroyed);
+}
+
+//=================================================================================================
+
+Standard_MMgrStat::ThreadData& Standard_MMgrStat::threadData()
+{
+  static thread_local ThreadData aData;
+  if (aData.Owner == this)
+  {
+    return aData;
+  }
+
+  // the counters are bound to the first manager used by the thread,
+  // and cannot be used any more when the thread is exiting
+  if (aData.Owner != NULL || aData.IsReleased)
+  {
+    return *myFinished;
+  }
+
+  Standard_Mutex::Sentry aSentry(myMutex);
+  aData.Owner      = this;
+  aData.Id         = std::this_thread::get_id();
+  aData.NbToSample = mySampling;
+  aData.Next       = myThreads;
+  myThreads        = &aData;
+  return aData;
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::recordAlloc(ThreadData& theData, const Standard_Size theSize)
+{
+  theData.NbAllocs[SizeClass(theSize)].fetch_add(1, std::memory_order_relaxed);
+  theData.AllocBytes.fetch_add(theSize, std::memory_order_relaxed);
+
+  const Standard_Size aLive = myLiveBytes.fetch_add(theSize, std::memory_order_relaxed) + theSize;
+  Standard_Size       aPeak = myPeakBytes.load(std::memory_order_relaxed);
+  while (aLive > aPeak
+         && !myPeakBytes.compare_exchange_weak(aPeak, aLive, std::memory_order_relaxed))
+  {
+    //
+  }
+
+  if (mySampling > 0 && &theData != myFinished && --theData.NbToSample <= 0)
+  {
+    theData.NbToSample = mySampling;
+    recordSite(theSize);
+  }
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::recordFree(ThreadData& theData, const Standard_Size theSize)
+{
+  theData.NbFrees[SizeClass(theSize)].fetch_add(1, std::memory_order_relaxed);
+  theData.FreeBytes.fetch_add(theSize, std::memory_order_relaxed);
+  myLiveBytes.fetch_sub(theSize, std::memory_order_relaxed);
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::recordSite(const Standard_Size theSize)
+{
+  if (THE_IS_RECORDING)
+  {
+    return;
+  }
+
+  THE_IS_RECORDING = true;
+
+  char aBuffer[4096] = {};
+  if (Standard::StackTrace(aBuffer, sizeof(aBuffer), THE_NB_FRAMES, NULL, 3))
+  {
+    std::string aStack(aBuffer);
+    trimStackTrace(aStack);
+
+    Standard_Mutex::Sentry aSentry(mySitesMutex);
+    SiteMap::Site&         aSite = mySites->Sites[aStack];
+    ++aSite.NbSamples;
+    aSite.NbBytes += theSize;
+  }
+  THE_IS_RECORDING = false;
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::releaseThreadData(ThreadData& theData)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  myFinished->Add(theData);
+  for (ThreadData** aDataIter = &myThreads; *aDataIter != NULL; aDataIter = &(*aDataIter)->Next)
+  {
+    if (*aDataIter == &theData)
+    {
+      *aDataIter = theData.Next;
+      break;
+    }
+  }
+  theData.Next  = NULL;
+  theData.Owner = NULL;
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::Counters(const Standard_Integer theClass,
+                                 Standard_Size&         theNbAllocs,
+                                 Standard_Size&         theNbFrees) const
+{
+  theNbAllocs = 0;
+  theNbFrees  = 0;
+  const auto addCounters = [&](const ThreadData& theData) {
+    if (theClass < 0)
+    {
+      Standard_Size aNbAllocs = 0, aNbFrees = 0;
+      theData.Totals(aNbAllocs, aNbFrees);
+      theNbAllocs += aNbAllocs;
+      theNbFrees += aNbFrees;
+    }
+    else if (theClass < THE_NB_SIZE_CLASSES)
+    {
+      theNbAllocs += theData.NbAllocs[theClass].load(std::memory_order_relaxed);
+      theNbFrees += theData.NbFrees[theClass].load(std::memory_order_relaxed);
+    }
+  };
+
+  Standard_Mutex::Sentry aSentry(myMutex);
+  addCounters(*myFinished);
+  for (const ThreadData* aData = myThreads; aData != NULL; aData = aData->Next)
+  {
+    addCounters(*aData);
+  }
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::Reset()
+{
+  {
+    Standard_Mutex::Sentry aSentry(myMutex);
+    for (ThreadData* aData = myThreads; aData != NULL; aData = aData->Next)
+    {
+      aData->Reset();
+    }
+    myFinished->Reset();
+    myPeakBytes.store(myLiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  Standard_Mutex::Sentry aSentry(mySitesMutex);
+  mySites->Sites.clear();
+}
+
+//=================================================================================================
+
+void Standard_MMgrStat::Dump(Standard_OStream& theStream, const Standard_Integer theNbSites) const
+{
+  Standard_Size aNbAllocs = 0, aNbFrees = 0;
+  Counters(-1, aNbAllocs, aNbFrees);
+  theStream << "Allocated blocks: " << aNbAllocs << ", freed blocks: " << aNbFrees << "\n"
+            << "Live bytes: " << LiveBytes() << ", peak bytes: " << PeakBytes() << "\n";
+
+  theStream << "Size classes:\n";
+  for (Standard_Integer aClass = 0; aClass < THE_NB_SIZE_CLASSES; ++aClass)
+  {
+    Counters(aClass, aNbAllocs, aNbFrees);
+    if (aNbAllocs == 0 && aNbFrees == 0)
+    {
+      continue;
+    }
+    if (aClass < THE_NB_SIZE_CLASSES - 1)
+    {
+      theStream << "  <= " << SizeClassUpperBound(aClass);
+    }
+    else
+    {
+      theStream << "  >  " << SizeClassUpperBound(aClass - 1);
+    }
+    theStream << ": allocated " << aNbAllocs << ", freed " << aNbFrees << "\n";
+  }
+
+  theStream << "Threads:\n";
+  {
+    Standard_Mutex::Sentry aSentry(myMutex);
+    for (const ThreadData* aData = myThreads; aData != NULL; aData = aData->Next)
+    {
+      aData->Totals(aNbAllocs, aNbFrees);
+      theStream << "  " << aData->Id << ": allocated " << aNbAllocs << " ("
+                << aData->AllocBytes.load(std::memory_order_relaxed) << " bytes), freed "
+                << aNbFrees << " (" << aData->FreeBytes.load(std::memory_order_relaxed)
+                << " bytes)\n";
+    }
+    myFinished->Totals(aNbAllocs, aNbFrees);
+    theStream << "  finished: allocated " << aNbAllocs << " ("
+              << myFinished->AllocBytes.load(std::memory_order_relaxed) << " bytes), freed "
+              << aNbFrees << " (" << myFinished->FreeBytes.load(std::memory_order_relaxed)
+              << " bytes)\n";
+  }
+
+  if (mySampling <= 0 || theNbSites <= 0)
+  {
+    return;
+  }
+
+  typedef std::pair<std::string, SiteMap::Site> SiteEntry;
+  std::vector<SiteEntry>                        aSites;
+  {
+    Standard_Mutex::Sentry aSentry(mySitesMutex);
+    aSites.assign(mySites->Sites.begin(), mySites->Sites.end());
+  }
+  std::sort(aSites.begin(), aSites.end(), [](const SiteEntry& theLeft, const SiteEntry& theRight) {
+    return theLeft.second.NbSamples > theRight.second.NbSamples;
+  });
+
+  theStream << "Call sites (each " << mySampling << " allocations sampled):\n";
+  const size_t aNbSites = std::min(aSites.size(), size_t(theNbSites));
+  for (size_t aSiteIter = 0; aSiteIter < aNbSites; ++aSiteIter)
+  {
+    theStream << "  samples " << aSites[aSiteIter].second.NbSamples << ", bytes "
+              << aSites[aSiteIter].second.NbBytes << ":" << aSites[aSiteIter].first << "\n";
+  }
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Standard_MMgrStat_HeaderFile
+#define _Standard_MMgrStat_HeaderFile
+
+#include <Standard_MMgrRoot.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_OStream.hxx>
+
+#include <atomic>
+
+/**
+ * @brief Memory manager collecting statistics of allocations
+ * passed to another memory manager.
+ *
+ * It is used by Standard::Allocate() and related functions when environment
+ * variable MMGT_STAT is set to 1 (see Standard::AllocatorStatistics()).
+ * The following data is collected:
+ *
+ * - numbers of allocated and freed blocks per size class;
+ *   size classes are powers of two, starting from 8 bytes;
+ *
+ * - number of bytes currently allocated, and its peak value;
+ *
+ * - numbers of allocated and freed blocks and bytes per thread;
+ *
+ * - call stacks of sampled allocations, if sampling rate is not zero
+ *   (environment variable MMGT_STAT_SAMPLING): call stack of each
+ *   N-th allocation of a thread is recorded, so that most frequent
+ *   allocation sites can be found.
+ *
+ * Each block is prefixed by a header keeping its size, so that the memory
+ * consumption is increased by 16 bytes per block. Counters of each thread
+ * are modified by this thread only; the number of allocated bytes is shared.
+ */
+class Standard_MMgrStat : public Standard_MMgrRoot
+{
+public:
+  //! Number of size classes; the last one collects all blocks
+  //! greater than the upper bound of the previous class
+  static const Standard_Integer THE_NB_SIZE_CLASSES = 32;
+
+  //! Constructor.
+  //! @param[in] theMMgr      memory manager performing allocations; it is deleted by destructor
+  //! @param[in] theSampling  rate of recording call stacks, 0 to disable
+  Standard_EXPORT Standard_MMgrStat(Standard_MMgrRoot* theMMgr, const Standard_Integer theSampling);
+
+  //! Destructor deletes the underlying memory manager
+  Standard_EXPORT virtual ~Standard_MMgrStat();
+
+  //! Allocate theSize bytes using underlying memory manager
+  Standard_EXPORT virtual Standard_Address Allocate(const Standard_Size theSize) Standard_OVERRIDE;
+
+  //! Reallocate thePtr to the size theSize using underlying memory manager
+  Standard_EXPORT virtual Standard_Address Reallocate(Standard_Address    thePtr,
+                                                      const Standard_Size theSize)
+    Standard_OVERRIDE;
+
+  //! Free allocated memory
+  Standard_EXPORT virtual void Free(Standard_Address thePtr) Standard_OVERRIDE;
+
+  //! Purge underlying memory manager
+  Standard_EXPORT virtual Standard_Integer Purge(Standard_Boolean isDestroyed) Standard_OVERRIDE;
+
+public: //! @name statistics
+  //! Returns the upper bound of block sizes within the size class.
+  static Standard_Size SizeClassUpperBound(const Standard_Integer theClass)
+  {
+    return Standard_Size(8) << theClass;
+  }
+
+  //! Returns the size class of the block.
+  static Standard_Integer SizeClass(const Standard_Size theSize)
+  {
+    Standard_Integer aClass = 0;
+    for (Standard_Size aBound = 8; theSize > aBound && aClass < THE_NB_SIZE_CLASSES - 1;
+         aBound <<= 1)
+    {
+      ++aClass;
+    }
+    return aClass;
+  }
+
+  //! Returns sampling rate of call stacks.
+  Standard_Integer Sampling() const { return mySampling; }
+
+  //! Returns the number of bytes currently allocated.
+  Standard_Size LiveBytes() const { return myLiveBytes.load(std::memory_order_relaxed); }
+
+  //! Returns the peak number of bytes allocated since construction or last Reset().
+  Standard_Size PeakBytes() const { return myPeakBytes.load(std::memory_order_relaxed); }
+
+  //! Returns numbers of allocated and freed blocks in the size class,
+  //! or in all classes if theClass is -1.
+  Standard_EXPORT void Counters(const Standard_Integer theClass,
+                                Standard_Size&         theNbAllocs,
+                                Standard_Size&         theNbFrees) const;
+
+  //! Resets all counters except the number of allocated bytes, and forgets recorded call stacks.
+  Standard_EXPORT void Reset();
+
+  //! Prints statistics into the stream.
+  //! @param[in] theStream   the output stream
+  //! @param[in] theNbSites  maximum number of most frequent call stacks to print
+  Standard_EXPORT void Dump(Standard_OStream&      theStream,
+                            const Standard_Integer theNbSites = 10) const;
+
+protected:
+  //! Counters of one thread
+  struct ThreadData;
+
+  //! Call stacks of sampled allocations
+  struct SiteMap;
+
+  //! Returns counters of the calling thread
+  ThreadData& threadData();
+
+  //! Records allocation of the block
+  void recordAlloc(ThreadData& theData, const Standard_Size theSize);
+
+  //! Records release of the block
+  void recordFree(ThreadData& theData, const Standard_Size theSize);
+
+  //! Records call stack of the calling thread
+  void recordSite(const Standard_Size theSize);
+
+  //! Accumulates counters of the finished thread and unregisters them
+  void releaseThreadData(ThreadData& theData);
+
+private:
+  Standard_MMgrStat(const Standard_MMgrStat&)            = delete;
+  Standard_MMgrStat& operator=(const Standard_MMgrStat&) = delete;
+
+protected:
+  Standard_MMgrRoot*         myMMgr;       //!< underlying memory manager
+  Standard_Integer           mySampling;   //!< sampling rate of call stacks
+  std::atomic<Standard_Size> myLiveBytes;  //!< number of allocated bytes
+  std::atomic<Standard_Size> myPeakBytes;  //!< peak number of allocated bytes
+  ThreadData*                myThreads;    //!< list of registered threads
+  ThreadData*                myFinished;   //!< counters of finished and unregistered threads
+  SiteMap*                   mySites;      //!< recorded call stacks
+  mutable Standard_Mutex     myMutex;      //!< mutex protecting list of threads
+  mutable Standard_Mutex     mySitesMutex; //!< mutex protecting call stacks
+};
+
+#endif // _Standard_MMgrStat_HeaderFile
@@ -20,11 +20,15 @@
 #include <BOPDS_DS.hxx>
 #include <BOPTools_AlgoTools.hxx>
 #include <BOPTools_AlgoTools3D.hxx>
+#include <BOPTools_BoxTree.hxx>
 #include <BOPTools_IndexedDataMapOfSetShape.hxx>
 #include <BOPTools_Set.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Tools.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -49,13 +53,29 @@ static void RemoveDuplicates(TopTools_ListOfShape& theContainers, const TopAbs_S
 static Standard_Integer NbCommonItemsInMap(const TopTools_MapOfShape& theM1,
                                            const TopTools_MapOfShape& theM2);
 //
+static void SortTools(const TopTools_ListOfShape& theTools, TopTools_ListOfShape& theSorted);
+//
+static void MakeBatches(const TopTools_ListOfShape&               theTools,
+                        const Standard_Integer                    theBatchSize,
+                        const Standard_Size                       theMemoryBudget,
+                        NCollection_Vector<TopTools_ListOfShape>& theBatches);
+//
 static void MapFacesToBuildSolids(const TopoDS_Shape&                        theSol,
                                   TopTools_IndexedDataMapOfShapeListOfShape& theMFS);
 
+//! Approximate memory (in bytes) of the intersection data of one vertex, edge or face
+//! of a tool, used by BOPAlgo_BOP::EstimatedToolMemory().
+//! It is a rough estimation of the information of the sub-shape in the data structure
+//! (pave blocks, face info, bounding boxes) and of the tools cached for it in the
+//! intersection context (projectors, classifiers).
+static const Standard_Size THE_MEMORY_PER_SUB_SHAPE = 4096;
+
 //=================================================================================================
 
 BOPAlgo_BOP::BOPAlgo_BOP()
-    : BOPAlgo_ToolsProvider()
+    : BOPAlgo_ToolsProvider(),
+      myToolsBatchSize(0),
+      myToolsMemoryBudget(0)
 {
   Clear();
 }
@@ -63,7 +83,9 @@ BOPAlgo_BOP::BOPAlgo_BOP()
 //=================================================================================================
 
 BOPAlgo_BOP::BOPAlgo_BOP(const Handle(NCollection_BaseAllocator)& theAllocator)
-    : BOPAlgo_ToolsProvider(theAllocator)
+    : BOPAlgo_ToolsProvider(theAllocator),
+      myToolsBatchSize(0),
+      myToolsMemoryBudget(0)
 {
   Clear();
 }
@@ -349,6 +371,12 @@ void BOPAlgo_BOP::BuildResult(const TopAbs_ShapeEnum theType)
 
 void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
 {
+  if (IsBatchingNeeded(myOperation, myTools, myToolsBatchSize, myToolsMemoryBudget))
+  {
+    PerformByBatches(theRange);
+    return;
+  }
+  //
   Handle(NCollection_BaseAllocator)  aAllocator;
   BOPAlgo_PaveFiller*                pPF;
   TopTools_ListIteratorOfListOfShape aItLS;
@@ -390,6 +418,7 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetIntersectionCache(myIntersectionCache);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -399,6 +428,129 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
 
 //=================================================================================================
 
+void BOPAlgo_BOP::PerformByBatches(const Message_ProgressRange& theRange)
+{
+  GetReport()->Clear();
+  //
+  if (myEntryPoint == 1)
+  {
+    if (myPaveFiller)
+    {
+      delete myPaveFiller;
+      myPaveFiller = NULL;
+    }
+  }
+  myEntryPoint = 0;
+  myDS         = NULL;
+  myShape.Nullify();
+  myHistory.Nullify();
+  //
+  // Order the tools so that the consecutive tools are close to each other
+  TopTools_ListOfShape aTools;
+  SortTools(myTools, aTools);
+  //
+  NCollection_Vector<TopTools_ListOfShape> aBatches;
+  MakeBatches(aTools, myToolsBatchSize, myToolsMemoryBudget, aBatches);
+  //
+  const Standard_Integer aNbBatches = aBatches.Length();
+  Message_ProgressScope  aPS(theRange, "Performing Boolean operation by batches", aNbBatches);
+  //
+  TopTools_ListOfShape anObjects = myArguments;
+  for (Standard_Integer iBatch = 0; iBatch < aNbBatches; ++iBatch)
+  {
+    if (UserBreak(aPS))
+    {
+      return;
+    }
+    //
+    const TopTools_ListOfShape& aBatch = aBatches(iBatch);
+    //
+    // The intersection data of the batch is released on exit from the iteration
+    BOPAlgo_BOP aBOP(myAllocator);
+    aBOP.SetArguments(anObjects);
+    aBOP.SetTools(aBatch);
+    aBOP.SetOperation(myOperation);
+    aBOP.SetRunParallel(myRunParallel);
+    aBOP.SetFuzzyValue(myFuzzyValue);
+    aBOP.SetNonDestructive(myNonDestructive);
+    aBOP.SetGlue(myGlue);
+    aBOP.SetUseOBB(myUseOBB);
+    aBOP.SetIntersectionCache(myIntersectionCache);
+    aBOP.SetCheckInverted(myCheckInverted);
+    aBOP.SetToFillHistory(myFillHistory);
+    aBOP.Perform(aPS.Next());
+    GetReport()->Merge(aBOP.GetReport());
+    if (aBOP.HasErrors())
+    {
+      return;
+    }
+    //
+    // Commit the result of the batch
+    myShape = aBOP.Shape();
+    if (myFillHistory)
+    {
+      if (myHistory.IsNull())
+      {
+        myHistory = new BRepTools_History;
+      }
+      myHistory->Merge(aBOP.History());
+    }
+    //
+    if (myOperation == BOPAlgo_CUT && !TopoDS_Iterator(myShape).More())
+    {
+      // nothing left to cut
+      break;
+    }
+    anObjects.Clear();
+    anObjects.Append(myShape);
+  }
+}
+
+//=================================================================================================
+
+Standard_Size BOPAlgo_BOP::EstimatedToolMemory(const TopoDS_Shape& theTool)
+{
+  TopTools_IndexedMapOfShape aMS;
+  TopExp::MapShapes(theTool, TopAbs_VERTEX, aMS);
+  TopExp::MapShapes(theTool, TopAbs_EDGE, aMS);
+  TopExp::MapShapes(theTool, TopAbs_FACE, aMS);
+  return Standard_Size(aMS.Extent()) * THE_MEMORY_PER_SUB_SHAPE;
+}
+
+//=================================================================================================
+
+Standard_Boolean BOPAlgo_BOP::IsBatchingNeeded(const BOPAlgo_Operation     theOperation,
+                                               const TopTools_ListOfShape& theTools,
+                                               const Standard_Integer      theBatchSize,
+                                               const Standard_Size         theMemoryBudget)
+{
+  if ((theOperation != BOPAlgo_CUT && theOperation != BOPAlgo_FUSE) || theTools.Extent() < 2)
+  {
+    return Standard_False;
+  }
+  //
+  if (theBatchSize > 0 && theTools.Extent() > theBatchSize)
+  {
+    return Standard_True;
+  }
+  //
+  if (theMemoryBudget > 0)
+  {
+    Standard_Size aMemory = 0;
+    for (TopTools_ListIteratorOfListOfShape aIt(theTools); aIt.More(); aIt.Next())
+    {
+      aMemory += EstimatedToolMemory(aIt.Value());
+      if (aMemory > theMemoryBudget)
+      {
+        return Standard_True;
+      }
+    }
+  }
+  return Standard_False;
+}
+
+//=================================================================================================
+
 void BOPAlgo_BOP::fillPIConstants(const Standard_Real theWhole, BOPAlgo_PISteps& theSteps) const
 {
   BOPAlgo_Builder::fillPIConstants(theWhole, theSteps);
@@ -1723,3 +1875,68 @@ void MapFacesToBuildSolids(const TopoDS_Shape&                        theSol,
     }
   }
 }
+
+//=======================================================================
+// function: SortTools
+// purpose: Orders the shapes along the space-filling curve
+//          of the centers of their bounding boxes
+//=======================================================================
+void SortTools(const TopTools_ListOfShape& theTools, TopTools_ListOfShape& theSorted)
+{
+  NCollection_Vector<TopoDS_Shape> aShapes;
+  BOPTools_BoxTree                 aBoxTree;
+  aBoxTree.SetSize(theTools.Extent());
+  for (TopTools_ListIteratorOfListOfShape aIt(theTools); aIt.More(); aIt.Next())
+  {
+    const TopoDS_Shape& aS = aIt.Value();
+    Bnd_Box             aBox;
+    BRepBndLib::Add(aS, aBox);
+    if (aBox.IsVoid())
+    {
+      theSorted.Append(aS);
+      continue;
+    }
+    aBoxTree.Add(aShapes.Length(), Bnd_Tools::Bnd2BVH(aBox));
+    aShapes.Append(aS);
+  }
+  //
+  // The linear builder sorts the boxes by Morton codes of their centers
+  aBoxTree.Build();
+  for (Standard_Integer i = 0; i < aBoxTree.Size(); ++i)
+  {
+    theSorted.Append(aShapes(aBoxTree.Element(i)));
+  }
+}
+
+//=======================================================================
+// function: MakeBatches
+// purpose: Splits the ordered tools on the consecutive batches
+//          bounded by the number of tools and by their estimated memory
+//=======================================================================
+void MakeBatches(const TopTools_ListOfShape&               theTools,
+                 const Standard_Integer                    theBatchSize,
+                 const Standard_Size                       theMemoryBudget,
+                 NCollection_Vector<TopTools_ListOfShape>& theBatches)
+{
+  Standard_Size aBatchMemory = 0;
+  for (TopTools_ListIteratorOfListOfShape aIt(theTools); aIt.More(); aIt.Next())
+  {
+    const TopoDS_Shape& aS = aIt.Value();
+    const Standard_Size aMemory = theMemoryBudget > 0 ? BOPAlgo_BOP::EstimatedToolMemory(aS) : 0;
+    //
+    Standard_Boolean bNewBatch = theBatches.IsEmpty();
+    if (!bNewBatch)
+    {
+      const Standard_Integer aNbTools = theBatches.Last().Extent();
+      bNewBatch = (theBatchSize > 0 && aNbTools >= theBatchSize)
+                  || (theMemoryBudget > 0 && aBatchMemory + aMemory > theMemoryBudget);
+    }
+    if (bNewBatch)
+    {
+      theBatches.Appended();
+      aBatchMemory = 0;
+    }
+    theBatches.ChangeLast().Append(aS);
+    aBatchMemory += aMemory;
+  }
+}
@@ -78,6 +78,46 @@ public:
 
   Standard_EXPORT BOPAlgo_Operation Operation() const;
 
+  //! Sets the maximal number of tools intersected with the objects at once
+  //! (0 by default, i.e. all tools are intersected at once).<br>
+  //! When the operation is CUT or FUSE and the number of tools exceeds this value,
+  //! the tools are split on batches of spatially close tools, and the operation
+  //! is performed batch by batch, each batch being applied to the result of the previous ones.
+  //! Thus, the data structure of intersections contains the tools of a single batch only,
+  //! which bounds the peak memory of the operation with large number of tools.<br>
+  //! The data structure is not available after the operation performed by batches.
+  //! In case of user break the result of already processed batches is kept.
+  void SetToolsBatchSize(const Standard_Integer theSize) { myToolsBatchSize = theSize; }
+
+  //! Returns the maximal number of tools intersected with the objects at once
+  Standard_Integer ToolsBatchSize() const { return myToolsBatchSize; }
+
+  //! Sets the memory budget (in bytes) for the tools intersected with the objects at once
+  //! (0 by default, i.e. no limit).<br>
+  //! When the operation is CUT or FUSE and the estimated memory of all tools exceeds the budget,
+  //! the operation is performed by batches (see SetToolsBatchSize()), and a batch is closed
+  //! as soon as the estimated memory of its tools reaches the budget.
+  //! The estimation is approximate: it is proportional to the number of the vertices,
+  //! edges and faces of the tools (see EstimatedToolMemory()).
+  //! A tool exceeding the budget alone forms its own batch.
+  //! The budget may be combined with the batch size, the batch is closed by the first limit.
+  void SetToolsMemoryBudget(const Standard_Size theBytes) { myToolsMemoryBudget = theBytes; }
+
+  //! Returns the memory budget (in bytes) for the tools intersected with the objects at once
+  Standard_Size ToolsMemoryBudget() const { return myToolsMemoryBudget; }
+
+  //! Returns the approximate memory (in bytes) taken by the tool in the intersection data,
+  //! i.e. 4 KB per each vertex, edge and face of the tool.
+  Standard_EXPORT static Standard_Size EstimatedToolMemory(const TopoDS_Shape& theTool);
+
+  //! Returns TRUE if the operation with the given tools has to be performed by batches
+  //! for the given batch size and memory budget (see SetToolsBatchSize(), SetToolsMemoryBudget()).
+  Standard_EXPORT static Standard_Boolean IsBatchingNeeded(
+    const BOPAlgo_Operation     theOperation,
+    const TopTools_ListOfShape& theTools,
+    const Standard_Integer      theBatchSize,
+    const Standard_Size         theMemoryBudget);
+
   Standard_EXPORT virtual void Perform(
     const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
 
@@ -98,6 +138,9 @@ protected:
 
   Standard_EXPORT void BuildSolid(const Message_ProgressRange& theRange);
 
+  //! Performs the operation by batches of tools (see SetToolsBatchSize(), SetToolsMemoryBudget()).
+  Standard_EXPORT void PerformByBatches(const Message_ProgressRange& theRange);
+
   //! Treatment of the cases with empty shapes.<br>
   //! It returns TRUE if there is nothing to do, i.e.
   //! all shapes in one of the groups are empty shapes.
@@ -125,6 +168,8 @@ protected:
   BOPAlgo_Operation myOperation;
   Standard_Integer  myDims[2];
   TopoDS_Shape      myRC;
+  Standard_Integer  myToolsBatchSize;
+  Standard_Size     myToolsMemoryBudget;
 };
 
 #endif // _BOPAlgo_BOP_HeaderFile
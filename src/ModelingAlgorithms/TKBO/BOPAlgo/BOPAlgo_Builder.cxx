@@ -190,6 +190,7 @@ void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetIntersectionCache(myIntersectionCache);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -203,11 +204,12 @@ void BOPAlgo_Builder::PerformWithFiller(const BOPAlgo_PaveFiller&    theFiller,
                                         const Message_ProgressRange& theRange)
 {
   GetReport()->Clear();
-  myEntryPoint     = 0;
-  myNonDestructive = theFiller.NonDestructive();
-  myFuzzyValue     = theFiller.FuzzyValue();
-  myGlue           = theFiller.Glue();
-  myUseOBB         = theFiller.UseOBB();
+  myEntryPoint        = 0;
+  myNonDestructive    = theFiller.NonDestructive();
+  myFuzzyValue        = theFiller.FuzzyValue();
+  myGlue              = theFiller.Glue();
+  myUseOBB            = theFiller.UseOBB();
+  myIntersectionCache = theFiller.IntersectionCache();
   PerformInternal(theFiller, theRange);
 }
 
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_IntersectionCache.hxx>
+
+#include <NCollection_List.hxx>
+#include <NCollection_Map.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Shape.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_IntersectionCache, Standard_Transient)
+
+//=================================================================================================
+
+BOPAlgo_IntersectionCache::BOPAlgo_IntersectionCache()
+    : myNbHits(0)
+{
+}
+
+//=================================================================================================
+
+void BOPAlgo_IntersectionCache::Add(const TopoDS_Face&                    theF1,
+                                    const TopoDS_Face&                    theF2,
+                                    const Parameters&                     theParams,
+                                    const IntTools_SequenceOfCurves&      theCurves,
+                                    const IntTools_SequenceOfPntOn2Faces& thePoints,
+                                    const Standard_Boolean                theIsTangent)
+{
+  Result aResult;
+  aResult.Params    = theParams;
+  aResult.Curves    = theCurves;
+  aResult.Points    = thePoints;
+  aResult.IsTangent = theIsTangent;
+
+  Standard_Mutex::Sentry aSentry(myMutex);
+  myResults.Bind(FacePair(theF1, theF2), aResult);
+}
+
+//=================================================================================================
+
+Standard_Boolean BOPAlgo_IntersectionCache::Find(const TopoDS_Face&              theF1,
+                                                 const TopoDS_Face&              theF2,
+                                                 const Parameters&               theParams,
+                                                 IntTools_SequenceOfCurves&      theCurves,
+                                                 IntTools_SequenceOfPntOn2Faces& thePoints,
+                                                 Standard_Boolean&               theIsTangent)
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  const Result*          aResult = myResults.Seek(FacePair(theF1, theF2));
+  if (!aResult || !aResult->Params.IsEqual(theParams))
+  {
+    return Standard_False;
+  }
+
+  theCurves    = aResult->Curves;
+  thePoints    = aResult->Points;
+  theIsTangent = aResult->IsTangent;
+  ++myNbHits;
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void BOPAlgo_IntersectionCache::Invalidate(const TopoDS_Shape& theShape)
+{
+  NCollection_Map<Handle(TopoDS_TShape)> aFaces;
+  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    aFaces.Add(anExp.Current().TShape());
+  }
+  if (aFaces.IsEmpty())
+  {
+    return;
+  }
+
+  Standard_Mutex::Sentry aSentry(myMutex);
+  NCollection_List<FacePair> aToRemove;
+  for (DataMapOfFacePairResult::Iterator anIt(myResults); anIt.More(); anIt.Next())
+  {
+    const FacePair& aPair = anIt.Key();
+    if (aFaces.Contains(aPair.Face1.TShape()) || aFaces.Contains(aPair.Face2.TShape()))
+    {
+      aToRemove.Append(aPair);
+    }
+  }
+  for (NCollection_List<FacePair>::Iterator anIt(aToRemove); anIt.More(); anIt.Next())
+  {
+    myResults.UnBind(anIt.Value());
+  }
+}
+
+//=================================================================================================
+
+void BOPAlgo_IntersectionCache::Clear()
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  myResults.Clear();
+  myNbHits = 0;
+}
+
+//=================================================================================================
+
+Standard_Integer BOPAlgo_IntersectionCache::Extent() const
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  return myResults.Extent();
+}
+
+//=================================================================================================
+
+Standard_Integer BOPAlgo_IntersectionCache::NbHits() const
+{
+  Standard_Mutex::Sentry aSentry(myMutex);
+  return myNbHits;
+}
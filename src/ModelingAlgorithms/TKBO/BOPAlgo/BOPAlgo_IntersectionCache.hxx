@@ -0,0 +1,173 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_IntersectionCache_HeaderFile
+#define _BOPAlgo_IntersectionCache_HeaderFile
+
+#include <IntTools_SequenceOfCurves.hxx>
+#include <IntTools_SequenceOfPntOn2Faces.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_HashUtils.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Face.hxx>
+
+class TopoDS_Shape;
+
+class BOPAlgo_IntersectionCache;
+DEFINE_STANDARD_HANDLE(BOPAlgo_IntersectionCache, Standard_Transient)
+
+//! The class stores the results of Face/Face intersections to reuse them
+//! in successive Boolean operations on the same shapes.
+//!
+//! The results are keyed by the pair of faces (TShape, Location and Orientation),
+//! and are reused only if the intersection is requested with the same parameters
+//! (fuzzy value, tolerances of the faces, approximation options, etc.).
+//! Thus, when the same stock is processed by many operations, the intersections
+//! of its faces unchanged by previous operations with the same tools are not recomputed.
+//!
+//! The cache is opt-in: it is used by the intersection algorithm only when it is set
+//! by BOPAlgo_Options::SetIntersectionCache(). The same cache may be shared
+//! by several algorithms, including concurrently running ones.
+//!
+//! The cache cannot detect the modification of geometry of the faces in place,
+//! so the results for such faces have to be removed by Invalidate() method.
+class BOPAlgo_IntersectionCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_IntersectionCache, Standard_Transient)
+public:
+  //! Parameters of the intersection of two faces.
+  struct Parameters
+  {
+    Standard_Real    FuzzyValue;      //!< additional tolerance of the operation
+    Standard_Real    Tolerance;       //!< tolerance of the intersection curves
+    Standard_Real    Tolerance1;      //!< tolerance of the first face
+    Standard_Real    Tolerance2;      //!< tolerance of the second face
+    Standard_Real    ApproxTolerance; //!< tolerance of approximation of the curves
+    Standard_Integer NbStartPoints;   //!< number of starting points of the intersection
+    Standard_Boolean ToApprox;        //!< approximation of the curves
+    Standard_Boolean ToComputePC1;    //!< computation of the p-curves on the first face
+    Standard_Boolean ToComputePC2;    //!< computation of the p-curves on the second face
+
+    Parameters()
+        : FuzzyValue(0.0),
+          Tolerance(0.0),
+          Tolerance1(0.0),
+          Tolerance2(0.0),
+          ApproxTolerance(0.0),
+          NbStartPoints(0),
+          ToApprox(Standard_False),
+          ToComputePC1(Standard_False),
+          ToComputePC2(Standard_False)
+    {
+    }
+
+    //! Returns TRUE if the parameters coincide
+    Standard_Boolean IsEqual(const Parameters& theOther) const
+    {
+      return FuzzyValue == theOther.FuzzyValue && Tolerance == theOther.Tolerance
+             && Tolerance1 == theOther.Tolerance1 && Tolerance2 == theOther.Tolerance2
+             && ApproxTolerance == theOther.ApproxTolerance
+             && NbStartPoints == theOther.NbStartPoints && ToApprox == theOther.ToApprox
+             && ToComputePC1 == theOther.ToComputePC1 && ToComputePC2 == theOther.ToComputePC2;
+    }
+  };
+
+public:
+  //! Empty constructor
+  Standard_EXPORT BOPAlgo_IntersectionCache();
+
+  //! Stores the result of intersection of the faces computed with the given parameters.
+  //! The previously stored result for the same faces is replaced.
+  Standard_EXPORT void Add(const TopoDS_Face&                    theF1,
+                           const TopoDS_Face&                    theF2,
+                           const Parameters&                     theParams,
+                           const IntTools_SequenceOfCurves&      theCurves,
+                           const IntTools_SequenceOfPntOn2Faces& thePoints,
+                           const Standard_Boolean                theIsTangent);
+
+  //! Looks for the result of intersection of the faces computed with the same parameters.
+  //! Returns FALSE if there is no such result.
+  Standard_EXPORT Standard_Boolean Find(const TopoDS_Face&              theF1,
+                                        const TopoDS_Face&              theF2,
+                                        const Parameters&               theParams,
+                                        IntTools_SequenceOfCurves&      theCurves,
+                                        IntTools_SequenceOfPntOn2Faces& thePoints,
+                                        Standard_Boolean&               theIsTangent);
+
+  //! Removes the results of intersection of all faces of the given shape
+  //! (regardless of their locations).
+  Standard_EXPORT void Invalidate(const TopoDS_Shape& theShape);
+
+  //! Removes all stored results and resets the statistics.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of stored results.
+  Standard_EXPORT Standard_Integer Extent() const;
+
+  //! Returns the number of results found in the cache since its creation or clearing.
+  Standard_EXPORT Standard_Integer NbHits() const;
+
+private:
+  //! Ordered pair of faces.
+  struct FacePair
+  {
+    TopoDS_Face Face1;
+    TopoDS_Face Face2;
+
+    FacePair(const TopoDS_Face& theF1, const TopoDS_Face& theF2)
+        : Face1(theF1),
+          Face2(theF2)
+    {
+    }
+  };
+
+  //! Hasher of the pair of faces.
+  struct FacePairHasher
+  {
+    size_t operator()(const FacePair& thePair) const noexcept
+    {
+      size_t aHashes[2] = {std::hash<TopoDS_Shape>{}(thePair.Face1),
+                           std::hash<TopoDS_Shape>{}(thePair.Face2)};
+      return opencascade::hashBytes(aHashes, sizeof(aHashes));
+    }
+
+    bool operator()(const FacePair& thePair1, const FacePair& thePair2) const noexcept
+    {
+      return thePair1.Face1.IsEqual(thePair2.Face1) && thePair1.Face2.IsEqual(thePair2.Face2);
+    }
+  };
+
+  //! Stored result of intersection.
+  struct Result
+  {
+    Parameters                     Params;
+    IntTools_SequenceOfCurves      Curves;
+    IntTools_SequenceOfPntOn2Faces Points;
+    Standard_Boolean               IsTangent;
+
+    Result()
+        : IsTangent(Standard_False)
+    {
+    }
+  };
+
+  typedef NCollection_DataMap<FacePair, Result, FacePairHasher> DataMapOfFacePairResult;
+
+private:
+  DataMapOfFacePairResult myResults; //!< results of intersections
+  Standard_Integer        myNbHits;  //!< number of reused results
+  mutable Standard_Mutex  myMutex;   //!< mutex protecting the data
+};
+
+#endif // _BOPAlgo_IntersectionCache_HeaderFile
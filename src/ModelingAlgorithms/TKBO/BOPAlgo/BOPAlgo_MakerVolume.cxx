@@ -92,6 +92,7 @@ void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetIntersectionCache(myIntersectionCache);
   pPF->Perform(aPS.Next(anInterPart));
   //
   myEntryPoint = 1;
@@ -15,6 +15,7 @@
 #ifndef _BOPAlgo_Options_HeaderFile
 #define _BOPAlgo_Options_HeaderFile
 
+#include <BOPAlgo_IntersectionCache.hxx>
 #include <Message_Report.hxx>
 #include <Standard_OStream.hxx>
 
@@ -32,6 +33,8 @@ class Message_ProgressScope;
 //!                       touching or coinciding cases;
 //! - *Using the Oriented Bounding Boxes* - Allows using the Oriented Bounding Boxes of the shapes
 //!                          for filtering the intersections.
+//! - *Intersection cache* - allows reusing the results of Face/Face intersections
+//!                          computed by previous operations on the same shapes.
 //!
 class BOPAlgo_Options
 {
@@ -134,6 +137,19 @@ public:
   //! Returns the flag defining usage of OBB
   Standard_Boolean UseOBB() const { return myUseOBB; }
 
+public:
+  //!@name Intersection cache
+
+  //! Sets the cache of Face/Face intersection results, which may be shared
+  //! between several operations. NULL handle (default) disables caching.
+  void SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache)
+  {
+    myIntersectionCache = theCache;
+  }
+
+  //! Returns the cache of Face/Face intersection results
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const { return myIntersectionCache; }
+
 protected:
   //! Adds error to the report if the break signal was caught. Returns true in this case, false
   //! otherwise.
@@ -145,6 +161,7 @@ protected:
   Standard_Boolean                  myRunParallel;
   Standard_Real                     myFuzzyValue;
   Standard_Boolean                  myUseOBB;
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache;
 };
 
 #endif // _BOPAlgo_Options_HeaderFile
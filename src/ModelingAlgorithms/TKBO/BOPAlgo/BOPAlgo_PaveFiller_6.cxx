@@ -18,6 +18,7 @@
 #include <BOPAlgo_PaveFiller.hxx>
 #include <Bnd_Box.hxx>
 #include <BOPAlgo_Alerts.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 #include <BOPAlgo_SectionAttribute.hxx>
 #include <BOPAlgo_Tools.hxx>
 #include <BOPDS_CoupleOfPaveBlocks.hxx>
@@ -148,7 +149,8 @@ public:
         BOPAlgo_ParallelAlgo(),
         myIF1(-1),
         myIF2(-1),
-        myTolFF(1.e-7)
+        myTolFF(1.e-7),
+        myIsCached(Standard_False)
   {
   }
 
@@ -201,11 +203,39 @@ public:
   //
   const gp_Trsf& Trsf() const { return myTrsf; }
 
+  //
+  void SetCacheParameters(const BOPAlgo_IntersectionCache::Parameters& theParams)
+  {
+    myCacheParams = theParams;
+  }
+
+  //! Takes the result of intersection of the given faces from the cache.
+  //! Returns TRUE if the result has been found, so the intersection is not performed.
+  Standard_Boolean FindInCache(BOPAlgo_IntersectionCache& theCache,
+                               const TopoDS_Face&         theF1,
+                               const TopoDS_Face&         theF2)
+  {
+    myIsCached = theCache.Find(theF1, theF2, myCacheParams, mySeqOfCurve, myPnts, myTangentFaces);
+    myIsDone   = myIsCached;
+    return myIsCached;
+  }
+
+  //! Stores the result of intersection of the given faces into the cache.
+  void AddToCache(BOPAlgo_IntersectionCache& theCache,
+                  const TopoDS_Face&         theF1,
+                  const TopoDS_Face&         theF2) const
+  {
+    theCache.Add(theF1, theF2, myCacheParams, mySeqOfCurve, myPnts, myTangentFaces);
+  }
+
+  //! Returns TRUE if the result has been taken from the cache
+  Standard_Boolean IsCached() const { return myIsCached; }
+
   //
   virtual void Perform()
   {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
-    if (UserBreak(aPS))
+    if (myIsCached || UserBreak(aPS))
     {
       return;
     }
@@ -277,6 +307,9 @@ protected:
   Bnd_Box          myBox1;
   Bnd_Box          myBox2;
   gp_Trsf          myTrsf;
+
+  BOPAlgo_IntersectionCache::Parameters myCacheParams;
+  Standard_Boolean                      myIsCached;
 };
 
 //=================================================================================================
@@ -509,6 +542,24 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      //
+      if (!myIntersectionCache.IsNull())
+      {
+        // Reuse the result of intersection of the same faces computed
+        // by one of the previous operations with the same parameters
+        BOPAlgo_IntersectionCache::Parameters aCacheParams;
+        aCacheParams.FuzzyValue      = myFuzzyValue;
+        aCacheParams.Tolerance       = aTolFF;
+        aCacheParams.Tolerance1      = BRep_Tool::Tolerance(aF1);
+        aCacheParams.Tolerance2      = BRep_Tool::Tolerance(aF2);
+        aCacheParams.ApproxTolerance = anApproxTol;
+        aCacheParams.NbStartPoints   = aNbLP;
+        aCacheParams.ToApprox        = bApprox;
+        aCacheParams.ToComputePC1    = bCompC2D1;
+        aCacheParams.ToComputePC2    = bCompC2D2;
+        aFaceFace.SetCacheParameters(aCacheParams);
+        aFaceFace.FindInCache(*myIntersectionCache, aF1, aF2);
+      }
     }
     else
     {
@@ -559,9 +610,19 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Boolean bTangentFaces = aFaceFace.TangentFaces();
     Standard_Real    aTolFF        = aFaceFace.TolFF();
     //
-    aFaceFace.PrepareLines3D(bSplitCurve);
-    //
-    aFaceFace.ApplyTrsf();
+    if (!aFaceFace.IsCached())
+    {
+      aFaceFace.PrepareLines3D(bSplitCurve);
+      //
+      aFaceFace.ApplyTrsf();
+      //
+      if (!myIntersectionCache.IsNull())
+      {
+        aFaceFace.AddToCache(*myIntersectionCache,
+                             TopoDS::Face(myDS->Shape(nF1)),
+                             TopoDS::Face(myDS->Shape(nF2)));
+      }
+    }
     //
     const IntTools_SequenceOfCurves&      aCvsX  = aFaceFace.Lines();
     const IntTools_SequenceOfPntOn2Faces& aPntsX = aFaceFace.Points();
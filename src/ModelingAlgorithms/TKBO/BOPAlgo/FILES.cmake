@@ -30,6 +30,8 @@ set(OCCT_BOPAlgo_FILES
   BOPAlgo_CheckResult.cxx
   BOPAlgo_CheckResult.hxx
   BOPAlgo_CheckStatus.hxx
+  BOPAlgo_IntersectionCache.cxx
+  BOPAlgo_IntersectionCache.hxx
   BOPAlgo_ListOfCheckResult.hxx
   BOPAlgo_MakeConnected.cxx
   BOPAlgo_MakeConnected.hxx
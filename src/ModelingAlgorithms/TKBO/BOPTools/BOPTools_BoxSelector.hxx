@@ -17,6 +17,7 @@
 
 #include <BVH_Traverse.hxx>
 #include <BVH_BoxSet.hxx>
+#include <BVH_BoxKernels.hxx>
 
 #include <Standard_Integer.hxx>
 #include <TColStd_ListOfInteger.hxx>
@@ -57,6 +58,32 @@ public: //! @name Rejection/Acceptance rules
     return !hasOverlap;
   }
 
+  //! Checks if the sibling boxes should be rejected (all boxes are tested at once)
+  virtual Standard_Integer RejectNodes(const BVH_VecNd*       theCMin,
+                                       const BVH_VecNd*       theCMax,
+                                       const Standard_Integer theNbNodes,
+                                       Standard_Boolean*      theIsInside) const Standard_OVERRIDE
+  {
+    if (!myBox.IsValid())
+    {
+      for (Standard_Integer i = 0; i < theNbNodes; ++i)
+        theIsInside[i] = Standard_False;
+      return (1 << theNbNodes) - 1;
+    }
+
+    int                    anInside  = 0;
+    const Standard_Integer aRejected = BVH_BoxKernels<Standard_Real, Dimension>::OutMask(
+      myBox.CornerMin(),
+      myBox.CornerMax(),
+      theCMin,
+      theCMax,
+      theNbNodes,
+      &anInside);
+    for (Standard_Integer i = 0; i < theNbNodes; ++i)
+      theIsInside[i] = (anInside & (1 << i)) != 0;
+    return aRejected;
+  }
+
   //! Checks if the element should be rejected
   Standard_Boolean RejectElement(const Standard_Integer theIndex)
   {
@@ -17,6 +17,7 @@
 
 #include <BVH_Traverse.hxx>
 #include <BVH_BoxSet.hxx>
+#include <BVH_BoxKernels.hxx>
 
 #include <Standard_Integer.hxx>
 #include <algorithm>
@@ -86,6 +87,22 @@ public: //! @name Rejection/Acceptance rules
     return BVH_Box<Standard_Real, 3>(theCMin1, theCMax1).IsOut(theCMin2, theCMax2);
   }
 
+  //! Checks if the pairs of nodes should be rejected (all pairs are tested at once).
+  virtual Standard_Integer RejectNodes(const BVH_VecNd*       theCMin1,
+                                       const BVH_VecNd*       theCMax1,
+                                       const BVH_VecNd*       theCMin2,
+                                       const BVH_VecNd*       theCMax2,
+                                       const Standard_Integer theNbPairs,
+                                       Standard_Real*) const Standard_OVERRIDE
+  {
+    return BVH_BoxKernels<Standard_Real, Dimension>::PairOutMask(theCMin1,
+                                                                 theCMax1,
+                                                                 theCMin2,
+                                                                 theCMax2,
+                                                                 theNbPairs,
+                                                                 0.0);
+  }
+
   //! Checks if the pair of elements should be rejected.
   Standard_Boolean RejectElement(const Standard_Integer theID1, const Standard_Integer theID2)
   {
@@ -18,6 +18,7 @@
 #include <OSD_Parallel.hxx>
 #include <OSD_ThreadPool.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard_Mutex.hxx>
 #include <OSD_Thread.hxx>
 
@@ -49,7 +50,10 @@ class BOPTools_Parallel
     TypeSolverVector& mySolvers;
   };
 
-  //! Functor storing map of thread id -> algorithm context
+  //! Functor storing the pool of algorithm contexts.
+  //! The context is taken by the solver exclusively for the time of its execution,
+  //! as the thread waiting for the nested parallel loop of the solver may execute
+  //! other solvers (see OSD_TaskGroup), so that the context cannot be bound to the thread.
   template <class TypeSolverVector, class TypeContext>
   class ContextFunctor
   {
@@ -60,41 +64,44 @@ class BOPTools_Parallel
     {
     }
 
-    //! Binds main thread context
+    //! Adds main thread context to the pool
     void SetContext(const opencascade::handle<TypeContext>& theContext)
     {
-      myContextMap.Bind(OSD_Thread::Current(), theContext);
+      myContexts.Append(theContext);
+    }
+
+    //! Defines functor interface
+    void operator()(const Standard_Integer theIndex) const
+    {
+      opencascade::handle<TypeContext>       aContext = acquireContext();
+      typename TypeSolverVector::value_type& aSolver  = mySolverVector[theIndex];
+
+      aSolver.SetContext(aContext);
+      aSolver.Perform();
+      releaseContext(aContext);
     }
 
-    //! Returns current thread context
-    const opencascade::handle<TypeContext>& GetThreadContext() const
+  private:
+    //! Takes the free context from the pool, or creates the new one
+    opencascade::handle<TypeContext> acquireContext() const
     {
-      const Standard_ThreadId aThreadID = OSD_Thread::Current();
-      if (const opencascade::handle<TypeContext>* aContextPtr = myContextMap.Seek(aThreadID))
       {
-        if (!aContextPtr->IsNull())
+        Standard_Mutex::Sentry aLocker(myMutex);
+        if (!myContexts.IsEmpty())
         {
-          return *aContextPtr;
+          opencascade::handle<TypeContext> aContext = myContexts.Last();
+          myContexts.EraseLast();
+          return aContext;
         }
       }
-
-      // Create new context
-      opencascade::handle<TypeContext> aContext =
-        new TypeContext(NCollection_BaseAllocator::CommonBaseAllocator());
-
-      Standard_Mutex::Sentry aLocker(myMutex);
-      myContextMap.Bind(aThreadID, aContext);
-      return myContextMap(aThreadID);
+      return new TypeContext(NCollection_BaseAllocator::CommonBaseAllocator());
     }
 
-    //! Defines functor interface
-    void operator()(const Standard_Integer theIndex) const
+    //! Returns the context to the pool
+    void releaseContext(const opencascade::handle<TypeContext>& theContext) const
     {
-      const opencascade::handle<TypeContext>& aContext = GetThreadContext();
-      typename TypeSolverVector::value_type&  aSolver  = mySolverVector[theIndex];
-
-      aSolver.SetContext(aContext);
-      aSolver.Perform();
+      Standard_Mutex::Sentry aLocker(myMutex);
+      myContexts.Append(theContext);
     }
 
   private:
@@ -102,9 +109,9 @@ class BOPTools_Parallel
     ContextFunctor& operator=(const ContextFunctor&);
 
   private:
-    TypeSolverVector&                                                                mySolverVector;
-    mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>> myContextMap;
-    mutable Standard_Mutex                                                           myMutex;
+    TypeSolverVector&                                           mySolverVector;
+    mutable NCollection_Vector<opencascade::handle<TypeContext>> myContexts;
+    mutable Standard_Mutex                                      myMutex;
   };
 
   //! Functor storing array of algorithm contexts per thread in pool
@@ -48,8 +48,10 @@ public:
   using BOPAlgo_Options::HasErrors;
   using BOPAlgo_Options::HasWarning;
   using BOPAlgo_Options::HasWarnings;
+  using BOPAlgo_Options::IntersectionCache;
   using BOPAlgo_Options::RunParallel;
   using BOPAlgo_Options::SetFuzzyValue;
+  using BOPAlgo_Options::SetIntersectionCache;
   using BOPAlgo_Options::SetRunParallel;
   using BOPAlgo_Options::SetUseOBB;
 
@@ -82,7 +82,9 @@ protected:
 
 BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation()
     : BRepAlgoAPI_BuilderAlgo(),
-      myOperation(BOPAlgo_UNKNOWN)
+      myOperation(BOPAlgo_UNKNOWN),
+      myToolsBatchSize(0),
+      myToolsMemoryBudget(0)
 {
 }
 
@@ -90,7 +92,9 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation()
 
 BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation(const BOPAlgo_PaveFiller& thePF)
     : BRepAlgoAPI_BuilderAlgo(thePF),
-      myOperation(BOPAlgo_UNKNOWN)
+      myOperation(BOPAlgo_UNKNOWN),
+      myToolsBatchSize(0),
+      myToolsMemoryBudget(0)
 {
 }
 
@@ -100,7 +104,9 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation(const TopoDS_Shape&
                                                            const TopoDS_Shape&     theS2,
                                                            const BOPAlgo_Operation theOp)
     : BRepAlgoAPI_BuilderAlgo(),
-      myOperation(theOp)
+      myOperation(theOp),
+      myToolsBatchSize(0),
+      myToolsMemoryBudget(0)
 {
   myArguments.Append(theS1);
   myTools.Append(theS2);
@@ -113,7 +119,9 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation(const TopoDS_Shape&
                                                            const BOPAlgo_PaveFiller& thePF,
                                                            const BOPAlgo_Operation   theOp)
     : BRepAlgoAPI_BuilderAlgo(thePF),
-      myOperation(theOp)
+      myOperation(theOp),
+      myToolsBatchSize(0),
+      myToolsMemoryBudget(0)
 {
   myArguments.Append(theS1);
   myTools.Append(theS2);
@@ -172,6 +180,53 @@ void BRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& theRange)
   }
 
   Message_ProgressScope aPS(theRange, aPSName, myIsIntersectionNeeded ? 100 : 30);
+  if (myIsIntersectionNeeded
+      && BOPAlgo_BOP::IsBatchingNeeded(myOperation, myTools, myToolsBatchSize, myToolsMemoryBudget))
+  {
+    // Perform the operation by batches of tools, the intersection
+    // of the arguments is performed by the builder for each batch
+    BOPAlgo_BOP* aBOP = new BOPAlgo_BOP(myAllocator);
+    myBuilder         = aBOP;
+    aBOP->SetArguments(myArguments);
+    aBOP->SetTools(myTools);
+    aBOP->SetOperation(myOperation);
+    aBOP->SetToolsBatchSize(myToolsBatchSize);
+    aBOP->SetToolsMemoryBudget(myToolsMemoryBudget);
+    aBOP->SetFuzzyValue(myFuzzyValue);
+    aBOP->SetNonDestructive(myNonDestructive);
+    aBOP->SetGlue(myGlue);
+    aBOP->SetUseOBB(myUseOBB);
+    aBOP->SetIntersectionCache(myIntersectionCache);
+    aBOP->SetRunParallel(myRunParallel);
+    aBOP->SetCheckInverted(myCheckInverted);
+    aBOP->SetToFillHistory(myFillHistory);
+    aBOP->Perform(aPS.Next(100));
+    GetReport()->Merge(aBOP->GetReport());
+    if (aBOP->HasErrors())
+    {
+      if (aDumpOper.IsDump())
+      {
+        aDumpOper.SetIsDumpRes(Standard_False);
+        aDumpOper.Dump(myArguments.First(), myTools.First(), TopoDS_Shape(), myOperation);
+      }
+      return;
+    }
+    Done();
+    myShape = aBOP->Shape();
+    if (myFillHistory)
+    {
+      myHistory = new BRepTools_History;
+      myHistory->Merge(aBOP->History());
+    }
+    if (aDumpOper.IsDump())
+    {
+      Standard_Boolean isDumpRes = myShape.IsNull() || !BRepAlgoAPI_Check(myShape).IsValid();
+      aDumpOper.SetIsDumpRes(isDumpRes);
+      aDumpOper.Dump(myArguments.First(), myTools.First(), myShape, myOperation);
+    }
+    return;
+  }
+
   // If necessary perform intersection of the argument shapes
   if (myIsIntersectionNeeded)
   {
@@ -82,6 +82,28 @@ public: //! @name Setting/Getting the type of Boolean operation
   //! Returns the type of Boolean Operation
   BOPAlgo_Operation Operation() const { return myOperation; }
 
+public: //! @name Setting/Getting the batch processing of the tools
+  //! Sets the maximal number of tools intersected with the objects at once
+  //! (0 by default, i.e. all tools are intersected at once).
+  //! When the operation is CUT or FUSE and the number of tools exceeds this value,
+  //! the operation is performed by batches of spatially close tools, bounding
+  //! the peak memory of the operation (see BOPAlgo_BOP::SetToolsBatchSize()).
+  //! The intersection results (DSFiller() and SectionEdges()) are not available in this mode.
+  void SetToolsBatchSize(const Standard_Integer theSize) { myToolsBatchSize = theSize; }
+
+  //! Returns the maximal number of tools intersected with the objects at once
+  Standard_Integer ToolsBatchSize() const { return myToolsBatchSize; }
+
+  //! Sets the memory budget (in bytes) for the tools intersected with the objects at once
+  //! (0 by default, i.e. no limit).
+  //! When the operation is CUT or FUSE and the estimated memory of the tools exceeds the budget,
+  //! the operation is performed by batches fitting the budget
+  //! (see BOPAlgo_BOP::SetToolsMemoryBudget()).
+  void SetToolsMemoryBudget(const Standard_Size theBytes) { myToolsMemoryBudget = theBytes; }
+
+  //! Returns the memory budget (in bytes) for the tools intersected with the objects at once
+  Standard_Size ToolsMemoryBudget() const { return myToolsMemoryBudget; }
+
 public: //! @name Performing the operation
   //! Performs the Boolean operation.
   Standard_EXPORT virtual void Build(
@@ -102,9 +124,11 @@ protected: //! @name Constructors
                                                const BOPAlgo_PaveFiller& thePF,
                                                const BOPAlgo_Operation   theOperation);
 
-protected:                          //! @name Fields
-  TopTools_ListOfShape myTools;     //!< Tool arguments of operation
-  BOPAlgo_Operation    myOperation; //!< Type of Boolean Operation
+protected:                                  //! @name Fields
+  TopTools_ListOfShape myTools;             //!< Tool arguments of operation
+  BOPAlgo_Operation    myOperation;         //!< Type of Boolean Operation
+  Standard_Integer     myToolsBatchSize;    //!< Maximal number of tools intersected at once
+  Standard_Size        myToolsMemoryBudget; //!< Memory budget of tools intersected at once
 };
 
 #endif // _BRepAlgoAPI_BooleanOperation_HeaderFile
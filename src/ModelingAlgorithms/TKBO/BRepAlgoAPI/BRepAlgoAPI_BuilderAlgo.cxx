@@ -123,6 +123,7 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape&  theAr
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetIntersectionCache(myIntersectionCache);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -244,7 +245,7 @@ Standard_Boolean BRepAlgoAPI_BuilderAlgo::HasDeleted() const
 const TopTools_ListOfShape& BRepAlgoAPI_BuilderAlgo::SectionEdges()
 {
   myGenerated.Clear();
-  if (myBuilder == NULL)
+  if (myBuilder == NULL || myDSFiller == NULL)
     return myGenerated;
 
   // Fence map to avoid duplicated section edges in the result list
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPTools_Parallel.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+namespace
+{
+//! Context counting the solvers using it
+class TestContext : public Standard_Transient
+{
+public:
+  TestContext(const Handle(NCollection_BaseAllocator)&)
+      : myNbUsers(0)
+  {
+  }
+
+  std::atomic<int> myNbUsers;
+};
+
+//! Solver running the nested parallel loop with the context taken
+class TestSolver
+{
+public:
+  TestSolver()
+      : myIsShared(false)
+  {
+  }
+
+  void SetContext(const Handle(TestContext)& theContext) { myContext = theContext; }
+
+  void Perform()
+  {
+    myIsShared = myIsShared || (++myContext->myNbUsers != 1);
+    // the waiting thread may pick up other solvers while the nested loop is being executed
+    OSD_Parallel::For(0, 8, [](const Standard_Integer theIndex) {
+      volatile double aValue = 0.0;
+      for (int anIter = 0; anIter < 20000; ++anIter)
+      {
+        aValue += anIter * theIndex;
+      }
+    });
+    myIsShared = myIsShared || (myContext->myNbUsers.load() != 1);
+    --myContext->myNbUsers;
+  }
+
+  bool IsShared() const { return myIsShared; }
+
+private:
+  Handle(TestContext) myContext;
+  bool                myIsShared;
+};
+} // namespace
+
+TEST(BOPTools_ParallelTest, ContextIsNotSharedByNestedSolvers)
+{
+  const Standard_Boolean toUseTaskGroup = OSD_Parallel::ToUseTaskGroup();
+  for (int aRunIter = 0; aRunIter < 40; ++aRunIter)
+  {
+    OSD_Parallel::SetUseTaskGroup(aRunIter % 2 == 0);
+
+    NCollection_Vector<TestSolver> aSolvers;
+    for (int aSolverIter = 0; aSolverIter < 64; ++aSolverIter)
+    {
+      aSolvers.Appended();
+    }
+    Handle(TestContext) aContext = new TestContext(NULL);
+    BOPTools_Parallel::Perform(Standard_True, aSolvers, aContext);
+    for (NCollection_Vector<TestSolver>::Iterator aSolverIter(aSolvers); aSolverIter.More();
+         aSolverIter.Next())
+    {
+      EXPECT_FALSE(aSolverIter.Value().IsShared());
+    }
+  }
+  OSD_Parallel::SetUseTaskGroup(toUseTaskGroup);
+}
@@ -2,4 +2,5 @@
 set(OCCT_TKHLR_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKHLR_GTests_FILES
+  HLRBRep_Algo_Test.cxx
 )
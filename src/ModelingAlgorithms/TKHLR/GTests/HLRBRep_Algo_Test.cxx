@@ -0,0 +1,128 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <GCPnts_AbscissaPoint.hxx>
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <HLRBRep_HLRToShape.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Trsf.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the shape translated by the vector.
+TopoDS_Shape translated(const TopoDS_Shape& theShape, const gp_Vec& theVec)
+{
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(theVec);
+  return BRepBuilderAPI_Transform(theShape, aTrsf, Standard_True).Shape();
+}
+
+//! Visible and hidden edges of the scene.
+struct HLRResult
+{
+  TopoDS_Shape Shapes[6];
+};
+
+//! Computes the hidden lines of the shape in the given mode.
+HLRResult computeHLR(const TopoDS_Shape& theShape, const Standard_Boolean theIsParallel)
+{
+  Handle(HLRBRep_Algo) anAlgo = new HLRBRep_Algo();
+  anAlgo->Add(theShape);
+  anAlgo->Projector(HLRAlgo_Projector(gp_Ax2(gp_Pnt(), gp_Dir(1, 1, 1), gp_Dir(1, -1, 0))));
+  anAlgo->SetRunParallel(theIsParallel);
+  anAlgo->Update();
+  anAlgo->Hide();
+
+  HLRBRep_HLRToShape aToShape(anAlgo);
+  HLRResult          aResult;
+  aResult.Shapes[0] = aToShape.VCompound();
+  aResult.Shapes[1] = aToShape.Rg1LineVCompound();
+  aResult.Shapes[2] = aToShape.OutLineVCompound();
+  aResult.Shapes[3] = aToShape.HCompound();
+  aResult.Shapes[4] = aToShape.Rg1LineHCompound();
+  aResult.Shapes[5] = aToShape.OutLineHCompound();
+  return aResult;
+}
+
+//! Returns the number of edges of the shape.
+Standard_Integer nbEdges(const TopoDS_Shape& theShape)
+{
+  TopTools_IndexedMapOfShape anEdges;
+  if (!theShape.IsNull())
+  {
+    TopExp::MapShapes(theShape, TopAbs_EDGE, anEdges);
+  }
+  return anEdges.Extent();
+}
+
+//! Returns the total length of the edges of the shape.
+//! The edges built by HLRBRep_HLRToShape have only curves on the projection plane.
+Standard_Real length(const TopoDS_Shape& theShape)
+{
+  Standard_Real aLength = 0.0;
+  if (!theShape.IsNull())
+  {
+    for (TopExp_Explorer anEdgeExp(theShape, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+    {
+      const BRepAdaptor_Curve aCurve(TopoDS::Edge(anEdgeExp.Current()));
+      aLength += GCPnts_AbscissaPoint::Length(aCurve);
+    }
+  }
+  return aLength;
+}
+} // namespace
+
+TEST(HLRBRep_AlgoTest, ParallelHidingMatchesSequential)
+{
+  TopoDS_Compound aScene;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aScene);
+  aBuilder.Add(aScene, BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape());
+  aBuilder.Add(aScene,
+               translated(BRepPrimAPI_MakeCylinder(3.0, 20.0).Shape(), gp_Vec(5.0, 5.0, -5.0)));
+  aBuilder.Add(aScene, translated(BRepPrimAPI_MakeSphere(4.0).Shape(), gp_Vec(15.0, 5.0, 5.0)));
+  aBuilder.Add(aScene,
+               translated(BRepPrimAPI_MakeTorus(6.0, 1.0).Shape(), gp_Vec(5.0, 5.0, 12.0)));
+
+  const HLRResult aSerial   = computeHLR(aScene, Standard_False);
+  const HLRResult aParallel = computeHLR(aScene, Standard_True);
+
+  Standard_Real aTotalLength = 0.0;
+  for (int aShapeIter = 0; aShapeIter < 6; ++aShapeIter)
+  {
+    EXPECT_EQ(nbEdges(aSerial.Shapes[aShapeIter]), nbEdges(aParallel.Shapes[aShapeIter]))
+      << "compound " << aShapeIter;
+    EXPECT_NEAR(length(aSerial.Shapes[aShapeIter]), length(aParallel.Shapes[aShapeIter]), 1.0e-6)
+      << "compound " << aShapeIter;
+    aTotalLength += length(aSerial.Shapes[aShapeIter]);
+  }
+  // both visible and hidden edges should be present
+  EXPECT_GT(nbEdges(aSerial.Shapes[0]), 0);
+  EXPECT_GT(nbEdges(aSerial.Shapes[3]), 0);
+  EXPECT_GT(aTotalLength, 0.0);
+}
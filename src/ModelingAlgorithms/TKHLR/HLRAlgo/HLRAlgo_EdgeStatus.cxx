@@ -109,3 +109,29 @@ void HLRAlgo_EdgeStatus::Hide(const Standard_Real      Start,
       AllHidden(myVisibles.NbIntervals() == 0);
   }
 }
+
+//=================================================================================================
+
+void HLRAlgo_EdgeStatus::Intersect(const HLRAlgo_EdgeStatus& theOther)
+{
+  if (AllHidden() || theOther.AllVisible())
+  {
+    return;
+  }
+  if (theOther.AllHidden())
+  {
+    HideAll();
+    return;
+  }
+
+  if (AllVisible())
+  {
+    myVisibles = theOther.myVisibles;
+    AllVisible(Standard_False);
+  }
+  else
+  {
+    myVisibles.Intersect(theOther.myVisibles);
+  }
+  AllHidden(myVisibles.NbIntervals() == 0);
+}
@@ -88,6 +88,11 @@ public:
                             const Standard_Boolean   OnFace,
                             const Standard_Boolean   OnBoundary);
 
+  //! Hides the parts of the Edge hidden in <theOther> status
+  //! of the same Edge, so that only the parts visible in both
+  //! statuses stay visible.
+  Standard_EXPORT void Intersect(const HLRAlgo_EdgeStatus& theOther);
+
   //! Hide the whole Edge.
   void HideAll()
   {
@@ -599,6 +599,40 @@ void HLRBRep_Data::Write(const Handle(HLRBRep_Data)& DS,
 
 //=================================================================================================
 
+Handle(HLRBRep_Data) HLRBRep_Data::CopyForHiding() const
+{
+  Handle(HLRBRep_Data) aCopy = new HLRBRep_Data(myNbVertices, myNbEdges, myNbFaces);
+  aCopy->myToler             = myToler;
+  aCopy->myProj              = myProj;
+  aCopy->myBigSize           = myBigSize;
+  for (Standard_Integer i = 0; i <= 15; i++)
+  {
+    aCopy->myDeca[i] = myDeca[i];
+    aCopy->mySurD[i] = mySurD[i];
+  }
+
+  // the evaluation caches of the adaptors cannot be shared between threads
+  for (Standard_Integer edge = 1; edge <= myNbEdges; edge++)
+  {
+    HLRBRep_EdgeData& ed = aCopy->myEData.ChangeValue(edge);
+    ed                   = myEData.Value(edge);
+    HLRBRep_Curve& EC    = ed.ChangeGeometry();
+    EC.Curve()           = *Handle(BRepAdaptor_Curve)::DownCast(EC.Curve().ShallowCopy());
+    EC.Projector(&aCopy->myProj);
+  }
+  for (Standard_Integer face = 1; face <= myNbFaces; face++)
+  {
+    HLRBRep_FaceData& fd = aCopy->myFData.ChangeValue(face);
+    fd                   = myFData.Value(face);
+    HLRBRep_Surface& FS  = fd.Geometry();
+    FS.Surface()         = *Handle(BRepAdaptor_Surface)::DownCast(FS.Surface().ShallowCopy());
+    FS.Projector(&aCopy->myProj);
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
 void HLRBRep_Data::Update(const HLRAlgo_Projector& P)
 {
   myProj             = P;
@@ -68,6 +68,14 @@ public:
                              const Standard_Integer      de,
                              const Standard_Integer      df);
 
+  //! Returns the data structure to hide  the edges of
+  //! me in a separate thread.  The records of the edges
+  //! and faces are copied with their own adaptors, the
+  //! wires of the faces  are shared  and the  maps  of
+  //! the shapes are not copied. Me must be updated
+  //! first.
+  Standard_EXPORT Handle(HLRBRep_Data) CopyForHiding() const;
+
   HLRBRep_Array1OfEData& EDataArray();
 
   HLRBRep_Array1OfFData& FDataArray();
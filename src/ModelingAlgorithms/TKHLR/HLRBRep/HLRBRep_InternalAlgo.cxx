@@ -21,6 +21,7 @@
 #include <HLRBRep_ShapeBounds.hxx>
 #include <HLRBRep_ShapeToHLR.hxx>
 #include <HLRTopoBRep_OutLiner.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_OutOfRange.hxx>
@@ -42,10 +43,50 @@ extern Standard_Integer nbCal3Intersection; // curve-surface intersections
 static Standard_Integer HLRBRep_InternalAlgo_TRACE   = Standard_True;
 static Standard_Integer HLRBRep_InternalAlgo_TRACE10 = Standard_True;
 
+namespace
+{
+//! Functor hiding the edges within the copy of the DataStructure
+//! by each N-th face of the list, where N is the number of copies.
+class HLRBRep_HideFunctor
+{
+public:
+  HLRBRep_HideFunctor(NCollection_Vector<Handle(HLRBRep_Data)>&          theCopies,
+                      NCollection_Vector<BRepTopAdaptor_MapOfShapeTool>& theMSTs,
+                      const TColStd_Array1OfInteger&                     theFaces,
+                      const Standard_Integer                             theNbFaces,
+                      const Standard_Integer                             theNbCopies)
+      : myCopies(&theCopies),
+        myMSTs(&theMSTs),
+        myFaces(&theFaces),
+        myNbFaces(theNbFaces),
+        myNbCopies(theNbCopies)
+  {
+  }
+
+  void operator()(const Standard_Integer theCopy) const
+  {
+    HLRBRep_Hider                  aHider(myCopies->Value(theCopy));
+    BRepTopAdaptor_MapOfShapeTool& aMST = myMSTs->ChangeValue(theCopy);
+    for (Standard_Integer aFaceIter = theCopy + 1; aFaceIter <= myNbFaces; aFaceIter += myNbCopies)
+    {
+      aHider.Hide(myFaces->Value(aFaceIter), aMST);
+    }
+  }
+
+private:
+  NCollection_Vector<Handle(HLRBRep_Data)>*          myCopies;
+  NCollection_Vector<BRepTopAdaptor_MapOfShapeTool>* myMSTs;
+  const TColStd_Array1OfInteger*                     myFaces;
+  Standard_Integer                                   myNbFaces;
+  Standard_Integer                                   myNbCopies;
+};
+} // namespace
+
 //=================================================================================================
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
-    : myDebug(Standard_False)
+    : myDebug(Standard_False),
+      myIsParallel(Standard_False)
 {
 }
 
@@ -55,8 +96,9 @@ HLRBRep_InternalAlgo::HLRBRep_InternalAlgo(const Handle(HLRBRep_InternalAlgo)& A
 {
   myDS     = A->DataStructure();
   myProj   = A->Projector();
-  myShapes = A->SeqOfShapeBounds();
-  myDebug  = A->Debug();
+  myShapes     = A->SeqOfShapeBounds();
+  myDebug      = A->Debug();
+  myIsParallel = A->RunParallel();
 }
 
 //=================================================================================================
@@ -77,6 +119,7 @@ HLRAlgo_Projector& HLRBRep_InternalAlgo::Projector()
 
 void HLRBRep_InternalAlgo::Update()
 {
+  clearCopies();
   if (!myShapes.IsEmpty())
   {
     Standard_Integer      n  = myShapes.Length();
@@ -185,6 +228,7 @@ void HLRBRep_InternalAlgo::Load(const Handle(HLRTopoBRep_OutLiner)& S,
 {
   myShapes.Append(HLRBRep_ShapeBounds(S, SData, nbIso, 0, 0, 0, 0, 0, 0));
   myDS.Nullify();
+  clearCopies();
 }
 
 //=================================================================================================
@@ -193,6 +237,7 @@ void HLRBRep_InternalAlgo::Load(const Handle(HLRTopoBRep_OutLiner)& S, const Sta
 {
   myShapes.Append(HLRBRep_ShapeBounds(S, nbIso, 0, 0, 0, 0, 0, 0));
   myDS.Nullify();
+  clearCopies();
 }
 
 //=================================================================================================
@@ -218,6 +263,7 @@ void HLRBRep_InternalAlgo::Remove(const Standard_Integer I)
 
   myMapOfShapeTool.Clear();
   myDS.Nullify();
+  clearCopies();
 }
 
 //=================================================================================================
@@ -853,36 +899,39 @@ void HLRBRep_InternalAlgo::HideSelected(const Standard_Integer I, const Standard
     j = 0;
 
     QWE = 0;
-    for (f = 1; f <= nf; f++)
+    if (!myIsParallel || !hideParallel(I, Index))
     {
-      Standard_Integer  fi = Index(f);
-      HLRBRep_FaceData& fd = aFDataArray.ChangeValue(fi);
-      if (fd.Selected())
+      for (f = 1; f <= nf; f++)
       {
-        if (fd.Hiding())
+        Standard_Integer  fi = Index(f);
+        HLRBRep_FaceData& fd = aFDataArray.ChangeValue(fi);
+        if (fd.Selected())
         {
-          if (HLRBRep_InternalAlgo_TRACE10 && HLRBRep_InternalAlgo_TRACE == Standard_False)
+          if (fd.Hiding())
           {
-            if (++QWE > QWEQWE)
+            if (HLRBRep_InternalAlgo_TRACE10 && HLRBRep_InternalAlgo_TRACE == Standard_False)
             {
-              if (myDebug)
-                std::cout << ".";
-              QWE = 0;
+              if (++QWE > QWEQWE)
+              {
+                if (myDebug)
+                  std::cout << ".";
+                QWE = 0;
+              }
             }
-          }
-          else if (myDebug && HLRBRep_InternalAlgo_TRACE)
-          {
-            static int rty = 0;
-            j++;
-            printf("%6d", fi);
-            fflush(stdout);
-            if (++rty > 25)
+            else if (myDebug && HLRBRep_InternalAlgo_TRACE)
             {
-              rty = 0;
-              printf("\n");
+              static int rty = 0;
+              j++;
+              printf("%6d", fi);
+              fflush(stdout);
+              if (++rty > 25)
+              {
+                rty = 0;
+                printf("\n");
+              }
             }
+            Cache.Hide(fi, myMapOfShapeTool);
           }
-          Cache.Hide(fi, myMapOfShapeTool);
         }
       }
     }
@@ -922,6 +971,103 @@ void HLRBRep_InternalAlgo::HideSelected(const Standard_Integer I, const Standard
 
 //=================================================================================================
 
+Standard_Boolean HLRBRep_InternalAlgo::hideParallel(const Standard_Integer         I,
+                                                    const TColStd_Array1OfInteger& theIndex)
+{
+  HLRBRep_Array1OfEData& aEDataArray = myDS->EDataArray();
+  HLRBRep_Array1OfFData& aFDataArray = myDS->FDataArray();
+  const Standard_Integer ne          = myDS->NbEdges();
+  const Standard_Integer nf          = myDS->NbFaces();
+
+  TColStd_Array1OfInteger aFaces(1, nf);
+  Standard_Integer        aNbFaces = 0;
+  for (Standard_Integer f = 1; f <= nf; f++)
+  {
+    const Standard_Integer  fi = theIndex(f);
+    const HLRBRep_FaceData& fd = aFDataArray.Value(fi);
+    if (fd.Selected() && fd.Hiding())
+    {
+      aFaces(++aNbFaces) = fi;
+    }
+  }
+
+  const Standard_Integer aNbCopies =
+    Min(aNbFaces, OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch());
+  if (aNbCopies < 2)
+  {
+    return Standard_False;
+  }
+
+  // the copies share the wires of the faces with the DataStructure
+  // and are kept until it is updated
+  while (myDSCopies.Length() < aNbCopies)
+  {
+    myMSTCopies.Append(BRepTopAdaptor_MapOfShapeTool());
+    myDSCopies.Append(myDS->CopyForHiding());
+  }
+
+  // copy the current state of the edges and faces
+  HLRBRep_ShapeBounds& SB = myShapes(I);
+  Standard_Integer     v1, v2, e1, e2, f1, f2;
+  SB.Bounds(v1, v2, e1, e2, f1, f2);
+  for (Standard_Integer aCopyIter = 0; aCopyIter < aNbCopies; ++aCopyIter)
+  {
+    const Handle(HLRBRep_Data)& aCopy = myDSCopies.Value(aCopyIter);
+    for (Standard_Integer e = 1; e <= ne; e++)
+    {
+      HLRBRep_EdgeData& ed  = aEDataArray.ChangeValue(e);
+      HLRBRep_EdgeData& edc = aCopy->EDataArray().ChangeValue(e);
+      edc.Selected(ed.Selected());
+      edc.Status() = ed.Status();
+    }
+    for (Standard_Integer f = 1; f <= nf; f++)
+    {
+      aCopy->FDataArray().ChangeValue(f).Selected(aFDataArray.Value(f).Selected());
+    }
+    aCopy->InitBoundSort(SB.MinMax(), e1, e2);
+  }
+
+  HLRBRep_HideFunctor aFunctor(myDSCopies, myMSTCopies, aFaces, aNbFaces, aNbCopies);
+  OSD_Parallel::For(0, aNbCopies, aFunctor);
+
+  // an edge part stays visible only if it is visible in all copies
+  for (Standard_Integer e = 1; e <= ne; e++)
+  {
+    HLRBRep_EdgeData& ed = aEDataArray.ChangeValue(e);
+    if (!ed.Selected())
+    {
+      continue;
+    }
+    for (Standard_Integer aCopyIter = 0; aCopyIter < aNbCopies; ++aCopyIter)
+    {
+      HLRBRep_EdgeData& edc = myDSCopies.Value(aCopyIter)->EDataArray().ChangeValue(e);
+      ed.Status().Intersect(edc.Status());
+    }
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void HLRBRep_InternalAlgo::clearCopies()
+{
+  myDSCopies.Clear();
+  myMSTCopies.Clear();
+}
+
+//=================================================================================================
+
+void HLRBRep_InternalAlgo::SetRunParallel(const Standard_Boolean theIsParallel)
+{
+  myIsParallel = theIsParallel;
+  if (!theIsParallel)
+  {
+    clearCopies();
+  }
+}
+
+//=================================================================================================
+
 void HLRBRep_InternalAlgo::Debug(const Standard_Boolean deb)
 {
   myDebug = deb;
@@ -23,8 +23,10 @@
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_SeqOfShapeBounds.hxx>
 #include <BRepTopAdaptor_MapOfShapeTool.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Integer.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 class HLRBRep_Data;
 class HLRTopoBRep_OutLiner;
 class HLRBRep_ShapeBounds;
@@ -119,6 +121,18 @@ public:
 
   Standard_EXPORT Standard_Boolean Debug() const;
 
+  //! Sets the flag to hide the edges by faces in parallel threads.
+  //! Each thread works with its own copy of the edges and faces of
+  //! the DataStructure built once on the first hiding, sharing the
+  //! wires of the faces and the geometry of the shapes; the parts of
+  //! edges hidden in the copies are merged into the DataStructure in
+  //! a fixed order, so that the result does not depend on the number
+  //! of threads.
+  Standard_EXPORT void SetRunParallel(const Standard_Boolean theIsParallel);
+
+  //! Returns the flag of hiding in parallel threads; FALSE by default.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
+
   Standard_EXPORT Handle(HLRBRep_Data) DataStructure() const;
 
   DEFINE_STANDARD_RTTIEXT(HLRBRep_InternalAlgo, Standard_Transient)
@@ -130,11 +144,24 @@ private:
   //! DataStructure.
   Standard_EXPORT void HideSelected(const Standard_Integer I, const Standard_Boolean SideFace);
 
-  Handle(HLRBRep_Data)          myDS;
-  HLRAlgo_Projector             myProj;
-  HLRBRep_SeqOfShapeBounds      myShapes;
-  BRepTopAdaptor_MapOfShapeTool myMapOfShapeTool;
-  Standard_Boolean              myDebug;
+  //! Hides the selected edges of the Shape <I> by the hiding faces
+  //! taken in the order <theIndex> using copies of the DataStructure
+  //! in parallel threads. Returns FALSE if parallel hiding is not
+  //! worth or not possible.
+  Standard_Boolean hideParallel(const Standard_Integer         I,
+                                const TColStd_Array1OfInteger& theIndex);
+
+  //! Removes the copies of the DataStructure.
+  void clearCopies();
+
+  Handle(HLRBRep_Data)                              myDS;
+  HLRAlgo_Projector                                 myProj;
+  HLRBRep_SeqOfShapeBounds                          myShapes;
+  BRepTopAdaptor_MapOfShapeTool                     myMapOfShapeTool;
+  Standard_Boolean                                  myDebug;
+  Standard_Boolean                                  myIsParallel;
+  NCollection_Vector<Handle(HLRBRep_Data)>          myDSCopies;  //!< copies for parallel threads
+  NCollection_Vector<BRepTopAdaptor_MapOfShapeTool> myMSTCopies; //!< tools of the copies
 };
 
 #endif // _HLRBRep_InternalAlgo_HeaderFile
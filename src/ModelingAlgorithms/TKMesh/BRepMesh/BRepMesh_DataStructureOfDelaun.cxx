@@ -32,8 +32,9 @@ BRepMesh_DataStructureOfDelaun::BRepMesh_DataStructureOfDelaun(
   const Standard_Integer                  theReservedNodeSize)
     : myAllocator(theAllocator),
       myNodes(new BRepMesh_VertexTool(myAllocator)),
-      myNodeLinks(theReservedNodeSize * 3, myAllocator),
+      myNodeLinks(theReservedNodeSize, myAllocator),
       myLinks(theReservedNodeSize * 3, myAllocator),
+      myLinkElements(theReservedNodeSize * 3, myAllocator),
       myDelLinks(myAllocator),
       myElements(theReservedNodeSize * 2, myAllocator)
 {
@@ -45,8 +46,8 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddNode(const BRepMesh_Vertex&
                                                          const Standard_Boolean isForceAdd)
 {
   const Standard_Integer aNodeId = myNodes->Add(theNode, isForceAdd);
-  if (!myNodeLinks.IsBound(aNodeId))
-    myNodeLinks.Bind(aNodeId, IMeshData::ListOfInteger(myAllocator));
+  while (myNodeLinks.Length() < aNodeId)
+    myNodeLinks.Append(IMeshData::ListOfInteger(myAllocator));
 
   return aNodeId;
 }
@@ -65,6 +66,25 @@ Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteNode(const Standard_I
 
 //=================================================================================================
 
+Standard_Integer BRepMesh_DataStructureOfDelaun::IndexOf(const BRepMesh_Edge& theLink) const
+{
+  const Standard_Integer aNodeId = theLink.FirstNode();
+  if (aNodeId < 1 || aNodeId > myNodeLinks.Length())
+    return 0;
+
+  // Deleted links are excluded from the lists of links connected to the nodes
+  IMeshData::ListOfInteger::Iterator aLinkIt(linksConnectedTo(aNodeId));
+  for (; aLinkIt.More(); aLinkIt.Next())
+  {
+    if (myLinks.Value(aLinkIt.Value() - 1).IsEqual(theLink))
+      return aLinkIt.Value();
+  }
+
+  return 0;
+}
+
+//=================================================================================================
+
 Standard_Integer BRepMesh_DataStructureOfDelaun::AddLink(const BRepMesh_Edge& theLink)
 {
   Standard_Integer aLinkIndex = IndexOf(theLink);
@@ -73,15 +93,19 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddLink(const BRepMesh_Edge& th
     return theLink.IsSameOrientation(GetLink(aLinkIndex)) ? aLinkIndex : -aLinkIndex;
   }
 
-  BRepMesh_PairOfIndex aPair;
   if (!myDelLinks.IsEmpty())
   {
     aLinkIndex = myDelLinks.First();
-    myLinks.Substitute(aLinkIndex, theLink, aPair);
+    myLinks(aLinkIndex - 1) = theLink;
+    myLinkElements(aLinkIndex - 1).Clear();
     myDelLinks.RemoveFirst();
   }
   else
-    aLinkIndex = myLinks.Add(theLink, aPair);
+  {
+    myLinks.Append(theLink);
+    myLinkElements.Append(BRepMesh_PairOfIndex());
+    aLinkIndex = myLinks.Length();
+  }
 
   const Standard_Integer aLinkId = Abs(aLinkIndex);
   linksConnectedTo(theLink.FirstNode()).Append(aLinkId);
@@ -96,25 +120,24 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddLink(const BRepMesh_Edge& th
 Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteLink(const Standard_Integer theIndex,
                                                                 const BRepMesh_Edge&   theNewLink)
 {
-  BRepMesh_PairOfIndex aPair;
-  BRepMesh_Edge        aLink = GetLink(theIndex);
+  const BRepMesh_Edge aLink = GetLink(theIndex);
   if (aLink.Movability() == BRepMesh_Deleted)
   {
-    myLinks.Substitute(theIndex, theNewLink, aPair);
+    myLinks(theIndex - 1) = theNewLink;
+    myLinkElements(theIndex - 1).Clear();
     return Standard_True;
   }
 
   if (IndexOf(theNewLink) != 0)
     return Standard_False;
 
-  aLink.SetMovability(BRepMesh_Deleted);
-  myLinks.Substitute(theIndex, aLink, aPair);
   cleanLink(theIndex, aLink);
 
   const Standard_Integer aLinkId = Abs(theIndex);
   linksConnectedTo(theNewLink.FirstNode()).Append(aLinkId);
   linksConnectedTo(theNewLink.LastNode()).Append(aLinkId);
-  myLinks.Substitute(theIndex, theNewLink, aPair);
+  myLinks(theIndex - 1) = theNewLink;
+  myLinkElements(theIndex - 1).Clear();
 
   return Standard_True;
 }
@@ -124,7 +147,7 @@ Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteLink(const Standard_I
 void BRepMesh_DataStructureOfDelaun::RemoveLink(const Standard_Integer theIndex,
                                                 const Standard_Boolean isForce)
 {
-  BRepMesh_Edge& aLink = (BRepMesh_Edge&)GetLink(theIndex);
+  BRepMesh_Edge& aLink = myLinks(theIndex - 1);
   if (aLink.Movability() == BRepMesh_Deleted || (!isForce && aLink.Movability() != BRepMesh_Free)
       || ElementsConnectedTo(theIndex).Extent() != 0)
   {
@@ -170,7 +193,7 @@ Standard_Integer BRepMesh_DataStructureOfDelaun::AddElement(const BRepMesh_Trian
 
   const Standard_Integer(&e)[3] = theElement.myEdges;
   for (Standard_Integer i = 0; i < 3; ++i)
-    myLinks(e[i]).Append(aElementIndex);
+    myLinkElements(e[i] - 1).Append(aElementIndex);
 
   return aElementIndex;
 }
@@ -198,7 +221,7 @@ void BRepMesh_DataStructureOfDelaun::cleanElement(const Standard_Integer   theIn
 
   const Standard_Integer(&e)[3] = theElement.myEdges;
   for (Standard_Integer i = 0; i < 3; ++i)
-    removeElementIndex(theIndex, myLinks(e[i]));
+    removeElementIndex(theIndex, myLinkElements(e[i] - 1));
 }
 
 //=================================================================================================
@@ -235,7 +258,7 @@ Standard_Boolean BRepMesh_DataStructureOfDelaun::SubstituteElement(
 
   const Standard_Integer(&e)[3] = theNewElement.myEdges;
   for (Standard_Integer i = 0; i < 3; ++i)
-    myLinks(e[i]).Append(theIndex);
+    myLinkElements(e[i] - 1).Append(theIndex);
 
   return Standard_True;
 }
@@ -305,7 +328,8 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedLinks()
       if (GetLink(aLastLiveItem).Movability() != BRepMesh_Deleted)
         break;
 
-      myLinks.RemoveLast();
+      myLinks.EraseLast();
+      myLinkElements.EraseLast();
       --aLastLiveItem;
     }
 
@@ -315,11 +339,13 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedLinks()
     if (aDelItem > aLastLiveItem)
       continue;
 
-    BRepMesh_Edge         aLink = GetLink(aLastLiveItem);
-    BRepMesh_PairOfIndex& aPair = myLinks(aLastLiveItem);
+    const BRepMesh_Edge        aLink = GetLink(aLastLiveItem);
+    const BRepMesh_PairOfIndex aPair = ElementsConnectedTo(aLastLiveItem);
 
-    myLinks.RemoveLast();
-    myLinks.Substitute(aDelItem, aLink, aPair);
+    myLinks.EraseLast();
+    myLinkElements.EraseLast();
+    myLinks(aDelItem - 1)        = aLink;
+    myLinkElements(aDelItem - 1) = aPair;
 
     myLinksOfDomain.Remove(aLastLiveItem);
     myLinksOfDomain.Add(aDelItem);
@@ -359,7 +385,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedLinks()
         }
       }
 
-      myElements(aLinkIt.Value()) = BRepMesh_Triangle(e, o, aElement.Movability());
+      myElements(aPair.Index(j) - 1) = BRepMesh_Triangle(e, o, aElement.Movability());
     }
   }
 }
@@ -379,6 +405,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
         break;
 
       myNodes->RemoveLast();
+      myNodeLinks.EraseLast();
       --aLastLiveItem;
     }
 
@@ -388,14 +415,15 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
     if (aDelItem > aLastLiveItem)
       continue;
 
-    BRepMesh_Vertex           aNode     = GetNode(aLastLiveItem);
-    IMeshData::ListOfInteger& aLinkList = linksConnectedTo(aLastLiveItem);
+    BRepMesh_Vertex aNode = GetNode(aLastLiveItem);
 
     myNodes->RemoveLast();
+    myNodeLinks(aDelItem - 1) = linksConnectedTo(aLastLiveItem);
+    myNodeLinks.EraseLast();
     --aLastLiveItem;
 
     myNodes->Substitute(aDelItem, aNode);
-    myNodeLinks.ChangeFind(aDelItem) = aLinkList;
+    const IMeshData::ListOfInteger& aLinkList = linksConnectedTo(aDelItem);
 
     const Standard_Integer             aLastLiveItemId = aLastLiveItem + 1;
     IMeshData::ListOfInteger::Iterator aLinkIt(aLinkList);
@@ -403,7 +431,6 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
     {
       const Standard_Integer aLinkId = aLinkIt.Value();
       const BRepMesh_Edge&   aLink   = GetLink(aLinkId);
-      BRepMesh_PairOfIndex&  aPair   = myLinks(aLinkId);
 
       Standard_Integer v[2] = {aLink.FirstNode(), aLink.LastNode()};
       if (v[0] == aLastLiveItemId)
@@ -411,7 +438,7 @@ void BRepMesh_DataStructureOfDelaun::clearDeletedNodes()
       else if (v[1] == aLastLiveItemId)
         v[1] = aDelItem;
 
-      myLinks.Substitute(aLinkId, BRepMesh_Edge(v[0], v[1], aLink.Movability()), aPair);
+      myLinks(aLinkId - 1) = BRepMesh_Edge(v[0], v[1], aLink.Movability());
     }
   }
 }
@@ -424,8 +451,8 @@ void BRepMesh_DataStructureOfDelaun::Statistics(Standard_OStream& theStream) con
   myNodes->Statistics(theStream);
   theStream << "\n Deleted nodes : " << myNodes->GetListOfDelNodes().Extent() << std::endl;
 
-  theStream << "\n\n Map of Links : \n";
-  myLinks.Statistics(theStream);
+  theStream << "\n\n Vector of links : \n";
+  theStream << "\n Links : " << myLinks.Length() << std::endl;
   theStream << "\n Deleted links : " << myDelLinks.Extent() << std::endl;
 
   theStream << "\n\n Map of elements : \n";
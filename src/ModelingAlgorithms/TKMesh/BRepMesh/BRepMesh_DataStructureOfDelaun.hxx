@@ -21,6 +21,12 @@ class BRepMesh_Edge;
 
 //! Describes the data structure necessary for the mesh algorithms in
 //! two dimensions plane or on surface by meshing in UV space.
+//!
+//! Links and their adjacency are stored in flat arrays addressed by index:
+//! the nodes refer to the connected links and the links to the connected
+//! elements, so that no hashing is performed on the hot path of the
+//! Delaunay algorithm. Search of a link by its nodes is performed among
+//! the links connected to its first node.
 class BRepMesh_DataStructureOfDelaun : public Standard_Transient
 {
 public:
@@ -90,7 +96,7 @@ public: //! @name API for accessing mesh nodes.
 
 public: //! @name API for accessing mesh links.
   //! Returns number of links.
-  Standard_Integer NbLinks() const { return myLinks.Extent(); }
+  Standard_Integer NbLinks() const { return myLinks.Length(); }
 
   //! Adds link to the mesh if it is not already in the mesh.
   //! @param theLink link to be added to the mesh.
@@ -100,17 +106,14 @@ public: //! @name API for accessing mesh links.
   //! Finds the index of the given link.
   //! @param theLink link to find.
   //! @return index of the given element of zero if link is not in the mesh.
-  Standard_Integer IndexOf(const BRepMesh_Edge& theLink) const
-  {
-    return myLinks.FindIndex(theLink);
-  }
+  Standard_EXPORT Standard_Integer IndexOf(const BRepMesh_Edge& theLink) const;
 
   //! Get link by the index.
   //! @param theIndex index of a link.
   //! @return link with the given index.
   const BRepMesh_Edge& GetLink(const Standard_Integer theIndex)
   {
-    return myLinks.FindKey(theIndex);
+    return myLinks.Value(theIndex - 1);
   }
 
   //! Returns map of indices of links registered in mesh.
@@ -136,7 +139,7 @@ public: //! @name API for accessing mesh links.
   //! @return indices of elements connected to the link.
   const BRepMesh_PairOfIndex& ElementsConnectedTo(const Standard_Integer theLinkIndex) const
   {
-    return myLinks.FindFromIndex(theLinkIndex);
+    return myLinkElements.Value(theLinkIndex - 1);
   }
 
 public: //! @name API for accessing mesh elements.
@@ -208,7 +211,7 @@ private:
   //! @return list of links attached to the node.
   IMeshData::ListOfInteger& linksConnectedTo(const Standard_Integer theIndex) const
   {
-    return (IMeshData::ListOfInteger&)myNodeLinks.Find(theIndex);
+    return (IMeshData::ListOfInteger&)myNodeLinks.Value(theIndex - 1);
   }
 
   //! Substitutes deleted links by the last one from corresponding map
@@ -237,14 +240,15 @@ private:
   void removeElementIndex(const Standard_Integer theIndex, BRepMesh_PairOfIndex& thePair);
 
 private:
-  Handle(NCollection_IncAllocator)      myAllocator;
-  Handle(BRepMesh_VertexTool)           myNodes;
-  IMeshData::DMapOfIntegerListOfInteger myNodeLinks;
-  IMeshData::IDMapOfLink                myLinks;
-  IMeshData::ListOfInteger              myDelLinks;
-  IMeshData::VectorOfElements           myElements;
-  IMeshData::MapOfInteger               myElementsOfDomain;
-  IMeshData::MapOfInteger               myLinksOfDomain;
+  Handle(NCollection_IncAllocator) myAllocator;
+  Handle(BRepMesh_VertexTool)      myNodes;
+  IMeshData::VectorOfListOfInteger myNodeLinks;
+  IMeshData::VectorOfLinks         myLinks;
+  IMeshData::VectorOfPairOfIndex   myLinkElements;
+  IMeshData::ListOfInteger         myDelLinks;
+  IMeshData::VectorOfElements      myElements;
+  IMeshData::MapOfInteger          myElementsOfDomain;
+  IMeshData::MapOfInteger          myLinksOfDomain;
 };
 
 #endif
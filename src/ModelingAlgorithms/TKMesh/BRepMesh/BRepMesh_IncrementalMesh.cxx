@@ -16,10 +16,13 @@
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepMesh_Context.hxx>
+#include <BRepMesh_ModelBuilder.hxx>
 #include <BRepMesh_PluginMacro.hxx>
+#include <BRepTools_History.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <TopExp.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -91,6 +94,13 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   theContext->ChangeParameters()            = myParameters;
   theContext->ChangeParameters().CleanModel = Standard_False;
 
+  Handle(BRepMesh_ModelBuilder) aModelBuilder =
+    Handle(BRepMesh_ModelBuilder)::DownCast(theContext->GetModelBuilder());
+  if (!aModelBuilder.IsNull())
+  {
+    aModelBuilder->SetModifiedShapes(myModifiedShapes);
+  }
+
   Message_ProgressScope  aPS(theRange, "Perform incmesh", 10);
   IMeshTools_MeshBuilder aIncMesh(theContext);
   aIncMesh.Perform(aPS.Next(9));
@@ -121,6 +131,43 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
 
 //=================================================================================================
 
+void BRepMesh_IncrementalMesh::SetHistory(const TopoDS_Shape&              theInitialShape,
+                                          const Handle(BRepTools_History)& theHistory)
+{
+  myModifiedShapes.Clear();
+  if (theHistory.IsNull())
+  {
+    return;
+  }
+
+  // The images of solids are not taken into account, as they
+  // would mark the whole shape as modified
+  const TopAbs_ShapeEnum aTypes[3] = {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX};
+  for (Standard_Integer aTypeIt = 0; aTypeIt < 3; ++aTypeIt)
+  {
+    TopTools_IndexedMapOfShape aSubShapes;
+    TopExp::MapShapes(theInitialShape, aTypes[aTypeIt], aSubShapes);
+    for (TopTools_IndexedMapOfShape::Iterator aShapeIt(aSubShapes); aShapeIt.More();
+         aShapeIt.Next())
+    {
+      for (TopTools_ListOfShape::Iterator anImageIt(theHistory->Modified(aShapeIt.Value()));
+           anImageIt.More();
+           anImageIt.Next())
+      {
+        myModifiedShapes.Add(anImageIt.Value());
+      }
+      for (TopTools_ListOfShape::Iterator anImageIt(theHistory->Generated(aShapeIt.Value()));
+           anImageIt.More();
+           anImageIt.Next())
+      {
+        myModifiedShapes.Add(anImageIt.Value());
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
 Standard_Integer BRepMesh_IncrementalMesh::Discret(const TopoDS_Shape&    theShape,
                                                    const Standard_Real    theDeflection,
                                                    const Standard_Real    theAngle,
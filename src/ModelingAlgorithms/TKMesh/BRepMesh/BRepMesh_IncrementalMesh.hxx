@@ -17,6 +17,9 @@
 #include <BRepMesh_DiscretRoot.hxx>
 #include <IMeshTools_Context.hxx>
 #include <Standard_NumericError.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+class BRepTools_History;
 
 //! Builds the mesh of a shape with respect of their
 //! correctly triangulated parts
@@ -74,6 +77,28 @@ public: //! @name accessing to parameters.
   //! Returns accumulated status flags faced during meshing.
   Standard_Integer GetStatusFlags() const { return myStatus; }
 
+public: //! @name re-meshing of the modified shape
+  //! Returns the sub-shapes modified since the last meshing of the shape.
+  const TopTools_IndexedMapOfShape& ModifiedShapes() const { return myModifiedShapes; }
+
+  //! Sets the sub-shapes (faces, edges or shapes containing them) modified since the last
+  //! meshing of the shape, e.g. by a local operation. If the map is not empty, only the faces
+  //! and free edges containing the modified shapes are meshed, while the adjacent faces are
+  //! used to stitch the new mesh with their existing one (see BRepMesh_ModelBuilder).
+  //! The rest of the shape is not processed at all, so it should have been meshed before.
+  void SetModifiedShapes(const TopTools_IndexedMapOfShape& theShapes)
+  {
+    myModifiedShapes = theShapes;
+  }
+
+  //! Sets the modified shapes as the images (modified and generated shapes) of the faces,
+  //! edges and vertices of the initial shape in the history of the operation
+  //! that produced the shape to be meshed from the initial one.
+  //! @param theInitialShape shape meshed before the operation.
+  //! @param theHistory history of the operation.
+  Standard_EXPORT void SetHistory(const TopoDS_Shape&              theInitialShape,
+                                  const Handle(BRepTools_History)& theHistory);
+
 private:
   //! Initializes specific parameters
   void initParameters()
@@ -129,9 +154,10 @@ public: //! @name plugin API
   DEFINE_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
 protected:
-  IMeshTools_Parameters myParameters;
-  Standard_Boolean      myModified;
-  Standard_Integer      myStatus;
+  IMeshTools_Parameters      myParameters;
+  Standard_Boolean           myModified;
+  Standard_Integer           myStatus;
+  TopTools_IndexedMapOfShape myModifiedShapes;
 };
 
 #endif
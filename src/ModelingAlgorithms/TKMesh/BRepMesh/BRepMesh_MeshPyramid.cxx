@@ -0,0 +1,334 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_MeshPyramid.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRep_CurveRepresentation.hxx>
+#include <BRep_ListOfCurveRepresentation.hxx>
+#include <BRep_TEdge.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Poly_TriangulationParameters.hxx>
+#include <Precision.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+namespace
+{
+//! Upper limit of the angular deflection of the coarse levels
+const Standard_Real THE_MAX_LEVEL_ANGLE = M_PI / 3.0;
+
+//! Returns TRUE if the list contains the polygon on the given triangulation
+Standard_Boolean hasPolygon(const BRep_ListOfCurveRepresentation& theCurves,
+                            const Handle(Poly_Triangulation)&     theTriangulation,
+                            const TopLoc_Location&                theLocation)
+{
+  for (BRep_ListOfCurveRepresentation::Iterator aCurveIt(theCurves); aCurveIt.More();
+       aCurveIt.Next())
+  {
+    if (aCurveIt.Value()->IsPolygonOnTriangulation(theTriangulation, theLocation))
+    {
+      return Standard_True;
+    }
+  }
+  return Standard_False;
+}
+
+//! Appends the polygons on triangulations of the edge missing in the list
+void savePolygons(const TopoDS_Edge& theEdge, BRep_ListOfCurveRepresentation& thePolygons)
+{
+  const Handle(BRep_TEdge) aTEdge = Handle(BRep_TEdge)::DownCast(theEdge.TShape());
+  for (BRep_ListOfCurveRepresentation::Iterator aCurveIt(aTEdge->Curves()); aCurveIt.More();
+       aCurveIt.Next())
+  {
+    const Handle(BRep_CurveRepresentation)& aCurve = aCurveIt.Value();
+    if (aCurve->IsPolygonOnTriangulation()
+        && !hasPolygon(thePolygons, aCurve->Triangulation(), aCurve->Location()))
+    {
+      thePolygons.Append(aCurve);
+    }
+  }
+}
+
+//! Returns to the edge the saved polygons removed by meshing of the next levels
+void restorePolygons(const TopoDS_Edge& theEdge, const BRep_ListOfCurveRepresentation& thePolygons)
+{
+  const Handle(BRep_TEdge)        aTEdge     = Handle(BRep_TEdge)::DownCast(theEdge.TShape());
+  BRep_ListOfCurveRepresentation& aCurves    = aTEdge->ChangeCurves();
+  Standard_Boolean                isRestored = Standard_False;
+  for (BRep_ListOfCurveRepresentation::Iterator aPolyIt(thePolygons); aPolyIt.More();
+       aPolyIt.Next())
+  {
+    const Handle(BRep_CurveRepresentation)& aPolygon = aPolyIt.Value();
+    if (!hasPolygon(aCurves, aPolygon->Triangulation(), aPolygon->Location()))
+    {
+      aCurves.Append(aPolygon);
+      isRestored = Standard_True;
+    }
+  }
+  if (isRestored)
+  {
+    aTEdge->Modified(Standard_True);
+  }
+}
+
+//! Marks the triangulation of the face fitting the deflection of the next level and
+//! the polygons of its edges with the parameters of that level, so that BRepMesh reuses them
+//! instead of meshing the face again (it checks the requested deflection, not the actual one).
+//! Only the faces bounded by straight edges are marked, as the polygons of the curved edges
+//! are refined at the next level anyway, which requires meshing of the adjacent faces.
+void markReused(const TopoDS_Face&                          theFace,
+                const Handle(Poly_Triangulation)&           theTriangulation,
+                const TopLoc_Location&                      theLocation,
+                const Handle(Poly_TriangulationParameters)& theParams)
+{
+  if (theTriangulation->Deflection() > theParams->Deflection())
+  {
+    return;
+  }
+
+  NCollection_Vector<Handle(Poly_PolygonOnTriangulation)> aPolygons;
+  for (TopExp_Explorer anEdgeExp(theFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+  {
+    const TopoDS_Edge& anEdge = TopoDS::Edge(anEdgeExp.Current());
+    if (!BRep_Tool::Degenerated(anEdge) && BRepAdaptor_Curve(anEdge).GetType() != GeomAbs_Line)
+    {
+      return;
+    }
+
+    const Handle(Poly_PolygonOnTriangulation)& aPolygon =
+      BRep_Tool::PolygonOnTriangulation(anEdge, theTriangulation, theLocation);
+    if (aPolygon.IsNull())
+    {
+      return;
+    }
+    aPolygons.Append(aPolygon);
+  }
+
+  for (NCollection_Vector<Handle(Poly_PolygonOnTriangulation)>::Iterator aPolyIt(aPolygons);
+       aPolyIt.More();
+       aPolyIt.Next())
+  {
+    aPolyIt.Value()->Deflection(theParams->Deflection());
+  }
+  theTriangulation->Parameters(theParams);
+}
+} // namespace
+
+//=================================================================================================
+
+BRepMesh_MeshPyramid::BRepMesh_MeshPyramid()
+    : myNbLevels(3),
+      myLevelRatio(4.0),
+      myIsDone(Standard_False)
+{
+}
+
+//=================================================================================================
+
+BRepMesh_MeshPyramid::BRepMesh_MeshPyramid(const TopoDS_Shape&          theShape,
+                                           const IMeshTools_Parameters& theParameters,
+                                           const Standard_Integer       theNbLevels,
+                                           const Standard_Real          theLevelRatio,
+                                           const Message_ProgressRange& theRange)
+    : myShape(theShape),
+      myParameters(theParameters),
+      myNbLevels(Max(theNbLevels, 1)),
+      myLevelRatio(theLevelRatio),
+      myIsDone(Standard_False)
+{
+  Perform(theRange);
+}
+
+//=================================================================================================
+
+IMeshTools_Parameters BRepMesh_MeshPyramid::LevelParameters(const Standard_Integer theLevel) const
+{
+  IMeshTools_Parameters aParams = myParameters;
+  if (theLevel <= 0)
+  {
+    return aParams;
+  }
+
+  // Deflection is proportional to the square of the size of the elements,
+  // while angular deflection is proportional to the size itself
+  const Standard_Real aScale     = Pow(myLevelRatio, theLevel);
+  const Standard_Real anAngScale = Sqrt(aScale);
+
+  aParams.Deflection *= aScale;
+  if (aParams.DeflectionInterior > 0.0)
+  {
+    aParams.DeflectionInterior *= aScale;
+  }
+  aParams.Angle = Min(aParams.Angle * anAngScale, Max(aParams.Angle, THE_MAX_LEVEL_ANGLE));
+  if (aParams.AngleInterior > 0.0)
+  {
+    aParams.AngleInterior =
+      Min(aParams.AngleInterior * anAngScale, Max(aParams.AngleInterior, THE_MAX_LEVEL_ANGLE));
+  }
+  if (aParams.MinSize > 0.0)
+  {
+    aParams.MinSize *= anAngScale;
+  }
+  return aParams;
+}
+
+//=================================================================================================
+
+void BRepMesh_MeshPyramid::Perform(const Message_ProgressRange& theRange)
+{
+  myIsDone = Standard_False;
+  if (myShape.IsNull() || myLevelRatio <= 1.0)
+  {
+    return;
+  }
+
+  TopTools_IndexedMapOfShape aFaces;
+  TopExp::MapShapes(myShape, TopAbs_FACE, aFaces);
+  if (aFaces.IsEmpty())
+  {
+    return;
+  }
+
+  // BRepMesh removes the polygons on the triangulations it replaces,
+  // so the polygons of each level are saved to be returned to the edges at the end
+  TopTools_IndexedMapOfShape aEdges;
+  TopExp::MapShapes(myShape, TopAbs_EDGE, aEdges);
+  NCollection_Array1<BRep_ListOfCurveRepresentation> aEdgePolygons(1, aEdges.Extent());
+
+  NCollection_Array1<Poly_ListOfTriangulation> aFaceLevels(1, aFaces.Extent());
+  Message_ProgressScope aPS(theRange, "Mesh pyramid", myNbLevels);
+  for (Standard_Integer aLevel = myNbLevels - 1; aLevel >= 0; --aLevel)
+  {
+    IMeshTools_Parameters aParams = LevelParameters(aLevel);
+    // The coarsest level replaces the mesh the shape might already have
+    aParams.AllowQualityDecrease = (aLevel == myNbLevels - 1);
+
+    BRepMesh_IncrementalMesh aMesher(myShape, aParams, aPS.Next());
+    if (!aPS.More())
+    {
+      // on user break the faces are left with the levels completed so far
+      break;
+    }
+
+    for (Standard_Integer anEdgeIt = 1; anEdgeIt <= aEdges.Extent(); ++anEdgeIt)
+    {
+      savePolygons(TopoDS::Edge(aEdges(anEdgeIt)), aEdgePolygons.ChangeValue(anEdgeIt));
+    }
+
+    // The meshes which fit the next level (e.g. of planar faces) are reused by it
+    Handle(Poly_TriangulationParameters) aNextParams;
+    if (aLevel > 0)
+    {
+      const IMeshTools_Parameters aNext = LevelParameters(aLevel - 1);
+      aNextParams = new Poly_TriangulationParameters(aNext.Deflection, aNext.Angle, aNext.MinSize);
+    }
+
+    const Poly_MeshPurpose aPurpose =
+      aLevel == 0 ? (Poly_MeshPurpose_Calculation | Poly_MeshPurpose_Presentation)
+                  : Poly_MeshPurpose_Presentation;
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+    {
+      TopLoc_Location                   aLoc;
+      const Handle(Poly_Triangulation)& aTriangulation =
+        BRep_Tool::Triangulation(TopoDS::Face(aFaces(aFaceIt)), aLoc);
+      if (aTriangulation.IsNull())
+      {
+        continue;
+      }
+
+      aTriangulation->SetMeshPurpose(aPurpose);
+      Poly_ListOfTriangulation& aLevels = aFaceLevels(aFaceIt);
+      if (aLevels.IsEmpty() || aLevels.Last() != aTriangulation)
+      {
+        aLevels.Append(aTriangulation);
+      }
+      if (!aNextParams.IsNull())
+      {
+        markReused(TopoDS::Face(aFaces(aFaceIt)), aTriangulation, aLoc, aNextParams);
+      }
+    }
+  }
+
+  // The finest completed level is active,
+  // so that the polygons of edges kept by BRepMesh are consistent
+  BRep_Builder aBuilder;
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+  {
+    const Poly_ListOfTriangulation& aLevels = aFaceLevels(aFaceIt);
+    if (!aLevels.IsEmpty())
+    {
+      aBuilder.UpdateFace(TopoDS::Face(aFaces(aFaceIt)), aLevels, aLevels.Last());
+    }
+  }
+  for (Standard_Integer anEdgeIt = 1; anEdgeIt <= aEdges.Extent(); ++anEdgeIt)
+  {
+    restorePolygons(TopoDS::Edge(aEdges(anEdgeIt)), aEdgePolygons.Value(anEdgeIt));
+  }
+  myIsDone = aPS.More();
+}
+
+//=================================================================================================
+
+Handle(Poly_Triangulation) BRepMesh_MeshPyramid::Level(const TopoDS_Face&  theFace,
+                                                       const Standard_Real theDeflection,
+                                                       TopLoc_Location&    theLocation)
+{
+  Handle(Poly_Triangulation) aCoarsest, aFinest;
+  for (Poly_ListOfTriangulation::Iterator aTriIt(BRep_Tool::Triangulations(theFace, theLocation));
+       aTriIt.More();
+       aTriIt.Next())
+  {
+    // The levels are compared by the number of triangles, as the deflections of
+    // the levels of planar faces are all close to zero
+    const Handle(Poly_Triangulation)& aTriangulation = aTriIt.Value();
+    if (aFinest.IsNull() || aTriangulation->NbTriangles() > aFinest->NbTriangles())
+    {
+      aFinest = aTriangulation;
+    }
+    if (aTriangulation->Deflection() <= theDeflection
+        && (aCoarsest.IsNull() || aTriangulation->NbTriangles() < aCoarsest->NbTriangles()))
+    {
+      aCoarsest = aTriangulation;
+    }
+  }
+  return !aCoarsest.IsNull() ? aCoarsest : aFinest;
+}
+
+//=================================================================================================
+
+Standard_Real BRepMesh_MeshPyramid::ScreenDeflection(const Standard_Real    thePixelError,
+                                                     const Standard_Real    theDistance,
+                                                     const Standard_Real    theFOVy,
+                                                     const Standard_Integer theViewportHeight)
+{
+  if (theViewportHeight <= 0)
+  {
+    return Precision::Infinite();
+  }
+
+  // Size of the pixel at the given distance from the eye
+  const Standard_Real aPixelSize =
+    2.0 * theDistance * Tan(0.5 * theFOVy * M_PI / 180.0) / theViewportHeight;
+  return thePixelError * aPixelSize;
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_MeshPyramid_HeaderFile
+#define _BRepMesh_MeshPyramid_HeaderFile
+
+#include <IMeshTools_Parameters.hxx>
+#include <Message_ProgressRange.hxx>
+#include <TopoDS_Shape.hxx>
+
+class Poly_Triangulation;
+class TopLoc_Location;
+class TopoDS_Face;
+
+//! Builds the pyramid of meshes of the shape with decreasing deflection (levels of detail).
+//!
+//! The shape is meshed level by level from the coarsest one to the finest one, which is defined
+//! by the given parameters. The deflections of the coarser levels are increased by the level
+//! ratio at each level, the angular deflections by the square root of the ratio. Each level is
+//! meshed for the whole shape at once, so that the faces of the same level share the
+//! discretization of their common edges and each level is watertight.
+//!
+//! The levels are stored in the list of triangulations of each face from the coarsest to the
+//! finest one (see BRep_Tool::Triangulations()), so that the coarse geometry can be transferred
+//! first. The finest level is active and has Poly_MeshPurpose_Calculation flag, the coarser ones
+//! have Poly_MeshPurpose_Presentation flag. Level of the face can be selected by the allowed
+//! deflection, which can be computed from the screen space error, see Level().
+//! The edges keep their polygons on the triangulations of all levels.
+//!
+//! Faces with the mesh which fits the deflections of several levels (e.g. planar faces)
+//! have the same triangulation for these levels, which is stored only once.
+class BRepMesh_MeshPyramid
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Default constructor.
+  Standard_EXPORT BRepMesh_MeshPyramid();
+
+  //! Constructor.
+  //! Automatically calls method Perform.
+  //! @param theShape shape to be meshed.
+  //! @param theParameters parameters of meshing of the finest level.
+  //! @param theNbLevels number of levels.
+  //! @param theLevelRatio ratio of the deflections of the neighbor levels.
+  Standard_EXPORT BRepMesh_MeshPyramid(
+    const TopoDS_Shape&          theShape,
+    const IMeshTools_Parameters& theParameters,
+    const Standard_Integer       theNbLevels   = 3,
+    const Standard_Real          theLevelRatio = 4.0,
+    const Message_ProgressRange& theRange      = Message_ProgressRange());
+
+  //! Performs meshing of all levels.
+  //! On user break the faces keep the levels completed before it (with the polygons of edges)
+  //! and IsDone() returns FALSE.
+  Standard_EXPORT void Perform(const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Returns TRUE if all levels have been meshed.
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+public: //! @name accessing to parameters
+  //! Returns the shape to be meshed.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Sets the shape to be meshed.
+  void SetShape(const TopoDS_Shape& theShape) { myShape = theShape; }
+
+  //! Returns parameters of meshing of the finest level.
+  const IMeshTools_Parameters& Parameters() const { return myParameters; }
+
+  //! Returns modifiable parameters of meshing of the finest level.
+  IMeshTools_Parameters& ChangeParameters() { return myParameters; }
+
+  //! Returns number of levels.
+  Standard_Integer NbLevels() const { return myNbLevels; }
+
+  //! Sets number of levels.
+  void SetNbLevels(const Standard_Integer theNbLevels) { myNbLevels = Max(theNbLevels, 1); }
+
+  //! Returns ratio of the deflections of the neighbor levels.
+  Standard_Real LevelRatio() const { return myLevelRatio; }
+
+  //! Sets ratio of the deflections of the neighbor levels, should be greater than 1.
+  void SetLevelRatio(const Standard_Real theRatio) { myLevelRatio = theRatio; }
+
+  //! Returns parameters of meshing of the level.
+  //! @param theLevel index of the level, 0 is the finest one.
+  Standard_EXPORT IMeshTools_Parameters LevelParameters(const Standard_Integer theLevel) const;
+
+public: //! @name selection of the level
+  //! Returns the coarsest triangulation (with the least number of triangles) of the face
+  //! with the deflection not greater than the given one, or the finest triangulation
+  //! (with the greatest number of triangles) of the face if there is no such one.
+  //! @param theFace face to get the triangulation of.
+  //! @param theDeflection allowed deflection.
+  //! @param[out] theLocation location of the triangulation.
+  Standard_EXPORT static Handle(Poly_Triangulation) Level(const TopoDS_Face&  theFace,
+                                                          const Standard_Real theDeflection,
+                                                          TopLoc_Location&    theLocation);
+
+  //! Returns deflection corresponding to the screen space error for the perspective projection.
+  //! @param thePixelError allowed error in pixels.
+  //! @param theDistance distance from the eye to the object.
+  //! @param theFOVy field of view in y axis in degrees.
+  //! @param theViewportHeight height of the viewport in pixels.
+  Standard_EXPORT static Standard_Real ScreenDeflection(const Standard_Real    thePixelError,
+                                                        const Standard_Real    theDistance,
+                                                        const Standard_Real    theFOVy,
+                                                        const Standard_Integer theViewportHeight);
+
+private:
+  TopoDS_Shape          myShape;
+  IMeshTools_Parameters myParameters;
+  Standard_Integer      myNbLevels;
+  Standard_Real         myLevelRatio;
+  Standard_Boolean      myIsDone;
+};
+
+#endif
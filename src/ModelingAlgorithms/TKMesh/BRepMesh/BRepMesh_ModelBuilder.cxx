@@ -20,7 +20,12 @@
 #include <IMeshTools_ShapeExplorer.hxx>
 
 #include <Bnd_Box.hxx>
+#include <BRep_Builder.hxx>
 #include <BRepBndLib.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_ModelBuilder, IMeshTools_ModelBuilder)
 
@@ -61,7 +66,10 @@ Handle(IMeshData_Model) BRepMesh_ModelBuilder::performInternal(
 
     Handle(IMeshTools_ShapeVisitor) aVisitor = new BRepMesh_ShapeVisitor(aModel);
 
-    IMeshTools_ShapeExplorer aExplorer(theShape);
+    // Size of the model is defined by the whole shape, so that the deflections
+    // of the affected part are the same as in case of meshing of the whole shape
+    IMeshTools_ShapeExplorer aExplorer(myModifiedShapes.IsEmpty() ? theShape
+                                                                  : affectedShape(theShape));
     aExplorer.Accept(aVisitor);
     SetStatus(Message_Done1);
   }
@@ -72,3 +80,79 @@ Handle(IMeshData_Model) BRepMesh_ModelBuilder::performInternal(
 
   return aModel;
 }
+
+//=================================================================================================
+
+TopoDS_Shape BRepMesh_ModelBuilder::affectedShape(const TopoDS_Shape& theShape) const
+{
+  TopTools_IndexedDataMapOfShapeListOfShape anEdgeFaces;
+  TopExp::MapShapesAndAncestors(theShape, TopAbs_EDGE, TopAbs_FACE, anEdgeFaces);
+  TopTools_IndexedMapOfShape aShapeFaces;
+  TopExp::MapShapes(theShape, TopAbs_FACE, aShapeFaces);
+
+  // Collect the faces and free edges of the shape containing the modified shapes
+  TopTools_IndexedMapOfShape aFaces, aFreeEdges;
+  for (TopTools_IndexedMapOfShape::Iterator aModIt(myModifiedShapes); aModIt.More(); aModIt.Next())
+  {
+    for (TopExp_Explorer aFaceExp(aModIt.Value(), TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+    {
+      const Standard_Integer anIndex = aShapeFaces.FindIndex(aFaceExp.Current());
+      if (anIndex != 0)
+      {
+        aFaces.Add(aShapeFaces(anIndex));
+      }
+    }
+
+    for (TopExp_Explorer anEdgeExp(aModIt.Value(), TopAbs_EDGE); anEdgeExp.More();
+         anEdgeExp.Next())
+    {
+      const TopTools_ListOfShape* anAncestors = anEdgeFaces.Seek(anEdgeExp.Current());
+      if (anAncestors == NULL)
+      {
+        continue;
+      }
+
+      if (anAncestors->IsEmpty())
+      {
+        aFreeEdges.Add(anEdgeExp.Current());
+      }
+      for (TopTools_ListOfShape::Iterator aFaceIt(*anAncestors); aFaceIt.More(); aFaceIt.Next())
+      {
+        aFaces.Add(aFaceIt.Value());
+      }
+    }
+  }
+
+  // Add the adjacent faces to stitch the new mesh with their existing one
+  const Standard_Integer aNbAffected = aFaces.Extent();
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aNbAffected; ++aFaceIt)
+  {
+    for (TopExp_Explorer anEdgeExp(aFaces(aFaceIt), TopAbs_EDGE); anEdgeExp.More();
+         anEdgeExp.Next())
+    {
+      const TopTools_ListOfShape* anAncestors = anEdgeFaces.Seek(anEdgeExp.Current());
+      if (anAncestors == NULL)
+      {
+        continue;
+      }
+
+      for (TopTools_ListOfShape::Iterator anAdjIt(*anAncestors); anAdjIt.More(); anAdjIt.Next())
+      {
+        aFaces.Add(anAdjIt.Value());
+      }
+    }
+  }
+
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  for (TopTools_IndexedMapOfShape::Iterator aFaceIt(aFaces); aFaceIt.More(); aFaceIt.Next())
+  {
+    aBuilder.Add(aCompound, aFaceIt.Value());
+  }
+  for (TopTools_IndexedMapOfShape::Iterator anEdgeIt(aFreeEdges); anEdgeIt.More(); anEdgeIt.Next())
+  {
+    aBuilder.Add(aCompound, anEdgeIt.Value());
+  }
+  return aCompound;
+}
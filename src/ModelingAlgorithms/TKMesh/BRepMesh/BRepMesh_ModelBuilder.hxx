@@ -19,6 +19,7 @@
 #include <IMeshTools_ModelBuilder.hxx>
 #include <Standard_Type.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 //! Class implements interface representing tool for discrete model building.
 //!
@@ -35,6 +36,19 @@ public:
   //! Destructor.
   Standard_EXPORT virtual ~BRepMesh_ModelBuilder();
 
+  //! Returns the sub-shapes modified since the last meshing of the shape.
+  const TopTools_IndexedMapOfShape& ModifiedShapes() const { return myModifiedShapes; }
+
+  //! Sets the sub-shapes (faces, edges or shapes containing them) modified since the last
+  //! meshing of the shape, e.g. by a local operation. If the map is not empty, the discrete
+  //! model is built only for the faces and free edges containing the modified shapes and
+  //! for the faces adjacent to them, instead of the whole shape. The adjacent faces keep
+  //! their mesh, and their polygons on the common edges are reused by the new mesh.
+  void SetModifiedShapes(const TopTools_IndexedMapOfShape& theShapes)
+  {
+    myModifiedShapes = theShapes;
+  }
+
   DEFINE_STANDARD_RTTIEXT(BRepMesh_ModelBuilder, IMeshTools_ModelBuilder)
 
 protected:
@@ -43,6 +57,14 @@ protected:
   Standard_EXPORT virtual Handle(IMeshData_Model) performInternal(
     const TopoDS_Shape&          theShape,
     const IMeshTools_Parameters& theParameters) Standard_OVERRIDE;
+
+private:
+  //! Returns the compound of faces and free edges of the shape
+  //! to be processed due to the modified shapes.
+  TopoDS_Shape affectedShape(const TopoDS_Shape& theShape) const;
+
+private:
+  TopTools_IndexedMapOfShape myModifiedShapes;
 };
 
 #endif
\ No newline at end of file
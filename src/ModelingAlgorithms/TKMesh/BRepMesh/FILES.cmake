@@ -58,6 +58,8 @@ set(OCCT_BRepMesh_FILES
   BRepMesh_IncrementalMesh.hxx
   BRepMesh_MeshAlgoFactory.cxx
   BRepMesh_MeshAlgoFactory.hxx
+  BRepMesh_MeshPyramid.cxx
+  BRepMesh_MeshPyramid.hxx
   BRepMesh_MeshTool.cxx
   BRepMesh_MeshTool.hxx
   BRepMesh_ModelBuilder.cxx
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_DataStructureOfDelaun.hxx>
+#include <BRepMesh_Delaun.hxx>
+#include <BRepMesh_Edge.hxx>
+#include <NCollection_IncAllocator.hxx>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace
+{
+//! Creates the data structure with the nodes of the unit square
+Handle(BRepMesh_DataStructureOfDelaun) createSquare()
+{
+  Handle(BRepMesh_DataStructureOfDelaun) aStructure =
+    new BRepMesh_DataStructureOfDelaun(new NCollection_IncAllocator());
+  aStructure->AddNode(BRepMesh_Vertex(0.0, 0.0, BRepMesh_Frontier));
+  aStructure->AddNode(BRepMesh_Vertex(1.0, 0.0, BRepMesh_Frontier));
+  aStructure->AddNode(BRepMesh_Vertex(1.0, 1.0, BRepMesh_Frontier));
+  aStructure->AddNode(BRepMesh_Vertex(0.0, 1.0, BRepMesh_Frontier));
+  return aStructure;
+}
+} // namespace
+
+TEST(BRepMesh_DataStructureOfDelaunTest, LinksAreFoundByNodes)
+{
+  Handle(BRepMesh_DataStructureOfDelaun) aStructure = createSquare();
+  EXPECT_EQ(4, aStructure->NbNodes());
+
+  const Standard_Integer aLink1 = aStructure->AddLink(BRepMesh_Edge(1, 2, BRepMesh_Frontier));
+  const Standard_Integer aLink2 = aStructure->AddLink(BRepMesh_Edge(2, 3, BRepMesh_Frontier));
+  EXPECT_EQ(1, aLink1);
+  EXPECT_EQ(2, aLink2);
+  EXPECT_EQ(2, aStructure->NbLinks());
+
+  // the existing link is returned with the sign of its orientation
+  EXPECT_EQ(aLink1, aStructure->AddLink(BRepMesh_Edge(1, 2, BRepMesh_Frontier)));
+  EXPECT_EQ(-aLink2, aStructure->AddLink(BRepMesh_Edge(3, 2, BRepMesh_Frontier)));
+  EXPECT_EQ(2, aStructure->NbLinks());
+
+  EXPECT_EQ(aLink2, aStructure->IndexOf(BRepMesh_Edge(3, 2, BRepMesh_Free)));
+  EXPECT_EQ(0, aStructure->IndexOf(BRepMesh_Edge(1, 3, BRepMesh_Free)));
+  EXPECT_EQ(0, aStructure->IndexOf(BRepMesh_Edge(10, 11, BRepMesh_Free)));
+  EXPECT_EQ(2, aStructure->LinksConnectedTo(2).Extent());
+}
+
+TEST(BRepMesh_DataStructureOfDelaunTest, RemovedLinkIsReused)
+{
+  Handle(BRepMesh_DataStructureOfDelaun) aStructure = createSquare();
+
+  const Standard_Integer aLink1 = aStructure->AddLink(BRepMesh_Edge(1, 2, BRepMesh_Free));
+  const Standard_Integer aLink2 = aStructure->AddLink(BRepMesh_Edge(2, 3, BRepMesh_Free));
+  aStructure->RemoveLink(aLink1);
+  EXPECT_EQ(0, aStructure->IndexOf(BRepMesh_Edge(1, 2, BRepMesh_Free)));
+  EXPECT_EQ(0, aStructure->LinksConnectedTo(1).Extent());
+  EXPECT_FALSE(aStructure->LinksOfDomain().Contains(aLink1));
+
+  // the index of the removed link is given to the new one
+  EXPECT_EQ(aLink1, aStructure->AddLink(BRepMesh_Edge(3, 4, BRepMesh_Free)));
+  EXPECT_EQ(aLink1, aStructure->IndexOf(BRepMesh_Edge(4, 3, BRepMesh_Free)));
+  EXPECT_EQ(aLink2, aStructure->IndexOf(BRepMesh_Edge(2, 3, BRepMesh_Free)));
+  EXPECT_TRUE(aStructure->ElementsConnectedTo(aLink1).IsEmpty());
+}
+
+TEST(BRepMesh_DataStructureOfDelaunTest, ElementsConnectedToLinks)
+{
+  Handle(BRepMesh_DataStructureOfDelaun) aStructure = createSquare();
+
+  const Standard_Integer aLinks[5] = {aStructure->AddLink(BRepMesh_Edge(1, 2, BRepMesh_Free)),
+                                      aStructure->AddLink(BRepMesh_Edge(2, 3, BRepMesh_Free)),
+                                      aStructure->AddLink(BRepMesh_Edge(3, 1, BRepMesh_Free)),
+                                      aStructure->AddLink(BRepMesh_Edge(3, 4, BRepMesh_Free)),
+                                      aStructure->AddLink(BRepMesh_Edge(4, 1, BRepMesh_Free))};
+
+  const Standard_Integer anEdges1[3]        = {aLinks[0], aLinks[1], aLinks[2]};
+  const Standard_Integer anEdges2[3]        = {aLinks[2], aLinks[3], aLinks[4]};
+  const Standard_Boolean anOrientations1[3] = {Standard_True, Standard_True, Standard_True};
+  const Standard_Boolean anOrientations2[3] = {Standard_False, Standard_True, Standard_True};
+
+  const Standard_Integer aTri1 =
+    aStructure->AddElement(BRepMesh_Triangle(anEdges1, anOrientations1, BRepMesh_Free));
+  const Standard_Integer aTri2 =
+    aStructure->AddElement(BRepMesh_Triangle(anEdges2, anOrientations2, BRepMesh_Free));
+  EXPECT_EQ(2, aStructure->ElementsConnectedTo(aLinks[2]).Extent());
+  EXPECT_EQ(1, aStructure->ElementsConnectedTo(aLinks[0]).Extent());
+
+  Standard_Integer aNodes[3];
+  aStructure->ElementNodes(aStructure->GetElement(aTri2), aNodes);
+  EXPECT_EQ(1, aNodes[0]);
+  EXPECT_EQ(3, aNodes[1]);
+  EXPECT_EQ(4, aNodes[2]);
+
+  aStructure->RemoveElement(aTri1);
+  EXPECT_EQ(1, aStructure->ElementsConnectedTo(aLinks[2]).Extent());
+  EXPECT_EQ(aTri2, aStructure->ElementsConnectedTo(aLinks[2]).FirstIndex());
+  EXPECT_TRUE(aStructure->ElementsConnectedTo(aLinks[0]).IsEmpty());
+}
+
+TEST(BRepMesh_DataStructureOfDelaunTest, DelaunayOfRandomPoints)
+{
+  const Standard_Integer                 aNbPoints = 5000;
+  Handle(NCollection_IncAllocator)       anAlloc   = new NCollection_IncAllocator();
+  Handle(BRepMesh_DataStructureOfDelaun) aStructure =
+    new BRepMesh_DataStructureOfDelaun(anAlloc, aNbPoints);
+
+  std::mt19937                           aGen(1);
+  std::uniform_real_distribution<double> aDist(0.0, 1.0);
+  IMeshData::VectorOfInteger             aVertices(aNbPoints, anAlloc);
+  for (Standard_Integer aPntIt = 0; aPntIt < aNbPoints; ++aPntIt)
+  {
+    const BRepMesh_Vertex aVertex(gp_XY(aDist(aGen), aDist(aGen)), aPntIt, BRepMesh_Free);
+    aVertices.Append(aStructure->AddNode(aVertex));
+  }
+
+  BRepMesh_Delaun aMesher(aStructure, aVertices);
+
+  // Euler formula for triangulation of the convex hull: E = T + V - 1
+  const Standard_Integer aNbTriangles = aStructure->ElementsOfDomain().Extent();
+  const Standard_Integer aNbLinks     = aStructure->LinksOfDomain().Extent();
+  EXPECT_GT(aNbTriangles, aNbPoints);
+  EXPECT_EQ(aNbLinks, aNbTriangles + aNbPoints - 1);
+
+  for (IMeshData::IteratorOfMapOfInteger aLinkIt(aStructure->LinksOfDomain()); aLinkIt.More();
+       aLinkIt.Next())
+  {
+    const BRepMesh_Edge& aLink = aStructure->GetLink(aLinkIt.Key());
+    EXPECT_EQ(aLinkIt.Key(), aStructure->IndexOf(aLink));
+    EXPECT_FALSE(aStructure->ElementsConnectedTo(aLinkIt.Key()).IsEmpty());
+  }
+}
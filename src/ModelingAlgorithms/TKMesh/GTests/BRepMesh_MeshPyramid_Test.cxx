@@ -0,0 +1,208 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Tool.hxx>
+#include <BRepMesh_MeshPyramid.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Geom_Plane.hxx>
+#include <Message_ProgressIndicator.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Meshes the shape with three levels of detail
+void meshPyramid(const TopoDS_Shape& theShape)
+{
+  IMeshTools_Parameters aParams;
+  aParams.Deflection = 0.01;
+  aParams.Angle      = 0.1;
+
+  BRepMesh_MeshPyramid aPyramid(theShape, aParams, 3, 4.0);
+  EXPECT_TRUE(aPyramid.IsDone());
+}
+
+//! Progress indicator requesting the break after the given position
+class BreakingIndicator : public Message_ProgressIndicator
+{
+public:
+  BreakingIndicator(const Standard_Real theBreakPosition)
+      : myBreakPosition(theBreakPosition)
+  {
+  }
+
+  virtual Standard_Boolean UserBreak() Standard_OVERRIDE
+  {
+    return GetPosition() > myBreakPosition;
+  }
+
+  virtual void Show(const Message_ProgressScope&, const Standard_Boolean) Standard_OVERRIDE {}
+
+private:
+  Standard_Real myBreakPosition;
+};
+} // namespace
+
+TEST(BRepMesh_MeshPyramidTest, LevelsOfCurvedFaces)
+{
+  const TopoDS_Shape aCylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+  meshPyramid(aCylinder);
+  for (TopExp_Explorer aFaceExp(aCylinder, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+  {
+    // the planar faces are meshed again at each level as their circular edges are refined
+    const TopoDS_Face&              aFace = TopoDS::Face(aFaceExp.Current());
+    TopLoc_Location                 aLoc;
+    const Poly_ListOfTriangulation& aLevels = BRep_Tool::Triangulations(aFace, aLoc);
+    ASSERT_EQ(3, aLevels.Extent());
+
+    const Handle(Poly_Triangulation)& aCoarsest = aLevels.First();
+    const Handle(Poly_Triangulation)& aFinest   = aLevels.Last();
+    EXPECT_EQ(aFinest, BRep_Tool::Triangulation(aFace, aLoc));
+    EXPECT_LT(aCoarsest->NbTriangles(), aFinest->NbTriangles());
+    EXPECT_TRUE((aFinest->MeshPurpose() & Poly_MeshPurpose_Calculation) != 0);
+    EXPECT_TRUE((aCoarsest->MeshPurpose() & Poly_MeshPurpose_Calculation) == 0);
+
+    // each level keeps the polygons of the edges
+    for (Poly_ListOfTriangulation::Iterator aLevelIt(aLevels); aLevelIt.More(); aLevelIt.Next())
+    {
+      for (TopExp_Explorer anEdgeExp(aFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+      {
+        EXPECT_FALSE(BRep_Tool::PolygonOnTriangulation(TopoDS::Edge(anEdgeExp.Current()),
+                                                       aLevelIt.Value(),
+                                                       aLoc)
+                       .IsNull());
+      }
+    }
+  }
+}
+
+TEST(BRepMesh_MeshPyramidTest, ReuseOfCoarseMesh)
+{
+  // the coarse meshes of the box faces fit all levels and are not meshed again
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  meshPyramid(aBox);
+  for (TopExp_Explorer aFaceExp(aBox, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aFaceExp.Current());
+    TopLoc_Location    aLoc;
+    ASSERT_EQ(1, BRep_Tool::Triangulations(aFace, aLoc).Extent());
+
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation(aFace, aLoc);
+    EXPECT_TRUE((aTriangulation->MeshPurpose() & Poly_MeshPurpose_Calculation) != 0);
+    for (TopExp_Explorer anEdgeExp(aFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+    {
+      EXPECT_FALSE(BRep_Tool::PolygonOnTriangulation(TopoDS::Edge(anEdgeExp.Current()),
+                                                     aTriangulation,
+                                                     aLoc)
+                     .IsNull());
+    }
+  }
+}
+
+TEST(BRepMesh_MeshPyramidTest, LevelSelection)
+{
+  const TopoDS_Shape aCylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+  meshPyramid(aCylinder);
+  for (TopExp_Explorer aFaceExp(aCylinder, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+  {
+    const TopoDS_Face&              aFace = TopoDS::Face(aFaceExp.Current());
+    TopLoc_Location                 aLoc;
+    const Poly_ListOfTriangulation& aLevels = BRep_Tool::Triangulations(aFace, aLoc);
+    ASSERT_EQ(3, aLevels.Extent());
+
+    Poly_ListOfTriangulation::Iterator aLevelIt(aLevels);
+    aLevelIt.Next();
+    const Handle(Poly_Triangulation)& aCoarsest = aLevels.First();
+    const Handle(Poly_Triangulation)& aMiddle   = aLevelIt.Value();
+    const Handle(Poly_Triangulation)& aFinest   = aLevels.Last();
+
+    // any level fits the infinite deflection, none fits the zero one
+    EXPECT_EQ(aCoarsest, BRepMesh_MeshPyramid::Level(aFace, Precision::Infinite(), aLoc));
+    EXPECT_EQ(aFinest, BRepMesh_MeshPyramid::Level(aFace, 0.0, aLoc));
+
+    const Standard_Boolean isPlane =
+      BRep_Tool::Surface(aFace)->IsKind(STANDARD_TYPE(Geom_Plane));
+    if (isPlane)
+    {
+      continue;
+    }
+
+    // the coarsest level fitting the deflection
+    EXPECT_EQ(aCoarsest, BRepMesh_MeshPyramid::Level(aFace, aCoarsest->Deflection(), aLoc));
+    EXPECT_EQ(aMiddle, BRepMesh_MeshPyramid::Level(aFace, aMiddle->Deflection(), aLoc));
+    EXPECT_EQ(aMiddle, BRepMesh_MeshPyramid::Level(aFace, 0.99 * aCoarsest->Deflection(), aLoc));
+    EXPECT_EQ(aFinest, BRepMesh_MeshPyramid::Level(aFace, aFinest->Deflection(), aLoc));
+
+    // the near object is shown by the finest level, the far one by the coarsest level
+    const Standard_Real aNear = BRepMesh_MeshPyramid::ScreenDeflection(0.1, 1.0, 45.0, 1000);
+    const Standard_Real aFar  = BRepMesh_MeshPyramid::ScreenDeflection(1.0, 1.e+4, 45.0, 1000);
+    EXPECT_EQ(aFinest, BRepMesh_MeshPyramid::Level(aFace, aNear, aLoc));
+    EXPECT_EQ(aCoarsest, BRepMesh_MeshPyramid::Level(aFace, aFar, aLoc));
+  }
+}
+
+TEST(BRepMesh_MeshPyramidTest, ScreenDeflection)
+{
+  // the pixel is 1 unit high at the distance 1 for FOV 90 degrees and viewport of 2 pixels
+  EXPECT_NEAR(0.5,
+              BRepMesh_MeshPyramid::ScreenDeflection(0.5, 1.0, 90.0, 2),
+              Precision::Confusion());
+  EXPECT_NEAR(10.0,
+              BRepMesh_MeshPyramid::ScreenDeflection(1.0, 10.0, 90.0, 2),
+              Precision::Confusion());
+  EXPECT_NEAR(BRepMesh_MeshPyramid::ScreenDeflection(1.0, 5.0, 60.0, 1000) * 2.0,
+              BRepMesh_MeshPyramid::ScreenDeflection(1.0, 5.0, 60.0, 500),
+              Precision::Confusion());
+  EXPECT_TRUE(Precision::IsInfinite(BRepMesh_MeshPyramid::ScreenDeflection(1.0, 5.0, 60.0, 0)));
+}
+
+TEST(BRepMesh_MeshPyramidTest, UserBreakKeepsCompletedLevels)
+{
+  IMeshTools_Parameters aParams;
+  aParams.Deflection = 0.01;
+  aParams.Angle      = 0.1;
+
+  // break during the second of three levels
+  const TopoDS_Shape                aCylinder = BRepPrimAPI_MakeCylinder(10.0, 20.0).Shape();
+  Handle(Message_ProgressIndicator) anIndicator = new BreakingIndicator(0.4);
+  BRepMesh_MeshPyramid aPyramid(aCylinder, aParams, 3, 4.0, anIndicator->Start());
+  EXPECT_FALSE(aPyramid.IsDone());
+
+  for (TopExp_Explorer aFaceExp(aCylinder, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+  {
+    const TopoDS_Face&              aFace = TopoDS::Face(aFaceExp.Current());
+    TopLoc_Location                 aLoc;
+    const Poly_ListOfTriangulation& aLevels = BRep_Tool::Triangulations(aFace, aLoc);
+    ASSERT_GE(aLevels.Extent(), 1);
+    ASSERT_LE(aLevels.Extent(), 2);
+    EXPECT_EQ(aLevels.Last(), BRep_Tool::Triangulation(aFace, aLoc));
+
+    // the polygons of the completed levels removed by meshing of the next one are restored
+    for (Poly_ListOfTriangulation::Iterator aLevelIt(aLevels); aLevelIt.More(); aLevelIt.Next())
+    {
+      for (TopExp_Explorer anEdgeExp(aFace, TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+      {
+        EXPECT_FALSE(BRep_Tool::PolygonOnTriangulation(TopoDS::Edge(anEdgeExp.Current()),
+                                                       aLevelIt.Value(),
+                                                       aLoc)
+                       .IsNull());
+      }
+    }
+  }
+}
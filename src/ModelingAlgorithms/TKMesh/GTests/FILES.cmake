@@ -2,4 +2,6 @@
 set(OCCT_TKMesh_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKMesh_GTests_FILES
+  BRepMesh_DataStructureOfDelaun_Test.cxx
+  BRepMesh_MeshPyramid_Test.cxx
 )
@@ -119,6 +119,10 @@ typedef NCollection_Shared<NCollection_List<Standard_Integer>> ListOfInteger;
 typedef NCollection_Shared<NCollection_List<gp_Pnt2d>>         ListOfPnt2d;
 typedef NCollection_Shared<NCollection_List<IPCurveHandle>>    ListOfIPCurves;
 
+typedef NCollection_Shared<NCollection_Vector<BRepMesh_Edge>>        VectorOfLinks;
+typedef NCollection_Shared<NCollection_Vector<BRepMesh_PairOfIndex>> VectorOfPairOfIndex;
+typedef NCollection_Shared<NCollection_Vector<ListOfInteger>>        VectorOfListOfInteger;
+
 typedef NCollection_Shared<TColStd_PackedMapOfInteger> MapOfInteger;
 typedef TColStd_MapIteratorOfPackedMapOfInteger        IteratorOfMapOfInteger;
 
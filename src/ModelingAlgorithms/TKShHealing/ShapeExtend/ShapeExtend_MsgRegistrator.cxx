@@ -41,6 +41,7 @@ void ShapeExtend_MsgRegistrator::Send(const Handle(Standard_Transient)& object,
 #endif
     return;
   }
+  Standard_Mutex::Sentry aSentry(myMutex);
   if (myMapTransient.IsBound(object))
   {
     Message_ListOfMsg& list = myMapTransient.ChangeFind(object);
@@ -67,6 +68,7 @@ void ShapeExtend_MsgRegistrator::Send(const TopoDS_Shape& shape,
 #endif
     return;
   }
+  Standard_Mutex::Sentry aSentry(myMutex);
   if (myMapShape.IsBound(shape))
   {
     Message_ListOfMsg& list = myMapShape.ChangeFind(shape);
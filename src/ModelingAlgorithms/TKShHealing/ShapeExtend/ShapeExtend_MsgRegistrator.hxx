@@ -23,6 +23,7 @@
 #include <ShapeExtend_DataMapOfShapeListOfMsg.hxx>
 #include <ShapeExtend_BasicMsgRegistrator.hxx>
 #include <Message_Gravity.hxx>
+#include <Standard_Mutex.hxx>
 class Standard_Transient;
 class Message_Msg;
 class TopoDS_Shape;
@@ -38,6 +39,7 @@ DEFINE_STANDARD_HANDLE(ShapeExtend_MsgRegistrator, ShapeExtend_BasicMsgRegistrat
 //! Messages are added to the Maps (stored as a field) that can be
 //! used, for instance, by Data Exchange processors to attach those
 //! messages to initial file entities.
+//! Messages can be sent from parallel threads.
 class ShapeExtend_MsgRegistrator : public ShapeExtend_BasicMsgRegistrator
 {
 
@@ -71,6 +73,7 @@ protected:
 private:
   ShapeExtend_DataMapOfTransientListOfMsg myMapTransient;
   ShapeExtend_DataMapOfShapeListOfMsg     myMapShape;
+  Standard_Mutex                          myMutex;
 };
 
 #include <ShapeExtend_MsgRegistrator.lxx>
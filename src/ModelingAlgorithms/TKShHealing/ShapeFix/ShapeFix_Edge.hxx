@@ -48,6 +48,7 @@ DEFINE_STANDARD_HANDLE(ShapeFix_Edge, Standard_Transient)
 //! - not adjacent curves (3d or pcurve) to the vertices.
 class ShapeFix_Edge : public Standard_Transient
 {
+  friend class ShapeFix_Shape;
 
 public:
   //! Empty constructor
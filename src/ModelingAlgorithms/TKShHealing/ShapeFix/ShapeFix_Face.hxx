@@ -51,6 +51,7 @@ DEFINE_STANDARD_HANDLE(ShapeFix_Face, ShapeFix_Root)
 //! and detection and removal of null-area wires
 class ShapeFix_Face : public ShapeFix_Root
 {
+  friend class ShapeFix_Shape;
 
 public:
   //! Creates an empty tool
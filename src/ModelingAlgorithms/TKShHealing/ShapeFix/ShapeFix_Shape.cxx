@@ -16,9 +16,18 @@
 
 #include <BRep_Builder.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <ShapeAnalysis_Wire.hxx>
 #include <ShapeBuild_ReShape.hxx>
+#include <ShapeConstruct_ProjectCurveOnSurface.hxx>
 #include <ShapeFix.hxx>
 #include <ShapeFix_Edge.hxx>
+#include <ShapeFix_Face.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <ShapeFix_Shell.hxx>
 #include <ShapeFix_Solid.hxx>
@@ -34,6 +43,52 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(ShapeFix_Shape, ShapeFix_Root)
 
+namespace
+{
+typedef NCollection_Map<Handle(TopoDS_TShape)> ShapeFix_MapOfTShape;
+
+//! Part of the compound fixed within a single thread.
+struct ShapeFix_ShapePart
+{
+  Handle(ShapeFix_Shape)               Tool;   //!< tool fixing sub-shapes of the part
+  NCollection_Vector<Standard_Integer> Shapes; //!< indices of sub-shapes of the part
+  Standard_Boolean                     Status; //!< flag indicating that some sub-shape is fixed
+
+  ShapeFix_ShapePart()
+      : Status(Standard_False)
+  {
+  }
+};
+
+//! Adds TShapes of the shape and all its sub-shapes to the map.
+//! TShapes are considered regardless of location and orientation,
+//! as fixes modify them in place (tolerances, pcurves, etc.).
+static void collectTShapes(const TopoDS_Shape& theShape, ShapeFix_MapOfTShape& theTShapes)
+{
+  if (!theTShapes.Add(theShape.TShape()))
+  {
+    return;
+  }
+  for (TopoDS_Iterator anIter(theShape, Standard_False, Standard_False); anIter.More();
+       anIter.Next())
+  {
+    collectTShapes(anIter.Value(), theTShapes);
+  }
+}
+
+//! Returns the root of the group of the item.
+static Standard_Integer findGroup(NCollection_Array1<Standard_Integer>& theGroups,
+                                  Standard_Integer                      theItem)
+{
+  while (theGroups(theItem) != theItem)
+  {
+    theGroups(theItem) = theGroups(theGroups(theItem));
+    theItem            = theGroups(theItem);
+  }
+  return theItem;
+}
+} // namespace
+
 //=================================================================================================
 
 ShapeFix_Shape::ShapeFix_Shape()
@@ -47,6 +102,7 @@ ShapeFix_Shape::ShapeFix_Shape()
   myFixVertexPositionMode = 0;
   myFixVertexTolMode      = -1;
   myFixSolid              = new ShapeFix_Solid;
+  myRunParallel           = Standard_False;
 }
 
 //=================================================================================================
@@ -62,6 +118,7 @@ ShapeFix_Shape::ShapeFix_Shape(const TopoDS_Shape& shape)
   myFixSolid              = new ShapeFix_Solid;
   myFixVertexPositionMode = 0;
   myFixVertexTolMode      = -1;
+  myRunParallel           = Standard_False;
   Init(shape);
 }
 
@@ -137,11 +194,14 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
 
       // Open progress indication scope for sub-shape fixing
       Message_ProgressScope aPSSubShape(aPS.Next(), "Fixing sub-shape", aShapesNb);
-      for (TopoDS_Iterator anIter(S); anIter.More() && aPSSubShape.More(); anIter.Next())
+      if (!myRunParallel || !fixParallel(S, aPSSubShape, status))
       {
-        myShape = anIter.Value();
-        if (Perform(aPSSubShape.Next()))
-          status = Standard_True;
+        for (TopoDS_Iterator anIter(S); anIter.More() && aPSSubShape.More(); anIter.Next())
+        {
+          myShape = anIter.Value();
+          if (Perform(aPSSubShape.Next()))
+            status = Standard_True;
+        }
       }
       if (!aPSSubShape.More())
         return Standard_False; // aborted execution
@@ -272,6 +332,169 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
 
 //=================================================================================================
 
+Standard_Boolean ShapeFix_Shape::fixParallel(const TopoDS_Shape&    theShape,
+                                             Message_ProgressScope& thePS,
+                                             Standard_Boolean&      theStatus)
+{
+  const Standard_Integer aNbThreads = OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch();
+  const Standard_Integer aNbShapes  = theShape.NbChildren();
+  if (aNbThreads < 2 || aNbShapes < 2)
+  {
+    return Standard_False;
+  }
+
+  // group sub-shapes sharing some topology
+  NCollection_Array1<TopoDS_Shape>                             aShapes(0, aNbShapes - 1);
+  NCollection_Array1<Standard_Integer>                         aGroups(0, aNbShapes - 1);
+  NCollection_DataMap<Handle(TopoDS_TShape), Standard_Integer> anOwners;
+  Standard_Integer                                             aShapeIndex = 0;
+  for (TopoDS_Iterator anIter(theShape); anIter.More(); anIter.Next(), ++aShapeIndex)
+  {
+    aShapes(aShapeIndex) = anIter.Value();
+    aGroups(aShapeIndex) = aShapeIndex;
+
+    ShapeFix_MapOfTShape aTShapes;
+    collectTShapes(aShapes(aShapeIndex), aTShapes);
+    for (ShapeFix_MapOfTShape::Iterator aTShapeIter(aTShapes); aTShapeIter.More();
+         aTShapeIter.Next())
+    {
+      if (const Standard_Integer* anOwner = anOwners.Seek(aTShapeIter.Key()))
+      {
+        const Standard_Integer aGroup1 = findGroup(aGroups, *anOwner);
+        const Standard_Integer aGroup2 = findGroup(aGroups, aShapeIndex);
+        aGroups(Max(aGroup1, aGroup2)) = Min(aGroup1, aGroup2);
+      }
+      else
+      {
+        anOwners.Bind(aTShapeIter.Key(), aShapeIndex);
+      }
+    }
+  }
+
+  // distribute groups among parts processed by threads;
+  // the number of parts exceeds the number of threads to balance the load
+  NCollection_DataMap<Standard_Integer, Standard_Integer> aGroupParts;
+  NCollection_Vector<ShapeFix_ShapePart>                  aParts;
+  const Standard_Integer                                  aNbPartsMax = 4 * aNbThreads;
+  Standard_Integer                                        aNbGroups   = 0;
+  for (aShapeIndex = 0; aShapeIndex < aNbShapes; ++aShapeIndex)
+  {
+    const Standard_Integer aGroup = findGroup(aGroups, aShapeIndex);
+    Standard_Integer*      aPart  = aGroupParts.ChangeSeek(aGroup);
+    if (aPart == NULL)
+    {
+      aPart = aGroupParts.Bound(aGroup, aNbGroups % aNbPartsMax);
+      if (aNbGroups++ < aNbPartsMax)
+      {
+        aParts.Append(ShapeFix_ShapePart());
+      }
+    }
+    aParts.ChangeValue(*aPart).Shapes.Append(aShapeIndex);
+  }
+  if (aNbGroups < 2)
+  {
+    return Standard_False;
+  }
+
+  // each part is fixed by its own tools with its own context
+  for (NCollection_Vector<ShapeFix_ShapePart>::Iterator aPartIter(aParts); aPartIter.More();
+       aPartIter.Next())
+  {
+    Handle(ShapeBuild_ReShape) aContext = new ShapeBuild_ReShape;
+    aContext->ModeConsiderLocation()    = Context()->ModeConsiderLocation();
+    aContext->Append(*Context());
+
+    ShapeFix_ShapePart& aPart = aPartIter.ChangeValue();
+    aPart.Tool                = copyTools();
+    aPart.Tool->SetContext(aContext);
+    aPart.Tool->FixSolidTool()->SetContext(aContext);
+    aPart.Tool->FixShellTool()->SetContext(aContext);
+    aPart.Tool->FixFaceTool()->SetContext(aContext);
+    aPart.Tool->FixWireTool()->SetContext(aContext);
+    aPart.Tool->FixEdgeTool()->SetContext(aContext);
+  }
+
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aNbShapes - 1);
+  for (aShapeIndex = 0; aShapeIndex < aNbShapes; ++aShapeIndex)
+  {
+    aRanges(aShapeIndex) = thePS.Next();
+  }
+
+  OSD_Parallel::For(0, aParts.Length(), [&](const Standard_Integer thePartIndex) {
+    ShapeFix_ShapePart& aPart = aParts.ChangeValue(thePartIndex);
+    for (NCollection_Vector<Standard_Integer>::Iterator anIter(aPart.Shapes); anIter.More();
+         anIter.Next())
+    {
+      Message_ProgressRange& aRange = aRanges.ChangeValue(anIter.Value());
+      if (aRange.UserBreak())
+      {
+        break;
+      }
+      aPart.Tool->myShape = aShapes(anIter.Value());
+      if (aPart.Tool->Perform(aRange))
+      {
+        aPart.Status = Standard_True;
+      }
+    }
+  });
+
+  // collect modifications
+  for (NCollection_Vector<ShapeFix_ShapePart>::Iterator aPartIter(aParts); aPartIter.More();
+       aPartIter.Next())
+  {
+    const ShapeFix_ShapePart& aPart = aPartIter.Value();
+    Context()->Append(*aPart.Tool->Context());
+    for (TopTools_MapOfShape::Iterator aShapeIter(aPart.Tool->myMapFixingShape); aShapeIter.More();
+         aShapeIter.Next())
+    {
+      myMapFixingShape.Add(aShapeIter.Key());
+    }
+    myStatus |= aPart.Tool->myStatus;
+    if (aPart.Status)
+    {
+      theStatus = Standard_True;
+    }
+  }
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Handle(ShapeFix_Shape) ShapeFix_Shape::copyTools() const
+{
+  // tools are copied with all modes, while auxiliary analyzers keeping the state are created anew
+  const Handle(ShapeFix_Edge)&                 anEdgeTool = FixEdgeTool();
+  Handle(ShapeConstruct_ProjectCurveOnSurface) aProjector =
+    new ShapeConstruct_ProjectCurveOnSurface;
+  aProjector->BuildCurveMode()      = anEdgeTool->Projector()->BuildCurveMode();
+  aProjector->AdjustOverDegenMode() = anEdgeTool->Projector()->AdjustOverDegenMode();
+
+  Handle(ShapeFix_Edge) anEdgeCopy = new ShapeFix_Edge(*anEdgeTool);
+  anEdgeCopy->myProjector          = aProjector;
+
+  Handle(ShapeFix_Wire) aWireCopy = new ShapeFix_Wire(*FixWireTool());
+  aWireCopy->myFixEdge            = anEdgeCopy;
+  aWireCopy->myAnalyzer           = new ShapeAnalysis_Wire;
+
+  Handle(ShapeFix_Face) aFaceCopy = new ShapeFix_Face(*FixFaceTool());
+  aFaceCopy->myFixWire            = aWireCopy;
+  aFaceCopy->mySurf.Nullify();
+
+  Handle(ShapeFix_Shell) aShellCopy = new ShapeFix_Shell(*FixShellTool());
+  aShellCopy->myFixFace             = aFaceCopy;
+
+  Handle(ShapeFix_Solid) aSolidCopy = new ShapeFix_Solid(*myFixSolid);
+  aSolidCopy->myFixShell            = aShellCopy;
+
+  Handle(ShapeFix_Shape) aCopy = new ShapeFix_Shape(*this);
+  aCopy->myFixSolid            = aSolidCopy;
+  aCopy->myMapFixingShape.Clear();
+  aCopy->myRunParallel = Standard_False;
+  return aCopy;
+}
+
+//=================================================================================================
+
 void ShapeFix_Shape::SameParameter(const TopoDS_Shape&          sh,
                                    const Standard_Boolean       enforce,
                                    const Message_ProgressRange& theProgress)
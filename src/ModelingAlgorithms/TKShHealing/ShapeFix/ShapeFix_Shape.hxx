@@ -27,6 +27,7 @@
 #include <ShapeExtend_Status.hxx>
 #include <Message_ProgressRange.hxx>
 
+class Message_ProgressScope;
 class ShapeFix_Solid;
 class ShapeFix_Shell;
 class ShapeFix_Face;
@@ -129,6 +130,18 @@ public:
   //! after performing all fixes
   Standard_Integer& FixVertexTolMode();
 
+  //! Sets the flag to fix sub-shapes of compound in parallel threads, by default False.
+  //! Sub-shapes sharing some topology (vertices, edges, faces, ...) are fixed within the same
+  //! thread, while fixes on whole shape (same parameterization, tolerances of vertices)
+  //! are performed sequentially after all.
+  //! Only the direct children of a compound (or compsolid) are distributed among threads,
+  //! so a single solid, shell or face is always fixed sequentially.
+  //! Message registrator, if defined, should accept messages from parallel threads.
+  void SetRunParallel(const Standard_Boolean theIsParallel);
+
+  //! Returns the flag to fix sub-shapes of compound in parallel threads.
+  Standard_Boolean RunParallel() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shape, ShapeFix_Root)
 
 protected:
@@ -151,8 +164,19 @@ protected:
   Standard_Integer       myFixVertexPositionMode;
   Standard_Integer       myFixVertexTolMode;
   Standard_Integer       myStatus;
+  Standard_Boolean       myRunParallel;
 
 private:
+  //! Fixes sub-shapes of the compound in parallel threads
+  //! splitting them into groups not sharing any topology.
+  //! Returns FALSE if there is nothing to process in parallel;
+  //! otherwise, sets theStatus to TRUE if some sub-shape has been fixed.
+  Standard_Boolean fixParallel(const TopoDS_Shape&    theShape,
+                               Message_ProgressScope& thePS,
+                               Standard_Boolean&      theStatus);
+
+  //! Returns the copy of this tool (including all sub-tools) with the same modes and parameters.
+  Handle(ShapeFix_Shape) copyTools() const;
 };
 
 #include <ShapeFix_Shape.lxx>
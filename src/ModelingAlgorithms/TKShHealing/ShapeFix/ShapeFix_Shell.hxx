@@ -39,6 +39,7 @@ DEFINE_STANDARD_HANDLE(ShapeFix_Shell, ShapeFix_Root)
 //! Fixing orientation of faces in shell
 class ShapeFix_Shell : public ShapeFix_Root
 {
+  friend class ShapeFix_Shape;
 
 public:
   //! Empty constructor
@@ -41,6 +41,7 @@ DEFINE_STANDARD_HANDLE(ShapeFix_Solid, ShapeFix_Root)
 //! orients them in order to have a valid solid with finite volume
 class ShapeFix_Solid : public ShapeFix_Root
 {
+  friend class ShapeFix_Shape;
 
 public:
   //! Empty constructor;
@@ -88,6 +88,7 @@ DEFINE_STANDARD_HANDLE(ShapeFix_Wire, ShapeFix_Root)
 //! by loading already filled ShapeAnalisis_Wire with method Load
 class ShapeFix_Wire : public ShapeFix_Root
 {
+  friend class ShapeFix_Shape;
 
 public:
   //! Empty Constructor, creates clear object with default flags
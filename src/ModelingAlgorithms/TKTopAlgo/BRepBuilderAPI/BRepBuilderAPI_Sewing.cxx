@@ -74,6 +74,7 @@
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_UBTreeFiller.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
@@ -100,6 +101,7 @@
 #include <TopoDS_Shell.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
+#include <TopTools_Array1OfShape.hxx>
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
@@ -1908,6 +1910,7 @@ void BRepBuilderAPI_Sewing::Init(const Standard_Real    tolerance,
   // myCuttingFloatingEdgesMode = Standard_False; //gka
   mySameParameterMode  = Standard_True;
   myLocalToleranceMode = Standard_False;
+  myRunParallel        = Standard_False;
   mySewedShape.Nullify();
   // Load empty shape
   Load(TopoDS_Shape());
@@ -2336,6 +2339,38 @@ void BRepBuilderAPI_Sewing::Dump() const
   std::cout << " " << std::endl;
 }
 
+//=======================================================================
+// function : IsSmallEdge
+// purpose  : internal use (static)
+//            Evaluates compactness of the 3d curve of edge
+//=======================================================================
+
+static Standard_Boolean IsSmallEdge(const TopoDS_Edge& theEdge, const Standard_Real theMinTol)
+{
+  Standard_Real      first, last;
+  Handle(Geom_Curve) c3d = BRep_Tool::Curve(theEdge, first, last);
+  if (c3d.IsNull())
+  {
+#ifdef OCCT_DEBUG
+    std::cout << "Warning: Possibly small edge can be sewed: No 3D curve" << std::endl;
+#endif
+    return Standard_False;
+  }
+
+  // Evaluate curve compactness
+  const Standard_Integer npt = 5;
+  gp_Pnt                 cp((c3d->Value(first).XYZ() + c3d->Value(last).XYZ()) * 0.5);
+  Standard_Real          dist, maxdist = 0.0;
+  Standard_Real          delta = (last - first) / (npt - 1);
+  for (Standard_Integer idx = 0; idx < npt; idx++)
+  {
+    dist = cp.Distance(c3d->Value(first + idx * delta));
+    if (maxdist < dist)
+      maxdist = dist;
+  }
+  return (2. * maxdist <= theMinTol);
+}
+
 //=======================================================================
 // function : FaceAnalysis
 // purpose  : Remove
@@ -2359,7 +2394,37 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Message_ProgressRange& theProgres
   TopTools_MapOfShape                       SmallEdges;
   TopTools_IndexedDataMapOfShapeListOfShape GluedVertices;
   Standard_Integer                          i = 1;
-  Message_ProgressScope aPS(theProgress, "Shape analysis", myOldShapes.Extent());
+  Message_ProgressScope                     aPSOuter(theProgress, "Shape analysis", 2);
+
+  // Check edges for smallness in advance, as the check does not depend on other edges
+  TopTools_IndexedMapOfShape anEdges;
+  for (i = 1; i <= myOldShapes.Extent(); i++)
+    TopExp::MapShapes(myOldShapes(i), TopAbs_EDGE, anEdges);
+  TColStd_Array1OfBoolean aSmallFlags(0, anEdges.Extent());
+  aSmallFlags.Init(Standard_False);
+  {
+    Message_ProgressScope aPSEdges(aPSOuter.Next(), NULL, anEdges.Extent());
+    // each edge gets its own range to check the user break inside the parallel loop
+    NCollection_Array1<Message_ProgressRange> aRanges(0, anEdges.Extent());
+    for (i = 1; i <= anEdges.Extent(); i++)
+      aRanges(i) = aPSEdges.Next();
+    OSD_Parallel::For(
+      1,
+      anEdges.Extent() + 1,
+      [&](const Standard_Integer theIndex) {
+        Message_ProgressScope anEdgePS(aRanges(theIndex), NULL, 1);
+        if (!anEdgePS.More())
+          return;
+        const TopoDS_Edge& anEdge = TopoDS::Edge(anEdges(theIndex));
+        if (!BRep_Tool::Degenerated(anEdge))
+          aSmallFlags(theIndex) = IsSmallEdge(anEdge, MinTolerance());
+      },
+      !myRunParallel);
+  }
+  if (!aPSOuter.More())
+    return;
+
+  Message_ProgressScope aPS(aPSOuter.Next(), NULL, myOldShapes.Extent());
   for (i = 1; i <= myOldShapes.Extent() && aPS.More(); i++, aPS.Next())
   {
     for (TopExp_Explorer fexp(myOldShapes(i), TopAbs_FACE); fexp.More(); fexp.Next())
@@ -2413,41 +2478,8 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Message_ProgressRange& theProgres
           {
 
             // Check for small edge
-            Standard_Real      first, last;
-            Handle(Geom_Curve) c3d = BRep_Tool::Curve(edge, first, last);
-            if (c3d.IsNull())
-            {
-#ifdef OCCT_DEBUG
-              std::cout << "Warning: Possibly small edge can be sewed: No 3D curve" << std::endl;
-#endif
-            }
-            else
-            {
-              // Evaluate curve compactness
-              const Standard_Integer npt = 5;
-              gp_Pnt                 cp((c3d->Value(first).XYZ() + c3d->Value(last).XYZ()) * 0.5);
-              Standard_Real          dist, maxdist = 0.0;
-              Standard_Real          delta = (last - first) / (npt - 1);
-              for (Standard_Integer idx = 0; idx < npt; idx++)
-              {
-                dist = cp.Distance(c3d->Value(first + idx * delta));
-                if (maxdist < dist)
-                  maxdist = dist;
-              }
-              isSmall = (2. * maxdist <= MinTolerance());
-              /*try {
-            GeomAdaptor_Curve cAdapt(c3d);
-            Standard_Real length = GCPnts_AbscissaPoint::Length(cAdapt,first,last);
-            isSmall = (length <= MinTolerance());
-              }
-              catch (Standard_Failure) {
-    #ifdef OCCT_DEBUG
-            std::cout << "Warning: Possibly small edge can be sewed: ";
-            Standard_Failure::Caught()->Print(std::cout); std::cout << std::endl;
-    #endif
-              }*/
-            }
-
+            const Standard_Integer anEdgeIndex = anEdges.FindIndex(edge);
+            isSmall = anEdgeIndex ? aSmallFlags(anEdgeIndex) : IsSmallEdge(edge, MinTolerance());
             if (isSmall)
             {
 
@@ -2976,11 +3008,13 @@ static Standard_Integer IsMergedVertices(const TopoDS_Shape& face1,
   return Status;
 }
 
-static Standard_Boolean GlueVertices(TopTools_IndexedDataMapOfShapeShape&             aVertexNode,
-                                     TopTools_DataMapOfShapeListOfShape&              aNodeEdges,
-                                     const TopTools_IndexedDataMapOfShapeListOfShape& aBoundFaces,
-                                     const Standard_Real                              Tolerance,
-                                     const Message_ProgressRange&                     theProgress)
+static Standard_Boolean GlueVertices(
+  TopTools_IndexedDataMapOfShapeShape&             aVertexNode,
+  TopTools_DataMapOfShapeListOfShape&              aNodeEdges,
+  const TopTools_IndexedDataMapOfShapeListOfShape& aBoundFaces,
+  const Standard_Real                              Tolerance,
+  const Standard_Boolean                           theToRunParallel,
+  const Message_ProgressRange&                     theProgress)
 {
   // Create map of node -> vertices
   TopTools_IndexedDataMapOfShapeListOfShape     NodeVertices;
@@ -3009,171 +3043,197 @@ static Standard_Boolean GlueVertices(TopTools_IndexedDataMapOfShapeShape&
 #ifdef OCCT_DEBUG
   std::cout << "Glueing " << nbNodes << " nodes..." << std::endl;
 #endif
-  // Merge nearest nodes
-  TopTools_IndexedDataMapOfShapeShape NodeNearestNode;
-  Message_ProgressScope               aPS(theProgress, "Glueing nodes", nbNodes, Standard_True);
-  for (Standard_Integer i = 1; i <= nbNodes && aPS.More(); i++, aPS.Next())
+  // Find near nodes; the cell filter is not used concurrently.
+  // The progress of a node is advanced by the check of its merging conditions.
+  Message_ProgressScope aPS(theProgress, "Glueing nodes", nbNodes, Standard_True);
+
+  NCollection_Array1<TColStd_ListOfInteger> aNearIndices(1, Max(nbNodes, 1));
+  NCollection_Array1<Message_ProgressRange> aNodeRanges(1, Max(nbNodes, 1));
+  Standard_Integer                          aNbInspected = 0;
+  while (aNbInspected < nbNodes && aPS.More())
   {
-    const TopoDS_Vertex& node1 = TopoDS::Vertex(NodeVertices.FindKey(i));
-    // Find near nodes
-    gp_Pnt pt1 = BRep_Tool::Pnt(node1);
+    const TopoDS_Vertex& node1 = TopoDS::Vertex(NodeVertices.FindKey(++aNbInspected));
+    gp_Pnt               pt1   = BRep_Tool::Pnt(node1);
     anInspector.SetCurrent(pt1.XYZ());
     gp_XYZ aPntMin = anInspector.Shift(pt1.XYZ(), -Tolerance);
     gp_XYZ aPntMax = anInspector.Shift(pt1.XYZ(), Tolerance);
     aFilter.Inspect(aPntMin, aPntMax, anInspector);
-    if (anInspector.ResInd().IsEmpty())
-      continue;
-    // Retrieve list of edges for the first node
-    const TopTools_ListOfShape& ledges1 = aNodeEdges(node1);
-    // Explore list of near nodes and fill the sequence of glued nodes
-    TopTools_SequenceOfShape SeqNodes;
-    TopTools_ListOfShape     listNodesSameEdge;
-    // gp_Pnt pt1 = BRep_Tool::Pnt(node1);
-    TColStd_ListIteratorOfListOfInteger iter1(anInspector.ResInd());
-    for (; iter1.More(); iter1.Next())
-    {
-      const TopoDS_Vertex& node2 = TopoDS::Vertex(NodeVertices.FindKey(iter1.Value()));
-      if (node1 == node2)
-        continue;
-      // Retrieve list of edges for the second node
-      const TopTools_ListOfShape& ledges2 = aNodeEdges(node2);
-      // Check merging condition for the pair of nodes
-      Standard_Integer Status = 0, isSameEdge = Standard_False;
-      // Explore edges of the first node
-      TopTools_ListIteratorOfListOfShape Ie1(ledges1);
-      for (; Ie1.More() && !Status && !isSameEdge; Ie1.Next())
+    aNearIndices(aNbInspected) = anInspector.ResInd();
+    anInspector.ClearResList();
+    aNodeRanges(aNbInspected) = aPS.Next();
+  }
+
+  // Check merging conditions for near nodes, each node is processed independently
+  TopTools_Array1OfShape aNearestNodes(1, Max(nbNodes, 1));
+  OSD_Parallel::For(
+    1,
+    aNbInspected + 1,
+    [&](const Standard_Integer theNodeIndex) {
+      Message_ProgressScope aNodePS(aNodeRanges(theNodeIndex), NULL, 1);
+      if (aNearIndices(theNodeIndex).IsEmpty() || !aNodePS.More())
+        return;
+      const TopoDS_Vertex& node1 = TopoDS::Vertex(NodeVertices.FindKey(theNodeIndex));
+      gp_Pnt               pt1   = BRep_Tool::Pnt(node1);
+      // Retrieve list of edges for the first node
+      const TopTools_ListOfShape& ledges1 = aNodeEdges.Find(node1);
+      // Explore list of near nodes and fill the sequence of glued nodes
+      TopTools_SequenceOfShape            SeqNodes;
+      TopTools_ListOfShape                listNodesSameEdge;
+      TColStd_ListIteratorOfListOfInteger iter1(aNearIndices(theNodeIndex));
+      for (; iter1.More(); iter1.Next())
       {
-        const TopoDS_Shape& e1 = Ie1.Value();
-        // Obtain real vertex from edge
-        TopoDS_Shape v1 = node1;
-        { // szv: Use brackets to destroy local variables
-          TopoDS_Vertex ov1, ov2;
-          TopExp::Vertices(TopoDS::Edge(e1), ov1, ov2);
-          if (aVertexNode.Contains(ov1))
-          {
-            if (node1.IsSame(aVertexNode.FindFromKey(ov1)))
-              v1 = ov1;
-          }
-          if (aVertexNode.Contains(ov2))
-          {
-            if (node1.IsSame(aVertexNode.FindFromKey(ov2)))
-              v1 = ov2;
-          }
-        }
-        // Create map of faces for e1
-        TopTools_MapOfShape         Faces1;
-        const TopTools_ListOfShape& lfac1 = aBoundFaces.FindFromKey(e1);
-        if (lfac1.Extent())
-        {
-          TopTools_ListIteratorOfListOfShape itf(lfac1);
-          for (; itf.More(); itf.Next())
-            if (!itf.Value().IsNull())
-              Faces1.Add(itf.Value());
-        }
-        // Explore edges of the second node
-        TopTools_ListIteratorOfListOfShape Ie2(ledges2);
-        for (; Ie2.More() && !Status && !isSameEdge; Ie2.Next())
+        const TopoDS_Vertex& node2 = TopoDS::Vertex(NodeVertices.FindKey(iter1.Value()));
+        if (node1 == node2)
+          continue;
+        // Retrieve list of edges for the second node
+        const TopTools_ListOfShape& ledges2 = aNodeEdges.Find(node2);
+        // Check merging condition for the pair of nodes
+        Standard_Integer Status = 0, isSameEdge = Standard_False;
+        // Explore edges of the first node
+        TopTools_ListIteratorOfListOfShape Ie1(ledges1);
+        for (; Ie1.More() && !Status && !isSameEdge; Ie1.Next())
         {
-          const TopoDS_Shape& e2 = Ie2.Value();
+          const TopoDS_Shape& e1 = Ie1.Value();
           // Obtain real vertex from edge
-          TopoDS_Shape v2 = node2;
+          TopoDS_Shape v1 = node1;
           { // szv: Use brackets to destroy local variables
             TopoDS_Vertex ov1, ov2;
-            TopExp::Vertices(TopoDS::Edge(e2), ov1, ov2);
+            TopExp::Vertices(TopoDS::Edge(e1), ov1, ov2);
             if (aVertexNode.Contains(ov1))
             {
-              if (node2.IsSame(aVertexNode.FindFromKey(ov1)))
-                v2 = ov1;
+              if (node1.IsSame(aVertexNode.FindFromKey(ov1)))
+                v1 = ov1;
             }
             if (aVertexNode.Contains(ov2))
             {
-              if (node2.IsSame(aVertexNode.FindFromKey(ov2)))
-                v2 = ov2;
+              if (node1.IsSame(aVertexNode.FindFromKey(ov2)))
+                v1 = ov2;
             }
           }
-          // Explore faces for e2
-          const TopTools_ListOfShape& lfac2 = aBoundFaces.FindFromKey(e2);
-          if (lfac2.Extent())
+          // Create map of faces for e1
+          TopTools_MapOfShape         Faces1;
+          const TopTools_ListOfShape& lfac1 = aBoundFaces.FindFromKey(e1);
+          if (lfac1.Extent())
+          {
+            TopTools_ListIteratorOfListOfShape itf(lfac1);
+            for (; itf.More(); itf.Next())
+              if (!itf.Value().IsNull())
+                Faces1.Add(itf.Value());
+          }
+          // Explore edges of the second node
+          TopTools_ListIteratorOfListOfShape Ie2(ledges2);
+          for (; Ie2.More() && !Status && !isSameEdge; Ie2.Next())
           {
-            TopTools_ListIteratorOfListOfShape itf(lfac2);
-            for (; itf.More() && !Status && !isSameEdge; itf.Next())
+            const TopoDS_Shape& e2 = Ie2.Value();
+            // Obtain real vertex from edge
+            TopoDS_Shape v2 = node2;
+            { // szv: Use brackets to destroy local variables
+              TopoDS_Vertex ov1, ov2;
+              TopExp::Vertices(TopoDS::Edge(e2), ov1, ov2);
+              if (aVertexNode.Contains(ov1))
+              {
+                if (node2.IsSame(aVertexNode.FindFromKey(ov1)))
+                  v2 = ov1;
+              }
+              if (aVertexNode.Contains(ov2))
+              {
+                if (node2.IsSame(aVertexNode.FindFromKey(ov2)))
+                  v2 = ov2;
+              }
+            }
+            // Explore faces for e2
+            const TopTools_ListOfShape& lfac2 = aBoundFaces.FindFromKey(e2);
+            if (lfac2.Extent())
             {
-              // Check merging conditions for the same face
-              if (Faces1.Contains(itf.Value()))
+              TopTools_ListIteratorOfListOfShape itf(lfac2);
+              for (; itf.More() && !Status && !isSameEdge; itf.Next())
               {
-                Standard_Integer stat = IsMergedVertices(itf.Value(), e1, e2, v1, v2);
-                if (stat == 1)
-                  isSameEdge = Standard_True;
-                else
-                  Status = stat;
+                // Check merging conditions for the same face
+                if (Faces1.Contains(itf.Value()))
+                {
+                  Standard_Integer stat = IsMergedVertices(itf.Value(), e1, e2, v1, v2);
+                  if (stat == 1)
+                    isSameEdge = Standard_True;
+                  else
+                    Status = stat;
+                }
               }
             }
-          }
-          else if (Faces1.IsEmpty() && e1 == e2)
-          {
-            Standard_Integer stat = IsMergedVertices(TopoDS_Face(), e1, e1, v1, v2);
-            if (stat == 1)
-              isSameEdge = Standard_True;
-            else
-              Status = stat;
-            break;
+            else if (Faces1.IsEmpty() && e1 == e2)
+            {
+              Standard_Integer stat = IsMergedVertices(TopoDS_Face(), e1, e1, v1, v2);
+              if (stat == 1)
+                isSameEdge = Standard_True;
+              else
+                Status = stat;
+              break;
+            }
           }
         }
-      }
-      if (Status)
-        continue;
-      if (isSameEdge)
-        listNodesSameEdge.Append(node2);
-      // Append near node to the sequence
-      gp_Pnt        pt2  = BRep_Tool::Pnt(node2);
-      Standard_Real dist = pt1.Distance(pt2);
-      if (dist < Tolerance)
-      {
-        Standard_Boolean isIns = Standard_False;
-        for (Standard_Integer kk = 1; kk <= SeqNodes.Length() && !isIns; kk++)
+        if (Status)
+          continue;
+        if (isSameEdge)
+          listNodesSameEdge.Append(node2);
+        // Append near node to the sequence
+        gp_Pnt        pt2  = BRep_Tool::Pnt(node2);
+        Standard_Real dist = pt1.Distance(pt2);
+        if (dist < Tolerance)
         {
-          gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(SeqNodes.Value(kk)));
-          if (dist < pt1.Distance(pt))
+          Standard_Boolean isIns = Standard_False;
+          for (Standard_Integer kk = 1; kk <= SeqNodes.Length() && !isIns; kk++)
           {
-            SeqNodes.InsertBefore(kk, node2);
-            isIns = Standard_True;
+            gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(SeqNodes.Value(kk)));
+            if (dist < pt1.Distance(pt))
+            {
+              SeqNodes.InsertBefore(kk, node2);
+              isIns = Standard_True;
+            }
           }
+          if (!isIns)
+            SeqNodes.Append(node2);
         }
-        if (!isIns)
-          SeqNodes.Append(node2);
       }
-    }
-    if (SeqNodes.Length())
-    {
-      // Remove nodes near to some other from the same edge
-      if (listNodesSameEdge.Extent())
+      if (SeqNodes.Length())
       {
-        TopTools_ListIteratorOfListOfShape lInt(listNodesSameEdge);
-        for (; lInt.More(); lInt.Next())
+        // Remove nodes near to some other from the same edge
+        if (listNodesSameEdge.Extent())
         {
-          const TopoDS_Vertex& n2 = TopoDS::Vertex(lInt.Value());
-          gp_Pnt               p2 = BRep_Tool::Pnt(n2);
-          for (Standard_Integer k = 1; k <= SeqNodes.Length();)
+          TopTools_ListIteratorOfListOfShape lInt(listNodesSameEdge);
+          for (; lInt.More(); lInt.Next())
           {
-            const TopoDS_Vertex& n1 = TopoDS::Vertex(SeqNodes.Value(k));
-            if (n1 != n2)
+            const TopoDS_Vertex& n2 = TopoDS::Vertex(lInt.Value());
+            gp_Pnt               p2 = BRep_Tool::Pnt(n2);
+            for (Standard_Integer k = 1; k <= SeqNodes.Length();)
             {
-              gp_Pnt p1 = BRep_Tool::Pnt(n1);
-              if (p2.Distance(p1) >= pt1.Distance(p1))
+              const TopoDS_Vertex& n1 = TopoDS::Vertex(SeqNodes.Value(k));
+              if (n1 != n2)
               {
-                k++;
-                continue;
+                gp_Pnt p1 = BRep_Tool::Pnt(n1);
+                if (p2.Distance(p1) >= pt1.Distance(p1))
+                {
+                  k++;
+                  continue;
+                }
               }
+              SeqNodes.Remove(k);
             }
-            SeqNodes.Remove(k);
           }
         }
+        // Keep nearest node if at least one exists
+        if (SeqNodes.Length())
+          aNearestNodes(theNodeIndex) = SeqNodes.First();
       }
-      // Bind nearest node if at least one exists
-      if (SeqNodes.Length())
-        NodeNearestNode.Add(node1, SeqNodes.First());
-    }
-    anInspector.ClearResList();
+    },
+    !theToRunParallel);
+  if (!aPS.More())
+    return Standard_False;
+
+  // Merge nearest nodes
+  TopTools_IndexedDataMapOfShapeShape NodeNearestNode;
+  for (Standard_Integer i = 1; i <= aNbInspected; i++)
+  {
+    if (!aNearestNodes(i).IsNull())
+      NodeNearestNode.Add(NodeVertices.FindKey(i), aNearestNodes(i));
   }
 
   // Create new nodes for chained nearest nodes
@@ -3214,7 +3274,12 @@ void BRepBuilderAPI_Sewing::VerticesAssembling(const Message_ProgressRange& theP
 #ifdef OCCT_DEBUG
       std::cout << "Assemble " << nbVert << " vertices on faces..." << std::endl;
 #endif
-      while (GlueVertices(myVertexNode, myNodeSections, myBoundFaces, myTolerance, aPS.Next()))
+      while (GlueVertices(myVertexNode,
+                          myNodeSections,
+                          myBoundFaces,
+                          myTolerance,
+                          myRunParallel,
+                          aPS.Next()))
         ;
     }
     if (!aPS.More())
@@ -3224,7 +3289,12 @@ void BRepBuilderAPI_Sewing::VerticesAssembling(const Message_ProgressRange& theP
 #ifdef OCCT_DEBUG
       std::cout << "Assemble " << nbVertFree << " vertices on floating edges..." << std::endl;
 #endif
-      while (GlueVertices(myVertexNodeFree, myNodeSections, myBoundFaces, myTolerance, aPS.Next()))
+      while (GlueVertices(myVertexNodeFree,
+                          myNodeSections,
+                          myBoundFaces,
+                          myTolerance,
+                          myRunParallel,
+                          aPS.Next()))
         ;
     }
   }
@@ -3970,6 +4040,20 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape&
   return success;
 }
 
+namespace
+{
+//! Vertices projected on the bound to be cut.
+struct BRepBuilderAPI_BoundProjection
+{
+  TopoDS_Vertex              V1;         //!< first vertex of the bound
+  TopoDS_Vertex              V2;         //!< last vertex of the bound
+  TopTools_IndexedMapOfShape Vertices;   //!< candidate vertices
+  TColStd_Array1OfReal       Distances;  //!< distances to projections, negative if not projected
+  TColStd_Array1OfReal       Parameters; //!< parameters of projections on the bound curve
+  TColgp_Array1OfPnt         Points;     //!< projection points
+};
+} // namespace
+
 //=======================================================================
 // function : Cutting
 // purpose  : Modifies :
@@ -3987,7 +4071,6 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   Standard_Real                                       eps = myTolerance * 0.5;
   BRepBuilderAPI_BndBoxTree                           aTree;
   NCollection_UBTreeFiller<Standard_Integer, Bnd_Box> aTreeFiller(aTree);
-  BRepBuilderAPI_BndBoxTreeSelector                   aSelector;
   for (i = 1; i <= nbVertices; i++)
   {
     gp_Pnt  pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
@@ -3998,49 +4081,55 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   }
   aTreeFiller.Fill();
 
-  Handle(Geom_Curve) c3d;
-  TopLoc_Location    loc;
-  Standard_Real      first, last;
-  // Iterate on all boundaries
-  Standard_Integer                                    nbBounds = myBoundFaces.Extent();
-  Message_ProgressScope                               aPS(theProgress, "Cutting bounds", nbBounds);
-  TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next())
-  {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent())
-      continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull())
-      continue;
-    if (!loc.IsIdentity())
-    {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
-    // Create cutting sections
-    TopTools_ListOfShape listSections;
-    { // szv: Use brackets to destroy local variables
-      // Obtain candidate vertices
-      TopoDS_Vertex              V1, V2;
-      TopTools_IndexedMapOfShape CandidateVertices;
+  // Project candidate vertices on all boundaries;
+  // bounds are processed independently, the maps are modified afterwards in the order of bounds
+  Standard_Integer      nbBounds = myBoundFaces.Extent();
+  Message_ProgressScope aPSOuter(theProgress, "Cutting bounds", 2);
+  Message_ProgressScope aPSProj(aPSOuter.Next(), NULL, nbBounds);
+
+  NCollection_Array1<Message_ProgressRange>          aRanges(1, Max(nbBounds, 1));
+  NCollection_Array1<BRepBuilderAPI_BoundProjection> aProjections(1, Max(nbBounds, 1));
+  for (i = 1; i <= nbBounds; i++)
+    aRanges(i) = aPSProj.Next();
+  OSD_Parallel::For(
+    1,
+    nbBounds + 1,
+    [&](const Standard_Integer theBoundIndex) {
+      Message_ProgressScope aBoundPS(aRanges(theBoundIndex), NULL, 1);
+      if (!aBoundPS.More())
+        return;
+      const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(theBoundIndex));
+      // Do not cut floating edges
+      if (!myBoundFaces.FindFromIndex(theBoundIndex).Extent())
+        return;
+      // Obtain bound curve
+      TopLoc_Location    loc;
+      Standard_Real      first, last;
+      Handle(Geom_Curve) c3d = BRep_Tool::Curve(bound, loc, first, last);
+      if (c3d.IsNull())
+        return;
+      if (!loc.IsIdentity())
+      {
+        c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
+        c3d->Transform(loc.Transformation());
+      }
+      BRepBuilderAPI_BoundProjection& aProj = aProjections(theBoundIndex);
       { // szv: Use brackets to destroy local variables
         // Create bounding box around curve
         Bnd_Box           aGlobalBox;
         GeomAdaptor_Curve adptC(c3d, first, last);
         BndLib_Add3dCurve::Add(adptC, myTolerance, aGlobalBox);
         // Sort vertices to find candidates
+        BRepBuilderAPI_BndBoxTreeSelector aSelector;
         aSelector.SetCurrent(aGlobalBox);
         aTree.Select(aSelector);
         // Skip bound if no node is in the boundind box
         if (!aSelector.ResInd().Extent())
-          continue;
+          return;
         // Retrieve bound nodes
-        TopExp::Vertices(bound, V1, V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
+        TopExp::Vertices(bound, aProj.V1, aProj.V2);
+        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(aProj.V1);
+        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(aProj.V2);
         // Fill map of candidate vertices
         TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
         for (; itl.More(); itl.Next())
@@ -4050,30 +4139,52 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
           if (!Node.IsSame(Node1) && !Node.IsSame(Node2))
           {
             TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
+            aProj.Vertices.Add(vertex);
           }
         }
-        aSelector.ClearResList();
       }
-      Standard_Integer nbCandidates = CandidateVertices.Extent();
+      Standard_Integer nbCandidates = aProj.Vertices.Extent();
       if (!nbCandidates)
-        continue;
+        return;
       // Project vertices on curve
-      TColStd_Array1OfReal arrPara(1, nbCandidates), arrDist(1, nbCandidates);
-      TColgp_Array1OfPnt   arrPnt(1, nbCandidates), arrProj(1, nbCandidates);
+      TColgp_Array1OfPnt arrPnt(1, nbCandidates);
+      aProj.Distances.Resize(1, nbCandidates, Standard_False);
+      aProj.Parameters.Resize(1, nbCandidates, Standard_False);
+      aProj.Points.Resize(1, nbCandidates, Standard_False);
       for (Standard_Integer j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt, c3d, first, last, arrDist, arrPara, arrProj, Standard_True);
+        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(aProj.Vertices(j)));
+      ProjectPointsOnCurve(arrPnt,
+                           c3d,
+                           first,
+                           last,
+                           aProj.Distances,
+                           aProj.Parameters,
+                           aProj.Points,
+                           Standard_True);
+    },
+    !myRunParallel);
+
+  // Iterate on all boundaries
+  Message_ProgressScope aPS(aPSOuter.Next(), NULL, nbBounds);
+  for (i = 1; i <= nbBounds && aPS.More(); i++, aPS.Next())
+  {
+    const TopoDS_Edge&                    bound = TopoDS::Edge(myBoundFaces.FindKey(i));
+    const BRepBuilderAPI_BoundProjection& aProj = aProjections(i);
+    if (aProj.Vertices.IsEmpty())
+      continue;
+    // Create cutting sections
+    TopTools_ListOfShape listSections;
+    { // szv: Use brackets to destroy local variables
       // Create cutting nodes
       TopTools_SequenceOfShape seqNode;
       TColStd_SequenceOfReal   seqPara;
-      CreateCuttingNodes(CandidateVertices,
+      CreateCuttingNodes(aProj.Vertices,
                          bound,
-                         V1,
-                         V2,
-                         arrDist,
-                         arrPara,
-                         arrProj,
+                         aProj.V1,
+                         aProj.V2,
+                         aProj.Distances,
+                         aProj.Parameters,
+                         aProj.Points,
                          seqNode,
                          seqPara);
       if (!seqPara.Length())
@@ -240,6 +240,14 @@ public:
   //! INTERNAL FUNCTIONS ---
   Standard_Boolean NonManifoldMode() const;
 
+  //! Sets mode for running analysis of faces, gluing of vertices
+  //! and cutting of bounds in parallel threads. By default - false.
+  //! The result does not depend on this mode.
+  void SetRunParallel(const Standard_Boolean theIsParallel);
+
+  //! Returns mode for running in parallel threads.
+  Standard_Boolean RunParallel() const;
+
   DEFINE_STANDARD_RTTIEXT(BRepBuilderAPI_Sewing, Standard_Transient)
 
 protected:
@@ -417,6 +425,7 @@ private:
   Standard_Boolean    myFloatingEdgesMode;
   Standard_Boolean    mySameParameterMode;
   Standard_Boolean    myLocalToleranceMode;
+  Standard_Boolean    myRunParallel;
   Standard_Real       myMinTolerance;
   Standard_Real       myMaxTolerance;
   TopTools_MapOfShape myMergedEdges;
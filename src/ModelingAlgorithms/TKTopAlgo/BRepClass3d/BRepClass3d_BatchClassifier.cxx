@@ -0,0 +1,610 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepClass3d_BatchClassifier.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BRepLib.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_DimensionError.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! Directions of the rays; not aligned with axes to avoid passing through the edges
+//! of the meshes of axis-aligned boxes and planes.
+const Standard_Real THE_RAY_DIRECTIONS[][3] = {{0.6279, 0.4618, 0.6266},
+                                               {-0.3213, 0.8819, 0.3451},
+                                               {0.5127, -0.2339, -0.8262},
+                                               {-0.7541, -0.5186, 0.4031}};
+
+//! Relative tolerance of barycentric coordinates of the ray hit
+//! below which the hit is considered to be on the triangle edge.
+const Standard_Real THE_BARYCENTRIC_TOL = 1.0e-7;
+
+//! Ratio of the distance to the node and its radius above which
+//! the triangles of the node are approximated by dipole in winding number computation.
+const Standard_Real THE_WINDING_FAR_FIELD_RATIO = 2.5;
+
+//! Maximal deviation of winding number from 0 or 1 accepted as a reliable result.
+const Standard_Real THE_WINDING_TOL = 0.25;
+
+//! Returns the solid angle of the triangle as seen from the origin,
+//! positive if the triangle is oriented counterclockwise as seen from the origin.
+Standard_Real solidAngle(const BVH_Vec3d& theA, const BVH_Vec3d& theB, const BVH_Vec3d& theC)
+{
+  const Standard_Real aLenA = theA.Modulus();
+  const Standard_Real aLenB = theB.Modulus();
+  const Standard_Real aLenC = theC.Modulus();
+  const Standard_Real aNum  = theA.Dot(BVH_Vec3d::Cross(theB, theC));
+  const Standard_Real aDen  = aLenA * aLenB * aLenC + theA.Dot(theB) * aLenC
+                             + theB.Dot(theC) * aLenA + theC.Dot(theA) * aLenB;
+  return 2.0 * std::atan2(aNum, aDen);
+}
+} // namespace
+
+//! Tool searching any triangle within the boundary band around the point.
+class BRepClass3d_BatchClassifier_BandTool
+    : public BVH_Traverse<Standard_Real,
+                          3,
+                          BVH_BoxSet<Standard_Real, 3, Standard_Integer>,
+                          Standard_Real>
+{
+public:
+  //! Constructor.
+  BRepClass3d_BatchClassifier_BandTool(const NCollection_Vector<BVH_Vec3d>& theNodes,
+                                       const NCollection_Vector<BVH_Vec3i>& theTriangles,
+                                       const BVH_Vec3d&                     thePoint,
+                                       const Standard_Real                  theBand)
+      : myNodes(theNodes),
+        myTriangles(theTriangles),
+        myPoint(thePoint),
+        mySqBand(theBand * theBand),
+        myIsNear(Standard_False)
+  {
+  }
+
+  //! Returns TRUE if the triangle within the band has been found.
+  Standard_Boolean IsNear() const { return myIsNear; }
+
+  //! Rejects the node farther than the band.
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& theCornerMin,
+                                      const BVH_Vec3d& theCornerMax,
+                                      Standard_Real&   theMetric) const Standard_OVERRIDE
+  {
+    theMetric =
+      BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance(myPoint, theCornerMin, theCornerMax);
+    return theMetric > mySqBand;
+  }
+
+  //! Checks the distance to the triangle.
+  virtual Standard_Boolean Accept(const Standard_Integer theIndex,
+                                  const Standard_Real&) Standard_OVERRIDE
+  {
+    const BVH_Vec3i& aTri = myTriangles.Value(myBVHSet->Element(theIndex));
+    myIsNear = BVH_Tools<Standard_Real, 3>::PointTriangleSquareDistance(myPoint,
+                                                                         myNodes.Value(aTri.x()),
+                                                                         myNodes.Value(aTri.y()),
+                                                                         myNodes.Value(aTri.z()))
+               <= mySqBand;
+    return myIsNear;
+  }
+
+  //! Stops the traverse when the triangle has been found.
+  virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsNear; }
+
+private:
+  const NCollection_Vector<BVH_Vec3d>& myNodes;
+  const NCollection_Vector<BVH_Vec3i>& myTriangles;
+  BVH_Vec3d                            myPoint;
+  Standard_Real                        mySqBand;
+  Standard_Boolean                     myIsNear;
+};
+
+//! Tool counting the crossings of the ray with the mesh.
+class BRepClass3d_BatchClassifier_RayTool
+    : public BVH_Traverse<Standard_Real,
+                          3,
+                          BVH_BoxSet<Standard_Real, 3, Standard_Integer>,
+                          Standard_Real>
+{
+public:
+  //! Constructor.
+  BRepClass3d_BatchClassifier_RayTool(const NCollection_Vector<BVH_Vec3d>& theNodes,
+                                      const NCollection_Vector<BVH_Vec3i>& theTriangles,
+                                      const BVH_Vec3d&                     theOrigin,
+                                      const BVH_Vec3d&                     theDirection)
+      : myNodes(theNodes),
+        myTriangles(theTriangles),
+        myOrigin(theOrigin),
+        myDirection(theDirection),
+        myNbHits(0),
+        myIsAmbiguous(Standard_False)
+  {
+  }
+
+  //! Returns the number of crossings.
+  Standard_Integer NbHits() const { return myNbHits; }
+
+  //! Returns TRUE if the ray passes near the edge of the mesh or along the triangle.
+  Standard_Boolean IsAmbiguous() const { return myIsAmbiguous; }
+
+  //! Rejects the node missed by the ray.
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& theCornerMin,
+                                      const BVH_Vec3d& theCornerMax,
+                                      Standard_Real&   theMetric) const Standard_OVERRIDE
+  {
+    Standard_Real aTimeLeave = 0.0;
+    return !BVH_Tools<Standard_Real, 3>::RayBoxIntersection(myOrigin,
+                                                             myDirection,
+                                                             theCornerMin,
+                                                             theCornerMax,
+                                                             theMetric,
+                                                             aTimeLeave)
+           || aTimeLeave < 0.0;
+  }
+
+  //! Intersects the ray with the triangle.
+  virtual Standard_Boolean Accept(const Standard_Integer theIndex,
+                                  const Standard_Real&) Standard_OVERRIDE
+  {
+    const BVH_Vec3i&    aTri    = myTriangles.Value(myBVHSet->Element(theIndex));
+    const BVH_Vec3d&    aNode0  = myNodes.Value(aTri.x());
+    const BVH_Vec3d     anEdge1 = myNodes.Value(aTri.y()) - aNode0;
+    const BVH_Vec3d     anEdge2 = myNodes.Value(aTri.z()) - aNode0;
+    const BVH_Vec3d     aVecP   = BVH_Vec3d::Cross(myDirection, anEdge2);
+    const BVH_Vec3d     aVecT   = myOrigin - aNode0;
+    const Standard_Real aDet    = anEdge1.Dot(aVecP);
+    if (Abs(aDet) <= THE_BARYCENTRIC_TOL * anEdge1.Modulus() * anEdge2.Modulus())
+    {
+      // the ray is parallel to the triangle, it is ambiguous only if lies in its plane
+      const BVH_Vec3d aNormal = BVH_Vec3d::Cross(anEdge1, anEdge2);
+      if (Abs(aVecT.Dot(aNormal)) <= THE_BARYCENTRIC_TOL * aNormal.Modulus() * aVecT.Modulus())
+      {
+        myIsAmbiguous = Standard_True;
+      }
+      return Standard_False;
+    }
+
+    const Standard_Real aU    = aVecT.Dot(aVecP) / aDet;
+    const BVH_Vec3d     aVecQ = BVH_Vec3d::Cross(aVecT, anEdge1);
+    const Standard_Real aV    = myDirection.Dot(aVecQ) / aDet;
+    const Standard_Real aTime = anEdge2.Dot(aVecQ) / aDet;
+    if (aTime <= 0.0 || aU < -THE_BARYCENTRIC_TOL || aV < -THE_BARYCENTRIC_TOL
+        || aU + aV > 1.0 + THE_BARYCENTRIC_TOL)
+    {
+      return Standard_False;
+    }
+    if (aU <= THE_BARYCENTRIC_TOL || aV <= THE_BARYCENTRIC_TOL
+        || aU + aV >= 1.0 - THE_BARYCENTRIC_TOL)
+    {
+      // the ray passes through the edge or vertex shared by several triangles
+      myIsAmbiguous = Standard_True;
+      return Standard_False;
+    }
+    ++myNbHits;
+    return Standard_True;
+  }
+
+  //! Stops the traverse when the result is ambiguous.
+  virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsAmbiguous; }
+
+private:
+  const NCollection_Vector<BVH_Vec3d>& myNodes;
+  const NCollection_Vector<BVH_Vec3i>& myTriangles;
+  BVH_Vec3d                            myOrigin;
+  BVH_Vec3d                            myDirection;
+  Standard_Integer                     myNbHits;
+  Standard_Boolean                     myIsAmbiguous;
+};
+
+//! Functor classifying the points in parallel threads.
+class BRepClass3d_BatchClassifier::ClassificationFunctor
+{
+public:
+  //! Constructor.
+  ClassificationFunctor(const BRepClass3d_BatchClassifier& theClassifier,
+                        const OSD_ThreadPool::Launcher&    theLauncher,
+                        const TColgp_Array1OfPnt&          thePoints,
+                        NCollection_Array1<TopAbs_State>&  theStates)
+      : myClassifier(theClassifier),
+        myPoints(thePoints),
+        myStates(theStates),
+        myExactClassifiers(theLauncher.LowerThreadIndex(), theLauncher.UpperThreadIndex())
+  {
+    //
+  }
+
+  //! Classifies the point with the specified index.
+  void operator()(int theThreadIndex, int thePntIndex) const
+  {
+    myStates.ChangeValue(myStates.Lower() + thePntIndex - myPoints.Lower()) =
+      myClassifier.classify(myPoints.Value(thePntIndex),
+                            myExactClassifiers.ChangeValue(theThreadIndex));
+  }
+
+private:
+  const BRepClass3d_BatchClassifier&                                        myClassifier;
+  const TColgp_Array1OfPnt&                                                 myPoints;
+  NCollection_Array1<TopAbs_State>&                                         myStates;
+  mutable NCollection_Array1<std::unique_ptr<BRepClass3d_SolidClassifier>> myExactClassifiers;
+};
+
+//=================================================================================================
+
+BRepClass3d_BatchClassifier::BRepClass3d_BatchClassifier()
+    : myTolerance(Precision::Confusion()),
+      myBand(Precision::Confusion()),
+      myMethod(Method_RayCasting)
+{
+}
+
+//=================================================================================================
+
+BRepClass3d_BatchClassifier::BRepClass3d_BatchClassifier(const TopoDS_Shape& theSolid,
+                                                         const Standard_Real theTolerance)
+    : myTolerance(theTolerance),
+      myBand(theTolerance),
+      myMethod(Method_RayCasting)
+{
+  Load(theSolid, theTolerance);
+}
+
+//=================================================================================================
+
+BRepClass3d_BatchClassifier::~BRepClass3d_BatchClassifier() {}
+
+//=================================================================================================
+
+void BRepClass3d_BatchClassifier::Load(const TopoDS_Shape& theSolid,
+                                       const Standard_Real theTolerance)
+{
+  myShape     = theSolid;
+  myTolerance = theTolerance;
+  myBand      = theTolerance;
+  myNodes.Clear();
+  myTriangles.Clear();
+  myTriangleSet.Nullify();
+  myBox.SetVoid();
+  myClassifier.reset();
+  if (theSolid.IsNull())
+  {
+    return;
+  }
+
+  Standard_Real    aMaxDeflection = 0.0;
+  Standard_Boolean isMeshed       = Standard_True;
+  for (TopExp_Explorer aFaceIter(theSolid, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aFaceIter.Current());
+    if (aFace.Orientation() != TopAbs_FORWARD && aFace.Orientation() != TopAbs_REVERSED)
+    {
+      // internal and external faces do not bound the solid
+      continue;
+    }
+
+    TopLoc_Location                   aLoc;
+    const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation(aFace, aLoc);
+    if (aTris.IsNull() || aTris->NbTriangles() == 0)
+    {
+      isMeshed = Standard_False;
+      break;
+    }
+    TopLoc_Location aSurfLoc;
+    if (aTris->Deflection() <= 0.0 && !BRep_Tool::Surface(aFace, aSurfLoc).IsNull())
+    {
+      // deflection of imported meshes is unknown, evaluate it against the surface
+      if (!aTris->HasUVNodes())
+      {
+        isMeshed = Standard_False;
+        break;
+      }
+      BRepLib::UpdateDeflection(aFace);
+    }
+    aMaxDeflection = Max(aMaxDeflection, aTris->Deflection());
+
+    const Standard_Integer aNodeOffset = myNodes.Length() - 1;
+    const gp_Trsf&         aTrsf       = aLoc.Transformation();
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aTris->NbNodes(); ++aNodeIter)
+    {
+      gp_Pnt aNode = aTris->Node(aNodeIter);
+      if (!aLoc.IsIdentity())
+      {
+        aNode.Transform(aTrsf);
+      }
+      myNodes.Append(BVH_Vec3d(aNode.X(), aNode.Y(), aNode.Z()));
+      myBox.Add(aNode);
+    }
+
+    // triangles are oriented by the surface normal, reversed faces bound the solid from outside
+    const Standard_Boolean isReversed = aFace.Orientation() == TopAbs_REVERSED;
+    for (Standard_Integer aTriIter = 1; aTriIter <= aTris->NbTriangles(); ++aTriIter)
+    {
+      Standard_Integer aN1 = 0, aN2 = 0, aN3 = 0;
+      aTris->Triangle(aTriIter).Get(aN1, aN2, aN3);
+      if (aN1 == aN2 || aN2 == aN3 || aN3 == aN1)
+      {
+        continue;
+      }
+      if (isReversed)
+      {
+        std::swap(aN2, aN3);
+      }
+      myTriangles.Append(BVH_Vec3i(aN1 + aNodeOffset, aN2 + aNodeOffset, aN3 + aNodeOffset));
+    }
+  }
+
+  Standard_Real aTolerance = Max(theTolerance, BRep_Tool::MaxTolerance(theSolid, TopAbs_FACE));
+  aTolerance               = Max(aTolerance, BRep_Tool::MaxTolerance(theSolid, TopAbs_EDGE));
+  aTolerance               = Max(aTolerance, BRep_Tool::MaxTolerance(theSolid, TopAbs_VERTEX));
+  myBand                   = aMaxDeflection + aTolerance;
+  if (!isMeshed || myTriangles.IsEmpty())
+  {
+    myNodes.Clear();
+    myTriangles.Clear();
+    myBox.SetVoid();
+    return;
+  }
+  myBox.Enlarge(myBand);
+
+  myTriangleSet = new TriangleSet();
+  myTriangleSet->SetSize(myTriangles.Length());
+  for (Standard_Integer aTriIter = 0; aTriIter < myTriangles.Length(); ++aTriIter)
+  {
+    const BVH_Vec3i&          aTri = myTriangles.Value(aTriIter);
+    BVH_Box<Standard_Real, 3> aBox(myNodes.Value(aTri.x()));
+    aBox.Add(myNodes.Value(aTri.y()));
+    aBox.Add(myNodes.Value(aTri.z()));
+    myTriangleSet->Add(aTriIter, aBox);
+  }
+  myTriangleSet->Build();
+
+  myDipoles.Resize(0, myTriangleSet->BVH()->Length() - 1, Standard_False);
+  computeDipoles(0);
+}
+
+//=================================================================================================
+
+TopAbs_State BRepClass3d_BatchClassifier::Perform(const gp_Pnt& thePoint)
+{
+  if (myShape.IsNull())
+  {
+    return TopAbs_UNKNOWN;
+  }
+  return classify(thePoint, myClassifier);
+}
+
+//=================================================================================================
+
+void BRepClass3d_BatchClassifier::Perform(const TColgp_Array1OfPnt&         thePoints,
+                                          NCollection_Array1<TopAbs_State>& theStates,
+                                          const Standard_Boolean            theToRunParallel)
+{
+  Standard_DimensionError_Raise_if(theStates.Length() != thePoints.Length(),
+                                   "BRepClass3d_BatchClassifier::Perform(), wrong size of array");
+  if (myShape.IsNull())
+  {
+    theStates.Init(TopAbs_UNKNOWN);
+    return;
+  }
+  if (thePoints.IsEmpty())
+  {
+    return;
+  }
+
+  if (!theToRunParallel)
+  {
+    for (Standard_Integer aPntIter = 0; aPntIter < thePoints.Length(); ++aPntIter)
+    {
+      theStates.ChangeValue(theStates.Lower() + aPntIter) =
+        classify(thePoints.Value(thePoints.Lower() + aPntIter), myClassifier);
+    }
+    return;
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const int aNbThreads = std::min(thePoints.Length(), aThreadPool->NbDefaultThreadsToLaunch());
+  OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+  ClassificationFunctor    aFunctor(*this, aLauncher, thePoints, theStates);
+  aLauncher.Perform(thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+}
+
+//=================================================================================================
+
+Standard_Real BRepClass3d_BatchClassifier::WindingNumber(const gp_Pnt& thePoint) const
+{
+  if (myTriangleSet.IsNull())
+  {
+    return 0.0;
+  }
+
+  const BVH_Vec3d aPoint(thePoint.X(), thePoint.Y(), thePoint.Z());
+  const opencascade::handle<BVH_Tree<Standard_Real, 3>>& aTree = myTriangleSet->BVH();
+
+  Standard_Real    aWinding = 0.0;
+  Standard_Integer aStack[BVH_Constants_MaxTreeDepth];
+  Standard_Integer aHead = -1;
+  Standard_Integer aNode = 0;
+  for (;;)
+  {
+    const Dipole&       aDipole = myDipoles.Value(aNode);
+    const BVH_Vec3d     aDelta  = aDipole.Center - aPoint;
+    const Standard_Real aDist   = aDelta.Modulus();
+    if (aDist > THE_WINDING_FAR_FIELD_RATIO * aDipole.Radius)
+    {
+      aWinding += aDelta.Dot(aDipole.Normal) / (aDist * aDist * aDist);
+    }
+    else if (aTree->IsOuter(aNode))
+    {
+      for (Standard_Integer anElemIter = aTree->BegPrimitive(aNode);
+           anElemIter <= aTree->EndPrimitive(aNode);
+           ++anElemIter)
+      {
+        const BVH_Vec3i& aTri = myTriangles.Value(myTriangleSet->Element(anElemIter));
+        aWinding += solidAngle(myNodes.Value(aTri.x()) - aPoint,
+                               myNodes.Value(aTri.y()) - aPoint,
+                               myNodes.Value(aTri.z()) - aPoint);
+      }
+    }
+    else
+    {
+      aStack[++aHead] = aTree->Child<1>(aNode);
+      aNode           = aTree->Child<0>(aNode);
+      continue;
+    }
+
+    if (aHead < 0)
+    {
+      break;
+    }
+    aNode = aStack[aHead--];
+  }
+  return aWinding / (4.0 * M_PI);
+}
+
+//=================================================================================================
+
+TopAbs_State BRepClass3d_BatchClassifier::classify(
+  const gp_Pnt&                                 thePoint,
+  std::unique_ptr<BRepClass3d_SolidClassifier>& theExact) const
+{
+  if (!myTriangleSet.IsNull())
+  {
+    if (myBox.IsOut(thePoint))
+    {
+      return TopAbs_OUT;
+    }
+
+    const BVH_Vec3d aPoint(thePoint.X(), thePoint.Y(), thePoint.Z());
+    if (!isNearBoundary(aPoint))
+    {
+      TopAbs_State aState = TopAbs_UNKNOWN;
+      if (myMethod == Method_WindingNumber)
+      {
+        const Standard_Real aWinding = WindingNumber(thePoint);
+        if (Abs(aWinding - 1.0) < THE_WINDING_TOL)
+        {
+          aState = TopAbs_IN;
+        }
+        else if (Abs(aWinding) < THE_WINDING_TOL)
+        {
+          aState = TopAbs_OUT;
+        }
+      }
+      else
+      {
+        aState = rayCastingState(aPoint);
+      }
+      if (aState != TopAbs_UNKNOWN)
+      {
+        return aState;
+      }
+    }
+  }
+
+  if (!theExact)
+  {
+    theExact.reset(new BRepClass3d_SolidClassifier(myShape));
+  }
+  theExact->Perform(thePoint, myTolerance);
+  return theExact->State();
+}
+
+//=================================================================================================
+
+TopAbs_State BRepClass3d_BatchClassifier::rayCastingState(const BVH_Vec3d& thePoint) const
+{
+  for (const Standard_Real(&aDir)[3] : THE_RAY_DIRECTIONS)
+  {
+    BRepClass3d_BatchClassifier_RayTool aRayTool(myNodes,
+                                                 myTriangles,
+                                                 thePoint,
+                                                 BVH_Vec3d(aDir[0], aDir[1], aDir[2]));
+    aRayTool.SetBVHSet(myTriangleSet.get());
+    aRayTool.Select();
+    if (!aRayTool.IsAmbiguous())
+    {
+      return aRayTool.NbHits() % 2 == 1 ? TopAbs_IN : TopAbs_OUT;
+    }
+  }
+  return TopAbs_UNKNOWN;
+}
+
+//=================================================================================================
+
+Standard_Boolean BRepClass3d_BatchClassifier::isNearBoundary(const BVH_Vec3d& thePoint) const
+{
+  BRepClass3d_BatchClassifier_BandTool aBandTool(myNodes, myTriangles, thePoint, myBand);
+  aBandTool.SetBVHSet(myTriangleSet.get());
+  aBandTool.Select();
+  return aBandTool.IsNear();
+}
+
+//=================================================================================================
+
+Standard_Real BRepClass3d_BatchClassifier::computeDipoles(const Standard_Integer theNode)
+{
+  const opencascade::handle<BVH_Tree<Standard_Real, 3>>& aTree = myTriangleSet->BVH();
+
+  Standard_Real anArea = 0.0;
+  BVH_Vec3d     aCenter(0.0, 0.0, 0.0);
+  BVH_Vec3d     aNormal(0.0, 0.0, 0.0);
+  if (aTree->IsOuter(theNode))
+  {
+    for (Standard_Integer anElemIter = aTree->BegPrimitive(theNode);
+         anElemIter <= aTree->EndPrimitive(theNode);
+         ++anElemIter)
+    {
+      const BVH_Vec3i&    aTri     = myTriangles.Value(myTriangleSet->Element(anElemIter));
+      const BVH_Vec3d&    aNode0   = myNodes.Value(aTri.x());
+      const BVH_Vec3d&    aNode1   = myNodes.Value(aTri.y());
+      const BVH_Vec3d&    aNode2   = myNodes.Value(aTri.z());
+      const BVH_Vec3d     aCross   = BVH_Vec3d::Cross(aNode1 - aNode0, aNode2 - aNode0);
+      const Standard_Real aTriArea = 0.5 * aCross.Modulus();
+      anArea += aTriArea;
+      aCenter += (aNode0 + aNode1 + aNode2) * (aTriArea / 3.0);
+      aNormal += aCross * 0.5;
+    }
+  }
+  else
+  {
+    const Standard_Integer aChildren[2] = {aTree->Child<0>(theNode), aTree->Child<1>(theNode)};
+    for (const Standard_Integer aChild : aChildren)
+    {
+      const Standard_Real aChildArea = computeDipoles(aChild);
+      anArea += aChildArea;
+      aCenter += myDipoles.Value(aChild).Center * aChildArea;
+      aNormal += myDipoles.Value(aChild).Normal;
+    }
+  }
+
+  const BVH_Vec3d& aMin    = aTree->MinPoint(theNode);
+  const BVH_Vec3d& aMax    = aTree->MaxPoint(theNode);
+  Dipole&          aDipole = myDipoles.ChangeValue(theNode);
+  aDipole.Center           = anArea > 0.0 ? aCenter / anArea : (aMin + aMax) * 0.5;
+  aDipole.Normal           = aNormal;
+
+  // radius of the sphere around center enclosing the node box
+  const BVH_Vec3d aFar =
+    (aDipole.Center - aMin).cwiseAbs().cwiseMax((aMax - aDipole.Center).cwiseAbs());
+  aDipole.Radius = aFar.Modulus();
+  return anArea;
+}
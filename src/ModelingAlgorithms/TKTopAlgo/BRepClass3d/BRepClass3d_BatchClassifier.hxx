@@ -0,0 +1,161 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BRepClass3d_BatchClassifier_HeaderFile
+#define _BRepClass3d_BatchClassifier_HeaderFile
+
+#include <Bnd_Box.hxx>
+#include <BVH_BoxSet.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <memory>
+
+class BRepClass3d_SolidClassifier;
+
+//! Classifies large sets of points against the solid.
+//!
+//! The classifier is built once per solid from the triangulation stored in its faces
+//! (the solid should be meshed beforehand, e.g. by BRepMesh_IncrementalMesh):
+//! the triangles are organized into BVH tree, and the point is classified either by
+//! ray casting (parity of the number of crossings of the ray with the mesh) or by
+//! generalized winding number of the mesh (computed with far field approximation
+//! of the BVH nodes by dipoles), see SetMethod().
+//!
+//! The triangulation approximates the surfaces only within its deflection, so the points
+//! closer to the mesh than the deflection plus tolerance (see BoundaryBand()), as well as
+//! the points with ambiguous mesh-based result (ray passing through mesh edges,
+//! winding number far from 0 and 1), are classified by the exact BRepClass3d_SolidClassifier.
+//! The zero deflection of the triangulation of the face having a surface (e.g. imported mesh)
+//! is evaluated by BRepLib::UpdateDeflection(); the exact classifier is used for all points
+//! if any face of the solid has no triangulation or its deflection cannot be evaluated
+//! (triangulation without UV nodes).
+//!
+//! The arrays of points are classified in parallel threads,
+//! each thread using its own instance of exact classifier.
+class BRepClass3d_BatchClassifier
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Classification method used for the points far from the boundary.
+  enum Method
+  {
+    Method_RayCasting,   //!< parity of the ray crossings with the mesh
+    Method_WindingNumber //!< generalized winding number of the mesh
+  };
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT BRepClass3d_BatchClassifier();
+
+  //! Constructor loading the solid, see Load().
+  Standard_EXPORT BRepClass3d_BatchClassifier(
+    const TopoDS_Shape& theSolid,
+    const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Destructor.
+  Standard_EXPORT ~BRepClass3d_BatchClassifier();
+
+  //! Loads the solid and builds the acceleration structure from the triangulation of its faces.
+  //! The zero deflection of the triangulations is updated, see BRepLib::UpdateDeflection().
+  //! @param[in] theSolid  solid to classify the points against
+  //! @param[in] theTolerance  tolerance of classification of the points ON the boundary
+  Standard_EXPORT void Load(const TopoDS_Shape& theSolid,
+                            const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Returns the loaded solid.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns tolerance of classification.
+  Standard_Real Tolerance() const { return myTolerance; }
+
+  //! Returns TRUE if the triangulation is used for classification,
+  //! FALSE if the exact classifier is used for all points.
+  Standard_Boolean IsMeshUsed() const { return !myTriangleSet.IsNull(); }
+
+  //! Returns the distance to the mesh within which the points are classified
+  //! by the exact classifier: maximal deflection of triangulations plus tolerance.
+  Standard_Real BoundaryBand() const { return myBand; }
+
+  //! Returns the classification method; Method_RayCasting by default.
+  Method ClassificationMethod() const { return myMethod; }
+
+  //! Sets the classification method.
+  void SetMethod(const Method theMethod) { myMethod = theMethod; }
+
+  //! Classifies the point.
+  Standard_EXPORT TopAbs_State Perform(const gp_Pnt& thePoint);
+
+  //! Classifies the array of points.
+  //! @param[in] thePoints  points to classify
+  //! @param[out] theStates  states of the points, of the same size as thePoints
+  //! @param[in] theToRunParallel  flag to classify the points in parallel threads
+  //! Raises Standard_DimensionError if theStates has wrong size.
+  Standard_EXPORT void Perform(const TColgp_Array1OfPnt&         thePoints,
+                               NCollection_Array1<TopAbs_State>& theStates,
+                               const Standard_Boolean            theToRunParallel = Standard_True);
+
+  //! Computes the generalized winding number of the mesh at the point:
+  //! close to 1 inside the closed mesh and to 0 outside it.
+  //! Returns 0 if the mesh is not used.
+  Standard_EXPORT Standard_Real WindingNumber(const gp_Pnt& thePoint) const;
+
+private:
+  //! Set of triangles; element is the index of the triangle in myTriangles.
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> TriangleSet;
+
+  //! Far field approximation of the triangles of BVH node.
+  struct Dipole
+  {
+    BVH_Vec3d     Center; //!< area-weighted center of the triangles
+    BVH_Vec3d     Normal; //!< sum of area-weighted normals of the triangles
+    Standard_Real Radius; //!< radius of the sphere around center enclosing the triangles
+  };
+
+  //! Functor classifying the points in parallel threads.
+  class ClassificationFunctor;
+
+  //! Classifies the point using the given exact classifier, created on demand.
+  TopAbs_State classify(const gp_Pnt&                                 thePoint,
+                        std::unique_ptr<BRepClass3d_SolidClassifier>& theExact) const;
+
+  //! Classifies the point far from the mesh by ray casting;
+  //! returns TopAbs_UNKNOWN if all rays pass near the mesh edges.
+  TopAbs_State rayCastingState(const BVH_Vec3d& thePoint) const;
+
+  //! Returns TRUE if the point is closer to the mesh than the boundary band.
+  Standard_Boolean isNearBoundary(const BVH_Vec3d& thePoint) const;
+
+  //! Computes dipoles of the node and its children, returns the area of the node triangles.
+  Standard_Real computeDipoles(const Standard_Integer theNode);
+
+private:
+  TopoDS_Shape                                 myShape;
+  NCollection_Vector<BVH_Vec3d>                myNodes;
+  NCollection_Vector<BVH_Vec3i>                myTriangles;
+  opencascade::handle<TriangleSet>             myTriangleSet;
+  NCollection_Array1<Dipole>                   myDipoles;
+  Bnd_Box                                      myBox;
+  std::unique_ptr<BRepClass3d_SolidClassifier> myClassifier;
+  Standard_Real                                myTolerance;
+  Standard_Real                                myBand;
+  Method                                       myMethod;
+};
+
+#endif // _BRepClass3d_BatchClassifier_HeaderFile
@@ -4,6 +4,8 @@ set(OCCT_BRepClass3d_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_BRepClass3d_FILES
   BRepClass3d.cxx
   BRepClass3d.hxx
+  BRepClass3d_BatchClassifier.cxx
+  BRepClass3d_BatchClassifier.hxx
   BRepClass3d_BndBoxTree.hxx
   BRepClass3d_BndBoxTree.cxx
   BRepClass3d_DataMapIteratorOfMapOfInter.hxx
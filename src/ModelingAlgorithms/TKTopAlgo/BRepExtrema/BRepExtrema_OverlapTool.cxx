@@ -16,6 +16,7 @@
 #include <Precision.hxx>
 
 #include <BRepExtrema_OverlapTool.hxx>
+#include <BVH_BoxKernels.hxx>
 
 //=================================================================================================
 
@@ -666,6 +667,23 @@ Standard_Boolean BRepExtrema_OverlapTool::RejectNode(const BVH_Vec3d& theCornerM
 
 //=================================================================================================
 
+Standard_Integer BRepExtrema_OverlapTool::RejectNodes(const BVH_Vec3d*       theCornersMin1,
+                                                      const BVH_Vec3d*       theCornersMax1,
+                                                      const BVH_Vec3d*       theCornersMin2,
+                                                      const BVH_Vec3d*       theCornersMax2,
+                                                      const Standard_Integer theNbPairs,
+                                                      Standard_Real*) const
+{
+  return BVH_BoxKernels<Standard_Real, 3>::PairOutMask(theCornersMin1,
+                                                       theCornersMax1,
+                                                       theCornersMin2,
+                                                       theCornersMax2,
+                                                       theNbPairs,
+                                                       myTolerance);
+}
+
+//=================================================================================================
+
 Standard_Boolean BRepExtrema_OverlapTool::Accept(const Standard_Integer theTrgIdx1,
                                                  const Standard_Integer theTrgIdx2)
 {
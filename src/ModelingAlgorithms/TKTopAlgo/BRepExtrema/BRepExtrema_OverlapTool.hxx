@@ -89,6 +89,15 @@ public: //! @name Reject/Accept implementations
                                                       const BVH_Vec3d& theCornerMin2,
                                                       const BVH_Vec3d& theCornerMax2,
                                                       Standard_Real&) const Standard_OVERRIDE;
+
+  //! Defines the rules for rejection of several pairs of nodes at once
+  Standard_EXPORT virtual Standard_Integer RejectNodes(const BVH_Vec3d*       theCornersMin1,
+                                                       const BVH_Vec3d*       theCornersMax1,
+                                                       const BVH_Vec3d*       theCornersMin2,
+                                                       const BVH_Vec3d*       theCornersMax2,
+                                                       const Standard_Integer theNbPairs,
+                                                       Standard_Real*) const Standard_OVERRIDE;
+
   //! Defines the rules for leaf acceptance
   Standard_EXPORT virtual Standard_Boolean Accept(const Standard_Integer theLeaf1,
                                                   const Standard_Integer theLeaf2)
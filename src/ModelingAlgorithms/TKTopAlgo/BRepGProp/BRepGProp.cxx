@@ -27,6 +27,8 @@
 #include <BRep_Tool.hxx>
 #include <TopTools_MapOfShape.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 #ifdef OCCT_DEBUG
 static Standard_Integer AffichEps = 0;
@@ -113,93 +115,159 @@ void BRepGProp::LinearProperties(const TopoDS_Shape&    S,
   }
 }
 
-static Standard_Real surfaceProperties(const TopoDS_Shape&    S,
-                                       GProp_GProps&          Props,
-                                       const Standard_Real    Eps,
-                                       const Standard_Boolean SkipShared,
-                                       const Standard_Boolean UseTriangulation)
+namespace
 {
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real    ErrorMax = 0.0, Error;
-  TopExp_Explorer  ex;
-  gp_Pnt           P(roughBaryCenter(S));
-  BRepGProp_Sinert G;
-  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face      BF;
-  BRepGProp_Domain    BD;
-  TopTools_MapOfShape aFMap;
-  TopLoc_Location     aLocDummy;
+//! Face to be integrated and its computed properties.
+struct BRepGProp_FaceItem
+{
+  TopoDS_Face      Face;     //!< face to integrate
+  Standard_Boolean ToUseTri; //!< flag to integrate the triangulation instead of the surface
+  GProp_GProps     Props;    //!< computed properties of the face
+  Standard_Real    Error;    //!< reached relative error
+
+  BRepGProp_FaceItem()
+      : ToUseTri(Standard_False),
+        Error(0.0)
+  {
+  }
+};
 
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
+typedef NCollection_Vector<BRepGProp_FaceItem> BRepGProp_VectorOfFaceItem;
+
+//! Integrates the surface of the face by Gauss method.
+template <class Inert>
+static void integrateFace(const TopoDS_Face&  theFace,
+                          const gp_Pnt&       theLocation,
+                          const Standard_Real theEps,
+                          GProp_GProps&       theProps,
+                          Standard_Real&      theError)
+{
+  BRepGProp_Face aPropFace;
+  aPropFace.Load(theFace);
+  Inert anInert;
+  anInert.SetLocation(theLocation);
+  const Standard_Boolean isNatRestr = (theFace.NbChildren() == 0);
+  if (isNatRestr)
   {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    if (SkipShared && !aFMap.Add(F))
+    if (theEps < 1.0)
     {
-      continue;
+      anInert.Perform(aPropFace, theEps);
+      theError = anInert.GetEpsilon();
     }
-
-    Standard_Boolean NoSurf = Standard_False, NoTri = Standard_False;
+    else
     {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = Standard_True;
-      }
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = Standard_True;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
+      anInert.Perform(aPropFace);
     }
+  }
+  else
+  {
+    BRepGProp_Domain aPropDomain(theFace);
+    if (theEps < 1.0)
+    {
+      anInert.Perform(aPropFace, aPropDomain, theEps);
+      theError = anInert.GetEpsilon();
+    }
+    else
+    {
+      anInert.Perform(aPropFace, aPropDomain);
+    }
+  }
+  theProps = anInert;
+}
+
+//! Functor computing properties of faces in parallel threads.
+template <class Inert>
+class BRepGProp_FaceFunctor
+{
+public:
+  BRepGProp_FaceFunctor(BRepGProp_VectorOfFaceItem&                      theFaces,
+                        const gp_Pnt&                                    theLocation,
+                        const Standard_Real                              theEps,
+                        const BRepGProp_MeshProps::BRepGProp_MeshObjType theMeshType)
+      : myFaces(theFaces),
+        myLocation(theLocation),
+        myEps(theEps),
+        myMeshType(theMeshType)
+  {
+  }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
+  void operator()(const Standard_Integer theIndex) const
+  {
+    BRepGProp_FaceItem& anItem = myFaces.ChangeValue(theIndex);
+    if (anItem.ToUseTri)
     {
-      TopAbs_Orientation                anOri = F.Orientation();
-      const Handle(Poly_Triangulation)& aTri  = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
+      TopLoc_Location                   aLoc;
+      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(anItem.Face, aLoc);
+      BRepGProp_MeshProps               aMeshProps(myMeshType);
+      aMeshProps.SetLocation(myLocation);
+      aMeshProps.Perform(aTri, aLoc, anItem.Face.Orientation());
+      anItem.Props = aMeshProps;
     }
     else
     {
-      BF.Load(F);
-      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr)
-        BD.Init(F);
-      if (Eps < 1.0)
-      {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error)
-        {
-          ErrorMax = Error;
+      integrateFace<Inert>(anItem.Face, myLocation, myEps, anItem.Props, anItem.Error);
+    }
+  }
+
+private:
+  BRepGProp_VectorOfFaceItem&                myFaces;
+  gp_Pnt                                     myLocation;
+  Standard_Real                              myEps;
+  BRepGProp_MeshProps::BRepGProp_MeshObjType myMeshType;
+};
+
+//! Checks availability of the surface and the triangulation of the face.
+//! Returns FALSE if the face has no geometry at all.
+static Standard_Boolean checkFaceData(const TopoDS_Face&     theFace,
+                                      const Standard_Boolean theUseTriangulation,
+                                      Standard_Boolean&      theToUseTri)
+{
+  TopLoc_Location                   aLocDummy;
+  const Handle(Geom_Surface)&       aSurf  = BRep_Tool::Surface(theFace, aLocDummy);
+  const Handle(Poly_Triangulation)& aTri   = BRep_Tool::Triangulation(theFace, aLocDummy);
+  const Standard_Boolean            NoSurf = aSurf.IsNull();
+  const Standard_Boolean NoTri = aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0;
+  if (NoTri && NoSurf)
+  {
+    return Standard_False;
+  }
+  theToUseTri = (theUseTriangulation && !NoTri) || (NoSurf && !NoTri);
+  return Standard_True;
+}
+
+//! Computes properties of collected faces and adds them to the properties in order of faces,
+//! so that the result does not depend on the number of threads.
+//! Returns the maximal reached error.
+template <class Inert>
+static Standard_Real integrateFaces(BRepGProp_VectorOfFaceItem&                      theFaces,
+                                    const gp_Pnt&                                    theLocation,
+                                    const Standard_Real                              theEps,
+                                    const BRepGProp_MeshProps::BRepGProp_MeshObjType theMeshType,
+                                    const Standard_Boolean                           theIsParallel,
+                                    GProp_GProps&                                    theProps)
+{
+  BRepGProp_FaceFunctor<Inert> aFunctor(theFaces, theLocation, theEps, theMeshType);
+  OSD_Parallel::For(0, theFaces.Length(), aFunctor, !theIsParallel);
+
 #ifdef OCCT_DEBUG
-          iErrorMax = i;
+  Standard_Integer iErrorMax = 0;
 #endif
-        }
-      }
-      else
-      {
-        if (IsNatRestr)
-          G.Perform(BF);
-        else
-          G.Perform(BF, BD);
-      }
-      Props.Add(G);
+  Standard_Real ErrorMax = 0.0;
+  for (Standard_Integer i = 0; i < theFaces.Length(); ++i)
+  {
+    const BRepGProp_FaceItem& anItem = theFaces.Value(i);
+    theProps.Add(anItem.Props);
+    if (ErrorMax < anItem.Error)
+    {
+      ErrorMax = anItem.Error;
 #ifdef OCCT_DEBUG
-      if (AffichEps)
-        std::cout << "\n" << i << ":\tEpsArea = " << G.GetEpsilon();
+      iErrorMax = i + 1;
 #endif
     }
+#ifdef OCCT_DEBUG
+    if (AffichEps && !anItem.ToUseTri)
+      std::cout << "\n" << i + 1 << ":\tEps = " << anItem.Error;
+#endif
   }
 #ifdef OCCT_DEBUG
   if (AffichEps)
@@ -207,59 +275,116 @@ static Standard_Real surfaceProperties(const TopoDS_Shape&    S,
 #endif
   return ErrorMax;
 }
+} // namespace
+
+//=================================================================================================
+
+static Standard_Real surfaceProperties(const TopoDS_Shape&    S,
+                                       GProp_GProps&          Props,
+                                       const Standard_Real    Eps,
+                                       const Standard_Boolean SkipShared,
+                                       const Standard_Boolean UseTriangulation,
+                                       const Standard_Boolean theIsParallel)
+{
+  TopExp_Explorer            ex;
+  gp_Pnt                     P(roughBaryCenter(S));
+  TopTools_MapOfShape        aFMap;
+  BRepGProp_VectorOfFaceItem aFaces;
+  for (ex.Init(S, TopAbs_FACE); ex.More(); ex.Next())
+  {
+    const TopoDS_Face& F = TopoDS::Face(ex.Current());
+    if (SkipShared && !aFMap.Add(F))
+    {
+      continue;
+    }
+
+    BRepGProp_FaceItem anItem;
+    if (!checkFaceData(F, UseTriangulation, anItem.ToUseTri))
+    {
+      continue;
+    }
+    anItem.Face = F;
+    aFaces.Append(anItem);
+  }
+  return integrateFaces<BRepGProp_Sinert>(aFaces,
+                                          P,
+                                          Eps,
+                                          BRepGProp_MeshProps::Sinert,
+                                          theIsParallel,
+                                          Props);
+}
 
 void BRepGProp::SurfaceProperties(const TopoDS_Shape&    S,
                                   GProp_GProps&          Props,
                                   const Standard_Boolean SkipShared,
-                                  const Standard_Boolean UseTriangulation)
+                                  const Standard_Boolean UseTriangulation,
+                                  const Standard_Boolean theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S, Props, 1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S, Props, 1.0, SkipShared, UseTriangulation, theIsParallel);
 }
 
 Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape&    S,
                                            GProp_GProps&          Props,
                                            const Standard_Real    Eps,
-                                           const Standard_Boolean SkipShared)
+                                           const Standard_Boolean SkipShared,
+                                           const Standard_Boolean theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
-  Props                  = GProp_GProps(P);
-  Standard_Real ErrorMax = surfaceProperties(S, Props, Eps, SkipShared, Standard_False);
+  Props = GProp_GProps(P);
+  Standard_Real ErrorMax =
+    surfaceProperties(S, Props, Eps, SkipShared, Standard_False, theIsParallel);
   return ErrorMax;
 }
 
 //=================================================================================================
 
+void BRepGProp::SurfaceProperties(const TopTools_Array1OfShape&     theShapes,
+                                  NCollection_Array1<GProp_GProps>& theProps,
+                                  const Standard_Boolean            theSkipShared,
+                                  const Standard_Boolean            theUseTriangulation,
+                                  const Standard_Boolean            theIsParallel)
+{
+  if (theShapes.IsEmpty())
+  {
+    theProps = NCollection_Array1<GProp_GProps>();
+    return;
+  }
+
+  theProps.Resize(theShapes.Lower(), theShapes.Upper(), Standard_False);
+  OSD_Parallel::For(
+    theShapes.Lower(),
+    theShapes.Upper() + 1,
+    [&](const Standard_Integer theIndex) {
+      SurfaceProperties(theShapes.Value(theIndex),
+                        theProps.ChangeValue(theIndex),
+                        theSkipShared,
+                        theUseTriangulation,
+                        theIsParallel);
+    },
+    !theIsParallel);
+}
+
+//=================================================================================================
+
 static Standard_Real volumeProperties(const TopoDS_Shape&    S,
                                       GProp_GProps&          Props,
                                       const Standard_Real    Eps,
                                       const Standard_Boolean SkipShared,
-                                      const Standard_Boolean UseTriangulation)
+                                      const Standard_Boolean UseTriangulation,
+                                      const Standard_Boolean theIsParallel)
 {
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real    ErrorMax = 0.0, Error = 0.0;
-  TopExp_Explorer  ex;
-  gp_Pnt           P(roughBaryCenter(S));
-  BRepGProp_Vinert G;
-  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face      BF;
-  BRepGProp_Domain    BD;
-  TopTools_MapOfShape aFwdFMap;
-  TopTools_MapOfShape aRvsFMap;
-  TopLoc_Location     aLocDummy;
-
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
+  TopExp_Explorer            ex;
+  gp_Pnt                     P(roughBaryCenter(S));
+  TopTools_MapOfShape        aFwdFMap;
+  TopTools_MapOfShape        aRvsFMap;
+  BRepGProp_VectorOfFaceItem aFaces;
+  for (ex.Init(S, TopAbs_FACE); ex.More(); ex.Next())
   {
     const TopoDS_Face& F     = TopoDS::Face(ex.Current());
     TopAbs_Orientation anOri = F.Orientation();
@@ -276,77 +401,29 @@ static Standard_Real volumeProperties(const TopoDS_Shape&    S,
         continue;
       }
     }
-    Standard_Boolean NoSurf = Standard_False, NoTri = Standard_False;
-    {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = Standard_True;
-      }
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = Standard_True;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
-    }
 
-    if (isFwd || isRvs)
+    BRepGProp_FaceItem anItem;
+    if (!checkFaceData(F, UseTriangulation, anItem.ToUseTri) || (!isFwd && !isRvs))
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-        if (!IsNatRestr)
-          BD.Init(F);
-        if (Eps < 1.0)
-        {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error)
-          {
-            ErrorMax = Error;
-#ifdef OCCT_DEBUG
-            iErrorMax = i;
-#endif
-          }
-        }
-        else
-        {
-          if (IsNatRestr)
-            G.Perform(BF);
-          else
-            G.Perform(BF, BD);
-        }
-        Props.Add(G);
-#ifdef OCCT_DEBUG
-        if (AffichEps)
-          std::cout << "\n" << i << ":\tEpsVolume = " << G.GetEpsilon();
-#endif
-      }
+      continue;
     }
+    anItem.Face = F;
+    aFaces.Append(anItem);
   }
-#ifdef OCCT_DEBUG
-  if (AffichEps)
-    std::cout << "\n-----------------\n" << iErrorMax << ":\tMaxError = " << ErrorMax << "\n";
-#endif
-  return ErrorMax;
+  return integrateFaces<BRepGProp_Vinert>(aFaces,
+                                          P,
+                                          Eps,
+                                          BRepGProp_MeshProps::Vinert,
+                                          theIsParallel,
+                                          Props);
 }
 
 void BRepGProp::VolumeProperties(const TopoDS_Shape&    S,
                                  GProp_GProps&          Props,
                                  const Standard_Boolean OnlyClosed,
                                  const Standard_Boolean SkipShared,
-                                 const Standard_Boolean UseTriangulation)
+                                 const Standard_Boolean UseTriangulation,
+                                 const Standard_Boolean theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
@@ -364,11 +441,41 @@ void BRepGProp::VolumeProperties(const TopoDS_Shape&    S,
         continue;
       }
       if (BRep_Tool::IsClosed(Sh))
-        volumeProperties(Sh, Props, 1.0, SkipShared, UseTriangulation);
+        volumeProperties(Sh, Props, 1.0, SkipShared, UseTriangulation, theIsParallel);
     }
   }
   else
-    volumeProperties(S, Props, 1.0, SkipShared, UseTriangulation);
+    volumeProperties(S, Props, 1.0, SkipShared, UseTriangulation, theIsParallel);
+}
+
+//=================================================================================================
+
+void BRepGProp::VolumeProperties(const TopTools_Array1OfShape&     theShapes,
+                                 NCollection_Array1<GProp_GProps>& theProps,
+                                 const Standard_Boolean            theOnlyClosed,
+                                 const Standard_Boolean            theSkipShared,
+                                 const Standard_Boolean            theUseTriangulation,
+                                 const Standard_Boolean            theIsParallel)
+{
+  if (theShapes.IsEmpty())
+  {
+    theProps = NCollection_Array1<GProp_GProps>();
+    return;
+  }
+
+  theProps.Resize(theShapes.Lower(), theShapes.Upper(), Standard_False);
+  OSD_Parallel::For(
+    theShapes.Lower(),
+    theShapes.Upper() + 1,
+    [&](const Standard_Integer theIndex) {
+      VolumeProperties(theShapes.Value(theIndex),
+                       theProps.ChangeValue(theIndex),
+                       theOnlyClosed,
+                       theSkipShared,
+                       theUseTriangulation,
+                       theIsParallel);
+    },
+    !theIsParallel);
 }
 
 //=================================================================================================
@@ -377,7 +484,8 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape&    S,
                                           GProp_GProps&          Props,
                                           const Standard_Real    Eps,
                                           const Standard_Boolean OnlyClosed,
-                                          const Standard_Boolean SkipShared)
+                                          const Standard_Boolean SkipShared,
+                                          const Standard_Boolean theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
@@ -401,7 +509,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape&    S,
       }
       if (BRep_Tool::IsClosed(Sh))
       {
-        Error = volumeProperties(Sh, Props, Eps, SkipShared, Standard_False);
+        Error = volumeProperties(Sh, Props, Eps, SkipShared, Standard_False, theIsParallel);
         if (ErrorMax < Error)
         {
           ErrorMax = Error;
@@ -413,7 +521,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape&    S,
     }
   }
   else
-    ErrorMax = volumeProperties(S, Props, Eps, SkipShared, Standard_False);
+    ErrorMax = volumeProperties(S, Props, Eps, SkipShared, Standard_False, theIsParallel);
 #ifdef OCCT_DEBUG
   if (AffichEps)
     std::cout << "\n\n===================" << iErrorMax << ":\tMaxEpsVolume = " << ErrorMax << "\n";
@@ -23,6 +23,7 @@
 
 #include <Standard_Boolean.hxx>
 #include <TColgp_Array1OfXYZ.hxx>
+#include <TopTools_Array1OfShape.hxx>
 
 class TopoDS_Shape;
 class GProp_GProps;
@@ -130,11 +131,25 @@ public:
   //! source of geometry data. If UseTriangulation = Standard_False,
   //! exact geometry objects (surfaces) are used,
   //! otherwise face triangulations are used first.
+  //! theIsParallel is a flag to integrate faces in parallel threads;
+  //! the result does not depend on this flag.
   Standard_EXPORT static void SurfaceProperties(
     const TopoDS_Shape&    S,
     GProp_GProps&          SProps,
     const Standard_Boolean SkipShared       = Standard_False,
-    const Standard_Boolean UseTriangulation = Standard_False);
+    const Standard_Boolean UseTriangulation = Standard_False,
+    const Standard_Boolean theIsParallel    = Standard_False);
+
+  //! Computes the surface global properties of each shape of the array theShapes
+  //! in the same way as SurfaceProperties() above.
+  //! Output array theProps is resized to the bounds of theShapes.
+  //! If theIsParallel is TRUE, shapes (and faces of each shape) are processed in parallel threads.
+  Standard_EXPORT static void SurfaceProperties(
+    const TopTools_Array1OfShape&     theShapes,
+    NCollection_Array1<GProp_GProps>& theProps,
+    const Standard_Boolean            theSkipShared       = Standard_False,
+    const Standard_Boolean            theUseTriangulation = Standard_False,
+    const Standard_Boolean            theIsParallel       = Standard_False);
 
   //! Updates <SProps> with the shape <S>, that contains its principal properties.
   //! The surface properties of all the faces in <S> are computed.
@@ -148,11 +163,13 @@ public:
   //! shared topological entities or not
   //! For ex., if SkipShared = True, faces, shared by two or more shells,
   //! are taken into calculation only once.
+  //! theIsParallel is a flag to integrate faces in parallel threads.
   Standard_EXPORT static Standard_Real SurfaceProperties(
     const TopoDS_Shape&    S,
     GProp_GProps&          SProps,
     const Standard_Real    Eps,
-    const Standard_Boolean SkipShared = Standard_False);
+    const Standard_Boolean SkipShared    = Standard_False,
+    const Standard_Boolean theIsParallel = Standard_False);
   //!
   //! Computes the global volume properties of the solid
   //! S, and brings them together with the global
@@ -195,12 +212,27 @@ public:
   //! source of geometry data. If UseTriangulation = Standard_False,
   //! exact geometry objects (surfaces) are used,
   //! otherwise face triangulations are used first.
+  //! theIsParallel is a flag to integrate faces in parallel threads;
+  //! the result does not depend on this flag.
   Standard_EXPORT static void VolumeProperties(
     const TopoDS_Shape&    S,
     GProp_GProps&          VProps,
     const Standard_Boolean OnlyClosed       = Standard_False,
     const Standard_Boolean SkipShared       = Standard_False,
-    const Standard_Boolean UseTriangulation = Standard_False);
+    const Standard_Boolean UseTriangulation = Standard_False,
+    const Standard_Boolean theIsParallel    = Standard_False);
+
+  //! Computes the global volume properties of each shape of the array theShapes
+  //! in the same way as VolumeProperties() above.
+  //! Output array theProps is resized to the bounds of theShapes.
+  //! If theIsParallel is TRUE, shapes (and faces of each shape) are processed in parallel threads.
+  Standard_EXPORT static void VolumeProperties(
+    const TopTools_Array1OfShape&     theShapes,
+    NCollection_Array1<GProp_GProps>& theProps,
+    const Standard_Boolean            theOnlyClosed       = Standard_False,
+    const Standard_Boolean            theSkipShared       = Standard_False,
+    const Standard_Boolean            theUseTriangulation = Standard_False,
+    const Standard_Boolean            theIsParallel       = Standard_False);
 
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -216,12 +248,14 @@ public:
   //! For ex., if SkipShared = True, the volumes formed by the equal
   //! (the same TShape, location and orientation)
   //! faces are taken into calculation only once.
+  //! theIsParallel is a flag to integrate faces in parallel threads.
   Standard_EXPORT static Standard_Real VolumeProperties(
     const TopoDS_Shape&    S,
     GProp_GProps&          VProps,
     const Standard_Real    Eps,
-    const Standard_Boolean OnlyClosed = Standard_False,
-    const Standard_Boolean SkipShared = Standard_False);
+    const Standard_Boolean OnlyClosed    = Standard_False,
+    const Standard_Boolean SkipShared    = Standard_False,
+    const Standard_Boolean theIsParallel = Standard_False);
 
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
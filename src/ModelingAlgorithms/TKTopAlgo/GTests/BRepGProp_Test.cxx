@@ -0,0 +1,104 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCone.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <GProp_GProps.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the array of solids with curved and planar faces
+TopTools_Array1OfShape makeShapes()
+{
+  TopTools_Array1OfShape aShapes(1, 5);
+  aShapes(1) = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  aShapes(2) = BRepPrimAPI_MakeCylinder(5.0, 15.0).Shape();
+  aShapes(3) = BRepPrimAPI_MakeSphere(7.0).Shape();
+  aShapes(4) = BRepPrimAPI_MakeCone(6.0, 2.0, 9.0).Shape();
+  aShapes(5) = BRepPrimAPI_MakeTorus(12.0, 3.0).Shape();
+  return aShapes;
+}
+
+//! Checks that the properties are equal
+void checkSameProps(const GProp_GProps& theProps1, const GProp_GProps& theProps2)
+{
+  const Standard_Real aTol = 1.0e-9 * Max(Abs(theProps1.Mass()), 1.0);
+  EXPECT_NEAR(theProps1.Mass(), theProps2.Mass(), aTol);
+  EXPECT_LT(theProps1.CentreOfMass().Distance(theProps2.CentreOfMass()), 1.0e-9);
+  for (Standard_Integer aRow = 1; aRow <= 3; ++aRow)
+  {
+    for (Standard_Integer aCol = 1; aCol <= 3; ++aCol)
+    {
+      const Standard_Real anInertia = theProps1.MatrixOfInertia().Value(aRow, aCol);
+      EXPECT_NEAR(anInertia,
+                  theProps2.MatrixOfInertia().Value(aRow, aCol),
+                  1.0e-9 * Max(Abs(anInertia), 1.0));
+    }
+  }
+}
+} // namespace
+
+TEST(BRepGPropTest, SurfacePropertiesOfArrayMatchPerShape)
+{
+  const TopTools_Array1OfShape aShapes = makeShapes();
+  for (Standard_Integer aParIter = 0; aParIter < 2; ++aParIter)
+  {
+    const Standard_Boolean           isParallel = aParIter == 1;
+    NCollection_Array1<GProp_GProps> aProps;
+    BRepGProp::SurfaceProperties(aShapes,
+                                 aProps,
+                                 Standard_False,
+                                 Standard_False,
+                                 isParallel);
+    ASSERT_EQ(aShapes.Lower(), aProps.Lower());
+    ASSERT_EQ(aShapes.Upper(), aProps.Upper());
+    for (Standard_Integer aShapeIter = aShapes.Lower(); aShapeIter <= aShapes.Upper();
+         ++aShapeIter)
+    {
+      GProp_GProps aShapeProps;
+      BRepGProp::SurfaceProperties(aShapes(aShapeIter), aShapeProps);
+      checkSameProps(aShapeProps, aProps(aShapeIter));
+    }
+  }
+}
+
+TEST(BRepGPropTest, VolumePropertiesOfArrayMatchPerShape)
+{
+  const TopTools_Array1OfShape aShapes = makeShapes();
+  for (Standard_Integer aParIter = 0; aParIter < 2; ++aParIter)
+  {
+    const Standard_Boolean           isParallel = aParIter == 1;
+    NCollection_Array1<GProp_GProps> aProps;
+    BRepGProp::VolumeProperties(aShapes,
+                                aProps,
+                                Standard_False,
+                                Standard_False,
+                                Standard_False,
+                                isParallel);
+    ASSERT_EQ(aShapes.Lower(), aProps.Lower());
+    ASSERT_EQ(aShapes.Upper(), aProps.Upper());
+    for (Standard_Integer aShapeIter = aShapes.Lower(); aShapeIter <= aShapes.Upper();
+         ++aShapeIter)
+    {
+      GProp_GProps aShapeProps;
+      BRepGProp::VolumeProperties(aShapes(aShapeIter), aShapeProps);
+      checkSameProps(aShapeProps, aProps(aShapeIter));
+    }
+  }
+}
@@ -582,6 +582,22 @@ void BRep_Builder::UpdateFace(const TopoDS_Face&                theFace,
 
 //=================================================================================================
 
+// 更新面：修改网格列表
+void BRep_Builder::UpdateFace(const TopoDS_Face&                theFace,
+                              const Poly_ListOfTriangulation&   theTriangulations,
+                              const Handle(Poly_Triangulation)& theActiveTriangulation) const
+{
+  const Handle(BRep_TFace)& aTFace = *((Handle(BRep_TFace)*)&theFace.TShape());
+  if (aTFace->Locked())
+  {
+    throw TopoDS_LockedShape("BRep_Builder::UpdateFace");
+  }
+  aTFace->Triangulations(theTriangulations, theActiveTriangulation);
+  theFace.TShape()->Modified(Standard_True);
+}
+
+//=================================================================================================
+
 // 更新面：修改公差
 void BRep_Builder::UpdateFace(const TopoDS_Face& F, const Standard_Real Tol) const
 {
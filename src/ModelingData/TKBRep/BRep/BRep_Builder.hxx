@@ -149,6 +149,16 @@ public:
                                   const Handle(Poly_Triangulation)& theTriangulation,
                                   const Standard_Boolean            theToReset = true) const;
 
+  //! Changes a list of face triangulations and the active one.
+  //! 修改面的三角网格列表，并指定当前激活的网格。
+  //! @param theFace                [in] 要更新的面
+  //! @param theTriangulations      [in] 三角网格列表 (如果为空，则移除所有网格)
+  //! @param theActiveTriangulation [in] 当前激活的网格 (默认为空，表示使用列表中的第一个)
+  Standard_EXPORT void UpdateFace(
+    const TopoDS_Face&                theFace,
+    const Poly_ListOfTriangulation&   theTriangulations,
+    const Handle(Poly_Triangulation)& theActiveTriangulation = Handle(Poly_Triangulation)()) const;
+
   //! Updates the face Tolerance.
   //! 仅更新面的公差。
   Standard_EXPORT void UpdateFace(const TopoDS_Face& F, const Standard_Real Tol) const;
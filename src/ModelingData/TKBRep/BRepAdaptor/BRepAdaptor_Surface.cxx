@@ -252,6 +252,70 @@ gp_Vec BRepAdaptor_Surface::DN(const Standard_Real    U,
 
 //=================================================================================================
 
+void BRepAdaptor_Surface::D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                                  TColgp_Array1OfPnt&         thePoints) const
+{
+  mySurf.D0Array(theUVs, thePoints);
+  for (gp_Pnt& aPnt : thePoints)
+  {
+    aPnt.Transform(myTrsf);
+  }
+}
+
+//=================================================================================================
+
+void BRepAdaptor_Surface::D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                                  TColgp_Array1OfPnt&         thePoints,
+                                  TColgp_Array1OfVec&         theD1U,
+                                  TColgp_Array1OfVec&         theD1V) const
+{
+  mySurf.D1Array(theUVs, thePoints, theD1U, theD1V);
+  for (Standard_Integer anIndex = 0; anIndex < thePoints.Length(); ++anIndex)
+  {
+    thePoints(thePoints.Lower() + anIndex).Transform(myTrsf);
+    theD1U(theD1U.Lower() + anIndex).Transform(myTrsf);
+    theD1V(theD1V.Lower() + anIndex).Transform(myTrsf);
+  }
+}
+
+//=================================================================================================
+
+void BRepAdaptor_Surface::D0Grid(const TColStd_Array1OfReal& theUParams,
+                                 const TColStd_Array1OfReal& theVParams,
+                                 TColgp_Array2OfPnt&         thePoints) const
+{
+  mySurf.D0Grid(theUParams, theVParams, thePoints);
+  for (gp_Pnt& aPnt : thePoints)
+  {
+    aPnt.Transform(myTrsf);
+  }
+}
+
+//=================================================================================================
+
+void BRepAdaptor_Surface::D1Grid(const TColStd_Array1OfReal& theUParams,
+                                 const TColStd_Array1OfReal& theVParams,
+                                 TColgp_Array2OfPnt&         thePoints,
+                                 TColgp_Array2OfVec&         theD1U,
+                                 TColgp_Array2OfVec&         theD1V) const
+{
+  mySurf.D1Grid(theUParams, theVParams, thePoints, theD1U, theD1V);
+  for (TColgp_Array2OfPnt::Iterator aPntIter(thePoints); aPntIter.More(); aPntIter.Next())
+  {
+    aPntIter.ChangeValue().Transform(myTrsf);
+  }
+  for (gp_Vec& aVec : theD1U)
+  {
+    aVec.Transform(myTrsf);
+  }
+  for (gp_Vec& aVec : theD1V)
+  {
+    aVec.Transform(myTrsf);
+  }
+}
+
+//=================================================================================================
+
 gp_Pln BRepAdaptor_Surface::Plane() const
 {
   return mySurf.Plane().Transformed(myTrsf);
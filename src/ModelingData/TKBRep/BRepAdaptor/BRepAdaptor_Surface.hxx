@@ -219,6 +219,29 @@ public:
                             const Standard_Integer Nu,
                             const Standard_Integer Nv) const Standard_OVERRIDE;
 
+  //! Computes the points of the given (U, V) parameters on the surface.
+  Standard_EXPORT void D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the given (U, V) parameters
+  //! on the surface.
+  Standard_EXPORT void D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         thePoints,
+                               TColgp_Array1OfVec&         theD1U,
+                               TColgp_Array1OfVec&         theD1V) const Standard_OVERRIDE;
+
+  //! Computes the points of the grid of parameters on the surface.
+  Standard_EXPORT void D0Grid(const TColStd_Array1OfReal& theUParams,
+                              const TColStd_Array1OfReal& theVParams,
+                              TColgp_Array2OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the grid of parameters on the surface.
+  Standard_EXPORT void D1Grid(const TColStd_Array1OfReal& theUParams,
+                              const TColStd_Array1OfReal& theVParams,
+                              TColgp_Array2OfPnt&         thePoints,
+                              TColgp_Array2OfVec&         theD1U,
+                              TColgp_Array2OfVec&         theD1V) const Standard_OVERRIDE;
+
   //! Returns the parametric U  resolution corresponding
   //! to the real space resolution <R3d>.
   virtual Standard_Real UResolution(const Standard_Real theR3d) const Standard_OVERRIDE
@@ -527,6 +527,21 @@ Standard_Boolean BRepTools_ReShape::IsNewShape(const TopoDS_Shape& theShape) con
 
 //=================================================================================================
 
+void BRepTools_ReShape::Append(const BRepTools_ReShape& theOther)
+{
+  for (TShapeToReplacement::Iterator anIter(theOther.myShapeToReplacement); anIter.More();
+       anIter.Next())
+  {
+    myShapeToReplacement.Bind(anIter.Key(), anIter.Value());
+  }
+  for (TopTools_MapOfShape::Iterator anIter(theOther.myNewShapes); anIter.More(); anIter.Next())
+  {
+    myNewShapes.Add(anIter.Key());
+  }
+}
+
+//=================================================================================================
+
 Handle(BRepTools_History) BRepTools_ReShape::History() const
 {
   Handle(BRepTools_History) aHistory = new BRepTools_History;
@@ -150,6 +150,12 @@ public:
   //! Returns the history of the substituted shapes.
   Standard_EXPORT Handle(BRepTools_History) History() const;
 
+  //! Copies substitution requests and new shapes recorded by another reshaper into this one.
+  //! Requests recorded by both reshapers for the same shape are replaced by the ones of theOther.
+  //! Allows filling separate reshapers for independent parts of a shape (e.g. in parallel threads)
+  //! and collecting the results afterwards.
+  Standard_EXPORT void Append(const BRepTools_ReShape& theOther);
+
   DEFINE_STANDARD_RTTIEXT(BRepTools_ReShape, Standard_Transient)
 
 protected:
@@ -193,6 +193,7 @@ Standard_Boolean BinTools::Write(const TopoDS_Shape&          theShape,
 
 Standard_Boolean BinTools::Read(TopoDS_Shape&                theShape,
                                 const Standard_CString       theFile,
+                                const Standard_Boolean       theToDeferTriangulation,
                                 const Message_ProgressRange& theRange)
 {
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
@@ -203,6 +204,13 @@ Standard_Boolean BinTools::Read(TopoDS_Shape&                theShape,
     return Standard_False;
   }
 
-  Read(theShape, *aStream, theRange);
+  BinTools_ShapeSet aShapeSet;
+  aShapeSet.SetWithTriangles(Standard_True);
+  if (theToDeferTriangulation)
+  {
+    aShapeSet.SetDeferredTriangulationFile(theFile);
+  }
+  aShapeSet.Read(*aStream, theRange);
+  aShapeSet.ReadSubs(theShape, *aStream, aShapeSet.NbShapes());
   return aStream->good();
 }
@@ -144,9 +144,25 @@ public:
     const Message_ProgressRange& theRange = Message_ProgressRange());
 
   //! Reads a shape from <theFile> and returns it in <theShape>.
+  static Standard_Boolean Read(TopoDS_Shape&                theShape,
+                               const Standard_CString       theFile,
+                               const Message_ProgressRange& theRange = Message_ProgressRange())
+  {
+    return Read(theShape, theFile, Standard_False, theRange);
+  }
+
+  //! Reads a shape from <theFile> and returns it in <theShape>.
+  //! @param[out] theShape                the restored shape
+  //! @param[in] theFile                   the path to file to read shape from
+  //! @param[in] theToDeferTriangulation   flag which specifies whether triangulation data
+  //!                                      should be skipped and loaded on demand (TRUE);
+  //!                                      faces then get BinTools_TriangulationSource objects
+  //!                                      to be filled by Poly_Triangulation::LoadDeferredData()
+  //! @param theRange                      the range of progress indicator to fill in
   Standard_EXPORT static Standard_Boolean Read(
     TopoDS_Shape&                theShape,
     const Standard_CString       theFile,
+    const Standard_Boolean       theToDeferTriangulation,
     const Message_ProgressRange& theRange = Message_ProgressRange());
 };
 
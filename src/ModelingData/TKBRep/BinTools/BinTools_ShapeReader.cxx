@@ -16,6 +16,7 @@
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_CurveSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
+#include <BinTools_TriangulationSource.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_PointOnCurve.hxx>
 #include <BRep_PointOnCurveOnSurface.hxx>
@@ -532,6 +533,24 @@ Handle(Poly_Triangulation) BinTools_ShapeReader::ReadTriangulation(BinTools_IStr
     Standard_Integer aNbTriangles = theStream.ReadInteger();
     Standard_Boolean aHasUV       = theStream.ReadBool();
     Standard_Boolean aHasNormals  = theStream.ReadBool();
+    if (!DeferredTriangulationFile().IsEmpty())
+    { // keep the position of arrays and skip them
+      const Standard_Real aDeflection = theStream.ReadReal();
+      const uint64_t      aDataPos    = theStream.Position();
+
+      aResult = new BinTools_TriangulationSource(DeferredTriangulationFile(),
+                                                 aDataPos,
+                                                 aNbNodes,
+                                                 aNbTriangles,
+                                                 aHasUV,
+                                                 aHasNormals);
+      aResult->Deflection(aDeflection);
+      theStream.GoTo(
+        aDataPos
+        + BinTools_TriangulationSource::DataSize(aNbNodes, aNbTriangles, aHasUV, aHasNormals));
+      myTriangulationPos.Bind(aPosition, aResult);
+      return aResult;
+    }
     aResult = new Poly_Triangulation(aNbNodes, aNbTriangles, aHasUV, aHasNormals);
     aResult->Deflection(theStream.ReadReal());
     for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
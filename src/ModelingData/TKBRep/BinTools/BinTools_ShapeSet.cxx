@@ -17,6 +17,7 @@
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
+#include <BinTools_TriangulationSource.hxx>
 #include <BRep_CurveOnClosedSurface.hxx>
 #include <BRep_CurveOnSurface.hxx>
 #include <BRep_CurveRepresentation.hxx>
@@ -37,6 +38,7 @@
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Standard_ErrorHandler.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
 #include <TColStd_HArray1OfInteger.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 #include <TopoDS.hxx>
@@ -1525,6 +1527,29 @@ void BinTools_ShapeSet::ReadTriangulation(Standard_IStream&            IS,
         BinTools::GetBool(IS, hasNormals);
       }
       BinTools::GetReal(IS, aDefl); // deflection
+      if (!DeferredTriangulationFile().IsEmpty())
+      {
+        // keep the position of arrays and skip them
+        Handle(Poly_Triangulation) aTriangulation =
+          new BinTools_TriangulationSource(DeferredTriangulationFile(),
+                                           uint64_t(IS.tellg()),
+                                           aNbNodes,
+                                           aNbTriangles,
+                                           hasUV,
+                                           hasNormals);
+        aTriangulation->Deflection(aDefl);
+        IS.seekg(
+          std::streamoff(
+            BinTools_TriangulationSource::DataSize(aNbNodes, aNbTriangles, hasUV, hasNormals)),
+          std::ios::cur);
+        if (IS.fail())
+        {
+          throw Storage_StreamTypeMismatchError();
+        }
+        myTriangulations.Add(aTriangulation, hasNormals);
+        continue;
+      }
+
       Handle(Poly_Triangulation) aTriangulation =
         new Poly_Triangulation(aNbNodes, aNbTriangles, hasUV, hasNormals);
       aTriangulation->Deflection(aDefl);
@@ -22,6 +22,7 @@
 #include <Standard_IStream.hxx>
 #include <Message_ProgressRange.hxx>
 #include <BinTools_FormatVersion.hxx>
+#include <TCollection_AsciiString.hxx>
 
 class TopoDS_Shape;
 class gp_Pnt;
@@ -57,6 +58,22 @@ public:
   //! Ignored (always written) if face defines only triangulation (no surface).
   void SetWithNormals(const Standard_Boolean theWithNormals) { myWithNormals = theWithNormals; }
 
+  //! Returns path to the file being read if triangulations should be loaded on demand.
+  const TCollection_AsciiString& DeferredTriangulationFile() const
+  {
+    return myDeferredTriangulationFile;
+  }
+
+  //! Defines path to the file being read to load triangulations on demand.
+  //! When not empty, nodes and triangles are skipped while reading the stream:
+  //! faces receive BinTools_TriangulationSource objects referring to their position
+  //! in the file, to be filled by Poly_Triangulation::LoadDeferredData().
+  //! The stream passed to Read() should be opened on the same file.
+  void SetDeferredTriangulationFile(const TCollection_AsciiString& theFilePath)
+  {
+    myDeferredTriangulationFile = theFilePath;
+  }
+
   //! Sets the BinTools_FormatVersion.
   Standard_EXPORT void SetFormatNb(const Standard_Integer theFormatNb);
 
@@ -116,9 +133,10 @@ public:
   static const Standard_CString THE_ASCII_VERSIONS[BinTools_FormatVersion_UPPER + 1];
 
 private:
-  Standard_Integer myFormatNb;
-  Standard_Boolean myWithTriangles;
-  Standard_Boolean myWithNormals;
+  Standard_Integer        myFormatNb;
+  Standard_Boolean        myWithTriangles;
+  Standard_Boolean        myWithNormals;
+  TCollection_AsciiString myDeferredTriangulationFile;
 };
 
 #endif // _BinTools_ShapeSet_HeaderFile
@@ -0,0 +1,136 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_TriangulationSource.hxx>
+
+#include <BinTools.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_TriangulationSource, Poly_Triangulation)
+
+//=================================================================================================
+
+BinTools_TriangulationSource::BinTools_TriangulationSource(
+  const TCollection_AsciiString& theFilePath,
+  const uint64_t                 theDataOffset,
+  const Standard_Integer         theNbNodes,
+  const Standard_Integer         theNbTriangles,
+  const Standard_Boolean         theHasUVNodes,
+  const Standard_Boolean         theHasNormals)
+    : myFilePath(theFilePath),
+      myDataOffset(theDataOffset),
+      myNbDefNodes(theNbNodes),
+      myNbDefTriangles(theNbTriangles),
+      myHasDefUVNodes(theHasUVNodes),
+      myHasDefNormals(theHasNormals)
+{
+}
+
+//=================================================================================================
+
+uint64_t BinTools_TriangulationSource::DataSize(const Standard_Integer theNbNodes,
+                                                const Standard_Integer theNbTriangles,
+                                                const Standard_Boolean theHasUVNodes,
+                                                const Standard_Boolean theHasNormals)
+{
+  uint64_t aNodeSize = sizeof(Standard_Real) * (theHasUVNodes ? 5 : 3);
+  if (theHasNormals)
+  {
+    aNodeSize += sizeof(Standard_ShortReal) * 3;
+  }
+  return aNodeSize * uint64_t(theNbNodes)
+         + sizeof(Standard_Integer) * 3 * uint64_t(theNbTriangles);
+}
+
+//=================================================================================================
+
+Standard_Boolean BinTools_TriangulationSource::loadDeferredData(
+  const Handle(OSD_FileSystem)&     theFileSystem,
+  const Handle(Poly_Triangulation)& theDestTriangulation) const
+{
+  const Handle(OSD_FileSystem)& aFileSystem =
+    !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aStream =
+    aFileSystem->OpenIStream(myFilePath, std::ios::in | std::ios::binary, int64_t(myDataOffset));
+  if (aStream.get() == NULL || !aStream->good())
+  {
+    return Standard_False;
+  }
+
+  theDestTriangulation->Clear();
+  theDestTriangulation->ResizeNodes(myNbDefNodes, Standard_False);
+  theDestTriangulation->ResizeTriangles(myNbDefTriangles, Standard_False);
+  if (myHasDefUVNodes)
+  {
+    theDestTriangulation->AddUVNodes();
+  }
+  if (myHasDefNormals)
+  {
+    theDestTriangulation->AddNormals();
+  }
+  theDestTriangulation->Deflection(Deflection());
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    gp_Pnt aNode;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= myNbDefNodes; ++aNodeIter)
+    {
+      BinTools::GetReal(*aStream, aNode.ChangeCoord().ChangeCoord(1));
+      BinTools::GetReal(*aStream, aNode.ChangeCoord().ChangeCoord(2));
+      BinTools::GetReal(*aStream, aNode.ChangeCoord().ChangeCoord(3));
+      theDestTriangulation->SetNode(aNodeIter, aNode);
+    }
+
+    if (myHasDefUVNodes)
+    {
+      gp_Pnt2d aNode2d;
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= myNbDefNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(*aStream, aNode2d.ChangeCoord().ChangeCoord(1));
+        BinTools::GetReal(*aStream, aNode2d.ChangeCoord().ChangeCoord(2));
+        theDestTriangulation->SetUVNode(aNodeIter, aNode2d);
+      }
+    }
+
+    Standard_Integer aTriNodes[3] = {};
+    for (Standard_Integer aTriIter = 1; aTriIter <= myNbDefTriangles; ++aTriIter)
+    {
+      BinTools::GetInteger(*aStream, aTriNodes[0]);
+      BinTools::GetInteger(*aStream, aTriNodes[1]);
+      BinTools::GetInteger(*aStream, aTriNodes[2]);
+      theDestTriangulation->SetTriangle(aTriIter,
+                                        Poly_Triangle(aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+    }
+
+    if (myHasDefNormals)
+    {
+      gp_Vec3f aNormal;
+      for (Standard_Integer aNormalIter = 1; aNormalIter <= myNbDefNodes; ++aNormalIter)
+      {
+        BinTools::GetShortReal(*aStream, aNormal.x());
+        BinTools::GetShortReal(*aStream, aNormal.y());
+        BinTools::GetShortReal(*aStream, aNormal.z());
+        theDestTriangulation->SetNormal(aNormalIter, aNormal);
+      }
+    }
+  }
+  catch (Standard_Failure const&)
+  {
+    theDestTriangulation->Clear();
+    return Standard_False;
+  }
+  return Standard_True;
+}
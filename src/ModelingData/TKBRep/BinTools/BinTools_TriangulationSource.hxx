@@ -0,0 +1,83 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_TriangulationSource_HeaderFile
+#define _BinTools_TriangulationSource_HeaderFile
+
+#include <Poly_Triangulation.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Triangulation stored in a binary shape file and loaded on demand.
+//! The object keeps only the header of the triangulation record (numbers of nodes
+//! and triangles, presence of UV nodes and normals, deflection) and the position
+//! of its arrays within the file; nodes and triangles are read by LoadDeferredData().
+//! Class inherits Poly_Triangulation so that it can be put into TopoDS_Face
+//! in place of the complete triangulation.
+class BinTools_TriangulationSource : public Poly_Triangulation
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_TriangulationSource, Poly_Triangulation)
+public:
+  //! Constructor.
+  //! @param[in] theFilePath     path to the binary shape file
+  //! @param[in] theDataOffset   position of the nodes array within the file
+  //! @param[in] theNbNodes      number of nodes
+  //! @param[in] theNbTriangles  number of triangles
+  //! @param[in] theHasUVNodes   flag indicating that UV nodes are stored
+  //! @param[in] theHasNormals   flag indicating that normals are stored
+  Standard_EXPORT BinTools_TriangulationSource(const TCollection_AsciiString& theFilePath,
+                                               const uint64_t                 theDataOffset,
+                                               const Standard_Integer         theNbNodes,
+                                               const Standard_Integer         theNbTriangles,
+                                               const Standard_Boolean         theHasUVNodes,
+                                               const Standard_Boolean         theHasNormals);
+
+  //! Returns path to the binary shape file.
+  const TCollection_AsciiString& FilePath() const { return myFilePath; }
+
+  //! Returns position of the triangulation arrays within the file.
+  uint64_t DataOffset() const { return myDataOffset; }
+
+  //! Returns size in bytes of the triangulation arrays stored in the file.
+  Standard_EXPORT static uint64_t DataSize(const Standard_Integer theNbNodes,
+                                           const Standard_Integer theNbTriangles,
+                                           const Standard_Boolean theHasUVNodes,
+                                           const Standard_Boolean theHasNormals);
+
+public: //! @name late-load deferred data interface
+  //! Returns number of nodes for deferred loading.
+  virtual Standard_Integer NbDeferredNodes() const Standard_OVERRIDE { return myNbDefNodes; }
+
+  //! Returns number of triangles for deferred loading.
+  virtual Standard_Integer NbDeferredTriangles() const Standard_OVERRIDE
+  {
+    return myNbDefTriangles;
+  }
+
+protected:
+  //! Loads triangulation data from the file using specified shared input file system.
+  Standard_EXPORT virtual Standard_Boolean loadDeferredData(
+    const Handle(OSD_FileSystem)&     theFileSystem,
+    const Handle(Poly_Triangulation)& theDestTriangulation) const Standard_OVERRIDE;
+
+protected:
+  TCollection_AsciiString myFilePath;
+  uint64_t                myDataOffset;
+  Standard_Integer        myNbDefNodes;
+  Standard_Integer        myNbDefTriangles;
+  Standard_Boolean        myHasDefUVNodes;
+  Standard_Boolean        myHasDefNormals;
+};
+
+DEFINE_STANDARD_HANDLE(BinTools_TriangulationSource, Poly_Triangulation)
+
+#endif // _BinTools_TriangulationSource_HeaderFile
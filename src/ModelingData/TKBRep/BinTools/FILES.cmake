@@ -27,4 +27,6 @@ set(OCCT_BinTools_FILES
   BinTools_ShapeReader.cxx
   BinTools_ShapeWriter.hxx
   BinTools_ShapeWriter.cxx
+  BinTools_TriangulationSource.hxx
+  BinTools_TriangulationSource.cxx
 )
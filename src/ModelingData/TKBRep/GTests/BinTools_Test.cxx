@@ -0,0 +1,127 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools.hxx>
+#include <BinTools_TriangulationSource.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+namespace
+{
+// Creates a triangulation of regular grid with UV nodes and normals
+Handle(Poly_Triangulation) makeGrid(const Standard_Integer theSize, const Standard_Real theZ)
+{
+  const Standard_Integer     aNbNodes     = theSize * theSize;
+  const Standard_Integer     aNbTriangles = (theSize - 1) * (theSize - 1) * 2;
+  Handle(Poly_Triangulation) aTriangulation =
+    new Poly_Triangulation(aNbNodes, aNbTriangles, Standard_True, Standard_True);
+  for (Standard_Integer aRow = 0; aRow < theSize; ++aRow)
+  {
+    for (Standard_Integer aCol = 0; aCol < theSize; ++aCol)
+    {
+      const Standard_Integer aNode = aRow * theSize + aCol + 1;
+      aTriangulation->SetNode(aNode, gp_Pnt(aCol, aRow, theZ));
+      aTriangulation->SetUVNode(aNode, gp_Pnt2d(aCol, aRow));
+      aTriangulation->SetNormal(aNode, gp_Vec3f(0.0f, 0.0f, 1.0f));
+    }
+  }
+  Standard_Integer aTriangle = 1;
+  for (Standard_Integer aRow = 0; aRow + 1 < theSize; ++aRow)
+  {
+    for (Standard_Integer aCol = 0; aCol + 1 < theSize; ++aCol)
+    {
+      const Standard_Integer aNode = aRow * theSize + aCol + 1;
+      aTriangulation->SetTriangle(aTriangle++,
+                                  Poly_Triangle(aNode, aNode + 1, aNode + theSize + 1));
+      aTriangulation->SetTriangle(aTriangle++,
+                                  Poly_Triangle(aNode, aNode + theSize + 1, aNode + theSize));
+    }
+  }
+  aTriangulation->Deflection(0.5);
+  return aTriangulation;
+}
+} // namespace
+
+TEST(BinToolsTest, DeferredTriangulationMatchesEager)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  for (Standard_Integer aFaceIter = 0; aFaceIter < 3; ++aFaceIter)
+  {
+    TopoDS_Face aFace;
+    aBuilder.MakeFace(aFace, makeGrid(4 + aFaceIter, aFaceIter));
+    aBuilder.Add(aCompound, aFace);
+  }
+
+  const char* aFileName = "BinTools_DeferredTriangulation.brep";
+  ASSERT_TRUE(BinTools::Write(aCompound,
+                              aFileName,
+                              Standard_True,
+                              Standard_True,
+                              BinTools_FormatVersion_CURRENT));
+
+  TopoDS_Shape anEager, aDeferred;
+  ASSERT_TRUE(BinTools::Read(anEager, aFileName));
+  ASSERT_TRUE(BinTools::Read(aDeferred, aFileName, Standard_True));
+
+  TopExp_Explorer anEagerExp(anEager, TopAbs_FACE), aDeferredExp(aDeferred, TopAbs_FACE);
+  for (; anEagerExp.More() && aDeferredExp.More(); anEagerExp.Next(), aDeferredExp.Next())
+  {
+    TopLoc_Location                   aLoc;
+    const Handle(Poly_Triangulation)& anExpected =
+      BRep_Tool::Triangulation(TopoDS::Face(anEagerExp.Current()), aLoc);
+    const Handle(Poly_Triangulation)& aSource =
+      BRep_Tool::Triangulation(TopoDS::Face(aDeferredExp.Current()), aLoc);
+    ASSERT_FALSE(anExpected.IsNull());
+    ASSERT_TRUE(aSource->IsKind(STANDARD_TYPE(BinTools_TriangulationSource)));
+    EXPECT_EQ(0, aSource->NbNodes());
+    EXPECT_EQ(anExpected->NbNodes(), aSource->NbDeferredNodes());
+    EXPECT_EQ(anExpected->NbTriangles(), aSource->NbDeferredTriangles());
+
+    ASSERT_TRUE(aSource->LoadDeferredData());
+    ASSERT_EQ(anExpected->NbNodes(), aSource->NbNodes());
+    ASSERT_EQ(anExpected->NbTriangles(), aSource->NbTriangles());
+    EXPECT_EQ(anExpected->Deflection(), aSource->Deflection());
+    EXPECT_TRUE(aSource->HasUVNodes());
+    EXPECT_TRUE(aSource->HasNormals());
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aSource->NbNodes(); ++aNodeIter)
+    {
+      EXPECT_TRUE(anExpected->Node(aNodeIter).IsEqual(aSource->Node(aNodeIter), 0.0));
+      EXPECT_TRUE(anExpected->UVNode(aNodeIter).IsEqual(aSource->UVNode(aNodeIter), 0.0));
+    }
+    for (Standard_Integer aTriIter = 1; aTriIter <= aSource->NbTriangles(); ++aTriIter)
+    {
+      Standard_Integer anExpNodes[3], aNodes[3];
+      anExpected->Triangle(aTriIter).Get(anExpNodes[0], anExpNodes[1], anExpNodes[2]);
+      aSource->Triangle(aTriIter).Get(aNodes[0], aNodes[1], aNodes[2]);
+      EXPECT_EQ(anExpNodes[0], aNodes[0]);
+      EXPECT_EQ(anExpNodes[1], aNodes[1]);
+      EXPECT_EQ(anExpNodes[2], aNodes[2]);
+    }
+
+    EXPECT_TRUE(aSource->UnloadDeferredData());
+    EXPECT_EQ(0, aSource->NbNodes());
+  }
+  EXPECT_FALSE(anEagerExp.More());
+  EXPECT_FALSE(aDeferredExp.More());
+
+  std::remove(aFileName);
+}
@@ -26,6 +26,7 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Curve, Standard_Transient)
@@ -142,6 +143,60 @@ void Adaptor3d_Curve::D2(const Standard_Real, gp_Pnt&, gp_Vec&, gp_Vec&) const
 
 //=================================================================================================
 
+void Adaptor3d_Curve::D0Array(const TColStd_Array1OfReal& theParams,
+                              TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theParams.Length(),
+                                   "Adaptor3d_Curve::D0Array");
+  const Standard_Integer aShift = thePoints.Lower() - theParams.Lower();
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    D0(theParams(anIndex), thePoints(anIndex + aShift));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Curve::D1Array(const TColStd_Array1OfReal& theParams,
+                              TColgp_Array1OfPnt&         thePoints,
+                              TColgp_Array1OfVec&         theD1) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theParams.Length()
+                                     || theD1.Length() != theParams.Length(),
+                                   "Adaptor3d_Curve::D1Array");
+  const Standard_Integer aShift   = thePoints.Lower() - theParams.Lower();
+  const Standard_Integer aShiftD1 = theD1.Lower() - theParams.Lower();
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    D1(theParams(anIndex), thePoints(anIndex + aShift), theD1(anIndex + aShiftD1));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Curve::D2Array(const TColStd_Array1OfReal& theParams,
+                              TColgp_Array1OfPnt&         thePoints,
+                              TColgp_Array1OfVec&         theD1,
+                              TColgp_Array1OfVec&         theD2) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theParams.Length()
+                                     || theD1.Length() != theParams.Length()
+                                     || theD2.Length() != theParams.Length(),
+                                   "Adaptor3d_Curve::D2Array");
+  const Standard_Integer aShift   = thePoints.Lower() - theParams.Lower();
+  const Standard_Integer aShiftD1 = theD1.Lower() - theParams.Lower();
+  const Standard_Integer aShiftD2 = theD2.Lower() - theParams.Lower();
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    D2(theParams(anIndex),
+       thePoints(anIndex + aShift),
+       theD1(anIndex + aShiftD1),
+       theD2(anIndex + aShiftD2));
+  }
+}
+
+//=================================================================================================
+
 // void Adaptor3d_Curve::D3(const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2, gp_Vec& V3)
 // const
 void Adaptor3d_Curve::D3(const Standard_Real, gp_Pnt&, gp_Vec&, gp_Vec&, gp_Vec&) const
@@ -25,6 +25,8 @@
 #include <Standard.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <GeomAbs_CurveType.hxx>
 
@@ -122,6 +124,28 @@ public:
   //! Raised if N < 1.
   Standard_EXPORT virtual gp_Vec DN(const Standard_Real U, const Standard_Integer N) const;
 
+  //! Computes the points of the given parameters on the curve.
+  //! The output array should have the same length as the array of parameters.
+  //! Default implementation evaluates the points one by one,
+  //! subclasses may redefine it to evaluate the whole batch at once.
+  //! @param[in]  theParams  parameters on the curve
+  //! @param[out] thePoints  computed points
+  Standard_EXPORT virtual void D0Array(const TColStd_Array1OfReal& theParams,
+                                       TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the given parameters on the curve,
+  //! see D0Array().
+  Standard_EXPORT virtual void D1Array(const TColStd_Array1OfReal& theParams,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec&         theD1) const;
+
+  //! Computes the points, the first and the second derivatives of the given parameters
+  //! on the curve, see D0Array().
+  Standard_EXPORT virtual void D2Array(const TColStd_Array1OfReal& theParams,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec&         theD1,
+                                       TColgp_Array1OfVec&         theD2) const;
+
   //! Returns the parametric  resolution corresponding
   //! to the real space resolution <R3d>.
   Standard_EXPORT virtual Standard_Real Resolution(const Standard_Real R3d) const;
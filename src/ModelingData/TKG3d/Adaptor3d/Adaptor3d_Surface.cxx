@@ -28,6 +28,7 @@
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Surface, Standard_Transient)
@@ -261,6 +262,123 @@ gp_Vec Adaptor3d_Surface::DN(const Standard_Real,
 
 //=================================================================================================
 
+void Adaptor3d_Surface::D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theUVs.Length(),
+                                   "Adaptor3d_Surface::D0Array");
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(theUVs.Lower() + anIndex);
+    D0(aUV.X(), aUV.Y(), thePoints(thePoints.Lower() + anIndex));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Surface::D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1U,
+                                TColgp_Array1OfVec&         theD1V) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theUVs.Length()
+                                     || theD1U.Length() != theUVs.Length()
+                                     || theD1V.Length() != theUVs.Length(),
+                                   "Adaptor3d_Surface::D1Array");
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(theUVs.Lower() + anIndex);
+    D1(aUV.X(),
+       aUV.Y(),
+       thePoints(thePoints.Lower() + anIndex),
+       theD1U(theD1U.Lower() + anIndex),
+       theD1V(theD1V.Lower() + anIndex));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Surface::D2Array(const TColgp_Array1OfPnt2d& theUVs,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1U,
+                                TColgp_Array1OfVec&         theD1V,
+                                TColgp_Array1OfVec&         theD2U,
+                                TColgp_Array1OfVec&         theD2V,
+                                TColgp_Array1OfVec&         theD2UV) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theUVs.Length()
+                                     || theD1U.Length() != theUVs.Length()
+                                     || theD1V.Length() != theUVs.Length()
+                                     || theD2U.Length() != theUVs.Length()
+                                     || theD2V.Length() != theUVs.Length()
+                                     || theD2UV.Length() != theUVs.Length(),
+                                   "Adaptor3d_Surface::D2Array");
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(theUVs.Lower() + anIndex);
+    D2(aUV.X(),
+       aUV.Y(),
+       thePoints(thePoints.Lower() + anIndex),
+       theD1U(theD1U.Lower() + anIndex),
+       theD1V(theD1V.Lower() + anIndex),
+       theD2U(theD2U.Lower() + anIndex),
+       theD2V(theD2V.Lower() + anIndex),
+       theD2UV(theD2UV.Lower() + anIndex));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Surface::D0Grid(const TColStd_Array1OfReal& theUParams,
+                               const TColStd_Array1OfReal& theVParams,
+                               TColgp_Array2OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(thePoints.ColLength() != theUParams.Length()
+                                     || thePoints.RowLength() != theVParams.Length(),
+                                   "Adaptor3d_Surface::D0Grid");
+  for (Standard_Integer aUIndex = 0; aUIndex < theUParams.Length(); ++aUIndex)
+  {
+    const Standard_Real aU = theUParams(theUParams.Lower() + aUIndex);
+    for (Standard_Integer aVIndex = 0; aVIndex < theVParams.Length(); ++aVIndex)
+    {
+      D0(aU,
+         theVParams(theVParams.Lower() + aVIndex),
+         thePoints(thePoints.LowerRow() + aUIndex, thePoints.LowerCol() + aVIndex));
+    }
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Surface::D1Grid(const TColStd_Array1OfReal& theUParams,
+                               const TColStd_Array1OfReal& theVParams,
+                               TColgp_Array2OfPnt&         thePoints,
+                               TColgp_Array2OfVec&         theD1U,
+                               TColgp_Array2OfVec&         theD1V) const
+{
+  Standard_DimensionError_Raise_if(thePoints.ColLength() != theUParams.Length()
+                                     || thePoints.RowLength() != theVParams.Length()
+                                     || theD1U.ColLength() != theUParams.Length()
+                                     || theD1U.RowLength() != theVParams.Length()
+                                     || theD1V.ColLength() != theUParams.Length()
+                                     || theD1V.RowLength() != theVParams.Length(),
+                                   "Adaptor3d_Surface::D1Grid");
+  for (Standard_Integer aUIndex = 0; aUIndex < theUParams.Length(); ++aUIndex)
+  {
+    const Standard_Real aU = theUParams(theUParams.Lower() + aUIndex);
+    for (Standard_Integer aVIndex = 0; aVIndex < theVParams.Length(); ++aVIndex)
+    {
+      D1(aU,
+         theVParams(theVParams.Lower() + aVIndex),
+         thePoints(thePoints.LowerRow() + aUIndex, thePoints.LowerCol() + aVIndex),
+         theD1U(theD1U.LowerRow() + aUIndex, theD1U.LowerCol() + aVIndex),
+         theD1V(theD1V.LowerRow() + aUIndex, theD1V.LowerCol() + aVIndex));
+    }
+  }
+}
+
+//=================================================================================================
+
 // Standard_Real Adaptor3d_Surface::UResolution(const Standard_Real R3d) const
 Standard_Real Adaptor3d_Surface::UResolution(const Standard_Real) const
 {
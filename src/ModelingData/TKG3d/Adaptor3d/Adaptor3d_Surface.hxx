@@ -29,6 +29,9 @@
 #include <Standard.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
 class Geom_BezierSurface;
@@ -176,6 +179,53 @@ public:
                                     const Standard_Integer Nu,
                                     const Standard_Integer Nv) const;
 
+  //! Computes the points of the given (U, V) parameters on the surface.
+  //! The output arrays should have the same length as the array of parameters.
+  //! Default implementation evaluates the points one by one,
+  //! subclasses may redefine it to evaluate the whole batch at once.
+  //! @param[in]  theUVs     parameters on the surface
+  //! @param[out] thePoints  computed points
+  Standard_EXPORT virtual void D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                                       TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the given (U, V) parameters
+  //! on the surface, see D0Array().
+  Standard_EXPORT virtual void D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec&         theD1U,
+                                       TColgp_Array1OfVec&         theD1V) const;
+
+  //! Computes the points, the first and the second derivatives of the given (U, V) parameters
+  //! on the surface, see D0Array().
+  Standard_EXPORT virtual void D2Array(const TColgp_Array1OfPnt2d& theUVs,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec&         theD1U,
+                                       TColgp_Array1OfVec&         theD1V,
+                                       TColgp_Array1OfVec&         theD2U,
+                                       TColgp_Array1OfVec&         theD2V,
+                                       TColgp_Array1OfVec&         theD2UV) const;
+
+  //! Computes the points of the grid of parameters on the surface.
+  //! The output array should have as many rows as U parameters and as many columns
+  //! as V parameters, the point of i-th U and j-th V parameter is stored into i-th row
+  //! and j-th column (counted from the lower bounds of the arrays).
+  //! Default implementation evaluates the points one by one,
+  //! subclasses may redefine it to share computations between the points of the grid.
+  //! @param[in]  theUParams  U parameters of the grid
+  //! @param[in]  theVParams  V parameters of the grid
+  //! @param[out] thePoints   computed points
+  Standard_EXPORT virtual void D0Grid(const TColStd_Array1OfReal& theUParams,
+                                      const TColStd_Array1OfReal& theVParams,
+                                      TColgp_Array2OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the grid of parameters on the surface,
+  //! see D0Grid().
+  Standard_EXPORT virtual void D1Grid(const TColStd_Array1OfReal& theUParams,
+                                      const TColStd_Array1OfReal& theVParams,
+                                      TColgp_Array2OfPnt&         thePoints,
+                                      TColgp_Array2OfVec&         theD1U,
+                                      TColgp_Array2OfVec&         theD1V) const;
+
   //! Returns the parametric U  resolution corresponding
   //! to the real space resolution <R3d>.
   Standard_EXPORT virtual Standard_Real UResolution(const Standard_Real R3d) const;
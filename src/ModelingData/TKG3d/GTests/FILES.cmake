@@ -8,4 +8,6 @@ set(OCCT_TKG3d_GTests_FILES
   Geom_BSplineSurface_Test.cxx
   Geom_OffsetCurve_Test.cxx
   Geom_OffsetSurface_Test.cxx
+  GeomAdaptor_Curve_Test.cxx
+  GeomAdaptor_Surface_Test.cxx
 )
@@ -0,0 +1,168 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <GeomAdaptor_Curve.hxx>
+
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_OffsetCurve.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+//! Creates rational B-spline curve with several spans.
+Handle(Geom_BSplineCurve) createCurve()
+{
+  const Standard_Integer aDegree = 3, aNbKnots = 5;
+  TColStd_Array1OfReal   aKnots(1, aNbKnots);
+  for (Standard_Integer i = 1; i <= aNbKnots; ++i)
+  {
+    aKnots(i) = (i - 1) * (i - 1) * 0.1;
+  }
+  TColStd_Array1OfInteger aMults(1, aNbKnots);
+  aMults.Init(1);
+  aMults(1) = aMults(aNbKnots) = aDegree + 1;
+
+  const Standard_Integer aNbPoles = aDegree + aNbKnots - 1;
+  TColgp_Array1OfPnt     aPoles(1, aNbPoles);
+  TColStd_Array1OfReal   aWeights(1, aNbPoles);
+  for (Standard_Integer i = 1; i <= aNbPoles; ++i)
+  {
+    aPoles(i)   = gp_Pnt(i, Sin(i), Cos(i));
+    aWeights(i) = 1.0 + 0.2 * (i % 2);
+  }
+  return new Geom_BSplineCurve(aPoles, aWeights, aKnots, aMults, aDegree);
+}
+
+//! Checks that batch evaluation of the curve gives the same results as evaluation by points.
+void checkBatchEvaluation(const GeomAdaptor_Curve& theCurve)
+{
+  // shuffled parameters including the bounds
+  const Standard_Integer     aNbParams = 101;
+  const Standard_Real        aFirst    = theCurve.FirstParameter();
+  const Standard_Real        aLast     = theCurve.LastParameter();
+  std::vector<Standard_Real> aValues;
+  for (Standard_Integer i = 0; i < aNbParams; ++i)
+  {
+    aValues.push_back(aFirst + (aLast - aFirst) * i / (aNbParams - 1));
+  }
+  std::shuffle(aValues.begin(), aValues.end(), std::mt19937(1));
+
+  TColStd_Array1OfReal aParams(0, aNbParams - 1);
+  for (Standard_Integer i = 0; i < aNbParams; ++i)
+  {
+    aParams(i) = aValues[i];
+  }
+
+  const GeomAdaptor_Curve aRef(theCurve.Curve(), aFirst, aLast);
+  TColgp_Array1OfPnt      aPnts(1, aNbParams);
+  TColgp_Array1OfVec      aD1(1, aNbParams), aD2(1, aNbParams);
+  theCurve.D0Array(aParams, aPnts);
+  for (Standard_Integer i = 0; i < aNbParams; ++i)
+  {
+    EXPECT_TRUE(aRef.Value(aParams(i)).IsEqual(aPnts(i + 1), 1.0e-10));
+  }
+
+  theCurve.D2Array(aParams, aPnts, aD1, aD2);
+  for (Standard_Integer i = 0; i < aNbParams; ++i)
+  {
+    gp_Pnt aPnt;
+    gp_Vec aRefD1, aRefD2;
+    aRef.D2(aParams(i), aPnt, aRefD1, aRefD2);
+    EXPECT_TRUE(aPnt.IsEqual(aPnts(i + 1), 1.0e-10));
+    EXPECT_TRUE(aRefD1.IsEqual(aD1(i + 1), 1.0e-8, 1.0e-8));
+    EXPECT_TRUE(aRefD2.IsEqual(aD2(i + 1), 1.0e-8, 1.0e-8));
+  }
+
+  theCurve.D1Array(aParams, aPnts, aD1);
+  for (Standard_Integer i = 0; i < aNbParams; ++i)
+  {
+    gp_Pnt aPnt;
+    gp_Vec aRefD1;
+    aRef.D1(aParams(i), aPnt, aRefD1);
+    EXPECT_TRUE(aPnt.IsEqual(aPnts(i + 1), 1.0e-10));
+    EXPECT_TRUE(aRefD1.IsEqual(aD1(i + 1), 1.0e-8, 1.0e-8));
+  }
+}
+} // namespace
+
+TEST(GeomAdaptor_CurveTest, BatchEvaluationBSpline)
+{
+  Handle(Geom_BSplineCurve) aCurve = createCurve();
+  checkBatchEvaluation(GeomAdaptor_Curve(aCurve));
+
+  // trimmed curve evaluates its bounds locally
+  checkBatchEvaluation(GeomAdaptor_Curve(aCurve, 0.25, 1.2));
+}
+
+TEST(GeomAdaptor_CurveTest, BatchEvaluationOffset)
+{
+  checkBatchEvaluation(GeomAdaptor_Curve(new Geom_OffsetCurve(createCurve(), 0.5, gp::DZ())));
+}
+
+TEST(GeomAdaptor_CurveTest, SpanCache)
+{
+  // periodic curve with uniform knots is evaluated also outside of its period
+  TColStd_Array1OfReal    aKnots(1, 9);
+  TColStd_Array1OfInteger aMults(1, 9);
+  TColgp_Array1OfPnt      aPoles(1, 8);
+  for (Standard_Integer i = 1; i <= 9; ++i)
+  {
+    aKnots(i) = (i - 1) * 0.25;
+    aMults(i) = 1;
+  }
+  for (Standard_Integer i = 1; i <= 8; ++i)
+  {
+    aPoles(i) = gp_Pnt(Cos(i), Sin(i), 0.1 * i * (8 - i));
+  }
+  Handle(Geom_BSplineCurve) aPeriodic = new Geom_BSplineCurve(aPoles, aKnots, aMults, 3, true);
+
+  const Handle(Geom_BSplineCurve) aCurves[] = {createCurve(), aPeriodic};
+  for (const Handle(Geom_BSplineCurve)& aCurve : aCurves)
+  {
+    const Standard_Real aFirst = aCurve->FirstParameter();
+    const Standard_Real aLast  = aCurve->LastParameter();
+    const Standard_Real aShift = aCurve->IsPeriodic() ? aLast - aFirst : 0.0;
+
+    // caches of all spans and of two spans only
+    GeomAdaptor_Curve aRef(aCurve), anAll(aCurve), aTwo(aCurve);
+    anAll.SetSpanCacheMemory(1 << 20);
+    aTwo.SetSpanCacheMemory(2 * BSplCLib_MultiSpanCache::SpanMemory(3, 3, aCurve->IsRational()));
+
+    std::mt19937                           aGen(1);
+    std::uniform_real_distribution<double> aDist(aFirst - aShift, aLast + aShift);
+    for (Standard_Integer i = 0; i < 500; ++i)
+    {
+      // knots are checked as the span boundaries
+      const Standard_Real aParam =
+        i % 5 == 0 ? aCurve->Knot(1 + (i / 5) % aCurve->NbKnots()) : aDist(aGen);
+
+      gp_Pnt aRefPnt, aPnt;
+      gp_Vec aRefD1, aRefD2, aD1, aD2;
+      aRef.D2(aParam, aRefPnt, aRefD1, aRefD2);
+      for (const GeomAdaptor_Curve* anAdaptor : {&anAll, &aTwo})
+      {
+        anAdaptor->D2(aParam, aPnt, aD1, aD2);
+        EXPECT_TRUE(aRefPnt.IsEqual(aPnt, 1.0e-10));
+        EXPECT_TRUE(aRefD1.IsEqual(aD1, 1.0e-8, 1.0e-8));
+        EXPECT_TRUE(aRefD2.IsEqual(aD2, 1.0e-8, 1.0e-8));
+      }
+    }
+  }
+}
@@ -0,0 +1,257 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <GeomAdaptor_Surface.hxx>
+
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_OffsetSurface.hxx>
+#include <Geom_SurfaceOfLinearExtrusion.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array2OfReal.hxx>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+//! Creates rational B-spline surface with several spans in both directions.
+Handle(Geom_BSplineSurface) createSurface(const Standard_Integer theUDegree,
+                                          const Standard_Integer theVDegree)
+{
+  const Standard_Integer aNbKnots = 4;
+  TColStd_Array1OfReal    aKnots(1, aNbKnots);
+  aKnots(1) = 0.0;
+  aKnots(2) = 0.3;
+  aKnots(3) = 0.5;
+  aKnots(4) = 1.0;
+  TColStd_Array1OfInteger aUMults(1, aNbKnots), aVMults(1, aNbKnots);
+  aUMults.Init(1);
+  aVMults.Init(1);
+  aUMults(1) = aUMults(aNbKnots) = theUDegree + 1;
+  aVMults(1) = aVMults(aNbKnots) = theVDegree + 1;
+
+  const Standard_Integer aNbUPoles = theUDegree + aNbKnots - 1;
+  const Standard_Integer aNbVPoles = theVDegree + aNbKnots - 1;
+  TColgp_Array2OfPnt     aPoles(1, aNbUPoles, 1, aNbVPoles);
+  TColStd_Array2OfReal   aWeights(1, aNbUPoles, 1, aNbVPoles);
+  for (Standard_Integer i = 1; i <= aNbUPoles; ++i)
+  {
+    for (Standard_Integer j = 1; j <= aNbVPoles; ++j)
+    {
+      aPoles(i, j)   = gp_Pnt(i, j, Sin(i) * Cos(j));
+      aWeights(i, j) = 1.0 + 0.1 * ((i + j) % 3);
+    }
+  }
+  return new Geom_BSplineSurface(aPoles,
+                                 aWeights,
+                                 aKnots,
+                                 aKnots,
+                                 aUMults,
+                                 aVMults,
+                                 theUDegree,
+                                 theVDegree);
+}
+
+//! Returns parameters of the grid including the bounds.
+TColStd_Array1OfReal gridParams(const Standard_Integer theNb)
+{
+  TColStd_Array1OfReal aParams(1, theNb);
+  for (Standard_Integer i = 1; i <= theNb; ++i)
+  {
+    aParams(i) = Standard_Real(i - 1) / (theNb - 1);
+  }
+  return aParams;
+}
+
+//! Returns parameters of the grid in random order.
+TColgp_Array1OfPnt2d shuffledParams(const Standard_Integer theNb)
+{
+  std::vector<gp_Pnt2d> aUVs;
+  for (Standard_Integer i = 0; i < theNb; ++i)
+  {
+    for (Standard_Integer j = 0; j < theNb; ++j)
+    {
+      aUVs.push_back(gp_Pnt2d(Standard_Real(i) / (theNb - 1), Standard_Real(j) / (theNb - 1)));
+    }
+  }
+  std::shuffle(aUVs.begin(), aUVs.end(), std::mt19937(1));
+
+  TColgp_Array1OfPnt2d aResult(0, Standard_Integer(aUVs.size()) - 1);
+  for (Standard_Integer i = aResult.Lower(); i <= aResult.Upper(); ++i)
+  {
+    aResult(i) = aUVs[i];
+  }
+  return aResult;
+}
+
+void checkPnt(const gp_Pnt& theExpected, const gp_Pnt& theActual)
+{
+  EXPECT_NEAR(theExpected.X(), theActual.X(), 1.0e-10);
+  EXPECT_NEAR(theExpected.Y(), theActual.Y(), 1.0e-10);
+  EXPECT_NEAR(theExpected.Z(), theActual.Z(), 1.0e-10);
+}
+
+void checkVec(const gp_Vec& theExpected, const gp_Vec& theActual)
+{
+  EXPECT_NEAR(theExpected.X(), theActual.X(), 1.0e-8);
+  EXPECT_NEAR(theExpected.Y(), theActual.Y(), 1.0e-8);
+  EXPECT_NEAR(theExpected.Z(), theActual.Z(), 1.0e-8);
+}
+
+//! Checks that batch evaluation of the surface gives the same results as evaluation by points.
+void checkBatchEvaluation(const Handle(Geom_Surface)& theSurface)
+{
+  const GeomAdaptor_Surface aBatch(theSurface);
+  const GeomAdaptor_Surface aRef(theSurface);
+
+  const TColgp_Array1OfPnt2d aUVs = shuffledParams(11);
+  const Standard_Integer     aNb  = aUVs.Length();
+  TColgp_Array1OfPnt         aPnts(1, aNb);
+  TColgp_Array1OfVec         aD1U(1, aNb), aD1V(1, aNb);
+  TColgp_Array1OfVec         aD2U(1, aNb), aD2V(1, aNb), aD2UV(1, aNb);
+
+  aBatch.D0Array(aUVs, aPnts);
+  for (Standard_Integer i = 0; i < aUVs.Length(); ++i)
+  {
+    const gp_Pnt2d& aUV = aUVs(aUVs.Lower() + i);
+    checkPnt(aRef.Value(aUV.X(), aUV.Y()), aPnts(aPnts.Lower() + i));
+  }
+
+  aBatch.D2Array(aUVs, aPnts, aD1U, aD1V, aD2U, aD2V, aD2UV);
+  for (Standard_Integer i = 0; i < aUVs.Length(); ++i)
+  {
+    const gp_Pnt2d& aUV = aUVs(aUVs.Lower() + i);
+    gp_Pnt          aPnt;
+    gp_Vec          aRefD1U, aRefD1V, aRefD2U, aRefD2V, aRefD2UV;
+    aRef.D2(aUV.X(), aUV.Y(), aPnt, aRefD1U, aRefD1V, aRefD2U, aRefD2V, aRefD2UV);
+    checkPnt(aPnt, aPnts(i + 1));
+    checkVec(aRefD1U, aD1U(i + 1));
+    checkVec(aRefD1V, aD1V(i + 1));
+    checkVec(aRefD2U, aD2U(i + 1));
+    checkVec(aRefD2V, aD2V(i + 1));
+    checkVec(aRefD2UV, aD2UV(i + 1));
+  }
+
+  aBatch.D1Array(aUVs, aPnts, aD1U, aD1V);
+  for (Standard_Integer i = 0; i < aUVs.Length(); ++i)
+  {
+    const gp_Pnt2d& aUV = aUVs(aUVs.Lower() + i);
+    gp_Pnt          aPnt;
+    gp_Vec          aRefD1U, aRefD1V;
+    aRef.D1(aUV.X(), aUV.Y(), aPnt, aRefD1U, aRefD1V);
+    checkPnt(aPnt, aPnts(i + 1));
+    checkVec(aRefD1U, aD1U(i + 1));
+    checkVec(aRefD1V, aD1V(i + 1));
+  }
+
+  const TColStd_Array1OfReal aUParams = gridParams(13);
+  const TColStd_Array1OfReal aVParams = gridParams(9);
+  TColgp_Array2OfPnt         aGrid(0, aUParams.Length() - 1, 0, aVParams.Length() - 1);
+  TColgp_Array2OfVec         aGridD1U(1, aUParams.Length(), 1, aVParams.Length());
+  TColgp_Array2OfVec         aGridD1V(1, aUParams.Length(), 1, aVParams.Length());
+  aBatch.D0Grid(aUParams, aVParams, aGrid);
+  for (Standard_Integer i = 1; i <= aUParams.Length(); ++i)
+  {
+    for (Standard_Integer j = 1; j <= aVParams.Length(); ++j)
+    {
+      checkPnt(aRef.Value(aUParams(i), aVParams(j)), aGrid(i - 1, j - 1));
+    }
+  }
+
+  aBatch.D1Grid(aUParams, aVParams, aGrid, aGridD1U, aGridD1V);
+  for (Standard_Integer i = 1; i <= aUParams.Length(); ++i)
+  {
+    for (Standard_Integer j = 1; j <= aVParams.Length(); ++j)
+    {
+      gp_Pnt aPnt;
+      gp_Vec aRefD1U, aRefD1V;
+      aRef.D1(aUParams(i), aVParams(j), aPnt, aRefD1U, aRefD1V);
+      checkPnt(aPnt, aGrid(i - 1, j - 1));
+      checkVec(aRefD1U, aGridD1U(i, j));
+      checkVec(aRefD1V, aGridD1V(i, j));
+    }
+  }
+}
+} // namespace
+
+TEST(GeomAdaptor_SurfaceTest, BatchEvaluationBSpline)
+{
+  // the grid is evaluated along U or V depending on the maximal degree
+  checkBatchEvaluation(createSurface(3, 2));
+  checkBatchEvaluation(createSurface(2, 3));
+}
+
+TEST(GeomAdaptor_SurfaceTest, BatchEvaluationExtrusion)
+{
+  Handle(Geom_BSplineSurface) aSurface = createSurface(3, 3);
+  Handle(Geom_Curve)          aBase    = aSurface->UIso(0.4);
+  checkBatchEvaluation(new Geom_SurfaceOfLinearExtrusion(aBase, gp_Dir(0.0, 0.0, 1.0)));
+}
+
+TEST(GeomAdaptor_SurfaceTest, BatchEvaluationOffset)
+{
+  checkBatchEvaluation(new Geom_OffsetSurface(createSurface(3, 2), 0.3));
+}
+
+TEST(GeomAdaptor_SurfaceTest, BatchEvaluationDimensionError)
+{
+  const GeomAdaptor_Surface aSurface(createSurface(2, 2));
+  TColgp_Array1OfPnt2d      aUVs(1, 4);
+  TColgp_Array1OfPnt        aPnts(1, 3);
+  aUVs.Init(gp_Pnt2d(0.5, 0.5));
+  EXPECT_THROW(aSurface.D0Array(aUVs, aPnts), Standard_DimensionError);
+}
+
+TEST(GeomAdaptor_SurfaceTest, SpanCache)
+{
+  Handle(Geom_BSplineSurface) aSurface = createSurface(3, 2);
+
+  // caches of all spans and of two spans only
+  GeomAdaptor_Surface aRef(aSurface), anAll(aSurface), aTwo(aSurface);
+  anAll.SetSpanCacheMemory(1 << 20);
+  aTwo.SetSpanCacheMemory(2 * BSplSLib_MultiSpanCache::SpanMemory(3, 2, Standard_True));
+
+  const TColgp_Array1OfPnt2d aUVs = shuffledParams(21);
+  for (Standard_Integer i = aUVs.Lower(); i <= aUVs.Upper(); ++i)
+  {
+    const gp_Pnt2d& aUV = aUVs(i);
+
+    gp_Pnt aRefPnt, aPnt;
+    gp_Vec aRefD1U, aRefD1V, aRefD2U, aRefD2V, aRefD2UV, aD1U, aD1V, aD2U, aD2V, aD2UV;
+    aRef.D2(aUV.X(), aUV.Y(), aRefPnt, aRefD1U, aRefD1V, aRefD2U, aRefD2V, aRefD2UV);
+    for (const GeomAdaptor_Surface* anAdaptor : {&anAll, &aTwo})
+    {
+      checkPnt(aRefPnt, anAdaptor->Value(aUV.X(), aUV.Y()));
+      anAdaptor->D2(aUV.X(), aUV.Y(), aPnt, aD1U, aD1V, aD2U, aD2V, aD2UV);
+      checkPnt(aRefPnt, aPnt);
+      checkVec(aRefD1U, aD1U);
+      checkVec(aRefD1V, aD1V);
+      checkVec(aRefD2U, aD2U);
+      checkVec(aRefD2V, aD2V);
+      checkVec(aRefD2UV, aD2UV);
+    }
+  }
+
+  // cache is reset by loading of other surface
+  Handle(Geom_BSplineSurface) anOther = createSurface(2, 3);
+  anAll.Load(anOther);
+  checkPnt(GeomAdaptor_Surface(anOther).Value(0.4, 0.7), anAll.Value(0.4, 0.7));
+}
@@ -45,7 +45,9 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <NCollection_Array1.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -54,8 +56,53 @@
 #include <TColStd_Array1OfReal.hxx>
 
 // #include <GeomConvert_BSplineCurveKnotSplitting.hxx>
+
+#include <algorithm>
+
 static const Standard_Real PosTol = Precision::PConfusion() / 2;
 
+//! Computes the order of evaluation of the parameters of B-spline curve grouping them by spans,
+//! so that the cache is rebuilt only once per span.
+//! The order is left empty if the parameters are already grouped and can be evaluated as is.
+static void orderBySpans(const Handle(Geom_BSplineCurve)&      theBSpline,
+                         const TColStd_Array1OfReal&           theParams,
+                         NCollection_Array1<Standard_Integer>& theOrder)
+{
+  if (theBSpline.IsNull() || theParams.Length() < 3)
+    return;
+
+  const TColStd_Array1OfReal& aFlatKnots = theBSpline->KnotSequence();
+  BSplCLib_CacheParams        aSpan(theBSpline->Degree(), theBSpline->IsPeriodic(), aFlatKnots);
+
+  NCollection_Array1<Standard_Integer> aSpans(theParams.Lower(), theParams.Upper());
+  Standard_Boolean                     isIncreasing = Standard_False, isDecreasing = Standard_False;
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    if (anIndex == theParams.Lower() || !aSpan.IsCacheValid(theParams(anIndex)))
+    {
+      Standard_Real aParam = aSpan.PeriodicNormalization(theParams(anIndex));
+      aSpan.LocateParameter(aParam, aFlatKnots);
+    }
+    aSpans(anIndex) = aSpan.SpanIndex;
+    if (anIndex != theParams.Lower())
+    {
+      isIncreasing = isIncreasing || aSpans(anIndex) > aSpans(anIndex - 1);
+      isDecreasing = isDecreasing || aSpans(anIndex) < aSpans(anIndex - 1);
+    }
+  }
+  if (!isIncreasing || !isDecreasing)
+    return;
+
+  theOrder.Resize(theParams.Lower(), theParams.Upper(), Standard_False);
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+    theOrder(anIndex) = anIndex;
+  std::stable_sort(theOrder.begin(),
+                   theOrder.end(),
+                   [&aSpans](const Standard_Integer theIndex1, const Standard_Integer theIndex2) {
+                     return aSpans(theIndex1) < aSpans(theIndex2);
+                   });
+}
+
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Curve, Adaptor3d_Curve)
 
 //=================================================================================================
@@ -69,6 +116,8 @@ Handle(Adaptor3d_Curve) GeomAdaptor_Curve::ShallowCopy() const
   aCopy->myFirst        = myFirst;
   aCopy->myLast         = myLast;
   aCopy->myBSplineCurve = myBSplineCurve;
+
+  aCopy->mySpanCacheMemory = mySpanCacheMemory;
   if (!myNestedEvaluator.IsNull())
   {
     aCopy->myNestedEvaluator = myNestedEvaluator->ShallowCopy();
@@ -171,6 +220,7 @@ void GeomAdaptor_Curve::Reset()
   myNestedEvaluator.Nullify();
   myBSplineCurve.Nullify();
   myCurveCache.Nullify();
+  mySpanCaches.Nullify();
   myFirst = myLast = 0.0;
 }
 
@@ -183,6 +233,7 @@ void GeomAdaptor_Curve::load(const Handle(Geom_Curve)& C,
   myFirst = UFirst;
   myLast  = ULast;
   myCurveCache.Nullify();
+  mySpanCaches.Nullify();
 
   if (myCurve != C)
   {
@@ -522,6 +573,21 @@ void GeomAdaptor_Curve::RebuildCache(const Standard_Real theParameter) const
                                         aBezier->Weights());
     myCurveCache->BuildCache(theParameter, aFlatKnots, aBezier->Poles(), aBezier->Weights());
   }
+  else if (myTypeCurve == GeomAbs_BSplineCurve && mySpanCacheMemory > 0)
+  {
+    // Take cache of the span from the caches of several spans
+    if (mySpanCaches.IsNull())
+      mySpanCaches = new BSplCLib_MultiSpanCache(myBSplineCurve->Degree(),
+                                                 myBSplineCurve->IsPeriodic(),
+                                                 myBSplineCurve->KnotSequence(),
+                                                 3,
+                                                 myBSplineCurve->Weights() != NULL,
+                                                 mySpanCacheMemory);
+    myCurveCache = mySpanCaches->Cache(theParameter,
+                                       myBSplineCurve->KnotSequence(),
+                                       myBSplineCurve->Poles(),
+                                       myBSplineCurve->Weights());
+  }
   else if (myTypeCurve == GeomAbs_BSplineCurve)
   {
     // Create cache for B-spline
@@ -737,6 +803,142 @@ gp_Vec GeomAdaptor_Curve::DN(const Standard_Real U, const Standard_Integer N) co
 
 //=================================================================================================
 
+void GeomAdaptor_Curve::D0Array(const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theParams.Length(),
+                                   "GeomAdaptor_Curve::D0Array");
+  const Standard_Integer aShift = thePoints.Lower() - theParams.Lower();
+  switch (myTypeCurve)
+  {
+    case GeomAbs_BezierCurve:
+    case GeomAbs_BSplineCurve: {
+      NCollection_Array1<Standard_Integer> anOrder;
+      orderBySpans(myBSplineCurve, theParams, anOrder);
+      for (Standard_Integer anIter = theParams.Lower(); anIter <= theParams.Upper(); ++anIter)
+      {
+        const Standard_Integer anIndex = anOrder.IsEmpty() ? anIter : anOrder(anIter);
+        const Standard_Real    aParam  = theParams(anIndex);
+        Standard_Integer       aStart  = 0, aFinish = 0;
+        if (IsBoundary(aParam, aStart, aFinish))
+        {
+          myBSplineCurve->LocalD0(aParam, aStart, aFinish, thePoints(anIndex + aShift));
+          continue;
+        }
+        if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid(aParam))
+          RebuildCache(aParam);
+        myCurveCache->D0(aParam, thePoints(anIndex + aShift));
+      }
+      break;
+    }
+
+    case GeomAbs_OffsetCurve:
+      myNestedEvaluator->D0Array(theParams, thePoints);
+      break;
+
+    default:
+      for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+        myCurve->D0(theParams(anIndex), thePoints(anIndex + aShift));
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Curve::D1Array(const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theParams.Length()
+                                     || theD1.Length() != theParams.Length(),
+                                   "GeomAdaptor_Curve::D1Array");
+  const Standard_Integer aShift   = thePoints.Lower() - theParams.Lower();
+  const Standard_Integer aShiftD1 = theD1.Lower() - theParams.Lower();
+  switch (myTypeCurve)
+  {
+    case GeomAbs_BezierCurve:
+    case GeomAbs_BSplineCurve: {
+      NCollection_Array1<Standard_Integer> anOrder;
+      orderBySpans(myBSplineCurve, theParams, anOrder);
+      for (Standard_Integer anIter = theParams.Lower(); anIter <= theParams.Upper(); ++anIter)
+      {
+        const Standard_Integer anIndex = anOrder.IsEmpty() ? anIter : anOrder(anIter);
+        const Standard_Real    aParam  = theParams(anIndex);
+        Standard_Integer       aStart  = 0, aFinish = 0;
+        if (IsBoundary(aParam, aStart, aFinish))
+        {
+          myBSplineCurve->LocalD1(aParam,
+                                  aStart,
+                                  aFinish,
+                                  thePoints(anIndex + aShift),
+                                  theD1(anIndex + aShiftD1));
+          continue;
+        }
+        if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid(aParam))
+          RebuildCache(aParam);
+        myCurveCache->D1(aParam, thePoints(anIndex + aShift), theD1(anIndex + aShiftD1));
+      }
+      break;
+    }
+
+    case GeomAbs_OffsetCurve:
+      myNestedEvaluator->D1Array(theParams, thePoints, theD1);
+      break;
+
+    default:
+      for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+        myCurve->D1(theParams(anIndex), thePoints(anIndex + aShift), theD1(anIndex + aShiftD1));
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Curve::D2Array(const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theD1,
+                                TColgp_Array1OfVec&         theD2) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theParams.Length()
+                                     || theD1.Length() != theParams.Length()
+                                     || theD2.Length() != theParams.Length(),
+                                   "GeomAdaptor_Curve::D2Array");
+  if (myTypeCurve != GeomAbs_BezierCurve && myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    Adaptor3d_Curve::D2Array(theParams, thePoints, theD1, theD2);
+    return;
+  }
+
+  const Standard_Integer aShift   = thePoints.Lower() - theParams.Lower();
+  const Standard_Integer aShiftD1 = theD1.Lower() - theParams.Lower();
+  const Standard_Integer aShiftD2 = theD2.Lower() - theParams.Lower();
+
+  NCollection_Array1<Standard_Integer> anOrder;
+  orderBySpans(myBSplineCurve, theParams, anOrder);
+  for (Standard_Integer anIter = theParams.Lower(); anIter <= theParams.Upper(); ++anIter)
+  {
+    const Standard_Integer anIndex = anOrder.IsEmpty() ? anIter : anOrder(anIter);
+    const Standard_Real    aParam  = theParams(anIndex);
+    Standard_Integer       aStart  = 0, aFinish = 0;
+    if (IsBoundary(aParam, aStart, aFinish))
+    {
+      myBSplineCurve->LocalD2(aParam,
+                              aStart,
+                              aFinish,
+                              thePoints(anIndex + aShift),
+                              theD1(anIndex + aShiftD1),
+                              theD2(anIndex + aShiftD2));
+      continue;
+    }
+    if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid(aParam))
+      RebuildCache(aParam);
+    myCurveCache->D2(aParam,
+                     thePoints(anIndex + aShift),
+                     theD1(anIndex + aShiftD1),
+                     theD2(anIndex + aShiftD2));
+  }
+}
+
+//=================================================================================================
+
 Standard_Real GeomAdaptor_Curve::Resolution(const Standard_Real R3D) const
 {
   switch (myTypeCurve)
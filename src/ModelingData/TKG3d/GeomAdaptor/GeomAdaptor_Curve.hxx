@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Curve.hxx>
 #include <BSplCLib_Cache.hxx>
+#include <BSplCLib_MultiSpanCache.hxx>
 #include <Geom_Curve.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <GeomEvaluator_Curve.hxx>
@@ -41,16 +42,22 @@ public:
   GeomAdaptor_Curve()
       : myTypeCurve(GeomAbs_OtherCurve),
         myFirst(0.0),
-        myLast(0.0)
+        myLast(0.0),
+        mySpanCacheMemory(0)
   {
   }
 
-  GeomAdaptor_Curve(const Handle(Geom_Curve)& theCurve) { Load(theCurve); }
+  GeomAdaptor_Curve(const Handle(Geom_Curve)& theCurve)
+      : mySpanCacheMemory(0)
+  {
+    Load(theCurve);
+  }
 
   //! Standard_ConstructionError is raised if theUFirst>theULast
   GeomAdaptor_Curve(const Handle(Geom_Curve)& theCurve,
                     const Standard_Real       theUFirst,
                     const Standard_Real       theULast)
+      : mySpanCacheMemory(0)
   {
     Load(theCurve, theUFirst, theULast);
   }
@@ -90,6 +97,20 @@ public:
   //! This is inherited to provide easy to use constructors.
   const Handle(Geom_Curve)& Curve() const { return myCurve; }
 
+  //! Returns the memory limit for caching of several spans of B-spline curve; 0 by default.
+  Standard_Size SpanCacheMemory() const { return mySpanCacheMemory; }
+
+  //! Sets the memory limit in bytes for caching of several spans of B-spline curve.
+  //! By default only the span of the last evaluated point is cached and the cache is recomputed
+  //! each time the evaluated parameter leaves the span. With non-zero limit the spans already
+  //! visited are kept (see BSplCLib_MultiSpanCache), which speeds up evaluations jumping
+  //! between spans.
+  void SetSpanCacheMemory(const Standard_Size theMaxMemory)
+  {
+    mySpanCacheMemory = theMaxMemory;
+    mySpanCaches.Nullify();
+  }
+
   virtual Standard_Real FirstParameter() const Standard_OVERRIDE { return myFirst; }
 
   virtual Standard_Real LastParameter() const Standard_OVERRIDE { return myLast; }
@@ -172,6 +193,25 @@ public:
   Standard_EXPORT gp_Vec DN(const Standard_Real    U,
                             const Standard_Integer N) const Standard_OVERRIDE;
 
+  //! Computes the points of the given parameters on the curve.
+  //! Parameters of B-spline curve are grouped by spans,
+  //! so that the polynomial coefficients of each span are cached only once for the whole batch.
+  Standard_EXPORT void D0Array(const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the given parameters on the curve,
+  //! see D0Array().
+  Standard_EXPORT void D1Array(const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         thePoints,
+                               TColgp_Array1OfVec&         theD1) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives of the given parameters
+  //! on the curve, see D0Array().
+  Standard_EXPORT void D2Array(const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         thePoints,
+                               TColgp_Array1OfVec&         theD1,
+                               TColgp_Array1OfVec&         theD2) const Standard_OVERRIDE;
+
   //! returns the parametric resolution
   Standard_EXPORT Standard_Real Resolution(const Standard_Real R3d) const Standard_OVERRIDE;
 
@@ -252,6 +292,9 @@ private:
   Handle(Geom_BSplineCurve)      myBSplineCurve;    ///< B-spline representation to prevent castings
   mutable Handle(BSplCLib_Cache) myCurveCache;      ///< Cached data for B-spline or Bezier curve
   Handle(GeomEvaluator_Curve)    myNestedEvaluator; ///< Calculates value of offset curve
+
+  Standard_Size                           mySpanCacheMemory; ///< Memory limit for span caches
+  mutable Handle(BSplCLib_MultiSpanCache) mySpanCaches;      ///< Cached data for several spans
 };
 
 #endif // _GeomAdaptor_Curve_HeaderFile
@@ -53,15 +53,69 @@
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <NCollection_Array1.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionError.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <algorithm>
+
 static const Standard_Real PosTol = Precision::PConfusion() * 0.5;
 
+//! Computes the order of evaluation of the parameters on B-spline surface grouping them by spans,
+//! so that the cache is rebuilt only once per span.
+//! The order is left empty if the parameters are already grouped and can be evaluated as is.
+static void orderBySpans(const Handle(Geom_BSplineSurface)&    theBSpline,
+                         const TColgp_Array1OfPnt2d&           theUVs,
+                         NCollection_Array1<Standard_Integer>& theOrder)
+{
+  if (theBSpline.IsNull() || theUVs.Length() < 3)
+    return;
+
+  const TColStd_Array1OfReal& aFlatKnotsU = theBSpline->UKnotSequence();
+  const TColStd_Array1OfReal& aFlatKnotsV = theBSpline->VKnotSequence();
+  BSplCLib_CacheParams aSpanU(theBSpline->UDegree(), theBSpline->IsUPeriodic(), aFlatKnotsU);
+  BSplCLib_CacheParams aSpanV(theBSpline->VDegree(), theBSpline->IsVPeriodic(), aFlatKnotsV);
+
+  NCollection_Array1<Standard_Integer> aSpans(theUVs.Lower(), theUVs.Upper());
+  Standard_Boolean                     isIncreasing = Standard_False, isDecreasing = Standard_False;
+  for (Standard_Integer anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(anIndex);
+    if (anIndex == theUVs.Lower() || !aSpanU.IsCacheValid(aUV.X()))
+    {
+      Standard_Real aParam = aSpanU.PeriodicNormalization(aUV.X());
+      aSpanU.LocateParameter(aParam, aFlatKnotsU);
+    }
+    if (anIndex == theUVs.Lower() || !aSpanV.IsCacheValid(aUV.Y()))
+    {
+      Standard_Real aParam = aSpanV.PeriodicNormalization(aUV.Y());
+      aSpanV.LocateParameter(aParam, aFlatKnotsV);
+    }
+    aSpans(anIndex) = aSpanU.SpanIndex * (aSpanV.SpanIndexMax + 1) + aSpanV.SpanIndex;
+    if (anIndex != theUVs.Lower())
+    {
+      isIncreasing = isIncreasing || aSpans(anIndex) > aSpans(anIndex - 1);
+      isDecreasing = isDecreasing || aSpans(anIndex) < aSpans(anIndex - 1);
+    }
+  }
+  if (!isIncreasing || !isDecreasing)
+    return;
+
+  theOrder.Resize(theUVs.Lower(), theUVs.Upper(), Standard_False);
+  for (Standard_Integer anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+    theOrder(anIndex) = anIndex;
+  std::stable_sort(theOrder.begin(),
+                   theOrder.end(),
+                   [&aSpans](const Standard_Integer theIndex1, const Standard_Integer theIndex2) {
+                     return aSpans(theIndex1) < aSpans(theIndex2);
+                   });
+}
+
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Surface, Adaptor3d_Surface)
 
 //=================================================================================================
@@ -128,7 +182,8 @@ Handle(Adaptor3d_Surface) GeomAdaptor_Surface::ShallowCopy() const
   aCopy->myTolV           = myTolV;
   aCopy->myBSplineSurface = myBSplineSurface;
 
-  aCopy->mySurfaceType = mySurfaceType;
+  aCopy->mySurfaceType     = mySurfaceType;
+  aCopy->mySpanCacheMemory = mySpanCacheMemory;
   if (!myNestedEvaluator.IsNull())
   {
     aCopy->myNestedEvaluator = myNestedEvaluator->ShallowCopy();
@@ -154,6 +209,7 @@ void GeomAdaptor_Surface::load(const Handle(Geom_Surface)& S,
   myVFirst = VFirst;
   myVLast  = VLast;
   mySurfaceCache.Nullify();
+  mySpanCaches.Nullify();
 
   if (mySurface != S)
   {
@@ -701,6 +757,25 @@ void GeomAdaptor_Surface::RebuildCache(const Standard_Real theU, const Standard_
     mySurfaceCache
       ->BuildCache(theU, theV, aFlatKnotsU, aFlatKnotsV, aBezier->Poles(), aBezier->Weights());
   }
+  else if (mySurfaceType == GeomAbs_BSplineSurface && mySpanCacheMemory > 0)
+  {
+    // Take cache of the span from the caches of several spans
+    if (mySpanCaches.IsNull())
+      mySpanCaches = new BSplSLib_MultiSpanCache(myBSplineSurface->UDegree(),
+                                                 myBSplineSurface->IsUPeriodic(),
+                                                 myBSplineSurface->UKnotSequence(),
+                                                 myBSplineSurface->VDegree(),
+                                                 myBSplineSurface->IsVPeriodic(),
+                                                 myBSplineSurface->VKnotSequence(),
+                                                 myBSplineSurface->Weights() != NULL,
+                                                 mySpanCacheMemory);
+    mySurfaceCache = mySpanCaches->Cache(theU,
+                                         theV,
+                                         myBSplineSurface->UKnotSequence(),
+                                         myBSplineSurface->VKnotSequence(),
+                                         myBSplineSurface->Poles(),
+                                         myBSplineSurface->Weights());
+  }
   else if (mySurfaceType == GeomAbs_BSplineSurface)
   {
     // Create cache for B-spline
@@ -1031,6 +1106,288 @@ gp_Vec GeomAdaptor_Surface::DN(const Standard_Real    U,
 
 //=================================================================================================
 
+void GeomAdaptor_Surface::D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                                  TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theUVs.Length(),
+                                   "GeomAdaptor_Surface::D0Array");
+  switch (mySurfaceType)
+  {
+    case GeomAbs_BezierSurface:
+    case GeomAbs_BSplineSurface: {
+      const Standard_Integer               aShift = thePoints.Lower() - theUVs.Lower();
+      NCollection_Array1<Standard_Integer> anOrder;
+      orderBySpans(myBSplineSurface, theUVs, anOrder);
+      for (Standard_Integer anIter = theUVs.Lower(); anIter <= theUVs.Upper(); ++anIter)
+      {
+        const Standard_Integer anIndex = anOrder.IsEmpty() ? anIter : anOrder(anIter);
+        const gp_Pnt2d&        aUV     = theUVs(anIndex);
+        if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(aUV.X(), aUV.Y()))
+          RebuildCache(aUV.X(), aUV.Y());
+        mySurfaceCache->D0(aUV.X(), aUV.Y(), thePoints(anIndex + aShift));
+      }
+      break;
+    }
+
+    case GeomAbs_OffsetSurface:
+    case GeomAbs_SurfaceOfExtrusion:
+    case GeomAbs_SurfaceOfRevolution:
+      Standard_NoSuchObject_Raise_if(myNestedEvaluator.IsNull(),
+                                     "GeomAdaptor_Surface::D0Array: evaluator is not initialized");
+      myNestedEvaluator->D0Array(theUVs, thePoints);
+      break;
+
+    default:
+      Adaptor3d_Surface::D0Array(theUVs, thePoints);
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Surface::D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                                  TColgp_Array1OfPnt&         thePoints,
+                                  TColgp_Array1OfVec&         theD1U,
+                                  TColgp_Array1OfVec&         theD1V) const
+{
+  Standard_DimensionError_Raise_if(thePoints.Length() != theUVs.Length()
+                                     || theD1U.Length() != theUVs.Length()
+                                     || theD1V.Length() != theUVs.Length(),
+                                   "GeomAdaptor_Surface::D1Array");
+  const Standard_Integer aShift   = thePoints.Lower() - theUVs.Lower();
+  const Standard_Integer aShiftDU = theD1U.Lower() - theUVs.Lower();
+  const Standard_Integer aShiftDV = theD1V.Lower() - theUVs.Lower();
+  switch (mySurfaceType)
+  {
+    case GeomAbs_BezierSurface:
+    case GeomAbs_BSplineSurface: {
+      NCollection_Array1<Standard_Integer> anOrder;
+      orderBySpans(myBSplineSurface, theUVs, anOrder);
+      for (Standard_Integer anIter = theUVs.Lower(); anIter <= theUVs.Upper(); ++anIter)
+      {
+        const Standard_Integer anIndex = anOrder.IsEmpty() ? anIter : anOrder(anIter);
+        const gp_Pnt2d&        aUV     = theUVs(anIndex);
+        if (!myBSplineSurface.IsNull() && isOnUVBound(aUV.X(), aUV.Y()))
+        {
+          GeomAdaptor_Surface::D1(aUV.X(),
+                                  aUV.Y(),
+                                  thePoints(anIndex + aShift),
+                                  theD1U(anIndex + aShiftDU),
+                                  theD1V(anIndex + aShiftDV));
+          continue;
+        }
+        if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(aUV.X(), aUV.Y()))
+          RebuildCache(aUV.X(), aUV.Y());
+        mySurfaceCache->D1(aUV.X(),
+                           aUV.Y(),
+                           thePoints(anIndex + aShift),
+                           theD1U(anIndex + aShiftDU),
+                           theD1V(anIndex + aShiftDV));
+      }
+      break;
+    }
+
+    case GeomAbs_OffsetSurface:
+    case GeomAbs_SurfaceOfExtrusion:
+    case GeomAbs_SurfaceOfRevolution: {
+      Standard_NoSuchObject_Raise_if(myNestedEvaluator.IsNull(),
+                                     "GeomAdaptor_Surface::D1Array: evaluator is not initialized");
+      myNestedEvaluator->D1Array(theUVs, thePoints, theD1U, theD1V);
+
+      // points on the boundary are evaluated in the parameters adjusted to the boundary
+      for (Standard_Integer anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+      {
+        const gp_Pnt2d& aUV = theUVs(anIndex);
+        if (isOnUVBound(aUV.X(), aUV.Y()))
+        {
+          GeomAdaptor_Surface::D1(aUV.X(),
+                                  aUV.Y(),
+                                  thePoints(anIndex + aShift),
+                                  theD1U(anIndex + aShiftDU),
+                                  theD1V(anIndex + aShiftDV));
+        }
+      }
+      break;
+    }
+
+    default:
+      Adaptor3d_Surface::D1Array(theUVs, thePoints, theD1U, theD1V);
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Surface::D2Array(const TColgp_Array1OfPnt2d& theUVs,
+                                  TColgp_Array1OfPnt&         thePoints,
+                                  TColgp_Array1OfVec&         theD1U,
+                                  TColgp_Array1OfVec&         theD1V,
+                                  TColgp_Array1OfVec&         theD2U,
+                                  TColgp_Array1OfVec&         theD2V,
+                                  TColgp_Array1OfVec&         theD2UV) const
+{
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    Adaptor3d_Surface::D2Array(theUVs, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+    return;
+  }
+
+  Standard_DimensionError_Raise_if(thePoints.Length() != theUVs.Length()
+                                     || theD1U.Length() != theUVs.Length()
+                                     || theD1V.Length() != theUVs.Length()
+                                     || theD2U.Length() != theUVs.Length()
+                                     || theD2V.Length() != theUVs.Length()
+                                     || theD2UV.Length() != theUVs.Length(),
+                                   "GeomAdaptor_Surface::D2Array");
+  NCollection_Array1<Standard_Integer> anOrder;
+  orderBySpans(myBSplineSurface, theUVs, anOrder);
+  for (Standard_Integer anIter = theUVs.Lower(); anIter <= theUVs.Upper(); ++anIter)
+  {
+    const Standard_Integer anIndex  = anOrder.IsEmpty() ? anIter : anOrder(anIter);
+    const Standard_Integer anOffset = anIndex - theUVs.Lower();
+
+    const gp_Pnt2d& aUV   = theUVs(anIndex);
+    gp_Pnt&         aPnt  = thePoints(thePoints.Lower() + anOffset);
+    gp_Vec&         aD1U  = theD1U(theD1U.Lower() + anOffset);
+    gp_Vec&         aD1V  = theD1V(theD1V.Lower() + anOffset);
+    gp_Vec&         aD2U  = theD2U(theD2U.Lower() + anOffset);
+    gp_Vec&         aD2V  = theD2V(theD2V.Lower() + anOffset);
+    gp_Vec&         aD2UV = theD2UV(theD2UV.Lower() + anOffset);
+    if (!myBSplineSurface.IsNull() && isOnUVBound(aUV.X(), aUV.Y()))
+    {
+      GeomAdaptor_Surface::D2(aUV.X(), aUV.Y(), aPnt, aD1U, aD1V, aD2U, aD2V, aD2UV);
+      continue;
+    }
+    if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(aUV.X(), aUV.Y()))
+      RebuildCache(aUV.X(), aUV.Y());
+    mySurfaceCache->D2(aUV.X(), aUV.Y(), aPnt, aD1U, aD1V, aD2U, aD2V, aD2UV);
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Surface::D0Grid(const TColStd_Array1OfReal& theUParams,
+                                 const TColStd_Array1OfReal& theVParams,
+                                 TColgp_Array2OfPnt&         thePoints) const
+{
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    Adaptor3d_Surface::D0Grid(theUParams, theVParams, thePoints);
+    return;
+  }
+
+  Standard_DimensionError_Raise_if(thePoints.ColLength() != theUParams.Length()
+                                     || thePoints.RowLength() != theVParams.Length(),
+                                   "GeomAdaptor_Surface::D0Grid");
+
+  // the grid is split into blocks of parameters lying in the same span
+  Standard_Integer aUFrom = theUParams.Lower();
+  while (aUFrom <= theUParams.Upper())
+  {
+    Standard_Integer aUTo   = aUFrom;
+    Standard_Integer aVFrom = theVParams.Lower();
+    while (aVFrom <= theVParams.Upper())
+    {
+      const Standard_Real aU = theUParams(aUFrom), aV = theVParams(aVFrom);
+      if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(aU, aV))
+        RebuildCache(aU, aV);
+
+      // extend the block while the parameters lie in the span of the cache
+      aUTo = aUFrom;
+      while (aUTo < theUParams.Upper() && mySurfaceCache->IsCacheValid(theUParams(aUTo + 1), aV))
+        ++aUTo;
+      Standard_Integer aVTo = aVFrom;
+      while (aVTo < theVParams.Upper() && mySurfaceCache->IsCacheValid(aU, theVParams(aVTo + 1)))
+        ++aVTo;
+
+      mySurfaceCache->D0Grid(theUParams, aUFrom, aUTo, theVParams, aVFrom, aVTo, thePoints);
+      aVFrom = aVTo + 1;
+    }
+    aUFrom = aUTo + 1;
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Surface::D1Grid(const TColStd_Array1OfReal& theUParams,
+                                 const TColStd_Array1OfReal& theVParams,
+                                 TColgp_Array2OfPnt&         thePoints,
+                                 TColgp_Array2OfVec&         theD1U,
+                                 TColgp_Array2OfVec&         theD1V) const
+{
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    Adaptor3d_Surface::D1Grid(theUParams, theVParams, thePoints, theD1U, theD1V);
+    return;
+  }
+
+  Standard_DimensionError_Raise_if(thePoints.ColLength() != theUParams.Length()
+                                     || thePoints.RowLength() != theVParams.Length()
+                                     || theD1U.ColLength() != theUParams.Length()
+                                     || theD1U.RowLength() != theVParams.Length()
+                                     || theD1V.ColLength() != theUParams.Length()
+                                     || theD1V.RowLength() != theVParams.Length(),
+                                   "GeomAdaptor_Surface::D1Grid");
+
+  // the grid is split into blocks of parameters lying in the same span
+  Standard_Integer aUFrom = theUParams.Lower();
+  while (aUFrom <= theUParams.Upper())
+  {
+    Standard_Integer aUTo   = aUFrom;
+    Standard_Integer aVFrom = theVParams.Lower();
+    while (aVFrom <= theVParams.Upper())
+    {
+      const Standard_Real aU = theUParams(aUFrom), aV = theVParams(aVFrom);
+      if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(aU, aV))
+        RebuildCache(aU, aV);
+
+      // extend the block while the parameters lie in the span of the cache
+      aUTo = aUFrom;
+      while (aUTo < theUParams.Upper() && mySurfaceCache->IsCacheValid(theUParams(aUTo + 1), aV))
+        ++aUTo;
+      Standard_Integer aVTo = aVFrom;
+      while (aVTo < theVParams.Upper() && mySurfaceCache->IsCacheValid(aU, theVParams(aVTo + 1)))
+        ++aVTo;
+
+      mySurfaceCache->D1Grid(theUParams,
+                             aUFrom,
+                             aUTo,
+                             theVParams,
+                             aVFrom,
+                             aVTo,
+                             thePoints,
+                             theD1U,
+                             theD1V);
+      aVFrom = aVTo + 1;
+    }
+    aUFrom = aUTo + 1;
+  }
+
+  if (myBSplineSurface.IsNull())
+  {
+    return;
+  }
+
+  // derivatives on the boundary of B-spline surface are evaluated in the span inside the boundary
+  for (Standard_Integer aUIndex = 0; aUIndex < theUParams.Length(); ++aUIndex)
+  {
+    const Standard_Real aU = theUParams(theUParams.Lower() + aUIndex);
+    for (Standard_Integer aVIndex = 0; aVIndex < theVParams.Length(); ++aVIndex)
+    {
+      const Standard_Real aV = theVParams(theVParams.Lower() + aVIndex);
+      if (isOnUVBound(aU, aV))
+      {
+        GeomAdaptor_Surface::D1(
+          aU,
+          aV,
+          thePoints(thePoints.LowerRow() + aUIndex, thePoints.LowerCol() + aVIndex),
+          theD1U(theD1U.LowerRow() + aUIndex, theD1U.LowerCol() + aVIndex),
+          theD1V(theD1V.LowerRow() + aUIndex, theD1V.LowerCol() + aVIndex));
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
 Standard_Real GeomAdaptor_Surface::UResolution(const Standard_Real R3d) const
 {
   Standard_Real Res = 0.;
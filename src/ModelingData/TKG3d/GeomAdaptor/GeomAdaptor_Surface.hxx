@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Surface.hxx>
 #include <BSplSLib_Cache.hxx>
+#include <BSplSLib_MultiSpanCache.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <GeomEvaluator_Surface.hxx>
 #include <Geom_Surface.hxx>
@@ -46,13 +47,15 @@ public:
         myVLast(0.),
         myTolU(0.),
         myTolV(0.),
-        mySurfaceType(GeomAbs_OtherSurface)
+        mySurfaceType(GeomAbs_OtherSurface),
+        mySpanCacheMemory(0)
   {
   }
 
   GeomAdaptor_Surface(const Handle(Geom_Surface)& theSurf)
       : myTolU(0.),
-        myTolV(0.)
+        myTolV(0.),
+        mySpanCacheMemory(0)
   {
     Load(theSurf);
   }
@@ -65,6 +68,7 @@ public:
                       const Standard_Real         theVLast,
                       const Standard_Real         theTolU = 0.0,
                       const Standard_Real         theTolV = 0.0)
+      : mySpanCacheMemory(0)
   {
     Load(theSurf, theUFirst, theULast, theVFirst, theVLast, theTolU, theTolV);
   }
@@ -107,6 +111,20 @@ public:
 
   const Handle(Geom_Surface)& Surface() const { return mySurface; }
 
+  //! Returns the memory limit for caching of several spans of B-spline surface; 0 by default.
+  Standard_Size SpanCacheMemory() const { return mySpanCacheMemory; }
+
+  //! Sets the memory limit in bytes for caching of several spans of B-spline surface.
+  //! By default only the span of the last evaluated point is cached and the cache is recomputed
+  //! each time the evaluated point leaves the span. With non-zero limit the spans already
+  //! visited are kept (see BSplSLib_MultiSpanCache), which speeds up evaluations jumping
+  //! between spans, like projection of points or marching across the surface.
+  void SetSpanCacheMemory(const Standard_Size theMaxMemory)
+  {
+    mySpanCacheMemory = theMaxMemory;
+    mySpanCaches.Nullify();
+  }
+
   virtual Standard_Real FirstUParameter() const Standard_OVERRIDE { return myUFirst; }
 
   virtual Standard_Real LastUParameter() const Standard_OVERRIDE { return myULast; }
@@ -237,6 +255,45 @@ public:
                             const Standard_Integer Nu,
                             const Standard_Integer Nv) const Standard_OVERRIDE;
 
+  //! Computes the points of the given (U, V) parameters on the surface.
+  //! Parameters on B-spline surface are grouped by spans,
+  //! so that the polynomial coefficients of each span are cached only once for the whole batch.
+  Standard_EXPORT void D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the given (U, V) parameters
+  //! on the surface, see D0Array().
+  Standard_EXPORT void D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         thePoints,
+                               TColgp_Array1OfVec&         theD1U,
+                               TColgp_Array1OfVec&         theD1V) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives of the given (U, V) parameters
+  //! on the surface, see D0Array().
+  Standard_EXPORT void D2Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         thePoints,
+                               TColgp_Array1OfVec&         theD1U,
+                               TColgp_Array1OfVec&         theD1V,
+                               TColgp_Array1OfVec&         theD2U,
+                               TColgp_Array1OfVec&         theD2V,
+                               TColgp_Array1OfVec&         theD2UV) const Standard_OVERRIDE;
+
+  //! Computes the points of the grid of parameters on the surface.
+  //! The grid of B-spline or Bezier surface is evaluated by blocks lying in the same span,
+  //! sharing the evaluation of the cached polynomial between the points of the same line
+  //! (see BSplSLib_Cache::D0Grid()).
+  Standard_EXPORT void D0Grid(const TColStd_Array1OfReal& theUParams,
+                              const TColStd_Array1OfReal& theVParams,
+                              TColgp_Array2OfPnt&         thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the grid of parameters on the surface,
+  //! see D0Grid().
+  Standard_EXPORT void D1Grid(const TColStd_Array1OfReal& theUParams,
+                              const TColStd_Array1OfReal& theVParams,
+                              TColgp_Array2OfPnt&         thePoints,
+                              TColgp_Array2OfVec&         theD1U,
+                              TColgp_Array2OfVec&         theD1V) const Standard_OVERRIDE;
+
   //! Returns the parametric U  resolution corresponding
   //! to the real space resolution <R3d>.
   Standard_EXPORT Standard_Real UResolution(const Standard_Real R3d) const Standard_OVERRIDE;
@@ -332,6 +389,14 @@ private:
   //! \param theV second parameter to identify the span for caching
   Standard_EXPORT void RebuildCache(const Standard_Real theU, const Standard_Real theV) const;
 
+  //! Returns TRUE if the point lies on the boundary of the surface within tolerance,
+  //! in which case the derivatives of B-spline surface need special treatment (see D1())
+  Standard_Boolean isOnUVBound(const Standard_Real theU, const Standard_Real theV) const
+  {
+    return Abs(theU - myUFirst) <= myTolU || Abs(theU - myULast) <= myTolU
+           || Abs(theV - myVFirst) <= myTolV || Abs(theV - myVLast) <= myTolV;
+  }
+
 protected:
   Handle(Geom_Surface) mySurface;
   Standard_Real        myUFirst;
@@ -348,6 +413,9 @@ protected:
   // clang-format off
   Handle(GeomEvaluator_Surface) myNestedEvaluator; ///< Calculates values of nested complex surfaces (offset surface, surface of extrusion or revolution)
   // clang-format on
+
+  Standard_Size                           mySpanCacheMemory; ///< Memory limit for span caches
+  mutable Handle(BSplSLib_MultiSpanCache) mySpanCaches;      ///< Cached data for several spans
 };
 
 #endif // _GeomAdaptor_Surface_HeaderFile
@@ -17,9 +17,9 @@
 
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
-
-class gp_Pnt;
-class gp_Vec;
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <TColStd_Array1OfReal.hxx>
 
 //! Interface for calculation of values and derivatives for different kinds of curves in 3D.
 //! Works both with adaptors and curves.
@@ -46,6 +46,30 @@ public:
   //! Calculates N-th derivatives of curve, where N = theDerU. Raises if N < 1
   virtual gp_Vec DN(const Standard_Real theU, const Standard_Integer theDerU) const = 0;
 
+  //! Values of curve in the given parameters.
+  //! Default implementation evaluates the points one by one.
+  virtual void D0Array(const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& theValues) const
+  {
+    for (Standard_Integer anIndex = 0; anIndex < theParams.Length(); ++anIndex)
+    {
+      D0(theParams(theParams.Lower() + anIndex), theValues(theValues.Lower() + anIndex));
+    }
+  }
+
+  //! Values and first derivatives of curve in the given parameters.
+  //! Default implementation evaluates the points one by one.
+  virtual void D1Array(const TColStd_Array1OfReal& theParams,
+                       TColgp_Array1OfPnt&         theValues,
+                       TColgp_Array1OfVec&         theD1) const
+  {
+    for (Standard_Integer anIndex = 0; anIndex < theParams.Length(); ++anIndex)
+    {
+      D1(theParams(theParams.Lower() + anIndex),
+         theValues(theValues.Lower() + anIndex),
+         theD1(theD1.Lower() + anIndex));
+    }
+  }
+
   virtual Handle(GeomEvaluator_Curve) ShallowCopy() const = 0;
 
   DEFINE_STANDARD_RTTI_INLINE(GeomEvaluator_Curve, Standard_Transient)
@@ -111,6 +111,41 @@ gp_Vec GeomEvaluator_OffsetCurve::DN(const Standard_Real    theU,
   return aDN;
 }
 
+void GeomEvaluator_OffsetCurve::D0Array(const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt&         theValues) const
+{
+  if (myBaseAdaptor.IsNull())
+  {
+    GeomEvaluator_Curve::D0Array(theParams, theValues);
+    return;
+  }
+
+  TColgp_Array1OfVec aD1(theValues.Lower(), theValues.Upper());
+  myBaseAdaptor->D1Array(theParams, theValues, aD1);
+  for (Standard_Integer anIndex = theValues.Lower(); anIndex <= theValues.Upper(); ++anIndex)
+    CalculateD0(theValues(anIndex), aD1(anIndex));
+}
+
+void GeomEvaluator_OffsetCurve::D1Array(const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt&         theValues,
+                                        TColgp_Array1OfVec&         theD1) const
+{
+  if (myBaseAdaptor.IsNull())
+  {
+    GeomEvaluator_Curve::D1Array(theParams, theValues, theD1);
+    return;
+  }
+
+  TColgp_Array1OfVec aD2(theValues.Lower(), theValues.Upper());
+  myBaseAdaptor->D2Array(theParams, theValues, theD1, aD2);
+  for (Standard_Integer anIndex = 0; anIndex < theValues.Length(); ++anIndex)
+  {
+    CalculateD1(theValues(theValues.Lower() + anIndex),
+                theD1(theD1.Lower() + anIndex),
+                aD2(aD2.Lower() + anIndex));
+  }
+}
+
 Handle(GeomEvaluator_Curve) GeomEvaluator_OffsetCurve::ShallowCopy() const
 {
   Handle(GeomEvaluator_OffsetCurve) aCopy;
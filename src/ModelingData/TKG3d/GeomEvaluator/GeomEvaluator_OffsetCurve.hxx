@@ -58,6 +58,16 @@ public:
   Standard_EXPORT gp_Vec DN(const Standard_Real    theU,
                             const Standard_Integer theDeriv) const Standard_OVERRIDE;
 
+  //! Values of curve in the given parameters.
+  //! Derivatives of the base curve adaptor are evaluated by a single batch.
+  Standard_EXPORT void D0Array(const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         theValues) const Standard_OVERRIDE;
+  //! Values and first derivatives of curve in the given parameters.
+  //! Derivatives of the base curve adaptor are evaluated by a single batch.
+  Standard_EXPORT void D1Array(const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt&         theValues,
+                               TColgp_Array1OfVec&         theD1) const Standard_OVERRIDE;
+
   Standard_EXPORT virtual Handle(GeomEvaluator_Curve) ShallowCopy() const Standard_OVERRIDE;
 
   DEFINE_STANDARD_RTTIEXT(GeomEvaluator_OffsetCurve, GeomEvaluator_Curve)
@@ -456,6 +456,78 @@ gp_Vec GeomEvaluator_OffsetSurface::DN(const Standard_Real    theU,
   }
 }
 
+void GeomEvaluator_OffsetSurface::D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                                          TColgp_Array1OfPnt&         theValues) const
+{
+  if (myBaseAdaptor.IsNull())
+  {
+    GeomEvaluator_Surface::D0Array(theUVs, theValues);
+    return;
+  }
+
+  TColgp_Array1OfVec aD1U(theValues.Lower(), theValues.Upper());
+  TColgp_Array1OfVec aD1V(theValues.Lower(), theValues.Upper());
+  myBaseAdaptor->D1Array(theUVs, theValues, aD1U, aD1V);
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV    = theUVs(theUVs.Lower() + anIndex);
+    gp_Pnt&         aValue = theValues(theValues.Lower() + anIndex);
+    const gp_Vec&   aDU    = aD1U(aD1U.Lower() + anIndex);
+    const gp_Vec&   aDV    = aD1V(aD1V.Lower() + anIndex);
+    CheckInfinite(aDU, aDV);
+    try
+    {
+      CalculateD0(aUV.X(), aUV.Y(), aValue, aDU, aDV);
+    }
+    catch (Geom_UndefinedValue&)
+    {
+      // the point requires shifting, evaluate it alone
+      D0(aUV.X(), aUV.Y(), aValue);
+    }
+  }
+}
+
+void GeomEvaluator_OffsetSurface::D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                                          TColgp_Array1OfPnt&         theValues,
+                                          TColgp_Array1OfVec&         theD1U,
+                                          TColgp_Array1OfVec&         theD1V) const
+{
+  if (myBaseAdaptor.IsNull())
+  {
+    GeomEvaluator_Surface::D1Array(theUVs, theValues, theD1U, theD1V);
+    return;
+  }
+
+  TColgp_Array1OfVec aD2U(theValues.Lower(), theValues.Upper());
+  TColgp_Array1OfVec aD2V(theValues.Lower(), theValues.Upper());
+  TColgp_Array1OfVec aD2UV(theValues.Lower(), theValues.Upper());
+  myBaseAdaptor->D2Array(theUVs, theValues, theD1U, theD1V, aD2U, aD2V, aD2UV);
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV    = theUVs(theUVs.Lower() + anIndex);
+    gp_Pnt&         aValue = theValues(theValues.Lower() + anIndex);
+    gp_Vec&         aDU    = theD1U(theD1U.Lower() + anIndex);
+    gp_Vec&         aDV    = theD1V(theD1V.Lower() + anIndex);
+    CheckInfinite(aDU, aDV);
+    try
+    {
+      CalculateD1(aUV.X(),
+                  aUV.Y(),
+                  aValue,
+                  aDU,
+                  aDV,
+                  aD2U(aD2U.Lower() + anIndex),
+                  aD2V(aD2V.Lower() + anIndex),
+                  aD2UV(aD2UV.Lower() + anIndex));
+    }
+    catch (Geom_UndefinedValue&)
+    {
+      // the point requires shifting, evaluate it alone
+      D1(aUV.X(), aUV.Y(), aValue, aDU, aDV);
+    }
+  }
+}
+
 Handle(GeomEvaluator_Surface) GeomEvaluator_OffsetSurface::ShallowCopy() const
 {
   Handle(GeomEvaluator_OffsetSurface) aCopy;
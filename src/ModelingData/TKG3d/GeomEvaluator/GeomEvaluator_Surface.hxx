@@ -17,9 +17,9 @@
 
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
-
-class gp_Pnt;
-class gp_Vec;
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 //! Interface for calculation of values and derivatives for different kinds of surfaces.
 //! Works both with adaptors and surfaces.
@@ -66,6 +66,35 @@ public:
                     const Standard_Integer theDerU,
                     const Standard_Integer theDerV) const = 0;
 
+  //! Values of surface in the given (U, V) parameters.
+  //! Default implementation evaluates the points one by one.
+  virtual void D0Array(const TColgp_Array1OfPnt2d& theUVs, TColgp_Array1OfPnt& theValues) const
+  {
+    for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+    {
+      const gp_Pnt2d& aUV = theUVs(theUVs.Lower() + anIndex);
+      D0(aUV.X(), aUV.Y(), theValues(theValues.Lower() + anIndex));
+    }
+  }
+
+  //! Values and first derivatives of surface in the given (U, V) parameters.
+  //! Default implementation evaluates the points one by one.
+  virtual void D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                       TColgp_Array1OfPnt&         theValues,
+                       TColgp_Array1OfVec&         theD1U,
+                       TColgp_Array1OfVec&         theD1V) const
+  {
+    for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+    {
+      const gp_Pnt2d& aUV = theUVs(theUVs.Lower() + anIndex);
+      D1(aUV.X(),
+         aUV.Y(),
+         theValues(theValues.Lower() + anIndex),
+         theD1U(theD1U.Lower() + anIndex),
+         theD1V(theD1V.Lower() + anIndex));
+    }
+  }
+
   virtual Handle(GeomEvaluator_Surface) ShallowCopy() const = 0;
 
   DEFINE_STANDARD_RTTI_INLINE(GeomEvaluator_Surface, Standard_Transient)
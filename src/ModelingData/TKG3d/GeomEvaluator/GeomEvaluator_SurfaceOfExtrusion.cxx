@@ -135,6 +135,47 @@ gp_Vec GeomEvaluator_SurfaceOfExtrusion::DN(const Standard_Real theU,
   return aResult;
 }
 
+void GeomEvaluator_SurfaceOfExtrusion::D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                                               TColgp_Array1OfPnt&         theValues) const
+{
+  if (myBaseAdaptor.IsNull())
+  {
+    GeomEvaluator_Surface::D0Array(theUVs, theValues);
+    return;
+  }
+
+  TColStd_Array1OfReal aParams(theValues.Lower(), theValues.Upper());
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+    aParams(aParams.Lower() + anIndex) = theUVs(theUVs.Lower() + anIndex).X();
+
+  myBaseAdaptor->D0Array(aParams, theValues);
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+    Shift(theUVs(theUVs.Lower() + anIndex).Y(), theValues(theValues.Lower() + anIndex));
+}
+
+void GeomEvaluator_SurfaceOfExtrusion::D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                                               TColgp_Array1OfPnt&         theValues,
+                                               TColgp_Array1OfVec&         theD1U,
+                                               TColgp_Array1OfVec&         theD1V) const
+{
+  if (myBaseAdaptor.IsNull())
+  {
+    GeomEvaluator_Surface::D1Array(theUVs, theValues, theD1U, theD1V);
+    return;
+  }
+
+  TColStd_Array1OfReal aParams(theValues.Lower(), theValues.Upper());
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+    aParams(aParams.Lower() + anIndex) = theUVs(theUVs.Lower() + anIndex).X();
+
+  myBaseAdaptor->D1Array(aParams, theValues, theD1U);
+  for (Standard_Integer anIndex = 0; anIndex < theUVs.Length(); ++anIndex)
+  {
+    Shift(theUVs(theUVs.Lower() + anIndex).Y(), theValues(theValues.Lower() + anIndex));
+    theD1V(theD1V.Lower() + anIndex) = myDirection;
+  }
+}
+
 Handle(GeomEvaluator_Surface) GeomEvaluator_SurfaceOfExtrusion::ShallowCopy() const
 {
   Handle(GeomEvaluator_SurfaceOfExtrusion) aCopy;
@@ -74,6 +74,17 @@ public:
                             const Standard_Integer theDerU,
                             const Standard_Integer theDerV) const Standard_OVERRIDE;
 
+  //! Values of surface in the given (U, V) parameters.
+  //! Points of the base curve adaptor are evaluated by a single batch.
+  Standard_EXPORT void D0Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         theValues) const Standard_OVERRIDE;
+  //! Values and first derivatives of surface in the given (U, V) parameters.
+  //! Points of the base curve adaptor are evaluated by a single batch.
+  Standard_EXPORT void D1Array(const TColgp_Array1OfPnt2d& theUVs,
+                               TColgp_Array1OfPnt&         theValues,
+                               TColgp_Array1OfVec&         theD1U,
+                               TColgp_Array1OfVec&         theD1V) const Standard_OVERRIDE;
+
   Standard_EXPORT Handle(GeomEvaluator_Surface) ShallowCopy() const Standard_OVERRIDE;
 
   DEFINE_STANDARD_RTTIEXT(GeomEvaluator_SurfaceOfExtrusion, GeomEvaluator_Surface)
@@ -0,0 +1,514 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Extrema_SurfaceProjector.hxx>
+
+#include <BVH_Distance.hxx>
+#include <BVH_Tools.hxx>
+#include <Extrema_GenLocateExtPS.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_DimensionError.hxx>
+#include <Standard_DomainError.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! Default number of samples in one direction.
+const Standard_Integer THE_NB_SAMPLES_DEFAULT = 32;
+
+//! Maximum number of samples in one direction defined automatically.
+const Standard_Integer THE_NB_SAMPLES_MAX = 400;
+
+//! Returns the number of samples in one direction.
+//! B-spline surfaces get at least one sample per pole on every knot span.
+Standard_Integer nbSamples(const Standard_Integer theNbSpans, const Standard_Integer theDegree)
+{
+  return std::min(std::max(THE_NB_SAMPLES_DEFAULT, theNbSpans * (theDegree + 1) + 1),
+                  THE_NB_SAMPLES_MAX);
+}
+
+//! Fills the array of uniformly distributed parameters.
+void fillParams(const Standard_Real   theFirst,
+                const Standard_Real   theLast,
+                TColStd_Array1OfReal& theParams)
+{
+  const Standard_Real aStep = (theLast - theFirst) / (theParams.Length() - 1);
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex < theParams.Upper(); ++anIndex)
+  {
+    theParams.ChangeValue(anIndex) = theFirst + (anIndex - theParams.Lower()) * aStep;
+  }
+  theParams.ChangeLast() = theLast;
+}
+
+//! Returns the sampled point of the U-iso (theIsUIso is TRUE) or V-iso grid line.
+const gp_Pnt& linePoint(const TColgp_Array2OfPnt& thePoints,
+                        const Standard_Boolean    theIsUIso,
+                        const Standard_Integer    theLine,
+                        const Standard_Integer    theIndex)
+{
+  return theIsUIso ? thePoints.Value(theLine, theIndex) : thePoints.Value(theIndex, theLine);
+}
+
+//! Returns TRUE if the sampled points of the grid line theLine coincide with
+//! the points of the line theOther, or with each other if theOther is equal to theLine.
+Standard_Boolean isSameLine(const TColgp_Array2OfPnt& thePoints,
+                            const Standard_Boolean    theIsUIso,
+                            const Standard_Integer    theLine,
+                            const Standard_Integer    theOther)
+{
+  const Standard_Integer aLower  = theIsUIso ? thePoints.LowerCol() : thePoints.LowerRow();
+  const Standard_Integer anUpper = theIsUIso ? thePoints.UpperCol() : thePoints.UpperRow();
+  for (Standard_Integer anIter = aLower; anIter <= anUpper; ++anIter)
+  {
+    const gp_Pnt& aPnt    = linePoint(thePoints, theIsUIso, theLine, anIter);
+    const gp_Pnt& anOther = theOther != theLine
+                              ? linePoint(thePoints, theIsUIso, theOther, anIter)
+                              : linePoint(thePoints, theIsUIso, theLine, aLower);
+    if (aPnt.SquareDistance(anOther) > Precision::SquareConfusion())
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//! Refines the projection by the local search started from the given point.
+//! Returns TRUE if the search is done and the result is not worse than the current one.
+Standard_Boolean refine(Extrema_GenLocateExtPS& theLocator,
+                        const gp_Pnt&           thePoint,
+                        const Extrema_POnSurf&  theStart,
+                        Extrema_POnSurf&        theResult,
+                        Standard_Real&          theSquareDistance)
+{
+  Standard_Real aU0 = 0.0, aV0 = 0.0;
+  theStart.Parameter(aU0, aV0);
+  theLocator.Perform(thePoint, aU0, aV0, Standard_False);
+  if (!theLocator.IsDone() || theLocator.SquareDistance() > theSquareDistance)
+  {
+    return Standard_False;
+  }
+  theSquareDistance = theLocator.SquareDistance();
+  theResult         = theLocator.Point();
+  return Standard_True;
+}
+
+//! Updates the nearest neighbour by the sample.
+void checkNeighbour(const NCollection_Array1<Extrema_POnSurf>& theSamples,
+                    const gp_Pnt&                              thePoint,
+                    const Standard_Integer                     theSample,
+                    Standard_Integer&                          theBest,
+                    Standard_Real&                             theBestSqDist)
+{
+  const Standard_Real aSqDist = thePoint.SquareDistance(theSamples.Value(theSample).Value());
+  if (aSqDist < theBestSqDist)
+  {
+    theBest       = theSample;
+    theBestSqDist = aSqDist;
+  }
+}
+} // namespace
+
+//! Tool searching the nearest sample of the surface to the point.
+class Extrema_SurfaceProjector_NearestSample
+    : public BVH_Distance<Standard_Real,
+                          3,
+                          BVH_Vec3d,
+                          BVH_BoxSet<Standard_Real, 3, Standard_Integer>>
+{
+public:
+  //! Constructor.
+  Extrema_SurfaceProjector_NearestSample()
+      : mySample(0)
+  {
+  }
+
+  //! Returns the index of the nearest sample.
+  Standard_Integer Sample() const { return mySample; }
+
+  //! Rejects the node by the distance to its bounding box.
+  virtual Standard_Boolean RejectNode(const BVH_Vec3d& theCornerMin,
+                                      const BVH_Vec3d& theCornerMax,
+                                      Standard_Real&   theMetric) const Standard_OVERRIDE
+  {
+    theMetric =
+      BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance(myObject, theCornerMin, theCornerMax);
+    return RejectMetric(theMetric);
+  }
+
+  //! Accepts the sample if it is closer than the current one.
+  virtual Standard_Boolean Accept(const Standard_Integer theIndex,
+                                  const Standard_Real&) Standard_OVERRIDE
+  {
+    const BVH_Vec3d     aDelta  = myBVHSet->Box(theIndex).CornerMin() - myObject;
+    const Standard_Real aSqDist = aDelta.Dot(aDelta);
+    if (aSqDist < myDistance)
+    {
+      myDistance = aSqDist;
+      mySample   = myBVHSet->Element(theIndex);
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+  Standard_Integer mySample;
+};
+
+//! Functor projecting the points in parallel threads.
+class Extrema_SurfaceProjector::ProjectionFunctor
+{
+public:
+  //! Constructor.
+  ProjectionFunctor(const Extrema_SurfaceProjector&      theProjector,
+                    const OSD_ThreadPool::Launcher&      theLauncher,
+                    const TColgp_Array1OfPnt&            thePoints,
+                    NCollection_Array1<Extrema_POnSurf>& theResults,
+                    TColStd_Array1OfReal&                theSquareDistances)
+      : myProjector(theProjector),
+        myPoints(thePoints),
+        myResults(theResults),
+        mySquareDistances(theSquareDistances),
+        mySurfaces(theLauncher.LowerThreadIndex(), theLauncher.UpperThreadIndex())
+  {
+    //
+  }
+
+  //! Projects the point with the specified index.
+  void operator()(int theThreadIndex, int thePntIndex) const
+  {
+    Handle(Adaptor3d_Surface)& aSurface = mySurfaces.ChangeValue(theThreadIndex);
+    if (aSurface.IsNull())
+    {
+      aSurface = myProjector.mySurface->ShallowCopy();
+    }
+    const Standard_Integer anOffset = thePntIndex - myPoints.Lower();
+    myProjector.project(*aSurface,
+                        myPoints.Value(thePntIndex),
+                        myResults.ChangeValue(myResults.Lower() + anOffset),
+                        mySquareDistances.ChangeValue(mySquareDistances.Lower() + anOffset));
+  }
+
+private:
+  const Extrema_SurfaceProjector&                       myProjector;
+  const TColgp_Array1OfPnt&                             myPoints;
+  NCollection_Array1<Extrema_POnSurf>&                  myResults;
+  TColStd_Array1OfReal&                                 mySquareDistances;
+  mutable NCollection_Array1<Handle(Adaptor3d_Surface)> mySurfaces;
+};
+
+//=================================================================================================
+
+Extrema_SurfaceProjector::Extrema_SurfaceProjector()
+    : myNbU(0),
+      myNbV(0),
+      myTolU(Precision::PConfusion()),
+      myTolV(Precision::PConfusion()),
+      myUMin(0.0),
+      myUMax(0.0),
+      myVMin(0.0),
+      myVMax(0.0),
+      myIsUClosed(Standard_False),
+      myIsVClosed(Standard_False)
+{
+  myIsDegenerated[0] = myIsDegenerated[1] = myIsDegenerated[2] = myIsDegenerated[3] =
+    Standard_False;
+}
+
+//=================================================================================================
+
+Extrema_SurfaceProjector::Extrema_SurfaceProjector(const Handle(Adaptor3d_Surface)& theSurface,
+                                                   const Standard_Integer           theNbU,
+                                                   const Standard_Integer           theNbV,
+                                                   const Standard_Real              theTolU,
+                                                   const Standard_Real              theTolV)
+    : myNbU(0),
+      myNbV(0),
+      myTolU(theTolU),
+      myTolV(theTolV),
+      myUMin(0.0),
+      myUMax(0.0),
+      myVMin(0.0),
+      myVMax(0.0),
+      myIsUClosed(Standard_False),
+      myIsVClosed(Standard_False)
+{
+  myIsDegenerated[0] = myIsDegenerated[1] = myIsDegenerated[2] = myIsDegenerated[3] =
+    Standard_False;
+  Init(theSurface, theNbU, theNbV, theTolU, theTolV);
+}
+
+//=================================================================================================
+
+void Extrema_SurfaceProjector::Init(const Handle(Adaptor3d_Surface)& theSurface,
+                                    const Standard_Integer           theNbU,
+                                    const Standard_Integer           theNbV,
+                                    const Standard_Real              theTolU,
+                                    const Standard_Real              theTolV)
+{
+  mySurface.Nullify();
+  mySampleSet.Nullify();
+  myNbU  = 0;
+  myNbV  = 0;
+  myTolU = theTolU;
+  myTolV = theTolV;
+  if (theSurface.IsNull())
+  {
+    return;
+  }
+
+  myUMin = theSurface->FirstUParameter();
+  myUMax = theSurface->LastUParameter();
+  myVMin = theSurface->FirstVParameter();
+  myVMax = theSurface->LastVParameter();
+  if (Precision::IsInfinite(myUMin) || Precision::IsInfinite(myUMax)
+      || Precision::IsInfinite(myVMin) || Precision::IsInfinite(myVMax))
+  {
+    throw Standard_DomainError("Extrema_SurfaceProjector::Init(), surface is unbounded");
+  }
+
+  myNbU = theNbU;
+  myNbV = theNbV;
+  if (myNbU < 2 || myNbV < 2)
+  {
+    Standard_Integer aNbU = THE_NB_SAMPLES_DEFAULT, aNbV = THE_NB_SAMPLES_DEFAULT;
+    switch (theSurface->GetType())
+    {
+      case GeomAbs_BSplineSurface:
+        aNbU = nbSamples(theSurface->NbUKnots() - 1, theSurface->UDegree());
+        aNbV = nbSamples(theSurface->NbVKnots() - 1, theSurface->VDegree());
+        break;
+      case GeomAbs_BezierSurface:
+        aNbU = nbSamples(1, theSurface->UDegree());
+        aNbV = nbSamples(1, theSurface->VDegree());
+        break;
+      default:
+        break;
+    }
+    myNbU = myNbU < 2 ? aNbU : myNbU;
+    myNbV = myNbV < 2 ? aNbV : myNbV;
+  }
+
+  TColStd_Array1OfReal aUParams(1, myNbU), aVParams(1, myNbV);
+  fillParams(myUMin, myUMax, aUParams);
+  fillParams(myVMin, myVMax, aVParams);
+  TColgp_Array2OfPnt aPoints(1, myNbU, 1, myNbV);
+  theSurface->D0Grid(aUParams, aVParams, aPoints);
+
+  // seams and degenerated boundaries are detected by samples to handle any closed surface
+  myIsUClosed        = isSameLine(aPoints, Standard_True, 1, myNbU);
+  myIsVClosed        = isSameLine(aPoints, Standard_False, 1, myNbV);
+  myIsDegenerated[0] = isSameLine(aPoints, Standard_True, 1, 1);
+  myIsDegenerated[1] = isSameLine(aPoints, Standard_True, myNbU, myNbU);
+  myIsDegenerated[2] = isSameLine(aPoints, Standard_False, 1, 1);
+  myIsDegenerated[3] = isSameLine(aPoints, Standard_False, myNbV, myNbV);
+
+  mySurface = theSurface;
+  mySamples.Resize(0, myNbU * myNbV - 1, Standard_False);
+  mySampleSet = new SampleSet();
+  mySampleSet->SetSize(mySamples.Size());
+  Standard_Integer aSample = 0;
+  for (Standard_Integer aUIter = 1; aUIter <= myNbU; ++aUIter)
+  {
+    for (Standard_Integer aVIter = 1; aVIter <= myNbV; ++aVIter, ++aSample)
+    {
+      const gp_Pnt& aPnt = aPoints.Value(aUIter, aVIter);
+      mySamples.ChangeValue(aSample).SetParameters(aUParams(aUIter), aVParams(aVIter), aPnt);
+
+      const BVH_Vec3d aVec(aPnt.X(), aPnt.Y(), aPnt.Z());
+      mySampleSet->Add(aSample, BVH_Box<Standard_Real, 3>(aVec, aVec));
+    }
+  }
+  mySampleSet->Build();
+}
+
+//=================================================================================================
+
+Standard_Boolean Extrema_SurfaceProjector::Perform(const gp_Pnt&    thePoint,
+                                                   Extrema_POnSurf& theResult,
+                                                   Standard_Real&   theSquareDistance)
+{
+  if (!IsInitialized())
+  {
+    return Standard_False;
+  }
+  project(*mySurface, thePoint, theResult, theSquareDistance);
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean Extrema_SurfaceProjector::Perform(const TColgp_Array1OfPnt&            thePoints,
+                                                   NCollection_Array1<Extrema_POnSurf>& theResults,
+                                                   TColStd_Array1OfReal&  theSquareDistances,
+                                                   const Standard_Boolean theToRunParallel)
+{
+  Standard_DimensionError_Raise_if(theResults.Length() != thePoints.Length()
+                                     || theSquareDistances.Length() != thePoints.Length(),
+                                   "Extrema_SurfaceProjector::Perform(), wrong size of arrays");
+  if (!IsInitialized())
+  {
+    return Standard_False;
+  }
+  if (thePoints.IsEmpty())
+  {
+    return Standard_True;
+  }
+
+  if (!theToRunParallel)
+  {
+    for (Standard_Integer aPntIter = 0; aPntIter < thePoints.Length(); ++aPntIter)
+    {
+      project(*mySurface,
+              thePoints.Value(thePoints.Lower() + aPntIter),
+              theResults.ChangeValue(theResults.Lower() + aPntIter),
+              theSquareDistances.ChangeValue(theSquareDistances.Lower() + aPntIter));
+    }
+    return Standard_True;
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const int aNbThreads = std::min(thePoints.Length(), aThreadPool->NbDefaultThreadsToLaunch());
+  OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+  ProjectionFunctor aFunctor(*this, aLauncher, thePoints, theResults, theSquareDistances);
+  aLauncher.Perform(thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+  return Standard_True;
+}
+
+//=================================================================================================
+
+void Extrema_SurfaceProjector::project(const Adaptor3d_Surface& theSurface,
+                                       const gp_Pnt&            thePoint,
+                                       Extrema_POnSurf&         theResult,
+                                       Standard_Real&           theSquareDistance) const
+{
+  // the nearest sample is the starting point and the fallback result of the local search
+  Extrema_SurfaceProjector_NearestSample aNearest;
+  aNearest.SetBVHSet(mySampleSet.get());
+  aNearest.SetObject(BVH_Vec3d(thePoint.X(), thePoint.Y(), thePoint.Z()));
+  theSquareDistance              = aNearest.ComputeDistance();
+  const Extrema_POnSurf& aSample = mySamples.Value(aNearest.Sample());
+  theResult                      = aSample;
+
+  Extrema_GenLocateExtPS aLocator(theSurface, myTolU, myTolV);
+
+  Standard_Boolean isRefined = refine(aLocator, thePoint, aSample, theResult, theSquareDistance);
+  if (!isRefined || isOnBoundary(theResult))
+  {
+    // the search may stop on the seam or on the degenerated boundary
+    const Standard_Integer aNeighbour = nearestNeighbour(aNearest.Sample(), thePoint);
+    if (aNeighbour >= 0
+        && refine(aLocator, thePoint, mySamples(aNeighbour), theResult, theSquareDistance))
+    {
+      isRefined = Standard_True;
+    }
+  }
+  if (isRefined)
+  {
+    return;
+  }
+
+  // normal projection does not exist near the sample, minimize the distance instead;
+  // this search is not bounded by the parametric domain
+  Standard_Real aU0 = 0.0, aV0 = 0.0;
+  aSample.Parameter(aU0, aV0);
+  aLocator.Perform(thePoint, aU0, aV0, Standard_True);
+  if (!aLocator.IsDone() || aLocator.SquareDistance() >= theSquareDistance)
+  {
+    return;
+  }
+
+  Standard_Real aU = 0.0, aV = 0.0;
+  aLocator.Point().Parameter(aU, aV);
+  if (aU >= myUMin - myTolU && aU <= myUMax + myTolU && aV >= myVMin - myTolV
+      && aV <= myVMax + myTolV)
+  {
+    theSquareDistance = aLocator.SquareDistance();
+    theResult         = aLocator.Point();
+  }
+}
+
+//=================================================================================================
+
+Standard_Integer Extrema_SurfaceProjector::nearestNeighbour(const Standard_Integer theSample,
+                                                            const gp_Pnt&          thePoint) const
+{
+  const Standard_Integer aU       = theSample / myNbV;
+  const Standard_Integer aV       = theSample % myNbV;
+  const Standard_Boolean isUBound = aU == 0 || aU == myNbU - 1;
+  const Standard_Boolean isVBound = aV == 0 || aV == myNbV - 1;
+
+  Standard_Integer aBest     = -1;
+  Standard_Real    aBestDist = RealLast();
+  for (Standard_Integer aDU = -1; aDU <= 1; ++aDU)
+  {
+    for (Standard_Integer aDV = -1; aDV <= 1; ++aDV)
+    {
+      Standard_Integer aNeighbU = aU + aDU;
+      Standard_Integer aNeighbV = aV + aDV;
+      if (aNeighbU < 0 || aNeighbU >= myNbU)
+      {
+        // first and last sampled lines of closed surface coincide
+        aNeighbU = myIsUClosed ? (aNeighbU < 0 ? myNbU - 2 : 1) : -1;
+      }
+      if (aNeighbV < 0 || aNeighbV >= myNbV)
+      {
+        aNeighbV = myIsVClosed ? (aNeighbV < 0 ? myNbV - 2 : 1) : -1;
+      }
+      if ((aDU == 0 && aDV == 0) || aNeighbU < 0 || aNeighbV < 0 || (isUBound && aDU == 0)
+          || (isVBound && aDV == 0))
+      {
+        // the search from the samples on the same boundary line would stop on it again
+        continue;
+      }
+
+      checkNeighbour(mySamples, thePoint, aNeighbU * myNbV + aNeighbV, aBest, aBestDist);
+    }
+  }
+
+  // all samples of degenerated boundary are the same point, so the parameter along the boundary
+  // is defined by the nearest sample of the next grid line
+  const Standard_Boolean isUDegen =
+    (aU == 0 && myIsDegenerated[0]) || (aU == myNbU - 1 && myIsDegenerated[1]);
+  const Standard_Boolean isVDegen =
+    (aV == 0 && myIsDegenerated[2]) || (aV == myNbV - 1 && myIsDegenerated[3]);
+  if (isUDegen && myNbU > 2)
+  {
+    const Standard_Integer aNeighbU = aU == 0 ? 1 : myNbU - 2;
+    for (Standard_Integer aNeighbV = 0; aNeighbV < myNbV; ++aNeighbV)
+    {
+      checkNeighbour(mySamples, thePoint, aNeighbU * myNbV + aNeighbV, aBest, aBestDist);
+    }
+  }
+  if (isVDegen && myNbV > 2)
+  {
+    const Standard_Integer aNeighbV = aV == 0 ? 1 : myNbV - 2;
+    for (Standard_Integer aNeighbU = 0; aNeighbU < myNbU; ++aNeighbU)
+    {
+      checkNeighbour(mySamples, thePoint, aNeighbU * myNbV + aNeighbV, aBest, aBestDist);
+    }
+  }
+  return aBest;
+}
+
+//=================================================================================================
+
+Standard_Boolean Extrema_SurfaceProjector::isOnBoundary(const Extrema_POnSurf& thePoint) const
+{
+  Standard_Real aU = 0.0, aV = 0.0;
+  thePoint.Parameter(aU, aV);
+  return aU <= myUMin + myTolU || aU >= myUMax - myTolU || aV <= myVMin + myTolV
+         || aV >= myVMax - myTolV;
+}
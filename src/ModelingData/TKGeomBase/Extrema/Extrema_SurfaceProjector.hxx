@@ -0,0 +1,144 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _Extrema_SurfaceProjector_HeaderFile
+#define _Extrema_SurfaceProjector_HeaderFile
+
+#include <Adaptor3d_Surface.hxx>
+#include <BVH_BoxSet.hxx>
+#include <Extrema_POnSurf.hxx>
+#include <NCollection_Array1.hxx>
+#include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+//! Reusable projector of points on the surface.
+//!
+//! The surface is sampled by the regular grid of parameters once at initialization,
+//! and the samples are organized into BVH tree. Each point is projected by searching
+//! the nearest sample in the tree and refining it by the local extremum search
+//! (Extrema_GenLocateExtPS) started from the parameters of this sample.
+//! The result is never worse than the nearest sample, so the sampling density
+//! defines the robustness of the projection for the points far from the surface
+//! or close to its curvature centers.
+//!
+//! Unlike Extrema_ExtPS, the projector returns only the nearest point (global minimum
+//! of distance) and keeps the sample tree between the calls, which makes it suitable
+//! for projecting large sets of points (e.g. point clouds) on the same surface.
+//! Projection of the array of points can be performed in parallel threads.
+class Extrema_SurfaceProjector
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor.
+  Standard_EXPORT Extrema_SurfaceProjector();
+
+  //! Constructor initializing the projector, see Init().
+  Standard_EXPORT Extrema_SurfaceProjector(const Handle(Adaptor3d_Surface)& theSurface,
+                                           const Standard_Integer           theNbU = 0,
+                                           const Standard_Integer           theNbV = 0,
+                                           const Standard_Real theTolU = Precision::PConfusion(),
+                                           const Standard_Real theTolV = Precision::PConfusion());
+
+  //! Initializes the projector: samples the surface within its parametric bounds
+  //! and builds the tree of samples.
+  //! @param[in] theSurface  surface with finite parametric bounds
+  //! @param[in] theNbU  number of samples along U; if zero, it is defined by the surface type
+  //!                    (number of knot spans and degree for B-spline surfaces)
+  //! @param[in] theNbV  number of samples along V, see theNbU
+  //! @param[in] theTolU  parametric tolerance of the local search along U
+  //! @param[in] theTolV  parametric tolerance of the local search along V
+  //! Raises Standard_DomainError if the surface is unbounded.
+  Standard_EXPORT void Init(const Handle(Adaptor3d_Surface)& theSurface,
+                            const Standard_Integer           theNbU  = 0,
+                            const Standard_Integer           theNbV  = 0,
+                            const Standard_Real              theTolU = Precision::PConfusion(),
+                            const Standard_Real              theTolV = Precision::PConfusion());
+
+  //! Returns TRUE if the projector is initialized.
+  Standard_Boolean IsInitialized() const { return !mySampleSet.IsNull(); }
+
+  //! Returns the surface.
+  const Handle(Adaptor3d_Surface)& Surface() const { return mySurface; }
+
+  //! Returns the number of samples along U.
+  Standard_Integer NbSamplesU() const { return myNbU; }
+
+  //! Returns the number of samples along V.
+  Standard_Integer NbSamplesV() const { return myNbV; }
+
+  //! Projects the point on the surface.
+  //! @param[in] thePoint  point to project
+  //! @param[out] theResult  nearest point on the surface with its parameters
+  //! @param[out] theSquareDistance  square distance to the nearest point
+  //! @return FALSE if the projector is not initialized
+  Standard_EXPORT Standard_Boolean Perform(const gp_Pnt&    thePoint,
+                                           Extrema_POnSurf& theResult,
+                                           Standard_Real&   theSquareDistance);
+
+  //! Projects the array of points on the surface.
+  //! Each thread evaluates its own shallow copy of the surface, so that the surface
+  //! adaptor is not shared between the threads.
+  //! @param[in] thePoints  points to project
+  //! @param[out] theResults  nearest points on the surface, of the same size as thePoints
+  //! @param[out] theSquareDistances  square distances, of the same size as thePoints
+  //! @param[in] theToRunParallel  flag to project points in parallel threads
+  //! @return FALSE if the projector is not initialized
+  //! Raises Standard_DimensionError if the output arrays have wrong size.
+  Standard_EXPORT Standard_Boolean Perform(
+    const TColgp_Array1OfPnt&            thePoints,
+    NCollection_Array1<Extrema_POnSurf>& theResults,
+    TColStd_Array1OfReal&                theSquareDistances,
+    const Standard_Boolean               theToRunParallel = Standard_True);
+
+private:
+  //! Set of samples; element is the index of the sample in mySamples.
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> SampleSet;
+
+  //! Functor projecting the range of points in parallel threads.
+  class ProjectionFunctor;
+
+  //! Projects the point on the given copy of the surface.
+  void project(const Adaptor3d_Surface& theSurface,
+               const gp_Pnt&            thePoint,
+               Extrema_POnSurf&         theResult,
+               Standard_Real&           theSquareDistance) const;
+
+  //! Returns the index of the grid neighbour of the sample nearest to the point;
+  //! neighbours are taken across the seam of periodic surface, and the whole next row
+  //! is considered for the sample on degenerated boundary.
+  Standard_Integer nearestNeighbour(const Standard_Integer theSample, const gp_Pnt& thePoint) const;
+
+  //! Returns TRUE if the parameters lie on the boundary of the surface.
+  Standard_Boolean isOnBoundary(const Extrema_POnSurf& thePoint) const;
+
+private:
+  Handle(Adaptor3d_Surface)           mySurface;
+  NCollection_Array1<Extrema_POnSurf> mySamples;
+  opencascade::handle<SampleSet>      mySampleSet;
+  Standard_Integer                    myNbU;
+  Standard_Integer                    myNbV;
+  Standard_Real                       myTolU;
+  Standard_Real                       myTolV;
+  Standard_Real                       myUMin;
+  Standard_Real                       myUMax;
+  Standard_Real                       myVMin;
+  Standard_Real                       myVMax;
+  Standard_Boolean                    myIsUClosed;
+  Standard_Boolean                    myIsVClosed;
+  Standard_Boolean                    myIsDegenerated[4]; //!< flags of UMin, UMax, VMin, VMax
+};
+
+#endif // _Extrema_SurfaceProjector_HeaderFile
@@ -156,4 +156,6 @@ set(OCCT_Extrema_FILES
   Extrema_SequenceOfPOnCurv.hxx
   Extrema_SequenceOfPOnCurv2d.hxx
   Extrema_SequenceOfPOnSurf.hxx
+  Extrema_SurfaceProjector.cxx
+  Extrema_SurfaceProjector.hxx
 )
@@ -0,0 +1,165 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Extrema_SurfaceProjector.hxx>
+
+#include <Extrema_ExtPS.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_Plane.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_SphericalSurface.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <gp_Ax3.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace
+{
+//! Creates the wavy B-spline surface of degree 3 x 3 with several knot spans.
+Handle(Geom_BSplineSurface) createWavySurface()
+{
+  const Standard_Integer aNbPoles = 8;
+  TColgp_Array2OfPnt     aPoles(1, aNbPoles, 1, aNbPoles);
+  for (Standard_Integer aUIter = 1; aUIter <= aNbPoles; ++aUIter)
+  {
+    for (Standard_Integer aVIter = 1; aVIter <= aNbPoles; ++aVIter)
+    {
+      const Standard_Real aZ = ((aUIter + aVIter) % 3 - 1) * 2.0;
+      aPoles(aUIter, aVIter) = gp_Pnt(aUIter * 2.0, aVIter * 2.0, aZ);
+    }
+  }
+
+  TColStd_Array1OfReal    aKnots(1, 6);
+  TColStd_Array1OfInteger aMults(1, 6);
+  for (Standard_Integer anIndex = 1; anIndex <= 6; ++anIndex)
+  {
+    aKnots(anIndex) = anIndex - 1;
+    aMults(anIndex) = anIndex == 1 || anIndex == 6 ? 4 : 1;
+  }
+  return new Geom_BSplineSurface(aPoles, aKnots, aKnots, aMults, aMults, 3, 3);
+}
+
+//! Generates random points within the box.
+void generatePoints(const gp_Pnt& theMin, const gp_Pnt& theMax, TColgp_Array1OfPnt& thePoints)
+{
+  std::mt19937                           aGen(42);
+  std::uniform_real_distribution<double> aDist(0.0, 1.0);
+  for (Standard_Integer anIndex = thePoints.Lower(); anIndex <= thePoints.Upper(); ++anIndex)
+  {
+    thePoints(anIndex) = gp_Pnt(theMin.X() + aDist(aGen) * (theMax.X() - theMin.X()),
+                                theMin.Y() + aDist(aGen) * (theMax.Y() - theMin.Y()),
+                                theMin.Z() + aDist(aGen) * (theMax.Z() - theMin.Z()));
+  }
+}
+} // namespace
+
+TEST(Extrema_SurfaceProjectorTest, SphereDistance)
+{
+  const Standard_Real           aRadius = 5.0;
+  Handle(Geom_SphericalSurface) aSphere = new Geom_SphericalSurface(gp_Ax3(), aRadius);
+  Extrema_SurfaceProjector      aProjector(new GeomAdaptor_Surface(aSphere));
+  ASSERT_TRUE(aProjector.IsInitialized());
+
+  TColgp_Array1OfPnt aPoints(1, 200);
+  generatePoints(gp_Pnt(-10.0, -10.0, -10.0), gp_Pnt(10.0, 10.0, 10.0), aPoints);
+  for (Standard_Integer anIndex = aPoints.Lower(); anIndex <= aPoints.Upper(); ++anIndex)
+  {
+    const gp_Pnt&   aPnt = aPoints(anIndex);
+    Extrema_POnSurf aResult;
+    Standard_Real   aSqDist = 0.0;
+    ASSERT_TRUE(aProjector.Perform(aPnt, aResult, aSqDist));
+
+    const Standard_Real anExpected = Abs(aPnt.Distance(gp::Origin()) - aRadius);
+    EXPECT_NEAR(anExpected, Sqrt(aSqDist), 1.0e-7);
+    EXPECT_NEAR(aSqDist, aPnt.SquareDistance(aResult.Value()), 1.0e-7);
+  }
+}
+
+TEST(Extrema_SurfaceProjectorTest, BSplineMatchesExtPS)
+{
+  Handle(GeomAdaptor_Surface) anAdaptor = new GeomAdaptor_Surface(createWavySurface());
+  Extrema_SurfaceProjector    aProjector(anAdaptor);
+  ASSERT_TRUE(aProjector.IsInitialized());
+  EXPECT_GE(aProjector.NbSamplesU(), 32);
+
+  TColgp_Array1OfPnt aPoints(1, 100);
+  generatePoints(gp_Pnt(3.0, 3.0, -3.0), gp_Pnt(15.0, 15.0, 3.0), aPoints);
+  Extrema_ExtPS anExtPS;
+  anExtPS.Initialize(*anAdaptor,
+                     anAdaptor->FirstUParameter(),
+                     anAdaptor->LastUParameter(),
+                     anAdaptor->FirstVParameter(),
+                     anAdaptor->LastVParameter(),
+                     Precision::PConfusion(),
+                     Precision::PConfusion());
+  for (Standard_Integer anIndex = aPoints.Lower(); anIndex <= aPoints.Upper(); ++anIndex)
+  {
+    anExtPS.Perform(aPoints(anIndex));
+    ASSERT_TRUE(anExtPS.IsDone());
+    Standard_Real aMinSqDist = RealLast();
+    for (Standard_Integer anExtIter = 1; anExtIter <= anExtPS.NbExt(); ++anExtIter)
+    {
+      aMinSqDist = Min(aMinSqDist, anExtPS.SquareDistance(anExtIter));
+    }
+
+    Extrema_POnSurf aResult;
+    Standard_Real   aSqDist = 0.0;
+    ASSERT_TRUE(aProjector.Perform(aPoints(anIndex), aResult, aSqDist));
+    EXPECT_LE(Sqrt(aSqDist), Sqrt(aMinSqDist) + 1.0e-7);
+  }
+}
+
+TEST(Extrema_SurfaceProjectorTest, MinimumOnBoundary)
+{
+  Handle(Geom_RectangularTrimmedSurface) aPlane =
+    new Geom_RectangularTrimmedSurface(new Geom_Plane(gp_Ax3()), 0.0, 1.0, 0.0, 1.0);
+  Extrema_SurfaceProjector aProjector(new GeomAdaptor_Surface(aPlane), 5, 5);
+  EXPECT_EQ(5, aProjector.NbSamplesU());
+  EXPECT_EQ(5, aProjector.NbSamplesV());
+
+  // nearest point is on the edge between samples
+  Extrema_POnSurf aResult;
+  Standard_Real   aSqDist = 0.0;
+  ASSERT_TRUE(aProjector.Perform(gp_Pnt(2.0, 0.4, 1.0), aResult, aSqDist));
+  EXPECT_NEAR(2.0, aSqDist, 1.0e-7);
+
+  // nearest point is in the corner
+  ASSERT_TRUE(aProjector.Perform(gp_Pnt(-1.0, -1.0, 0.0), aResult, aSqDist));
+  EXPECT_NEAR(2.0, aSqDist, 1.0e-7);
+  EXPECT_NEAR(0.0, aResult.Value().Distance(gp::Origin()), 1.0e-7);
+}
+
+TEST(Extrema_SurfaceProjectorTest, ParallelMatchesSequential)
+{
+  Extrema_SurfaceProjector aProjector(new GeomAdaptor_Surface(createWavySurface()));
+
+  TColgp_Array1OfPnt aPoints(0, 2999);
+  generatePoints(gp_Pnt(0.0, 0.0, -5.0), gp_Pnt(18.0, 18.0, 5.0), aPoints);
+  NCollection_Array1<Extrema_POnSurf> aResults(1, 3000), aResultsPar(1, 3000);
+  TColStd_Array1OfReal                aSqDists(1, 3000), aSqDistsPar(1, 3000);
+  ASSERT_TRUE(aProjector.Perform(aPoints, aResults, aSqDists, Standard_False));
+  ASSERT_TRUE(aProjector.Perform(aPoints, aResultsPar, aSqDistsPar, Standard_True));
+  for (Standard_Integer anIndex = 1; anIndex <= 3000; ++anIndex)
+  {
+    EXPECT_EQ(aSqDists(anIndex), aSqDistsPar(anIndex));
+    EXPECT_EQ(0.0, aResults(anIndex).Value().Distance(aResultsPar(anIndex).Value()));
+  }
+
+  TColStd_Array1OfReal aWrongSize(1, 10);
+  EXPECT_THROW(aProjector.Perform(aPoints, aResults, aWrongSize), Standard_DimensionError);
+}
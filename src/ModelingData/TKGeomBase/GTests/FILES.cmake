@@ -2,5 +2,6 @@
 set(OCCT_TKGeomBase_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKGeomBase_GTests_FILES
+  Extrema_SurfaceProjector_Test.cxx
   IntAna_IntQuadQuad_Test.cxx
 )
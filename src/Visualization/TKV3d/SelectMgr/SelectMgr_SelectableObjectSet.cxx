@@ -232,11 +232,16 @@ private:
 };
 
 static const Graphic3d_Mat4d SelectMgr_SelectableObjectSet_THE_IDENTITY_MAT;
+
+//! Maximum ratio of SAH of the refitted BVH tree to the one of the built tree.
+static const Standard_Real SelectMgr_SelectableObjectSet_THE_REFIT_SAH_RATIO = 2.0;
 } // namespace
 
 //=================================================================================================
 
 SelectMgr_SelectableObjectSet::SelectMgr_SelectableObjectSet()
+    : myIsMoved(Standard_False),
+      myBuiltSAH(0.0)
 {
   myBVH[BVHSubset_ortho2dPersistent] = new BVH_Tree<Standard_Real, 3>();
   myBVH[BVHSubset_ortho3dPersistent] = new BVH_Tree<Standard_Real, 3>();
@@ -358,16 +363,30 @@ void SelectMgr_SelectableObjectSet::UpdateBVH(const Handle(Graphic3d_Camera)& th
   // -----------------------------------------
   // check and update 3D BVH tree if necessary
   // -----------------------------------------
-  if (!IsEmpty(BVHSubset_3d) && myIsDirty[BVHSubset_3d])
+  if (!IsEmpty(BVHSubset_3d) && (myIsDirty[BVHSubset_3d] || myIsMoved))
   {
     // construct adaptor over private fields to provide direct access for the BVH builder
     BVHBuilderAdaptorRegular anAdaptor(myObjects[BVHSubset_3d]);
 
-    // update corresponding BVH tree data structure
-    myBuilder[BVHSubset_3d]->Build(&anAdaptor, myBVH[BVHSubset_3d].get(), anAdaptor.Box());
+    // when only the objects are moved, keep the topology of the tree
+    // until its quality degrades too much in comparison with the built one
+    if (!myIsDirty[BVHSubset_3d] && myBVH[BVHSubset_3d]->Length() != 0)
+    {
+      const Standard_Real aSAH = myBVH[BVHSubset_3d]->Refit(anAdaptor);
+      myIsDirty[BVHSubset_3d] =
+        aSAH > myBuiltSAH * SelectMgr_SelectableObjectSet_THE_REFIT_SAH_RATIO;
+    }
+
+    if (myIsDirty[BVHSubset_3d])
+    {
+      // update corresponding BVH tree data structure
+      myBuilder[BVHSubset_3d]->Build(&anAdaptor, myBVH[BVHSubset_3d].get(), anAdaptor.Box());
+      myBuiltSAH = myBVH[BVHSubset_3d]->EstimateSAH();
+    }
 
     // release dirty state
     myIsDirty[BVHSubset_3d] = Standard_False;
+    myIsMoved               = Standard_False;
   }
 
   if (!theCam.IsNull())
@@ -494,6 +513,17 @@ void SelectMgr_SelectableObjectSet::MarkDirty()
 
 //=================================================================================================
 
+void SelectMgr_SelectableObjectSet::MarkMoved()
+{
+  myIsMoved                              = Standard_True;
+  myIsDirty[BVHSubset_3dPersistent]      = Standard_True;
+  myIsDirty[BVHSubset_2dPersistent]      = Standard_True;
+  myIsDirty[BVHSubset_ortho3dPersistent] = Standard_True;
+  myIsDirty[BVHSubset_ortho2dPersistent] = Standard_True;
+}
+
+//=================================================================================================
+
 void SelectMgr_SelectableObjectSet::DumpJson(Standard_OStream& theOStream, Standard_Integer) const
 {
   for (Standard_Integer aSubsetIdx = 0; aSubsetIdx < BVHSubsetNb; ++aSubsetIdx)
@@ -151,6 +151,11 @@ public:
   //! Marks every BVH subset for update.
   Standard_EXPORT void MarkDirty();
 
+  //! Marks every BVH subset for update due to the movement of objects only (the set of objects
+  //! remains the same). The BVH tree of 3D objects is refitted instead of rebuilding until its
+  //! quality degrades too much, while the trees of persistent objects are rebuilt.
+  Standard_EXPORT void MarkMoved();
+
   //! Returns true if this objects set contains theObject given.
   Standard_Boolean Contains(const Handle(SelectMgr_SelectableObject)& theObject) const
   {
@@ -248,6 +253,8 @@ private:
   opencascade::handle<BVH_Tree<Standard_Real, 3> >           myBVH[BVHSubsetNb];     //!< BVH tree computed for each subset
   Handle(Select3D_BVHBuilder3d)                              myBuilder[BVHSubsetNb]; //!< Builder allocated for each subset
   Standard_Boolean                                           myIsDirty[BVHSubsetNb]; //!< Dirty flag for each subset
+  Standard_Boolean                                           myIsMoved;              //!< Flag of moved objects of 3D subset
+  Standard_Real                                              myBuiltSAH;             //!< SAH of the last built BVH tree of 3D subset
   Graphic3d_WorldViewProjState                               myLastViewState;        //!< Last view-projection state used for construction of BVH
   Graphic3d_Vec2i                                            myLastWinSize;          //!< Last viewport's (window's) width used for construction of BVH
   // clang-format on
@@ -142,12 +142,13 @@ void SelectMgr_SelectionManager::Activate(const Handle(SelectMgr_SelectableObjec
         mySelector->RemoveSelectionOfObject(theObject, aSelection);
       }
       theObject->RecomputePrimitives(theMode);
+      mySelector->RebuildObjectsTree();
       // pass through SelectMgr_TOU_Partial
     }
       Standard_FALLTHROUGH
     case SelectMgr_TOU_Partial: {
       theObject->UpdateTransformations(aSelection);
-      mySelector->RebuildObjectsTree();
+      mySelector->RefitObjectsTree();
       break;
     }
     default:
@@ -462,12 +463,13 @@ void SelectMgr_SelectionManager::Update(const Handle(SelectMgr_SelectableObject)
           ClearSelectionStructures(theObject, aSelection->Mode());
           theObject->RecomputePrimitives(aSelection->Mode()); // no break on purpose...
           RestoreSelectionStructures(theObject, aSelection->Mode());
+          mySelector->RebuildObjectsTree();
           // pass through SelectMgr_TOU_Partial
         }
           Standard_FALLTHROUGH
         case SelectMgr_TOU_Partial: {
           theObject->UpdateTransformations(aSelection);
-          mySelector->RebuildObjectsTree();
+          mySelector->RefitObjectsTree();
           break;
         }
         default:
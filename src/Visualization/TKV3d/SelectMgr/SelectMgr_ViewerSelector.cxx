@@ -1133,6 +1133,22 @@ void SelectMgr_ViewerSelector::RebuildObjectsTree(const Standard_Boolean theIsFo
   }
 }
 
+//=======================================================================
+// function : RefitObjectsTree
+// purpose  : Marks BVH of selectable objects for refit
+//=======================================================================
+void SelectMgr_ViewerSelector::RefitObjectsTree(const Standard_Boolean theIsForce)
+{
+  mySelectableObjects.MarkMoved();
+
+  if (theIsForce)
+  {
+    Graphic3d_Vec2i aWinSize;
+    mySelectingVolumeMgr.WindowSize(aWinSize.x(), aWinSize.y());
+    mySelectableObjects.UpdateBVH(mySelectingVolumeMgr.Camera(), aWinSize);
+  }
+}
+
 //=======================================================================
 // function : RebuildSensitivesTree
 // purpose  : Marks BVH of sensitive entities of particular selectable
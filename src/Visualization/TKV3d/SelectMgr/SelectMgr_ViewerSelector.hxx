@@ -243,6 +243,11 @@ public:
   //! guarantees that 1st level BVH for the viewer selector will be rebuilt during this call
   Standard_EXPORT void RebuildObjectsTree(const Standard_Boolean theIsForce = Standard_False);
 
+  //! Marks BVH of selectable objects for refit after the change of their transformations,
+  //! which is much cheaper than rebuilding. Parameter theIsForce set as true
+  //! guarantees that 1st level BVH for the viewer selector will be updated during this call
+  Standard_EXPORT void RefitObjectsTree(const Standard_Boolean theIsForce = Standard_False);
+
   //! Marks BVH of sensitive entities of particular selectable object for rebuild. Parameter
   //! theIsForce set as true guarantees that 2nd level BVH for the object given will be
   //! rebuilt during this call